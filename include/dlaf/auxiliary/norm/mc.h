@@ -19,6 +19,7 @@
 #include <dlaf/communication/sync/reduce.h>
 #include <dlaf/lapack/tile.h>
 #include <dlaf/matrix/distribution.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/types.h>
 #include <dlaf/util_matrix.h>
@@ -48,6 +49,10 @@ pika::execution::experimental::unique_any_sender<T> reduce_in_place(
                     void* out = is_root_rank ? &local : nullptr;
                     DLAF_MPI_CHECK_ERROR(MPI_Ireduce(in, out, 1, dlaf::comm::mpi_datatype<T>::type,
                                                      reduce_op, rank, comm, req));
+                    if (is_root_rank)
+                      dlaf::comm::internal::addBytesReceived(comm, dlaf::comm::mpi_datatype<T>::type, 1);
+                    else
+                      dlaf::comm::internal::addBytesSent(comm, dlaf::comm::mpi_datatype<T>::type, 1);
                   }) |
                   ex::then([&local]() -> T { return local; });
          });
@@ -21,6 +21,7 @@
 #include <dlaf/common/single_threaded_blas.h>
 #include <dlaf/matrix/copy_tile.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/make_sender_algorithm_overloads.h>
 #include <dlaf/sender/policy.h>
 #include <dlaf/sender/transform.h>
@@ -176,6 +177,7 @@ template <class T>
 void gemm(const blas::Op op_a, const blas::Op op_b, const T alpha, const Tile<const T, Device::CPU>& a,
           const Tile<const T, Device::CPU>& b, const T beta, const Tile<T, Device::CPU>& c) noexcept {
   auto s = tile::internal::getGemmSizes(op_a, op_b, a, b, c);
+  dlaf::internal::addFlops(gemmFlops<T>(s));
   common::internal::SingleThreadedBlasScope single;
   blas::gemm(blas::Layout::ColMajor, op_a, op_b, s.m, s.n, s.k, alpha, a.ptr(), a.ld(), b.ptr(), b.ld(),
              beta, c.ptr(), c.ld());
@@ -186,6 +188,7 @@ void hemm(const blas::Side side, const blas::Uplo uplo, const T alpha,
           const Tile<const T, Device::CPU>& a, const Tile<const T, Device::CPU>& b, const T beta,
           const Tile<T, Device::CPU>& c) {
   auto s = tile::internal::getHemmSizes(side, a, b, c);
+  dlaf::internal::addFlops(hemmFlops<T>(side, s));
   common::internal::SingleThreadedBlasScope single;
   blas::hemm(blas::Layout::ColMajor, side, uplo, s.m, s.n, alpha, a.ptr(), a.ld(), b.ptr(), b.ld(), beta,
              c.ptr(), c.ld());
@@ -196,6 +199,7 @@ void her2k(const blas::Uplo uplo, const blas::Op op, const T alpha, const Tile<c
            const Tile<const T, Device::CPU>& b, const BaseType<T> beta,
            const Tile<T, Device::CPU>& c) noexcept {
   auto s = tile::internal::getHer2kSizes(op, a, b, c);
+  dlaf::internal::addFlops(her2kFlops<T>(s));
   common::internal::SingleThreadedBlasScope single;
   blas::her2k(blas::Layout::ColMajor, uplo, op, s.n, s.k, alpha, a.ptr(), a.ld(), b.ptr(), b.ld(), beta,
               c.ptr(), c.ld());
@@ -206,6 +210,7 @@ void herk(const blas::Uplo uplo, const blas::Op op, const BaseType<T> alpha,
           const Tile<const T, Device::CPU>& a, const BaseType<T> beta,
           const Tile<T, Device::CPU>& c) noexcept {
   auto s = tile::internal::getHerkSizes(op, a, c);
+  dlaf::internal::addFlops(herkFlops<T>(s));
   common::internal::SingleThreadedBlasScope single;
   blas::herk(blas::Layout::ColMajor, uplo, op, s.n, s.k, alpha, a.ptr(), a.ld(), beta, c.ptr(), c.ld());
 }
@@ -215,6 +220,7 @@ template <class T>
 void trmm(const blas::Side side, const blas::Uplo uplo, const blas::Op op, const blas::Diag diag,
           const T alpha, const Tile<const T, Device::CPU>& a, const Tile<T, Device::CPU>& b) noexcept {
   auto s = tile::internal::getTrmmSizes(side, a, b);
+  dlaf::internal::addFlops(trmmFlops<T>(side, s.m, s.n));
   common::internal::SingleThreadedBlasScope single;
   blas::trmm(blas::Layout::ColMajor, side, uplo, op, diag, s.m, s.n, alpha, a.ptr(), a.ld(), b.ptr(),
              b.ld());
@@ -228,6 +234,7 @@ void trmm3(const blas::Side side, const blas::Uplo uplo, const blas::Op op, cons
            const Tile<T, Device::CPU>& c) noexcept {
   auto s = tile::internal::getTrmm3Sizes(side, a, b, c);
   DLAF_ASSERT(b.ptr() == nullptr || b.ptr() != c.ptr(), b.ptr(), c.ptr());
+  dlaf::internal::addFlops(trmmFlops<T>(side, s.m, s.n));
 
   matrix::internal::copy(b, c);
   common::internal::SingleThreadedBlasScope single;
@@ -239,6 +246,7 @@ template <class T>
 void trsm(const blas::Side side, const blas::Uplo uplo, const blas::Op op, const blas::Diag diag,
           const T alpha, const Tile<const T, Device::CPU>& a, const Tile<T, Device::CPU>& b) noexcept {
   auto s = tile::internal::getTrsmSizes(side, a, b);
+  dlaf::internal::addFlops(trmmFlops<T>(side, s.m, s.n));
   common::internal::SingleThreadedBlasScope single;
   blas::trsm(blas::Layout::ColMajor, side, uplo, op, diag, s.m, s.n, alpha, a.ptr(), a.ld(), b.ptr(),
              b.ld());
@@ -253,6 +261,7 @@ void gemm(cublasHandle_t handle, const blas::Op op_a, const blas::Op op_b, const
   using util::blasToCublas;
   using util::blasToCublasCast;
   auto s = getGemmSizes(op_a, op_b, a, b, c);
+  dlaf::internal::addFlops(gemmFlops<T>(s));
   gpublas::internal::Gemm<T>::call(handle, blasToCublas(op_a), blasToCublas(op_b), to_int(s.m),
                                    to_int(s.n), to_int(s.k), blasToCublasCast(&alpha),
                                    blasToCublasCast(a.ptr()), to_int(a.ld()), blasToCublasCast(b.ptr()),
@@ -267,6 +276,7 @@ void hemm(cublasHandle_t handle, const blas::Side side, const blas::Uplo uplo, c
   using util::blasToCublas;
   using util::blasToCublasCast;
   auto s = getHemmSizes(side, a, b, c);
+  dlaf::internal::addFlops(hemmFlops<T>(side, s));
   gpublas::internal::Hemm<T>::call(handle, blasToCublas(side), blasToCublas(uplo), to_int(s.m),
                                    to_int(s.n), blasToCublasCast(&alpha), blasToCublasCast(a.ptr()),
                                    to_int(a.ld()), blasToCublasCast(b.ptr()), to_int(b.ld()),
@@ -280,6 +290,7 @@ void her2k(cublasHandle_t handle, const blas::Uplo uplo, blas::Op op, const T al
   using util::blasToCublas;
   using util::blasToCublasCast;
   auto s = getHer2kSizes(op, a, b, c);
+  dlaf::internal::addFlops(her2kFlops<T>(s));
 #if defined(DLAF_WITH_HIP) && HIP_VERSION < 50200000
   if (!isComplex_v<T> && op == blas::Op::ConjTrans)
     op = blas::Op::Trans;
@@ -297,6 +308,7 @@ void herk(cublasHandle_t handle, const blas::Uplo uplo, const blas::Op op, const
   using util::blasToCublas;
   using util::blasToCublasCast;
   auto s = getHerkSizes(op, a, c);
+  dlaf::internal::addFlops(herkFlops<T>(s));
   gpublas::internal::Herk<T>::call(handle, blasToCublas(uplo), blasToCublas(op), to_int(s.n),
                                    to_int(s.k), blasToCublasCast(&alpha), blasToCublasCast(a.ptr()),
                                    to_int(a.ld()), blasToCublasCast(&beta), blasToCublasCast(c.ptr()),
@@ -310,6 +322,7 @@ void trmm(cublasHandle_t handle, const blas::Side side, const blas::Uplo uplo, c
   using util::blasToCublas;
   using util::blasToCublasCast;
   auto s = tile::internal::getTrmmSizes(side, a, b);
+  dlaf::internal::addFlops(trmmFlops<T>(side, s.m, s.n));
 
   gpublas::internal::Trmm<T>::call(handle, blasToCublas(side), blasToCublas(uplo), blasToCublas(op),
                                    blasToCublas(diag), to_int(s.m), to_int(s.n),
@@ -326,6 +339,7 @@ void trmm3(cublasHandle_t handle, const blas::Side side, const blas::Uplo uplo,
   using util::blasToCublasCast;
   auto s = tile::internal::getTrmm3Sizes(side, a, b, c);
   DLAF_ASSERT(b.ptr() == nullptr || b.ptr() != c.ptr(), b.ptr(), c.ptr());
+  dlaf::internal::addFlops(trmmFlops<T>(side, s.m, s.n));
 
   gpublas::internal::Trmm<T>::call(handle, blasToCublas(side), blasToCublas(uplo), blasToCublas(op),
                                    blasToCublas(diag), to_int(s.m), to_int(s.n),
@@ -341,6 +355,7 @@ void trsm(cublasHandle_t handle, const blas::Side side, const blas::Uplo uplo, c
   using util::blasToCublas;
   using util::blasToCublasCast;
   auto s = getTrsmSizes(side, a, b);
+  dlaf::internal::addFlops(trmmFlops<T>(side, s.m, s.n));
   auto a_ptr = blasToCublasCast(a.ptr());
   gpublas::internal::Trsm<T>::call(handle, blasToCublas(side), blasToCublas(uplo), blasToCublas(op),
                                    blasToCublas(diag), to_int(s.m), to_int(s.n),
@@ -0,0 +1,200 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+/// @file
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include <dlaf/types.h>
+
+namespace dlaf::common::internal {
+
+// Opt-in recorder of the tasks executed by DLA-Future, exported as a timeline in the Chrome trace
+// event format (which can be opened with Perfetto or chrome://tracing).
+//
+// The recorder is available only if DLA-Future is built with DLAF_WITH_TRACE, otherwise transform and
+// transformMPI do not wrap the callables and do not add any stage to the senders.
+// When tracing is enabled (see configuration::trace_file), each function run by transform and each MPI
+// call issued by transformMPI is recorded with its name (the type of the callable), the rank, the
+// worker thread and the index of the tile set by the algorithm with TraceTileScope (if any).
+// The name, rank and thread are recorded for all the algorithms, while the tile index is not: the
+// sender layer only sees the tiles, not their position in the matrix, therefore the index is known
+// only where the algorithm sets it explicitly. Currently only the Cholesky factorization does it, the
+// events of the other algorithms have no tile index.
+// Kernels span their execution (on GPU only the submission to the stream is recorded), while MPI
+// operations span from the posting of the request to its completion.
+// Events are stored in per-thread buffers without synchronization, and exported by exportTrace. Each
+// buffer holds at most a given number of events, further events of the thread are dropped and counted.
+
+using TraceClock = std::chrono::steady_clock;
+
+// Index of the tile an event refers to (row and col are negative if not known).
+struct TraceTileIndex {
+  SizeType row = -1;
+  SizeType col = -1;
+};
+
+struct TraceEvent {
+  const std::type_info* name;
+  const char* category;
+  TraceClock::time_point begin;
+  TraceClock::time_point end;
+  TraceTileIndex tile;
+};
+
+// Returns true if events have to be recorded.
+bool traceEnabled() noexcept;
+
+// Starts recording events (timestamps are relative to the time of this call), storing at most
+// @p max_events_per_thread events for each thread.
+void enableTrace(std::size_t max_events_per_thread);
+
+// Stops recording events and discards the ones not exported yet.
+void disableTrace();
+
+// Records @p event in the buffer of the calling thread.
+void recordTraceEvent(const TraceEvent& event);
+
+// Writes all the events recorded so far in @p filename with the Chrome trace event format, using
+// @p rank as process id, and discards them. The number of dropped events (if any) is reported in the
+// metadata of the process.
+//
+// Note: it has to be called when no task is running.
+void exportTrace(const std::string& filename, int rank);
+
+// Returns the tile index set by the innermost TraceTileScope of the calling thread.
+TraceTileIndex currentTraceTile() noexcept;
+
+// Sets the tile index of the events of the tasks created by the calling thread (i.e. of the
+// callables wrapped by transform and transformMPI) during the lifetime of the object.
+//
+// Note: the scope must not span any suspension point of the calling task, as the index is stored in
+// a thread_local variable.
+// Note: it is used only by the Cholesky factorization, the events of the other algorithms are
+// exported without tile index.
+class TraceTileScope {
+public:
+  TraceTileScope(SizeType row, SizeType col) noexcept;
+
+  template <class Index2D>
+  explicit TraceTileScope(const Index2D& index) noexcept : TraceTileScope(index.row(), index.col()) {}
+
+  TraceTileScope(const TraceTileScope&) = delete;
+  TraceTileScope(TraceTileScope&&) = delete;
+  TraceTileScope& operator=(const TraceTileScope&) = delete;
+  TraceTileScope& operator=(TraceTileScope&&) = delete;
+
+  ~TraceTileScope();
+
+private:
+  TraceTileIndex previous_;
+};
+
+// Records the lifetime of the object as an event (if tracing is enabled at construction).
+class TraceScope {
+public:
+  TraceScope(const std::type_info& name, const char* category, const TraceTileIndex& tile) noexcept
+      : enabled_(traceEnabled()), name_(&name), category_(category), tile_(tile) {
+    if (enabled_)
+      begin_ = TraceClock::now();
+  }
+
+  TraceScope(const TraceScope&) = delete;
+  TraceScope(TraceScope&&) = delete;
+  TraceScope& operator=(const TraceScope&) = delete;
+  TraceScope& operator=(TraceScope&&) = delete;
+
+  ~TraceScope() {
+    if (enabled_)
+      recordTraceEvent({name_, category_, begin_, TraceClock::now(), tile_});
+  }
+
+private:
+  bool enabled_;
+  const std::type_info* name_;
+  const char* category_;
+  TraceTileIndex tile_;
+  TraceClock::time_point begin_;
+};
+
+/// Wrapper of a callable which records each call as an event of @p category.
+///
+/// The tile index of the event is the one set by TraceTileScope when the wrapper is created.
+template <typename F>
+struct Traced {
+  std::decay_t<F> f;
+  const char* category;
+  TraceTileIndex tile = currentTraceTile();
+
+  template <typename... Ts>
+  auto operator()(Ts&&... ts) -> decltype(std::move(f)(std::forward<Ts>(ts)...)) {
+    TraceScope scope(typeid(std::decay_t<F>), category, tile);
+    return std::move(f)(std::forward<Ts>(ts)...);
+  }
+};
+
+template <typename F>
+Traced(F&&, const char*) -> Traced<std::decay_t<F>>;
+
+/// Returns @p f wrapped in Traced if DLA-Future is built with DLAF_WITH_TRACE, @p f otherwise.
+template <typename F>
+auto traced(F&& f, [[maybe_unused]] const char* category) {
+#ifdef DLAF_WITH_TRACE
+  return Traced{std::forward<F>(f), category};
+#else
+  return std::forward<F>(f);
+#endif
+}
+
+/// Wrapper of a callable starting an asynchronous operation, which stores the time of the call in
+/// @p begin (if not null). The operation is recorded once completed by TracedCompletion.
+template <typename F>
+struct TracedStart {
+  std::decay_t<F> f;
+  std::shared_ptr<TraceClock::time_point> begin;
+
+  template <typename... Ts>
+  auto operator()(Ts&&... ts) -> decltype(std::move(f)(std::forward<Ts>(ts)...)) {
+    if (begin)
+      *begin = TraceClock::now();
+    return std::move(f)(std::forward<Ts>(ts)...);
+  }
+};
+
+template <typename F>
+TracedStart(F&&, std::shared_ptr<TraceClock::time_point>) -> TracedStart<std::decay_t<F>>;
+
+/// Continuation recording the asynchronous operation started by TracedStart (if @p begin is not null),
+/// which forwards the value sent by the operation (if any).
+///
+/// The tile index of the event is the one set by TraceTileScope when the continuation is created.
+struct TracedCompletion {
+  const std::type_info* name;
+  const char* category;
+  std::shared_ptr<TraceClock::time_point> begin;
+  TraceTileIndex tile = currentTraceTile();
+
+  template <typename... Ts>
+  auto operator()(Ts&&... ts) {
+    static_assert(sizeof...(Ts) <= 1, "Only operations sending at most one value can be traced.");
+    if (begin)
+      recordTraceEvent({name, category, *begin, TraceClock::now(), tile});
+    if constexpr (sizeof...(Ts) == 1)
+      return (std::forward<Ts>(ts), ...);
+  }
+};
+}
@@ -12,23 +12,165 @@
 
 /// @file
 
+#include <functional>
 #include <type_traits>
 #include <utility>
+#include <vector>
+
+#include <lapack.hh>
 
 #include <pika/execution.hpp>
 
 #include <dlaf/common/index2d.h>
+#include <dlaf/common/unwrap.h>
 #include <dlaf/communication/communicator_pipeline.h>
 #include <dlaf/communication/index.h>
 #include <dlaf/communication/kernels/broadcast.h>
+#include <dlaf/communication/kernels/internal/broadcast.h>
+#include <dlaf/communication/kernels/p2p.h>
 #include <dlaf/communication/message.h>
 #include <dlaf/matrix/copy_tile.h>
 #include <dlaf/matrix/panel.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/memory/memory_view.h>
+#include <dlaf/sender/policy.h>
+#include <dlaf/sender/transform.h>
+#include <dlaf/sender/transform_mpi.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
 #include <dlaf/util_matrix.h>
 
 namespace dlaf::comm {
+/// Algorithm used for broadcasting the tiles of a panel.
+enum class BroadcastPanelAlgorithm {
+  /// MPI broadcast of each tile (or of all the local tiles together, see
+  /// TuneParameters::broadcast_panel_aggregate_max_bytes)
+  collective,
+  /// Pipelined ring of point to point communications, where each rank forwards each tile to the next
+  /// one as soon as it has been received.
+  ring,
+};
+
+namespace internal {
+// Returns true if the local tiles of @p panel have to be broadcast with a single collective (see
+// TuneParameters::broadcast_panel_aggregate_max_bytes).
+//
+// Note: the choice depends only on the local tiles along the panel axis, which are the same on all the
+// ranks of the communicator orthogonal to the panel axis.
+template <class T, Coord axis, matrix::StoreTransposed storage>
+bool use_aggregated_broadcast(const matrix::Panel<axis, T, Device::CPU, storage>& panel) {
+  const SizeType max_bytes = getTuneParameters().broadcast_panel_aggregate_max_bytes;
+  const SizeType nr_tiles = panel.rangeEndLocal() - panel.rangeStartLocal();
+  const TileElementSize block_size = panel.parentDistribution().block_size();
+  const SizeType bytes = nr_tiles * block_size.linear_size() * static_cast<SizeType>(sizeof(T));
+
+  return nr_tiles > 1 && bytes <= max_bytes;
+}
+
+// Broadcasts all the local tiles of @p panel with a single collective: on @p rank_root they are packed
+// in a contiguous buffer (i.e. a single column tile) which is unpacked on the other ranks.
+template <class T, Coord axis, matrix::StoreTransposed storage>
+void broadcast_aggregated(comm::IndexT_MPI rank_root,
+                          matrix::Panel<axis, T, Device::CPU, storage>& panel,
+                          comm::CommunicatorPipeline<coord_to_communicator_type(orthogonal(axis))>&
+                              serial_comm) {
+  namespace ex = pika::execution::experimental;
+  using dlaf::internal::Policy;
+  using pika::execution::thread_priority;
+
+  using dlaf::common::internal::unwrap;
+
+  // Note: the buffer is a column tile storing the local tiles one after the other.
+  auto make_buffer = [](const auto& tiles) {
+    SizeType n = 0;
+    for (const auto& tile : tiles)
+      n += unwrap(tile).size().linear_size();
+    return matrix::Tile<T, Device::CPU>({n, 1}, memory::MemoryView<T, Device::CPU>(n), n);
+  };
+
+  const auto rank = panel.parentDistribution().rankIndex().get(axis);
+
+  if (rank == rank_root) {
+    std::vector<matrix::ReadOnlyTileSender<T, Device::CPU>> tiles;
+    for (const auto& index : panel.iteratorLocal())
+      tiles.push_back(panel.read(index));
+
+    auto pack = [make_buffer](const auto& tiles) {
+      auto buffer = make_buffer(tiles);
+      T* ptr = buffer.ptr();
+      for (const auto& tile_wrapper : tiles) {
+        const auto& tile = unwrap(tile_wrapper);
+        lapack::lacpy(blas::Uplo::General, tile.size().rows(), tile.size().cols(), tile.ptr(),
+                      tile.ld(), ptr, tile.size().rows());
+        ptr += tile.size().linear_size();
+      }
+      return buffer;
+    };
+
+    ex::start_detached(ex::when_all_vector(std::move(tiles)) |
+                       dlaf::internal::transform(Policy<Backend::MC>(thread_priority::high),
+                                                 std::move(pack)) |
+                       ex::let_value([pcomm = serial_comm.exclusive()](const auto& buffer) mutable {
+                         return ex::when_all(std::move(pcomm), ex::just(std::cref(buffer))) |
+                                transformMPI(sendBcast_o);
+                       }));
+  }
+  else {
+    std::vector<matrix::ReadWriteTileSender<T, Device::CPU>> tiles;
+    for (const auto& index : panel.iteratorLocal())
+      tiles.push_back(panel.readwrite(index));
+
+    auto unpack = [](const auto& buffer, auto& tiles) {
+      const T* ptr = buffer.ptr();
+      for (auto& tile : tiles) {
+        lapack::lacpy(blas::Uplo::General, tile.size().rows(), tile.size().cols(), ptr,
+                      tile.size().rows(), tile.ptr(), tile.ld());
+        ptr += tile.size().linear_size();
+      }
+    };
+
+    auto recv = [rank_root, make_buffer, unpack, pcomm = serial_comm.exclusive()](auto& tiles) mutable {
+      auto recv_buffer = [rank_root, unpack, &tiles, pcomm = std::move(pcomm)](auto& buffer) mutable {
+        return ex::when_all(std::move(pcomm), ex::just(rank_root, std::cref(buffer))) |
+               transformMPI(recvBcast_o) |
+               dlaf::internal::transform(Policy<Backend::MC>(thread_priority::high),
+                                         [unpack, &buffer, &tiles]() { unpack(buffer, tiles); });
+      };
+      return ex::just(make_buffer(tiles)) | ex::let_value(std::move(recv_buffer));
+    };
+
+    ex::start_detached(ex::when_all_vector(std::move(tiles)) | ex::let_value(std::move(recv)));
+  }
+}
+
+// Broadcasts the local tiles of @p panel along a ring starting from @p rank_root: each rank receives
+// each tile from the previous rank and forwards it to the next one (unless it is @p rank_root).
+//
+// Note: the tiles are received and forwarded one by one, so the tiles which have already been received
+// can be forwarded (and used) while the following ones are still being received.
+// Communications are scheduled in the same order on all the ranks through @p serial_comm, therefore
+// messages of the same pair of ranks are matched in order.
+template <class T, Device D, Coord axis, matrix::StoreTransposed storage>
+void broadcast_ring(comm::IndexT_MPI rank_root, matrix::Panel<axis, T, D, storage>& panel,
+                    comm::CommunicatorPipeline<coord_to_communicator_type(orthogonal(axis))>&
+                        serial_comm) {
+  namespace ex = pika::execution::experimental;
+
+  const auto& dist = panel.parentDistribution();
+  const comm::IndexT_MPI nranks = dist.commGridSize().get(axis);
+  const comm::IndexT_MPI rank = dist.rankIndex().get(axis);
+  const comm::IndexT_MPI rank_prev = (rank + nranks - 1) % nranks;
+  const comm::IndexT_MPI rank_next = (rank + 1) % nranks;
+
+  for (const auto& index : panel.iteratorLocal()) {
+    if (rank != rank_root)
+      ex::start_detached(schedule_recv(serial_comm.exclusive(), rank_prev, 0, panel.readwrite(index)));
+    if (rank_next != rank_root)
+      ex::start_detached(schedule_send(serial_comm.exclusive(), rank_next, 0, panel.read(index)));
+  }
+}
+}
+
 /// Broadcast
 ///
 /// Given a source panel on a rank, it gets broadcasted to make it available to all other ranks.
@@ -39,19 +181,30 @@ namespace dlaf::comm {
 /// @param panel        on @p rank_root it is the source panel
 ///                     on other ranks it is the destination panel
 /// @param serial_comm  where to pipeline the tasks for communications.
+/// @param algorithm    how the tiles are broadcast (the same on all ranks).
 /// @pre Communicator in @p serial_comm must be orthogonal to panel axis
 template <class T, Device D, Coord axis, matrix::StoreTransposed storage,
           std::enable_if_t<!std::is_const_v<T>, int> = 0>
 void broadcast(comm::IndexT_MPI rank_root, matrix::Panel<axis, T, D, storage>& panel,
-               comm::CommunicatorPipeline<coord_to_communicator_type(orthogonal(axis))>& serial_comm) {
+               comm::CommunicatorPipeline<coord_to_communicator_type(orthogonal(axis))>& serial_comm,
+               const BroadcastPanelAlgorithm algorithm = BroadcastPanelAlgorithm::collective) {
   constexpr auto comm_coord = axis;
 
   // do not schedule communication tasks if there is no reason to do so...
   if (panel.parentDistribution().commGridSize().get(comm_coord) <= 1)
     return;
 
+  if (algorithm == BroadcastPanelAlgorithm::ring)
+    return internal::broadcast_ring(rank_root, panel, serial_comm);
+
   const auto rank = panel.parentDistribution().rankIndex().get(comm_coord);
 
+  // Note: the tiles on GPU are always broadcast one by one, as packing them requires device copies.
+  if constexpr (D == Device::CPU) {
+    if (internal::use_aggregated_broadcast(panel))
+      return internal::broadcast_aggregated(rank_root, panel, serial_comm);
+  }
+
   namespace ex = pika::execution::experimental;
   for (const auto& index : panel.iteratorLocal()) {
     if (rank == rank_root)
@@ -100,6 +253,8 @@ auto& get_taskchain(comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row
 /// @param row_task_chain where to pipeline the tasks for row-wise communications
 /// @param col_task_chain where to pipeline the tasks for col-wise communications
 /// @param grid_size shape of the grid of row and col communicators from @p row_task_chain and @p col_task_chain
+/// @param algorithm how the tiles of @p panel are broadcast (the tiles of @p panelT are always broadcast
+/// with MPI broadcasts, as each of them comes from a different rank)
 ///
 /// @pre both panels are child of a matrix (even not the same) with the same Distribution
 /// @pre both panels parent matrices should be square matrices with square tile_sizes
@@ -109,7 +264,8 @@ template <class T, Device D, Coord axis, matrix::StoreTransposed storage,
 void broadcast(comm::IndexT_MPI rank_root, matrix::Panel<axis, T, D, storage>& panel,
                matrix::Panel<orthogonal(axis), T, D, storageT>& panelT,
                comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain,
-               comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain) {
+               comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain,
+               const BroadcastPanelAlgorithm algorithm = BroadcastPanelAlgorithm::collective) {
   constexpr Coord coord = orthogonal(axis);
   constexpr Coord coordT = axis;
 
@@ -156,7 +312,7 @@ void broadcast(comm::IndexT_MPI rank_root, matrix::Panel<axis, T, D, storage>& p
   // STEP 1
   auto& chain_step1 = internal::get_taskchain<coord>(row_task_chain, col_task_chain);
 
-  broadcast(rank_root, panel, chain_step1);
+  broadcast(rank_root, panel, chain_step1, algorithm);
 
   // STEP 2
   auto& chain_step2 = internal::get_taskchain<coordT>(row_task_chain, col_task_chain);
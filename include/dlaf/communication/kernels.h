@@ -16,4 +16,5 @@
 #include <dlaf/communication/kernels/broadcast.h>
 #include <dlaf/communication/kernels/p2p.h>
 #include <dlaf/communication/kernels/p2p_allsum.h>
+#include <dlaf/communication/kernels/persistent.h>
 #include <dlaf/communication/kernels/reduce.h>
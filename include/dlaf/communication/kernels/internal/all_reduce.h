@@ -27,6 +27,7 @@
 #include <dlaf/communication/message.h>
 #include <dlaf/communication/rdma.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/sender/with_temporary_tile.h>
 
@@ -45,6 +46,8 @@ auto allReduce(const Communicator& comm, MPI_Op reduce_op, const matrix::Tile<co
   auto msg_out = comm::make_message(common::make_data(tile_out));
   DLAF_MPI_CHECK_ERROR(MPI_Iallreduce(msg_in.data(), msg_out.data(), msg_in.count(), msg_in.mpi_type(),
                                       reduce_op, comm, req));
+  addBytesSent(comm, msg_in.mpi_type(), msg_in.count());
+  addBytesReceived(comm, msg_in.mpi_type(), msg_in.count());
 }
 
 DLAF_MAKE_CALLABLE_OBJECT(allReduce);
@@ -111,6 +114,8 @@ auto allReduceInPlace(const Communicator& comm, MPI_Op reduce_op, const matrix::
   auto msg = comm::make_message(common::make_data(tile));
   DLAF_MPI_CHECK_ERROR(MPI_Iallreduce(MPI_IN_PLACE, msg.data(), msg.count(), msg.mpi_type(), reduce_op,
                                       comm, req));
+  addBytesSent(comm, msg.mpi_type(), msg.count());
+  addBytesReceived(comm, msg.mpi_type(), msg.count());
 }
 
 DLAF_MAKE_CALLABLE_OBJECT(allReduceInPlace);
@@ -27,6 +27,7 @@
 #include <dlaf/communication/message.h>
 #include <dlaf/communication/rdma.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/traits.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/sender/with_temporary_tile.h>
@@ -41,6 +42,7 @@ void sendBcast(const Communicator& comm, const matrix::Tile<const T, D>& tile, M
   auto msg = comm::make_message(common::make_data(tile));
   DLAF_MPI_CHECK_ERROR(MPI_Ibcast(const_cast<T*>(msg.data()), msg.count(), msg.mpi_type(), comm.rank(),
                                   comm, req));
+  addBytesSent(comm, msg.mpi_type(), msg.count());
 }
 
 DLAF_MAKE_CALLABLE_OBJECT(sendBcast);
@@ -79,6 +81,7 @@ void recvBcast(const Communicator& comm, comm::IndexT_MPI root_rank, const matri
 
   auto msg = comm::make_message(common::make_data(tile));
   DLAF_MPI_CHECK_ERROR(MPI_Ibcast(msg.data(), msg.count(), msg.mpi_type(), root_rank, comm, req));
+  addBytesReceived(comm, msg.mpi_type(), msg.count());
 }
 
 DLAF_MAKE_CALLABLE_OBJECT(recvBcast);
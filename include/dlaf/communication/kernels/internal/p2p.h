@@ -29,6 +29,7 @@
 #include <dlaf/communication/message.h>
 #include <dlaf/communication/rdma.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/traits.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/sender/with_temporary_tile.h>
@@ -44,6 +45,7 @@ void send(const Communicator& comm, IndexT_MPI dest, IndexT_MPI tag,
 
   auto msg = comm::make_message(common::make_data(tile));
   DLAF_MPI_CHECK_ERROR(MPI_Isend(msg.data(), msg.count(), msg.mpi_type(), dest, tag, comm, req));
+  addBytesSent(comm, msg.mpi_type(), msg.count());
 }
 
 DLAF_MAKE_CALLABLE_OBJECT(send);
@@ -81,6 +83,7 @@ auto recv(const Communicator& comm, IndexT_MPI source, IndexT_MPI tag, const mat
 
   auto msg = comm::make_message(common::make_data(tile));
   DLAF_MPI_CHECK_ERROR(MPI_Irecv(msg.data(), msg.count(), msg.mpi_type(), source, tag, comm, req));
+  addBytesReceived(comm, msg.mpi_type(), msg.count());
 }
 
 DLAF_MAKE_CALLABLE_OBJECT(recv);
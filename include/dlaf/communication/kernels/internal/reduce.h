@@ -26,6 +26,7 @@
 #include <dlaf/communication/kernels/reduce.h>
 #include <dlaf/communication/message.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/traits.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/sender/with_temporary_tile.h>
@@ -42,6 +43,7 @@ void reduceRecvInPlace(const Communicator& comm, MPI_Op reduce_op, const matrix:
   auto msg = comm::make_message(common::make_data(tile));
   DLAF_MPI_CHECK_ERROR(MPI_Ireduce(MPI_IN_PLACE, msg.data(), msg.count(), msg.mpi_type(), reduce_op,
                                    comm.rank(), comm, req));
+  addBytesReceived(comm, msg.mpi_type(), msg.count());
 }
 
 DLAF_MAKE_CALLABLE_OBJECT(reduceRecvInPlace);
@@ -57,6 +59,7 @@ void reduceSend(const Communicator& comm, comm::IndexT_MPI rank_root, MPI_Op red
   auto msg = comm::make_message(common::make_data(tile));
   DLAF_MPI_CHECK_ERROR(MPI_Ireduce(msg.data(), nullptr, msg.count(), msg.mpi_type(), reduce_op,
                                    rank_root, comm, req));
+  addBytesSent(comm, msg.mpi_type(), msg.count());
 }
 
 DLAF_MAKE_CALLABLE_OBJECT(reduceSend);
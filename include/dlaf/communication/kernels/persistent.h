@@ -0,0 +1,291 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// @file
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include <mpi.h>
+
+#include <pika/execution.hpp>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/common/pipeline.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/datatypes.h>
+#include <dlaf/communication/error.h>
+#include <dlaf/communication/index.h>
+#include <dlaf/metrics.h>
+#include <dlaf/sender/transform_mpi.h>
+
+namespace dlaf::comm {
+namespace internal {
+/// MPI persistent request, which can be started multiple times (one at a time).
+///
+/// The request is freed on destruction, therefore it must not be active anymore.
+class PersistentRequest {
+public:
+  explicit PersistentRequest(MPI_Request request) noexcept : request_(request) {}
+
+  PersistentRequest(const PersistentRequest&) = delete;
+  PersistentRequest(PersistentRequest&&) = delete;
+  PersistentRequest& operator=(const PersistentRequest&) = delete;
+  PersistentRequest& operator=(PersistentRequest&&) = delete;
+
+  ~PersistentRequest() {
+    MPI_Request_free(&request_);
+  }
+
+  /// Starts the request and copies its handle in @p req (for testing its completion), unless it is
+  /// already in use by a previous operation not released yet.
+  ///
+  /// @return true if the request has been started.
+  bool tryStart(MPI_Request* req) {
+    if (in_use_.exchange(true))
+      return false;
+
+    DLAF_MPI_CHECK_ERROR(MPI_Start(&request_));
+    *req = request_;
+    return true;
+  }
+
+  /// Makes the request available for the following operations.
+  ///
+  /// @pre the operation started with tryStart() has completed.
+  void release() noexcept {
+    in_use_ = false;
+  }
+
+private:
+  MPI_Request request_;
+  std::atomic<bool> in_use_ = false;
+};
+
+enum class PersistentOperation { send, recv, bcast };
+}
+
+/// Cache of MPI persistent requests for communication patterns which are repeated with the same
+/// arguments (buffer, count, datatype, peer, tag and communicator).
+///
+/// The first time an operation is requested, the corresponding persistent request is created (with
+/// MPI_Send_init, MPI_Recv_init or MPI_Bcast_init) and stored, and it is started again each time the
+/// same operation is requested later on. If the request of a send or of a receive is still in use by a
+/// previous operation, a non-persistent operation (MPI_Isend or MPI_Irecv) is issued instead.
+/// Broadcasts never fall back to MPI_Ibcast, as a persistent collective can only match persistent
+/// collectives started in the same order on all the ranks: schedule_persistent_bcast makes each
+/// broadcast wait for the completion of the previous one on the same buffer instead.
+///
+/// Note: the buffers must stay allocated as long as the cache exists, as they are referenced by the
+/// persistent requests.
+/// Note: persistent broadcasts require MPI 4, with older MPI versions MPI_Ibcast is always used.
+class PersistentRequests {
+public:
+  /// Starts a non-blocking send of @p count elements from @p ptr to rank @p dest, returning in @p req
+  /// the request handle to test for completion.
+  ///
+  /// @return the persistent request used (to be released after completion), or nullptr.
+  template <class T>
+  std::shared_ptr<internal::PersistentRequest> startSend(const Communicator& comm, const T* ptr,
+                                                         int count, IndexT_MPI dest, IndexT_MPI tag,
+                                                         MPI_Request* req) {
+    using internal::PersistentOperation;
+    const MPI_Datatype dtype = mpi_datatype<T>::type;
+    internal::addBytesSent(comm, dtype, count);
+
+    auto create = [&](MPI_Request* preq) {
+      DLAF_MPI_CHECK_ERROR(MPI_Send_init(ptr, count, dtype, dest, tag, comm, preq));
+    };
+    if (auto request = tryStart({PersistentOperation::send, comm, ptr, count, dtype, dest, tag},
+                                create, req))
+      return request;
+
+    DLAF_MPI_CHECK_ERROR(MPI_Isend(ptr, count, dtype, dest, tag, comm, req));
+    return nullptr;
+  }
+
+  /// Starts a non-blocking receive of @p count elements in @p ptr from rank @p source, returning in
+  /// @p req the request handle to test for completion.
+  ///
+  /// @return the persistent request used (to be released after completion), or nullptr.
+  template <class T>
+  std::shared_ptr<internal::PersistentRequest> startRecv(const Communicator& comm, T* ptr, int count,
+                                                         IndexT_MPI source, IndexT_MPI tag,
+                                                         MPI_Request* req) {
+    using internal::PersistentOperation;
+    const MPI_Datatype dtype = mpi_datatype<T>::type;
+    internal::addBytesReceived(comm, dtype, count);
+
+    auto create = [&](MPI_Request* preq) {
+      DLAF_MPI_CHECK_ERROR(MPI_Recv_init(ptr, count, dtype, source, tag, comm, preq));
+    };
+    if (auto request = tryStart({PersistentOperation::recv, comm, ptr, count, dtype, source, tag},
+                                create, req))
+      return request;
+
+    DLAF_MPI_CHECK_ERROR(MPI_Irecv(ptr, count, dtype, source, tag, comm, req));
+    return nullptr;
+  }
+
+  /// Starts a non-blocking broadcast of @p count elements in @p ptr from rank @p root, returning in
+  /// @p req the request handle to test for completion.
+  ///
+  /// @return the persistent request used (to be released after completion), or nullptr.
+  /// @pre the previous broadcast of the same buffer has been released (see schedule_persistent_bcast).
+  template <class T>
+  std::shared_ptr<internal::PersistentRequest> startBcast(const Communicator& comm, T* ptr, int count,
+                                                          IndexT_MPI root, MPI_Request* req) {
+    const MPI_Datatype dtype = mpi_datatype<T>::type;
+    if (root == comm.rank())
+      internal::addBytesSent(comm, dtype, count);
+    else
+      internal::addBytesReceived(comm, dtype, count);
+
+#if MPI_VERSION >= 4
+    using internal::PersistentOperation;
+    auto create = [&](MPI_Request* preq) {
+      DLAF_MPI_CHECK_ERROR(MPI_Bcast_init(ptr, count, dtype, root, comm, MPI_INFO_NULL, preq));
+    };
+    auto request =
+        tryStart({PersistentOperation::bcast, comm, ptr, count, dtype, root, 0}, create, req);
+    DLAF_ASSERT(request, "The persistent broadcast is still in use by a previous operation.");
+    return request;
+#else
+    DLAF_MPI_CHECK_ERROR(MPI_Ibcast(ptr, count, dtype, root, comm, req));
+    return nullptr;
+#endif
+  }
+
+  /// Returns a sender giving exclusive access to the broadcasts of @p count elements in @p ptr from rank
+  /// @p root, which is granted in the order this function is called.
+  ///
+  /// The access has to be held until the broadcast started with it has been released.
+  auto bcastAccess(const void* ptr, int count, IndexT_MPI root) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [it, inserted] = bcasts_.try_emplace({ptr, count, root}, std::monostate{});
+    return it->second.readwrite();
+  }
+
+private:
+  using Key = std::tuple<internal::PersistentOperation, MPI_Comm, const void*, int, MPI_Datatype,
+                         IndexT_MPI, IndexT_MPI>;
+
+  template <class CreateF>
+  std::shared_ptr<internal::PersistentRequest> tryStart(const Key& key, CreateF&& create,
+                                                        MPI_Request* req) {
+    std::shared_ptr<internal::PersistentRequest> request;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& cached = requests_[key];
+      if (!cached) {
+        MPI_Request preq;
+        create(&preq);
+        cached = std::make_shared<internal::PersistentRequest>(preq);
+      }
+      request = cached;
+    }
+
+    if (request->tryStart(req))
+      return request;
+    return nullptr;
+  }
+
+  std::mutex mutex_;
+  std::map<Key, std::shared_ptr<internal::PersistentRequest>> requests_;
+  std::map<std::tuple<const void*, int, IndexT_MPI>, common::Pipeline<std::monostate>> bcasts_;
+};
+
+/// Schedules a non-blocking send of @p count elements from @p ptr to rank @p dest using the persistent
+/// requests of @p requests, once @p pcomm and @p dep are ready.
+///
+/// @pre @p ptr stays allocated as long as @p requests exists.
+template <class T, class CommSender, class DepSender>
+[[nodiscard]] auto schedule_persistent_send(CommSender&& pcomm,
+                                            std::shared_ptr<PersistentRequests> requests,
+                                            IndexT_MPI dest, IndexT_MPI tag, const T* ptr, int count,
+                                            DepSender&& dep) {
+  using dlaf::comm::internal::transformMPI;
+  namespace ex = pika::execution::experimental;
+
+  auto used = std::make_shared<std::shared_ptr<internal::PersistentRequest>>();
+  auto send = [requests = std::move(requests), used, dest, tag, ptr, count](const Communicator& comm,
+                                                                           MPI_Request* req) {
+    *used = requests->startSend(comm, ptr, count, dest, tag, req);
+  };
+  return ex::when_all(std::forward<CommSender>(pcomm), std::forward<DepSender>(dep)) |
+         transformMPI(std::move(send)) | ex::then([used]() {
+           if (*used)
+             (*used)->release();
+         });
+}
+
+/// Schedules a non-blocking receive of @p count elements in @p ptr from rank @p source using the
+/// persistent requests of @p requests, once @p pcomm and @p dep are ready.
+///
+/// @pre @p ptr stays allocated as long as @p requests exists.
+template <class T, class CommSender, class DepSender>
+[[nodiscard]] auto schedule_persistent_recv(CommSender&& pcomm,
+                                            std::shared_ptr<PersistentRequests> requests,
+                                            IndexT_MPI source, IndexT_MPI tag, T* ptr, int count,
+                                            DepSender&& dep) {
+  using dlaf::comm::internal::transformMPI;
+  namespace ex = pika::execution::experimental;
+
+  auto used = std::make_shared<std::shared_ptr<internal::PersistentRequest>>();
+  auto recv = [requests = std::move(requests), used, source, tag, ptr, count](const Communicator& comm,
+                                                                             MPI_Request* req) {
+    *used = requests->startRecv(comm, ptr, count, source, tag, req);
+  };
+  return ex::when_all(std::forward<CommSender>(pcomm), std::forward<DepSender>(dep)) |
+         transformMPI(std::move(recv)) | ex::then([used]() {
+           if (*used)
+             (*used)->release();
+         });
+}
+
+/// Schedules a non-blocking broadcast of @p count elements in @p ptr from rank @p root using the
+/// persistent requests of @p requests, once @p pcomm and @p dep are ready and the broadcast of the
+/// same buffer scheduled before (if any) has completed, so that the persistent request is always
+/// available when started.
+///
+/// @pre @p ptr stays allocated as long as @p requests exists.
+/// @pre all the ranks schedule the broadcasts of the same buffer in the same order.
+template <class T, class CommSender, class DepSender>
+[[nodiscard]] auto schedule_persistent_bcast(CommSender&& pcomm,
+                                             std::shared_ptr<PersistentRequests> requests,
+                                             IndexT_MPI root, T* ptr, int count, DepSender&& dep) {
+  using dlaf::comm::internal::transformMPI;
+  namespace ex = pika::execution::experimental;
+
+  auto access = requests->bcastAccess(ptr, count, root);
+  auto used = std::make_shared<std::shared_ptr<internal::PersistentRequest>>();
+  auto bcast = [requests = std::move(requests), used, root, ptr, count](const Communicator& comm,
+                                                                       MPI_Request* req) {
+    *used = requests->startBcast(comm, ptr, count, root, req);
+  };
+  // Note: the access to the broadcasts of the buffer is held until the persistent request is released.
+  return std::move(access) |
+         ex::let_value([pcomm = std::forward<CommSender>(pcomm), dep = std::forward<DepSender>(dep),
+                        bcast = std::move(bcast), used](auto&) mutable {
+           return ex::when_all(std::move(pcomm), std::move(dep)) | transformMPI(std::move(bcast)) |
+                  ex::then([used]() {
+                    if (*used)
+                      (*used)->release();
+                  });
+         });
+}
+}
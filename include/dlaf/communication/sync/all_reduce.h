@@ -19,6 +19,7 @@
 #include <dlaf/communication/communicator.h>
 #include <dlaf/communication/message.h>
 #include <dlaf/communication/sync/reduce.h>
+#include <dlaf/metrics.h>
 
 namespace dlaf {
 namespace comm {
@@ -57,6 +58,8 @@ void allReduce(Communicator& communicator, MPI_Op reduce_operation, const DataIn
 
   DLAF_MPI_CHECK_ERROR(MPI_Allreduce(message_input.data(), message_output.data(), message_input.count(),
                                      message_input.mpi_type(), reduce_operation, communicator));
+  internal::addBytesSent(communicator, message_input.mpi_type(), message_input.count());
+  internal::addBytesReceived(communicator, message_input.mpi_type(), message_input.count());
 
   // if the output buffer has been used, copy-back output values
   if (buffer_out)
@@ -88,6 +91,8 @@ void allReduceInPlace(Communicator& communicator, MPI_Op reduce_operation, const
 
   DLAF_MPI_CHECK_ERROR(MPI_Allreduce(MPI_IN_PLACE, message_inout.data(), message_inout.count(),
                                      message_inout.mpi_type(), reduce_operation, communicator));
+  internal::addBytesSent(communicator, message_inout.mpi_type(), message_inout.count());
+  internal::addBytesReceived(communicator, message_inout.mpi_type(), message_inout.count());
 
   // if the output buffer has been used, copy-back output values
   if (buffer_inout)
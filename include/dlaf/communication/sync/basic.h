@@ -18,6 +18,7 @@
 #include <dlaf/communication/communicator.h>
 #include <dlaf/communication/error.h>
 #include <dlaf/communication/message.h>
+#include <dlaf/metrics.h>
 
 namespace dlaf {
 namespace comm {
@@ -32,6 +33,7 @@ void send_to(int receiver_rank, Communicator& communicator, DataIn&& data) {
   auto message = make_message(common::make_data(std::forward<DataIn>(data)));
   DLAF_MPI_CHECK_ERROR(MPI_Send(message.data(), message.count(), message.mpi_type(), receiver_rank, tag,
                                 communicator));
+  internal::addBytesSent(communicator, message.mpi_type(), message.count());
 }
 
 /// MPI_Recv wrapper for receiver side accepting a Data.
@@ -43,6 +45,7 @@ void receive_from(int sender_rank, Communicator& communicator, DataOut&& data) {
   auto message = make_message(common::make_data(std::forward<DataOut>(data)));
   DLAF_MPI_CHECK_ERROR(MPI_Recv(message.data(), message.count(), message.mpi_type(), sender_rank, tag,
                                 communicator, MPI_STATUS_IGNORE));
+  internal::addBytesReceived(communicator, message.mpi_type(), message.count());
 }
 }
 }
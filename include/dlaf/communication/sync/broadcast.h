@@ -23,6 +23,7 @@
 #include <dlaf/communication/message.h>
 #include <dlaf/matrix/copy_tile.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/metrics.h>
 
 namespace dlaf {
 namespace comm {
@@ -40,6 +41,7 @@ void send(Communicator& communicator, DataIn&& message_to_send) {
   auto message = comm::make_message(std::move(data));
   DLAF_MPI_CHECK_ERROR(MPI_Bcast(const_cast<DataT*>(message.data()), message.count(), message.mpi_type(),
                                  communicator.rank(), communicator));
+  internal::addBytesSent(communicator, message.mpi_type(), message.count());
 }
 
 /// MPI_Bcast wrapper for receiver side accepting a dlaf::comm::Message.
@@ -51,6 +53,7 @@ void receive_from(const int broadcaster_rank, Communicator& communicator, DataOu
   auto message = comm::make_message(common::make_data(std::forward<DataOut>(data)));
   DLAF_MPI_CHECK_ERROR(MPI_Bcast(message.data(), message.count(), message.mpi_type(), broadcaster_rank,
                                  communicator));
+  internal::addBytesReceived(communicator, message.mpi_type(), message.count());
 }
 }
 }
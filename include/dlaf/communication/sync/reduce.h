@@ -19,6 +19,7 @@
 #include <dlaf/communication/communicator.h>
 #include <dlaf/communication/index.h>
 #include <dlaf/communication/message.h>
+#include <dlaf/metrics.h>
 
 namespace dlaf {
 namespace comm {
@@ -55,6 +56,7 @@ void reduceRecv(Communicator& communicator, MPI_Op reduce_op, const DataIn input
   DLAF_MPI_CHECK_ERROR(MPI_Reduce(message_input.data(), message_output.data(), message_input.count(),
                                   message_input.mpi_type(), reduce_op, communicator.rank(),
                                   communicator));
+  internal::addBytesReceived(communicator, message_input.mpi_type(), message_input.count());
 
   // if the output buffer has been used, copy-back output values
   if (buffer_out)
@@ -93,6 +95,7 @@ void reduceRecvInPlace(Communicator& communicator, MPI_Op reduce_op, const DataI
   DLAF_MPI_CHECK_ERROR(MPI_Reduce(MPI_IN_PLACE, message_inout.data(), message_inout.count(),
                                   message_inout.mpi_type(), reduce_op, communicator.rank(),
                                   communicator));
+  internal::addBytesReceived(communicator, message_inout.mpi_type(), message_inout.count());
 
   // if the buffer has been used, copy-back output values
   if (buffer_inout)
@@ -122,6 +125,7 @@ void reduceSend(IndexT_MPI rank_root, Communicator& communicator, MPI_Op reduce_
 
   DLAF_MPI_CHECK_ERROR(MPI_Reduce(message_input.data(), nullptr, message_input.count(),
                                   message_input.mpi_type(), reduce_op, rank_root, communicator));
+  internal::addBytesSent(communicator, message_input.mpi_type(), message_input.count());
 }
 
 /// MPI_Reduce wrapper (both sides).
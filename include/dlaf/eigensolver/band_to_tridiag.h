@@ -62,6 +62,9 @@ namespace dlaf::eigensolver::internal {
 /// Note the letter denotes sw (A=0, B=1, ...), and the number st.
 /// (*) diagonal + band_size off-diagonals.
 ///
+/// If @p compute_hh_reflectors is false the HH reflectors are discarded (e.g. when only the eigenvalues
+/// are needed) and the returned hh_reflectors matrix is empty.
+///
 /// Implementation on local memory.
 ///
 /// @param mat_a contains the Hermitian band matrix A (if A is real, the matrix is symmetric).
@@ -73,7 +76,8 @@ namespace dlaf::eigensolver::internal {
 /// @pre @p band_size is a divisor of `mat_a.blockSize().cols()`, and @p band_size >= 2
 template <Backend B, Device D, class T>
 TridiagResult<T, Device::CPU> band_to_tridiagonal(blas::Uplo uplo, SizeType band_size,
-                                                  Matrix<const T, D>& mat_a) {
+                                                  Matrix<const T, D>& mat_a,
+                                                  const bool compute_hh_reflectors = true) {
   DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
   DLAF_ASSERT(matrix::single_tile_per_block(mat_a), mat_a);
   DLAF_ASSERT(matrix::square_block_size(mat_a), mat_a);
@@ -83,7 +87,7 @@ TridiagResult<T, Device::CPU> band_to_tridiagonal(blas::Uplo uplo, SizeType band
 
   switch (uplo) {
     case blas::Uplo::Lower:
-      return BandToTridiag<B, D, T>::call_L(band_size, mat_a);
+      return BandToTridiag<B, D, T>::call_L(band_size, mat_a, compute_hh_reflectors);
     case blas::Uplo::Upper:
       DLAF_UNIMPLEMENTED(uplo);
       break;
@@ -95,6 +99,36 @@ TridiagResult<T, Device::CPU> band_to_tridiagonal(blas::Uplo uplo, SizeType band
   return DLAF_UNREACHABLE(TridiagResult<T, Device::CPU>);
 }
 
+/// \overload band_to_tridiagonal
+///
+/// The tridiagonal matrix and the HH reflectors are stored in @p result, which allows to reuse its
+/// allocation in subsequent calls.
+/// @pre @p result has been allocated with makeTridiagResult<T>(mat_a.distribution(),
+///      compute_hh_reflectors)
+template <Backend B, Device D, class T>
+void band_to_tridiagonal(blas::Uplo uplo, SizeType band_size, Matrix<const T, D>& mat_a,
+                         TridiagResult<T, Device::CPU>& result,
+                         const bool compute_hh_reflectors = true) {
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_block_size(mat_a), mat_a);
+  DLAF_ASSERT(mat_a.blockSize().rows() % band_size == 0, mat_a.blockSize().rows(), band_size);
+  DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
+  DLAF_ASSERT(band_size >= 2, band_size);
+
+  switch (uplo) {
+    case blas::Uplo::Lower:
+      BandToTridiag<B, D, T>::call_L(band_size, mat_a, compute_hh_reflectors, result);
+      break;
+    case blas::Uplo::Upper:
+      DLAF_UNIMPLEMENTED(uplo);
+      break;
+    case blas::Uplo::General:
+      DLAF_UNIMPLEMENTED(uplo);
+      break;
+  }
+}
+
 /// Reduces a Hermitian band matrix A (with the given band_size(*)) to real symmetric tridiagonal
 /// form T by a unitary similarity transformation Q**H * A * Q = T.
 ///
@@ -135,6 +169,9 @@ TridiagResult<T, Device::CPU> band_to_tridiagonal(blas::Uplo uplo, SizeType band
 /// Note the letter denotes sw (A=0, B=1, ...), and the number st.
 /// (*) diagonal + band_size off-diagonals.
 ///
+/// If @p compute_hh_reflectors is false the HH reflectors are discarded (e.g. when only the eigenvalues
+/// are needed) and the returned hh_reflectors matrix is empty.
+///
 /// Implementation on distributed memory.
 ///
 /// @param mat_a contains the Hermitian band matrix A (if A is real, the matrix is symmetric).
@@ -146,7 +183,8 @@ TridiagResult<T, Device::CPU> band_to_tridiagonal(blas::Uplo uplo, SizeType band
 /// @pre @p band_size is a divisor of `mat_a.block_size().cols()`, and @p band_size >= 2
 template <Backend backend, Device device, class T>
 TridiagResult<T, Device::CPU> band_to_tridiagonal(comm::CommunicatorGrid& grid, blas::Uplo uplo,
-                                                  SizeType band_size, Matrix<const T, device>& mat_a) {
+                                                  SizeType band_size, Matrix<const T, device>& mat_a,
+                                                  const bool compute_hh_reflectors = true) {
   DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
   DLAF_ASSERT(matrix::square_block_size(mat_a), mat_a);
   DLAF_ASSERT(matrix::single_tile_per_block(mat_a), mat_a);
@@ -155,11 +193,11 @@ TridiagResult<T, Device::CPU> band_to_tridiagonal(comm::CommunicatorGrid& grid,
 
   // If the grid contains only one rank force local implementation.
   if (grid.size() == comm::Size2D(1, 1))
-    return band_to_tridiagonal<backend, device, T>(uplo, band_size, mat_a);
+    return band_to_tridiagonal<backend, device, T>(uplo, band_size, mat_a, compute_hh_reflectors);
 
   switch (uplo) {
     case blas::Uplo::Lower:
-      return BandToTridiag<backend, device, T>::call_L(grid, band_size, mat_a);
+      return BandToTridiag<backend, device, T>::call_L(grid, band_size, mat_a, compute_hh_reflectors);
     case blas::Uplo::Upper:
       DLAF_UNIMPLEMENTED(uplo);
       break;
@@ -171,4 +209,38 @@ TridiagResult<T, Device::CPU> band_to_tridiagonal(comm::CommunicatorGrid& grid,
   return DLAF_UNREACHABLE(TridiagResult<T, Device::CPU>);
 }
 
+/// \overload band_to_tridiagonal
+///
+/// The tridiagonal matrix and the HH reflectors are stored in @p result, which allows to reuse its
+/// allocation in subsequent calls.
+/// @pre @p result has been allocated with makeTridiagResult<T>(mat_a.distribution(),
+///      compute_hh_reflectors)
+template <Backend backend, Device device, class T>
+void band_to_tridiagonal(comm::CommunicatorGrid& grid, blas::Uplo uplo, SizeType band_size,
+                         Matrix<const T, device>& mat_a, TridiagResult<T, Device::CPU>& result,
+                         const bool compute_hh_reflectors = true) {
+  DLAF_ASSERT(matrix::square_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::square_block_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_a), mat_a);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_a, grid), mat_a, grid);
+  DLAF_ASSERT(band_size >= 2, band_size);
+
+  // If the grid contains only one rank force local implementation.
+  if (grid.size() == comm::Size2D(1, 1))
+    return band_to_tridiagonal<backend, device, T>(uplo, band_size, mat_a, result,
+                                                   compute_hh_reflectors);
+
+  switch (uplo) {
+    case blas::Uplo::Lower:
+      BandToTridiag<backend, device, T>::call_L(grid, band_size, mat_a, compute_hh_reflectors, result);
+      break;
+    case blas::Uplo::Upper:
+      DLAF_UNIMPLEMENTED(uplo);
+      break;
+    case blas::Uplo::General:
+      DLAF_UNIMPLEMENTED(uplo);
+      break;
+  }
+}
+
 }
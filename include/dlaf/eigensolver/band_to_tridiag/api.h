@@ -12,6 +12,7 @@
 
 #include <complex>
 
+#include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 
@@ -23,6 +24,27 @@ struct TridiagResult {
   Matrix<T, D> hh_reflectors;
 };
 
+// Returns the distribution of the HH reflectors computed by the band to tridiagonal reduction of a
+// matrix distributed according to @p dist_a (empty if @p compute_hh_reflectors is false).
+inline matrix::Distribution hhReflectorsDistribution(const matrix::Distribution& dist_a,
+                                                     const bool compute_hh_reflectors) {
+  const SizeType size_v = compute_hh_reflectors ? dist_a.size().cols() : 0;
+  const SizeType nb = dist_a.block_size().cols();
+  return matrix::Distribution({size_v, size_v}, {nb, nb}, dist_a.grid_size(), dist_a.rank_index(),
+                              dist_a.source_rank_index());
+}
+
+// Allocates the result of the band to tridiagonal reduction of a matrix distributed according to
+// @p dist_a.
+template <class T>
+TridiagResult<T, Device::CPU> makeTridiagResult(const matrix::Distribution& dist_a,
+                                                const bool compute_hh_reflectors) {
+  const SizeType size = dist_a.size().cols();
+  const SizeType nb = dist_a.block_size().cols();
+  return {Matrix<BaseType<T>, Device::CPU>({size, 2}, {nb, 2}),
+          Matrix<T, Device::CPU>(hhReflectorsDistribution(dist_a, compute_hh_reflectors))};
+}
+
 template <class T>
 SizeType nrSweeps(SizeType size) noexcept {
   // Complex needs an extra sweep to have a real tridiagonal matrix.
@@ -40,9 +62,15 @@ struct BandToTridiag;
 
 template <Device D, class T>
 struct BandToTridiag<Backend::MC, D, T> {
-  static TridiagResult<T, Device::CPU> call_L(const SizeType b, Matrix<const T, D>& mat_a) noexcept;
+  static TridiagResult<T, Device::CPU> call_L(const SizeType b, Matrix<const T, D>& mat_a,
+                                              const bool compute_hh_reflectors) noexcept;
+  static void call_L(const SizeType b, Matrix<const T, D>& mat_a, const bool compute_hh_reflectors,
+                     TridiagResult<T, Device::CPU>& result) noexcept;
   static TridiagResult<T, Device::CPU> call_L(comm::CommunicatorGrid& grid, const SizeType b,
-                                              Matrix<const T, D>& mat_a) noexcept;
+                                              Matrix<const T, D>& mat_a,
+                                              const bool compute_hh_reflectors) noexcept;
+  static void call_L(comm::CommunicatorGrid& grid, const SizeType b, Matrix<const T, D>& mat_a,
+                     const bool compute_hh_reflectors, TridiagResult<T, Device::CPU>& result) noexcept;
 };
 
 // ETI
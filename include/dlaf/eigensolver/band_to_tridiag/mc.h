@@ -10,9 +10,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <utility>
 #include <vector>
@@ -41,9 +43,11 @@
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/tile.h>
 #include <dlaf/memory/memory_view.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/traits.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/traits.h>
+#include <dlaf/tune.h>
 
 #ifdef DLAF_WITH_GPU
 #include <whip.hpp>
@@ -435,34 +439,54 @@ private:
   memory::MemoryView<T, Device::CPU> mem_;
 };
 
+// Note: if @p requests is not null the column is sent using its persistent requests.
 template <class CommSender, class T, class DepSender>
-[[nodiscard]] auto schedule_send_col(CommSender&& pcomm, comm::IndexT_MPI dest, comm::IndexT_MPI tag,
-                                     SizeType b, std::shared_ptr<BandBlock<T, true>> a_block, SizeType j,
-                                     DepSender&& dep) {
+[[nodiscard]] pika::execution::experimental::unique_any_sender<> schedule_send_col(
+    CommSender&& pcomm, comm::IndexT_MPI dest, comm::IndexT_MPI tag, SizeType b,
+    std::shared_ptr<BandBlock<T, true>> a_block, SizeType j, DepSender&& dep,
+    const std::shared_ptr<comm::PersistentRequests>& requests) {
   using dlaf::comm::internal::transformMPI;
   namespace ex = pika::execution::experimental;
 
+  if (requests) {
+    const T* ptr = a_block->ptr(0, j);
+    return comm::schedule_persistent_send(std::forward<CommSender>(pcomm), requests, dest, tag, ptr,
+                                          to_int(2 * b), std::forward<DepSender>(dep)) |
+           ex::then([a_block = std::move(a_block)]() {});
+  }
+
   auto send = [dest, tag, b, j](const comm::Communicator& comm,
                                 std::shared_ptr<BandBlock<T, true>>& a_block, MPI_Request* req) {
     DLAF_MPI_CHECK_ERROR(MPI_Isend(a_block->ptr(0, j), to_int(2 * b), dlaf::comm::mpi_datatype<T>::type,
                                    dest, tag, comm, req));
+    comm::internal::addBytesSent(comm, dlaf::comm::mpi_datatype<T>::type, to_int(2 * b));
   };
   return ex::when_all(std::forward<CommSender>(pcomm), ex::just(std::move(a_block)),
                       std::forward<DepSender>(dep)) |
          transformMPI(send);
 }
 
+// Note: if @p requests is not null the column is received using its persistent requests.
 template <class CommSender, class T, class DepSender>
-[[nodiscard]] auto schedule_recv_col(CommSender&& pcomm, comm::IndexT_MPI src, comm::IndexT_MPI tag,
-                                     SizeType b, std::shared_ptr<BandBlock<T, true>> a_block, SizeType j,
-                                     DepSender&& dep) {
+[[nodiscard]] pika::execution::experimental::unique_any_sender<> schedule_recv_col(
+    CommSender&& pcomm, comm::IndexT_MPI src, comm::IndexT_MPI tag, SizeType b,
+    std::shared_ptr<BandBlock<T, true>> a_block, SizeType j, DepSender&& dep,
+    const std::shared_ptr<comm::PersistentRequests>& requests) {
   using dlaf::comm::internal::transformMPI;
   namespace ex = pika::execution::experimental;
 
+  if (requests) {
+    T* ptr = a_block->ptr(0, j);
+    return comm::schedule_persistent_recv(std::forward<CommSender>(pcomm), requests, src, tag, ptr,
+                                          to_int(2 * b), std::forward<DepSender>(dep)) |
+           ex::then([a_block = std::move(a_block)]() {});
+  }
+
   auto recv = [src, tag, b, j](const comm::Communicator& comm,
                                std::shared_ptr<BandBlock<T, true>>& a_block, MPI_Request* req) {
     DLAF_MPI_CHECK_ERROR(MPI_Irecv(a_block->ptr(0, j), to_int(2 * b), dlaf::comm::mpi_datatype<T>::type,
                                    src, tag, comm, req));
+    comm::internal::addBytesReceived(comm, dlaf::comm::mpi_datatype<T>::type, to_int(2 * b));
   };
 
   return ex::when_all(std::forward<CommSender>(pcomm), ex::just(std::move(a_block)),
@@ -473,6 +497,17 @@ template <class CommSender, class T, class DepSender>
 template <class T>
 using BandBlockDist = BandBlock<T, true>;
 
+// Returns the number of consecutive sweeps run by each task of the local algorithm on CPU, i.e. the
+// largest divisor of the block size @p nb not larger than
+// getTuneParameters().band_to_tridiag_sweeps_per_task.
+inline SizeType sweepsPerTask(const SizeType nb) noexcept {
+  SizeType sweeps_per_task =
+      std::clamp<SizeType>(getTuneParameters().band_to_tridiag_sweeps_per_task, 1, nb);
+  while (nb % sweeps_per_task != 0)
+    --sweeps_per_task;
+  return sweeps_per_task;
+}
+
 template <class T>
 class SweepWorker {
 public:
@@ -591,6 +626,7 @@ public:
             MPI_Request* req) const noexcept {
     DLAF_MPI_CHECK_ERROR(MPI_Isend(data_(), to_int(band_size_ + 1), comm::mpi_datatype<T>::type, dest,
                                    tag, comm, req));
+    comm::internal::addBytesSent(comm, comm::mpi_datatype<T>::type, to_int(band_size_ + 1));
   }
 
   void recv(SizeType sweep, SizeType step, const comm::Communicator& comm, comm::IndexT_MPI src,
@@ -598,6 +634,7 @@ public:
     SweepWorker<T>::set_id(sweep, step);
     DLAF_MPI_CHECK_ERROR(MPI_Irecv(data_(), to_int(band_size_ + 1), comm::mpi_datatype<T>::type, src,
                                    tag, comm, req));
+    comm::internal::addBytesReceived(comm, comm::mpi_datatype<T>::type, to_int(band_size_ + 1));
   }
 
   using SweepWorker<T>::compact_copy_to_tile;
@@ -662,7 +699,16 @@ template <class CommSender, class PromiseSender>
 
 template <Device D, class T>
 TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
-    const SizeType b, Matrix<const T, D>& mat_a) noexcept {
+    const SizeType b, Matrix<const T, D>& mat_a, const bool compute_hh_reflectors) noexcept {
+  auto result = makeTridiagResult<T>(mat_a.distribution(), compute_hh_reflectors);
+  call_L(b, mat_a, compute_hh_reflectors, result);
+  return result;
+}
+
+template <Device D, class T>
+void BandToTridiag<Backend::MC, D, T>::call_L(const SizeType b, Matrix<const T, D>& mat_a,
+                                             const bool compute_hh_reflectors,
+                                             TridiagResult<T, Device::CPU>& result) noexcept {
   // Note on the algorithm and dependency tracking:
   // The algorithm is composed by n-2 (real) or n-1 (complex) sweeps:
   // The i-th sweep is initialized by init_sweep/init_sweep_copy_tridiag
@@ -716,11 +762,17 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
   // Need share pointer to keep the allocation until all the tasks are executed.
   auto a_ws = std::make_shared<BandBlock<T>>(size, b);
 
-  Matrix<BaseType<T>, Device::CPU> mat_trid({size, 2}, {nb, 2});
-  Matrix<T, Device::CPU> mat_v({size, size}, {nb, nb});
+  // If the HH reflectors are not needed (eigenvalues only), mat_v is empty and they are discarded.
+  auto& mat_trid = result.tridiagonal;
+  auto& mat_v = result.hh_reflectors;
+  DLAF_ASSERT(mat_trid.size() == GlobalElementSize(size, 2), mat_trid, size);
+  DLAF_ASSERT(mat_trid.block_size() == GlobalElementSize(nb, 2), mat_trid, nb);
+  DLAF_ASSERT(mat_v.distribution() ==
+                  hhReflectorsDistribution(mat_a.distribution(), compute_hh_reflectors),
+              mat_v, compute_hh_reflectors);
 
   if (size == 0) {
-    return {std::move(mat_trid), std::move(mat_v)};
+    return;
   }
 
   auto copy_diag = [a_ws](SizeType j, auto source) {
@@ -754,11 +806,6 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
   const auto max_workers =
       std::min(ceilDiv(size, 2 * b - 1), 2 * to_SizeType(get_num_threads("default")));
 
-  vector<Pipeline<SweepWorker<T>>> workers;
-  workers.reserve(max_workers);
-  for (SizeType i = 0; i < max_workers; ++i)
-    workers.emplace_back(SweepWorker<T>(size, b));
-
   auto run_sweep = [a_ws, size, nb, b](SemaphorePtr&& sem, SemaphorePtr&& sem_next, SizeType sweep,
                                        SweepWorker<T>& worker, const TileVectorPtr& tiles_v) {
     const SizeType nr_steps = nrStepsForSweep(sweep, size, b);
@@ -766,7 +813,9 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
       SizeType j_el_tl = sweep % nb;
       // i_el is the row element index with origin in the first row of the diagonal tile.
       SizeType i_el = j_el_tl / b * b + step * b;
-      worker.compact_copy_to_tile((*tiles_v)[to_sizet(i_el / nb)], TileElementIndex(i_el % nb, j_el_tl));
+      if (tiles_v)
+        worker.compact_copy_to_tile((*tiles_v)[to_sizet(i_el / nb)],
+                                    TileElementIndex(i_el % nb, j_el_tl));
       sem->acquire();
       worker.do_step(*a_ws);
       sem_next->release(1);
@@ -806,42 +855,142 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
     return std::move(sem);
   };
 
+  // Runs the sweeps [sweep0, sweep0 + nr_sweeps) as a wavefront: the i-th sweep of the group starts at
+  // iteration i and performs its step k at iteration i + 1 + k, i.e. each sweep lags one step behind the
+  // previous one, which is the minimum lag allowed by the dependencies (step k of a sweep requires step
+  // k + 1 of the previous sweep). In this way the steps of an iteration act on a window of about
+  // nr_sweeps * b columns of the band, which is reused while it is in cache, and only the first and the
+  // last sweep of the group synchronize with the previous and the next group respectively.
+  auto run_sweeps = [a_ws, size, nb, b, copy_tridiag_task](
+                        SemaphorePtr&& sem, SemaphorePtr&& sem_next, const SizeType sweep0,
+                        const SizeType nr_sweeps, std::vector<SweepWorker<T>>& workers,
+                        const TileVectorPtr& tiles_v,
+                        const std::optional<matrix::Tile<BaseType<T>, Device::CPU>>& tile_t) {
+    SizeType nr_iterations = 0;
+    for (SizeType i = 0; i < nr_sweeps; ++i)
+      nr_iterations = std::max(nr_iterations, i + 1 + nrStepsForSweep(sweep0 + i, size, b));
+
+    for (SizeType it = 0; it < nr_iterations; ++it) {
+      for (SizeType i = 0; i < std::min(it + 1, nr_sweeps); ++i) {
+        const SizeType sweep = sweep0 + i;
+        const SizeType step = it - i - 1;
+        SweepWorker<T>& worker = workers[to_sizet(i)];
+
+        if (step == -1) {
+          if (i == 0)
+            sem->acquire();
+          worker.start_sweep(sweep, *a_ws);
+          if ((sweep + 1) % nb == 0) {
+            DLAF_ASSERT_HEAVY(tile_t.has_value(), sweep);
+            copy_tridiag_task(sweep - (nb - 1), nb, nb, *tile_t);
+          }
+        }
+        else if (step < nrStepsForSweep(sweep, size, b)) {
+          const SizeType j_el_tl = sweep % nb;
+          // i_el is the row element index with origin in the first row of the diagonal tile.
+          const SizeType i_el = j_el_tl / b * b + step * b;
+          if (tiles_v)
+            worker.compact_copy_to_tile((*tiles_v)[to_sizet(i_el / nb)],
+                                        TileElementIndex(i_el % nb, j_el_tl));
+          if (i == 0)
+            sem->acquire();
+          worker.do_step(*a_ws);
+          if (i == nr_sweeps - 1)
+            sem_next->release(1);
+        }
+      }
+    }
+    // Make sure to unlock the last step of the next sweep
+    sem_next->release(1);
+  };
+
+  // The run_sweep tasks writes a single column of elements of mat_v.
+  // To avoid to retile the matrix (to avoid to have too many tiles), each column of tiles should
+  // be shared in read/write mode by multiple tasks.
+  // Therefore we extract the tiles of the column in a vector and move it to a shared_ptr,
+  // that can be copied to the different tasks, but reference the same tiles.
+  auto select_tiles_v = [&mat_v, n](const SizeType i) {
+    return ex::when_all_vector(matrix::select(
+               mat_v, common::iterate_range2d(LocalTileIndex{i, i}, LocalTileSize{n - i, 1}))) |
+           ex::then([](TileVector&& vector) {
+             return std::make_shared<TileVector>(std::move(vector));
+           }) |
+           ex::drop_operation_state() | ex::split();
+  };
+
   const SizeType sweeps = nrSweeps<T>(size);
-  ex::any_sender<TileVectorPtr> tiles_v;
+  ex::any_sender<TileVectorPtr> tiles_v = ex::just(TileVectorPtr{});
+
+  const SizeType sweeps_per_task = sweepsPerTask(nb);
+  if (sweeps_per_task == 1) {
+    vector<Pipeline<SweepWorker<T>>> workers;
+    workers.reserve(max_workers);
+    for (SizeType i = 0; i < max_workers; ++i)
+      workers.emplace_back(SweepWorker<T>(size, b));
+
+    for (SizeType sweep = 0; sweep < sweeps; ++sweep) {
+      auto& w_pipeline = workers[sweep % max_workers];
+      auto sem_next = std::make_shared<pika::counting_semaphore<>>(0);
+      ex::unique_any_sender<SemaphorePtr> sem_sender;
+      if ((sweep + 1) % nb != 0) {
+        sem_sender =
+            ex::ensure_started(ex::when_all(ex::just(std::move(sem), sweep), w_pipeline.readwrite()) |
+                               dlaf::internal::transform(policy_hp, init_sweep));
+      }
+      else {
+        const auto tile_index = sweep / nb;
+        sem_sender =
+            ex::ensure_started(ex::when_all(ex::just(std::move(sem), sweep), w_pipeline.readwrite(),
+                                            mat_trid.readwrite(GlobalTileIndex{tile_index, 0})) |
+                               dlaf::internal::transform(policy_hp, init_sweep_copy_tridiag));
+      }
+      if (compute_hh_reflectors && sweep % nb == 0)
+        tiles_v = select_tiles_v(sweep / nb);
 
-  for (SizeType sweep = 0; sweep < sweeps; ++sweep) {
-    auto& w_pipeline = workers[sweep % max_workers];
-    auto sem_next = std::make_shared<pika::counting_semaphore<>>(0);
-    ex::unique_any_sender<SemaphorePtr> sem_sender;
-    if ((sweep + 1) % nb != 0) {
-      sem_sender =
-          ex::ensure_started(ex::when_all(ex::just(std::move(sem), sweep), w_pipeline.readwrite()) |
-                             dlaf::internal::transform(policy_hp, init_sweep));
-    }
-    else {
-      const auto tile_index = sweep / nb;
-      sem_sender =
-          ex::ensure_started(ex::when_all(ex::just(std::move(sem), sweep), w_pipeline.readwrite(),
-                                          mat_trid.readwrite(GlobalTileIndex{tile_index, 0})) |
-                             dlaf::internal::transform(policy_hp, init_sweep_copy_tridiag));
+      ex::when_all(std::move(sem_sender), ex::just(sem_next, sweep), w_pipeline.readwrite(), tiles_v) |
+          dlaf::internal::transformDetach(policy_hp, run_sweep);
+      sem = std::move(sem_next);
     }
-    if (sweep % nb == 0) {
-      // The run_sweep tasks writes a single column of elements of mat_v.
-      // To avoid to retile the matrix (to avoid to have too many tiles), each column of tiles should
-      // be shared in read/write mode by multiple tasks.
-      // Therefore we extract the tiles of the column in a vector and move it to a shared_ptr,
-      // that can be copied to the different tasks, but reference the same tiles.
-      const SizeType i = sweep / nb;
-      tiles_v =
-          ex::when_all_vector(matrix::select(mat_v, common::iterate_range2d(LocalTileIndex{i, i},
-                                                                            LocalTileSize{n - i, 1}))) |
-          ex::then([](TileVector&& vector) { return std::make_shared<TileVector>(std::move(vector)); }) |
-          ex::drop_operation_state() | ex::split();
+  }
+  else {
+    using TridiagTileOpt = std::optional<matrix::Tile<BaseType<T>, Device::CPU>>;
+
+    // Each group of workers runs sweeps_per_task sweeps, therefore less groups are needed to reach the
+    // same parallelism.
+    const SizeType max_groups = ceilDiv(max_workers, sweeps_per_task);
+    vector<Pipeline<std::vector<SweepWorker<T>>>> groups;
+    groups.reserve(max_groups);
+    for (SizeType i = 0; i < max_groups; ++i) {
+      std::vector<SweepWorker<T>> group;
+      group.reserve(to_sizet(sweeps_per_task));
+      for (SizeType k = 0; k < sweeps_per_task; ++k)
+        group.emplace_back(size, b);
+      groups.emplace_back(std::move(group));
     }
 
-    ex::when_all(std::move(sem_sender), ex::just(sem_next, sweep), w_pipeline.readwrite(), tiles_v) |
-        dlaf::internal::transformDetach(policy_hp, run_sweep);
-    sem = std::move(sem_next);
+    for (SizeType sweep0 = 0; sweep0 < sweeps; sweep0 += sweeps_per_task) {
+      const SizeType nr_sweeps = std::min(sweeps_per_task, sweeps - sweep0);
+      auto& g_pipeline = groups[(sweep0 / sweeps_per_task) % max_groups];
+      auto sem_next = std::make_shared<pika::counting_semaphore<>>(0);
+
+      // Note: as sweeps_per_task divides nb, only the last sweep of the group might have to copy a tile
+      // of the tridiagonal matrix and only the first one might start a new column of tiles of mat_v.
+      const SizeType sweep_last = sweep0 + nr_sweeps - 1;
+      ex::unique_any_sender<TridiagTileOpt> tile_t = ex::just(TridiagTileOpt{});
+      if ((sweep_last + 1) % nb == 0) {
+        tile_t = mat_trid.readwrite(GlobalTileIndex{sweep_last / nb, 0}) |
+                 ex::then([](matrix::Tile<BaseType<T>, Device::CPU> tile) {
+                   return TridiagTileOpt{std::move(tile)};
+                 });
+      }
+      if (compute_hh_reflectors && sweep0 % nb == 0)
+        tiles_v = select_tiles_v(sweep0 / nb);
+
+      ex::when_all(ex::just(std::move(sem), sem_next, sweep0, nr_sweeps), g_pipeline.readwrite(),
+                   tiles_v, std::move(tile_t)) |
+          dlaf::internal::transformDetach(policy_hp, run_sweeps);
+      sem = std::move(sem_next);
+    }
   }
 
   auto copy_tridiag = [policy_hp_nostack, a_ws, size, nb, &mat_trid, copy_tridiag_task](SizeType i,
@@ -863,8 +1012,6 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
     copy_tridiag(size - 1, dep);
   }
   copy_tridiag(size, std::move(dep));
-
-  return {std::move(mat_trid), std::move(mat_v)};
 }
 
 struct VAccessHelper {
@@ -989,7 +1136,18 @@ private:
 
 template <Device D, class T>
 TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
-    comm::CommunicatorGrid& grid, const SizeType b, Matrix<const T, D>& mat_a) noexcept {
+    comm::CommunicatorGrid& grid, const SizeType b, Matrix<const T, D>& mat_a,
+    const bool compute_hh_reflectors) noexcept {
+  auto result = makeTridiagResult<T>(mat_a.distribution(), compute_hh_reflectors);
+  call_L(grid, b, mat_a, compute_hh_reflectors, result);
+  return result;
+}
+
+template <Device D, class T>
+void BandToTridiag<Backend::MC, D, T>::call_L(comm::CommunicatorGrid& grid, const SizeType b,
+                                             Matrix<const T, D>& mat_a,
+                                             const bool compute_hh_reflectors,
+                                             TridiagResult<T, Device::CPU>& result) noexcept {
   // Note on the algorithm and dependency tracking:
   // The algorithm is composed by n-2 (real) or n-1 (complex) sweeps:
   // The i-th sweep is initialized by init_sweep/init_sweep_copy_tridiag
@@ -1062,13 +1220,18 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
   SizeType nb = mat_a.blockSize().cols();
   auto& dist_a = mat_a.distribution();
 
-  Matrix<BaseType<T>, Device::CPU> mat_trid({size, 2}, {nb, 2});
   matrix::Distribution dist_v({size, size}, {nb, nb}, dist_a.commGridSize(), dist_a.rankIndex(),
                               dist_a.sourceRankIndex());
-  Matrix<T, Device::CPU> mat_v(dist_v);
+  // If the HH reflectors are not needed (eigenvalues only), mat_v is empty and they are discarded.
+  auto& mat_trid = result.tridiagonal;
+  auto& mat_v = result.hh_reflectors;
+  DLAF_ASSERT(mat_trid.size() == GlobalElementSize(size, 2), mat_trid, size);
+  DLAF_ASSERT(mat_trid.block_size() == GlobalElementSize(nb, 2), mat_trid, nb);
+  DLAF_ASSERT(mat_v.distribution() == hhReflectorsDistribution(dist_a, compute_hh_reflectors),
+              mat_v, compute_hh_reflectors);
 
   if (size == 0) {
-    return {std::move(mat_trid), std::move(mat_v)};
+    return;
   }
 
   // The algorithm would still work if we only defined one pipeline below and used that for both p2p
@@ -1086,6 +1249,12 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
   const auto prev_rank = (rank == 0 ? ranks - 1 : rank - 1);
   const auto next_rank = (rank + 1 == ranks ? 0 : rank + 1);
 
+  // The columns exchanged between consecutive ranks are always communicated with the same buffers
+  // (the band blocks are circular buffers), peers and tags, therefore persistent requests can be used.
+  const auto col_requests = getTuneParameters().band_to_tridiag_persistent_requests
+                                ? std::make_shared<comm::PersistentRequests>()
+                                : nullptr;
+
   auto policy_hp = dlaf::internal::Policy<Backend::MC>(thread_priority::high);
   auto policy_hp_nostack =
       dlaf::internal::Policy<Backend::MC>(thread_priority::high, thread_stacksize::nostack);
@@ -1111,14 +1280,14 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
   // The offset is set to the first unused tag by compute_copy_tag.
   const comm::IndexT_MPI offset_v_tag = compute_copy_tag(n, false);
 
-  auto compute_v_tag = [nb, b, offset_v_tag, tiles_v = mat_v.nrTiles(),
+  auto compute_v_tag = [nb, b, offset_v_tag, tiles_v = dist_v.nrTiles(),
                         ranks2d = grid.size()](GlobalTileIndex ij, SizeType j_origin, bool is_bottom) {
     auto i = static_cast<comm::IndexT_MPI>(ij.row() / ranks2d.rows());
     auto j = static_cast<comm::IndexT_MPI>(ij.col() / ranks2d.cols() * (nb / b) + j_origin / b);
     auto ld = static_cast<comm::IndexT_MPI>(util::ceilDiv<SizeType>(tiles_v.rows(), ranks2d.rows()));
     return offset_v_tag + 2 * (i + ld * j) + (is_bottom ? 1 : 0);
   };
-  auto end_v_tag = [nb, b, offset_v_tag, tiles_v = mat_v.nrTiles(), ranks2d = grid.size()]() {
+  auto end_v_tag = [nb, b, offset_v_tag, tiles_v = dist_v.nrTiles(), ranks2d = grid.size()]() {
     auto i = static_cast<comm::IndexT_MPI>(util::ceilDiv<SizeType>(tiles_v.rows(), ranks2d.rows()));
     auto j = static_cast<comm::IndexT_MPI>(util::ceilDiv<SizeType>(tiles_v.cols(), ranks2d.cols()) *
                                            (nb / b));
@@ -1270,14 +1439,16 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
   }
 
   constexpr std::size_t n_workspaces = 2;
-  matrix::Distribution dist_panel({size, b}, {nb_band, b}, {ranks, 1}, {rank, 0}, {0, 0});
+  matrix::Distribution dist_panel({compute_hh_reflectors ? size : 0, b}, {nb_band, b}, {ranks, 1},
+                                  {rank, 0}, {0, 0});
   common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>> v_panels(n_workspaces, dist_panel);
 
   auto run_steps = [b](std::shared_ptr<BandBlock<T, true>>&& a_bl, SemaphorePtr&& sem,
                        SemaphorePtr&& sem_next, SizeType nr_steps, bool last_step,
                        SweepWorkerDist<T>& worker, const TilePtr& tile_v, SizeType j_el_tl) {
     for (SizeType step = 0; step < nr_steps; ++step) {
-      worker.compact_copy_to_tile(*tile_v, TileElementIndex(step * b, j_el_tl));
+      if (tile_v)
+        worker.compact_copy_to_tile(*tile_v, TileElementIndex(step * b, j_el_tl));
       sem->acquire();
       worker.do_step(*a_bl);
       sem_next->release(1);
@@ -1356,7 +1527,7 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
               ex::split();
           ex::start_detached(schedule_send_col(mpi_chain.shared(), prev_rank,
                                                compute_col_tag(id_block.col(), next_j == size - 1), b,
-                                               a_block, next_j, send_col_dep));
+                                               a_block, next_j, send_col_dep, col_requests));
         }
       }
       else if (rank == rank_block) {
@@ -1368,9 +1539,12 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
         auto& tile_v = tiles_v[id_block_local];
 
         if (sweep % b == 0) {
-          tile_v = panel_v.readwrite(LocalTileIndex{id_block_local, 0}) |
-                   ex::then([](Tile&& tile) { return std::make_shared<Tile>(std::move(tile)); }) |
-                   ex::drop_operation_state() | ex::split();
+          if (compute_hh_reflectors)
+            tile_v = panel_v.readwrite(LocalTileIndex{id_block_local, 0}) |
+                     ex::then([](Tile&& tile) { return std::make_shared<Tile>(std::move(tile)); }) |
+                     ex::drop_operation_state() | ex::split();
+          else
+            tile_v = ex::just(TilePtr{});
         }
 
         ex::unique_any_sender<SemaphorePtr> sem_sender;
@@ -1390,7 +1564,7 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
               ex::when_all(ex::just(sem),
                            schedule_recv_col(mpi_chain.shared(), next_rank,
                                              compute_col_tag(id_block.col(), next_j == size - 1), b,
-                                             a_block, next_j, std::move(dep_block))) |
+                                             a_block, next_j, std::move(dep_block), col_requests)) |
               ex::then([](SemaphorePtr&& sem) { sem->release(1); }));
         }
 
@@ -1441,7 +1615,7 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
       }
     }
     // send HH reflector to the correct rank.
-    if ((sweep + 1) % b == 0 || sweep + 1 == sweeps) {
+    if (compute_hh_reflectors && ((sweep + 1) % b == 0 || sweep + 1 == sweeps)) {
       const SizeType base_sweep = sweep / b * b;
       const SizeType base_sweep_steps = nrStepsForSweep(base_sweep, size, b);
 
@@ -1553,7 +1727,5 @@ TridiagResult<T, Device::CPU> BandToTridiag<Backend::MC, D, T>::call_L(
 
   num_b2t_calls++;
 #endif
-
-  return {std::move(mat_trid), std::move(mat_v)};
 }
 }
@@ -12,21 +12,66 @@
 
 #include <complex>
 
+#include <dlaf/common/round_robin.h>
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_ref.h>
+#include <dlaf/matrix/panel.h>
 #include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
 
 using matrix::internal::MatrixRef;
 
+// Workspace of the back-transformation from tridiagonal to band, holding the panels used by the steps
+// of the algorithm.
+//
+// The panels are allocated by the first call taking the workspace and they are reused by the following
+// calls (e.g. the ones of EigensolverPlan), unless their distributions change (e.g. for a different
+// number of eigenvectors), in which case they are allocated again.
+//
+// Note: the members are managed by BackTransformationT2B::call.
+template <Backend B, Device D, class T>
+struct BackTransformationT2BWorkspace {
+  template <Coord C, Device PD = D>
+  using Panels = common::RoundRobin<matrix::Panel<C, T, PD>>;
+
+  bool distributed = false;
+  matrix::Distribution dist_t;
+  matrix::Distribution dist_w;
+  matrix::Distribution dist_w2;
+
+  Panels<Coord::Col> t_panels;
+  Panels<Coord::Col> v_panels;
+  Panels<Coord::Col> w_panels;
+  Panels<Coord::Row> w2_panels;
+
+  // Used just by the distributed variant
+  Panels<Coord::Col, Device::CPU> hh_panels;
+  Panels<Coord::Row> w2tmp_panels;
+
+  // Used just by the GPU backend for computing V and W on CPU
+  Panels<Coord::Col, Device::CPU> t_panels_h;
+  Panels<Coord::Col, Device::CPU> w_panels_h;
+};
+
 template <Backend B, Device D, class T>
 struct BackTransformationT2B {
   static void call(const SizeType band_size, MatrixRef<T, D>& mat_e,
                    Matrix<const T, Device::CPU>& mat_hh);
+  static void call(const SizeType band_size, MatrixRef<T, D>& mat_e,
+                   Matrix<const T, Device::CPU>& mat_hh, BackTransformationT2BWorkspace<B, D, T>& ws);
+  static void call(const SizeType band_size, MatrixRef<T, D>& mat_e,
+                   MatrixRef<const BaseType<T>, D>& mat_e_real, Matrix<const T, Device::CPU>& mat_hh,
+                   BackTransformationT2BWorkspace<B, D, T>& ws);
   static void call(comm::CommunicatorGrid& grid, const SizeType band_size, MatrixRef<T, D>& mat_e,
                    Matrix<const T, Device::CPU>& mat_hh);
+  static void call(comm::CommunicatorGrid& grid, const SizeType band_size, MatrixRef<T, D>& mat_e,
+                   Matrix<const T, Device::CPU>& mat_hh, BackTransformationT2BWorkspace<B, D, T>& ws);
+  static void call(comm::CommunicatorGrid& grid, const SizeType band_size, MatrixRef<T, D>& mat_e,
+                   MatrixRef<const BaseType<T>, D>& mat_e_real, Matrix<const T, Device::CPU>& mat_hh,
+                   BackTransformationT2BWorkspace<B, D, T>& ws);
 };
 
 // ETI
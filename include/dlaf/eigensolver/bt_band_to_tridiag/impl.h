@@ -11,6 +11,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -37,6 +38,7 @@
 #include <dlaf/communication/kernels/p2p_allsum.h>
 #include <dlaf/eigensolver/band_to_tridiag/api.h>
 #include <dlaf/eigensolver/bt_band_to_tridiag/api.h>
+#include <dlaf/eigensolver/tridiag_solver/kernels_async.h>
 #include <dlaf/matrix/copy_tile.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/index.h>
@@ -499,6 +501,42 @@ protected:
   SizeType ij_b_row;
 };
 
+// Allocates the panels of @p ws with the given distributions, unless they have been already allocated
+// with the same ones by a previous call.
+template <Backend B, Device D, class T>
+void setupWorkspace(BackTransformationT2BWorkspace<B, D, T>& ws, const bool distributed,
+                    const matrix::Distribution& dist_t, const matrix::Distribution& dist_w,
+                    const matrix::Distribution& dist_w2) {
+  if (ws.t_panels.size() > 0 && ws.distributed == distributed && ws.dist_t == dist_t &&
+      ws.dist_w == dist_w && ws.dist_w2 == dist_w2)
+    return;
+
+  ws.distributed = distributed;
+  ws.dist_t = dist_t;
+  ws.dist_w = dist_w;
+  ws.dist_w2 = dist_w2;
+
+  constexpr std::size_t n_workspaces = 2;
+  ws.t_panels = decltype(ws.t_panels)(n_workspaces, dist_t);
+  ws.v_panels = decltype(ws.v_panels)(n_workspaces, dist_w);
+  ws.w_panels = decltype(ws.w_panels)(n_workspaces, dist_w);
+  ws.w2_panels = decltype(ws.w2_panels)(n_workspaces, dist_w2);
+
+  if (distributed) {
+    ws.hh_panels = decltype(ws.hh_panels)(n_workspaces, dist_t);
+    ws.w2tmp_panels = decltype(ws.w2tmp_panels)(n_workspaces, dist_w2);
+  }
+  else {
+    ws.hh_panels = decltype(ws.hh_panels)();
+    ws.w2tmp_panels = decltype(ws.w2tmp_panels)();
+  }
+
+  if constexpr (B == Backend::GPU) {
+    ws.t_panels_h = decltype(ws.t_panels_h)(n_workspaces, dist_t);
+    ws.w_panels_h = decltype(ws.w_panels_h)(n_workspaces, dist_w);
+  }
+}
+
 template <Backend B, Device D, class T>
 struct HHManager;
 
@@ -507,7 +545,7 @@ struct HHManager<Backend::MC, Device::CPU, T> {
   static constexpr Backend B = Backend::MC;
   static constexpr Device D = Device::CPU;
 
-  HHManager(const SizeType b, const std::size_t, matrix::Distribution, matrix::Distribution) : b(b) {}
+  HHManager(const SizeType b, BackTransformationT2BWorkspace<B, D, T>&) : b(b) {}
 
   template <class SenderHH>
   auto computeVW(const SizeType nb_apply, const LocalTileIndex ij, const TileAccessHelper& helper,
@@ -535,9 +573,8 @@ struct HHManager<Backend::GPU, Device::GPU, T> {
   static constexpr Backend B = Backend::GPU;
   static constexpr Device D = Device::GPU;
 
-  HHManager(const SizeType b, const std::size_t n_workspaces, matrix::Distribution dist_t,
-            matrix::Distribution dist_w)
-      : b(b), t_panels_h(n_workspaces, dist_t), w_panels_h(n_workspaces, dist_w) {}
+  HHManager(const SizeType b, BackTransformationT2BWorkspace<B, D, T>& ws)
+      : b(b), t_panels_h(ws.t_panels_h), w_panels_h(ws.w_panels_h) {}
 
   template <class SenderHH>
   auto computeVW(const SizeType hhr_nb, const LocalTileIndex ij, const TileAccessHelper& helper,
@@ -598,30 +635,106 @@ struct HHManager<Backend::GPU, Device::GPU, T> {
 
 protected:
   const SizeType b;
-  common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>> t_panels_h;
-  common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>> w_panels_h;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>>& t_panels_h;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>>& w_panels_h;
 };
 #endif
+
+// Initializes the tile @p tile_e of the eigenvectors from the tile @p tile_e_real of the real
+// eigenvectors (the imaginary part is set to zero if T is complex).
+template <Device D, class T, class TileSenderReal, class TileSender>
+void initEigenvectorsTile(TileSenderReal&& tile_e_real, TileSender&& tile_e) {
+  namespace ex = pika::execution::experimental;
+  using pika::execution::thread_stacksize;
+
+  if constexpr (isComplex_v<T>) {
+    castToComplexAsync<D>(std::forward<TileSenderReal>(tile_e_real), std::forward<TileSender>(tile_e));
+  }
+  else {
+    ex::start_detached(
+        ex::when_all(std::forward<TileSenderReal>(tile_e_real), std::forward<TileSender>(tile_e)) |
+        matrix::copy(dlaf::internal::Policy<matrix::internal::CopyBackend_v<D, D>>(
+            thread_stacksize::nostack)));
+  }
 }
 
+// Initializes the eigenvectors @p mat_e from the real eigenvectors @p mat_e_real one row of tiles at a
+// time, just before the first application of HH reflectors to it, so that no pass over the full matrix
+// is needed before starting the back-transformation.
+//
+// Note: if @p mat_e_real is nullptr, @p mat_e is already initialized and nothing is done.
+template <Device D, class T>
+class EigenvectorsInitializer {
+public:
+  EigenvectorsInitializer(Matrix<const BaseType<T>, D>* mat_e_real, Matrix<T, D>& mat_e)
+      : mat_e_real_(mat_e_real), mat_e_(mat_e),
+        initialized_(to_sizet(mat_e.distribution().localNrTiles().rows()), mat_e_real == nullptr) {}
+
+  // Initializes the local tiles of the row of tiles @p i_e (global index), unless already done.
+  void initRow(const SizeType i_e) {
+    const matrix::Distribution& dist = mat_e_.distribution();
+    if (dist.rankGlobalTile<Coord::Row>(i_e) != dist.rankIndex().row())
+      return;
+    initLocalRow(dist.localTileFromGlobalTile<Coord::Row>(i_e));
+  }
+
+  // Initializes the local tiles of the rows of tiles which have not been touched.
+  void initRemainingRows() {
+    for (SizeType i_lc = 0; i_lc < to_SizeType(initialized_.size()); ++i_lc)
+      initLocalRow(i_lc);
+  }
+
+private:
+  void initLocalRow(const SizeType i_lc) {
+    if (initialized_[to_sizet(i_lc)])
+      return;
+    initialized_[to_sizet(i_lc)] = true;
+
+    for (SizeType j_lc = 0; j_lc < mat_e_.distribution().localNrTiles().cols(); ++j_lc) {
+      const LocalTileIndex ij(i_lc, j_lc);
+      initEigenvectorsTile<D, T>(mat_e_real_->read(ij), mat_e_.readwrite(ij));
+    }
+  }
+
+  Matrix<const BaseType<T>, D>* mat_e_real_;
+  Matrix<T, D>& mat_e_;
+  std::vector<bool> initialized_;
+};
+
+// Initializes all the eigenvectors @p mat_e from the real eigenvectors @p mat_e_real (if not nullptr).
+template <Device D, class T>
+void initEigenvectors(MatrixRef<const BaseType<T>, D>* mat_e_real, MatrixRef<T, D>& mat_e) {
+  if (mat_e_real == nullptr)
+    return;
+
+  for (const auto& ij : common::iterate_range2d(mat_e.distribution().localNrTiles()))
+    initEigenvectorsTile<D, T>(mat_e_real->read(ij), mat_e.readwrite(ij));
+}
+
+// Back-transformation of @p mat_e. If @p mat_e_real is not nullptr, @p mat_e is initialized from it
+// during the algorithm (see EigenvectorsInitializer).
 template <Backend B, Device D, class T>
-void BackTransformationT2B<B, D, T>::call(const SizeType band_size, MatrixRef<T, D>& mat_e,
-                                          Matrix<const T, Device::CPU>& mat_hh) {
+void backTransformation(const SizeType band_size, MatrixRef<T, D>& mat_e,
+                        MatrixRef<const BaseType<T>, D>* mat_e_real,
+                        Matrix<const T, Device::CPU>& mat_hh,
+                        BackTransformationT2BWorkspace<B, D, T>& ws) {
   using pika::execution::thread_priority;
   using pika::execution::thread_stacksize;
   namespace ex = pika::execution::experimental;
 
   using common::iterate_range2d;
-  using common::RoundRobin;
-  using matrix::Panel;
   using namespace bt_tridiag;
 
-  if (mat_hh.size().isEmpty() || mat_e.size().isEmpty())
+  if (mat_hh.size().isEmpty() || mat_e.size().isEmpty()) {
+    initEigenvectors(mat_e_real, mat_e);
     return;
+  }
 
   // Note: if no householder reflectors are going to be applied (in case of trivial matrix)
-  if (mat_hh.size().rows() <= (dlaf::isComplex_v<T> ? 1 : 2))
+  if (mat_hh.size().rows() <= (dlaf::isComplex_v<T> ? 1 : 2)) {
+    initEigenvectors(mat_e_real, mat_e);
     return;
+  }
 
   const SizeType b = band_size;
   const SizeType group_size = getTuneParameters().bt_band_to_tridiag_hh_apply_group_size;
@@ -631,6 +744,10 @@ void BackTransformationT2B<B, D, T>::call(const SizeType band_size, MatrixRef<T,
   Matrix<const T, Device::CPU> mat_hh_rt = mat_hh.retiled_sub_pipeline_const(tiles_per_block_hh);
   const LocalTileSize tiles_per_block_e(mat_e.blockSize().rows() / b, 1);
   Matrix<T, D> mat_e_rt = mat_e.retiled_sub_pipeline(tiles_per_block_e);
+  std::optional<Matrix<const BaseType<T>, D>> mat_e_real_rt;
+  if (mat_e_real != nullptr)
+    mat_e_real_rt.emplace(mat_e_real->retiled_sub_pipeline_const(tiles_per_block_e));
+  EigenvectorsInitializer<D, T> init_e(mat_e_real_rt ? &*mat_e_real_rt : nullptr, mat_e_rt);
 
   const auto& dist_hh_rt = mat_hh_rt.distribution();
   const auto& dist_e_rt = mat_e_rt.distribution();
@@ -655,13 +772,13 @@ void BackTransformationT2B<B, D, T>::call(const SizeType band_size, MatrixRef<T,
   const matrix::Distribution dist_t({mat_hh_rt.size().rows(), b}, {b, b});
   const matrix::Distribution dist_w2({b, mat_e_rt.size().cols()}, {b, mat_e_rt.blockSize().cols()});
 
-  constexpr std::size_t n_workspaces = 2;
-  RoundRobin<Panel<Coord::Col, T, D>> t_panels(n_workspaces, dist_t);
-  RoundRobin<Panel<Coord::Col, T, D>> v_panels(n_workspaces, dist_w);
-  RoundRobin<Panel<Coord::Col, T, D>> w_panels(n_workspaces, dist_w);
-  RoundRobin<Panel<Coord::Row, T, D>> w2_panels(n_workspaces, dist_w2);
+  setupWorkspace(ws, false, dist_t, dist_w, dist_w2);
+  auto& t_panels = ws.t_panels;
+  auto& v_panels = ws.v_panels;
+  auto& w_panels = ws.w_panels;
+  auto& w2_panels = ws.w2_panels;
 
-  HHManager<B, D, T> helperBackend(b, n_workspaces, dist_t, dist_w);
+  HHManager<B, D, T> helperBackend(b, ws);
 
   // Note: sweep are on diagonals, steps are on verticals
   const SizeType j_last_sweep = (nsweeps - 1) / b;
@@ -704,6 +821,10 @@ void BackTransformationT2B<B, D, T>::call(const SizeType band_size, MatrixRef<T,
       auto tile_v = matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_v_unshared)));
       auto tile_w = matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_w_unshared)));
 
+      init_e.initRow(helper.topIndexE(0).row());
+      if (helper.affectsMultipleTiles())
+        init_e.initRow(helper.bottomIndexE(0).row());
+
       for (SizeType j_e = 0; j_e < dist_e_rt.nrTiles().cols(); ++j_e) {
         const auto idx_e = helper.topIndexE(j_e);
 
@@ -732,26 +853,65 @@ void BackTransformationT2B<B, D, T>::call(const SizeType band_size, MatrixRef<T,
       mat_w2.reset();
     }
   }
+
+  init_e.initRemainingRows();
+}
 }
 
 template <Backend B, Device D, class T>
-void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid& grid, const SizeType band_size,
-                                          MatrixRef<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh) {
+void BackTransformationT2B<B, D, T>::call(const SizeType band_size, MatrixRef<T, D>& mat_e,
+                                          Matrix<const T, Device::CPU>& mat_hh) {
+  BackTransformationT2BWorkspace<B, D, T> ws;
+  call(band_size, mat_e, mat_hh, ws);
+}
+
+template <Backend B, Device D, class T>
+void BackTransformationT2B<B, D, T>::call(const SizeType band_size, MatrixRef<T, D>& mat_e,
+                                          Matrix<const T, Device::CPU>& mat_hh,
+                                          BackTransformationT2BWorkspace<B, D, T>& ws) {
+  bt_tridiag::backTransformation(band_size, mat_e, nullptr, mat_hh, ws);
+}
+
+// \overload BackTransformationT2B<B, D, T>::call()
+//
+// The eigenvectors @p mat_e are set to the real eigenvectors @p mat_e_real (e.g. the ones computed by
+// the tridiagonal eigensolver) one row of tiles at a time during the algorithm, so that they are cast to
+// complex without a separate pass over the full matrix.
+template <Backend B, Device D, class T>
+void BackTransformationT2B<B, D, T>::call(const SizeType band_size, MatrixRef<T, D>& mat_e,
+                                          MatrixRef<const BaseType<T>, D>& mat_e_real,
+                                          Matrix<const T, Device::CPU>& mat_hh,
+                                          BackTransformationT2BWorkspace<B, D, T>& ws) {
+  DLAF_ASSERT(mat_e_real.distribution() == mat_e.distribution(), mat_e_real.size(), mat_e.size());
+  bt_tridiag::backTransformation(band_size, mat_e, &mat_e_real, mat_hh, ws);
+}
+
+namespace bt_tridiag {
+
+// Distributed back-transformation of @p mat_e. If @p mat_e_real is not nullptr, @p mat_e is initialized
+// from it during the algorithm (see EigenvectorsInitializer).
+template <Backend B, Device D, class T>
+void backTransformation(comm::CommunicatorGrid& grid, const SizeType band_size, MatrixRef<T, D>& mat_e,
+                        MatrixRef<const BaseType<T>, D>* mat_e_real,
+                        Matrix<const T, Device::CPU>& mat_hh,
+                        BackTransformationT2BWorkspace<B, D, T>& ws) {
   using pika::execution::thread_priority;
   using pika::execution::thread_stacksize;
   namespace ex = pika::execution::experimental;
 
   using common::iterate_range2d;
-  using common::RoundRobin;
-  using matrix::Panel;
   using namespace bt_tridiag;
 
-  if (mat_hh.size().isEmpty() || mat_e.size().isEmpty())
+  if (mat_hh.size().isEmpty() || mat_e.size().isEmpty()) {
+    initEigenvectors(mat_e_real, mat_e);
     return;
+  }
 
   // Note: if no householder reflectors are going to be applied (in case of trivial matrix)
-  if (nrSweeps<T>(mat_hh.size().rows()) == 0)
+  if (nrSweeps<T>(mat_hh.size().rows()) == 0) {
+    initEigenvectors(mat_e_real, mat_e);
     return;
+  }
 
   const SizeType b = band_size;
   const SizeType mb = mat_hh.blockSize().rows();
@@ -759,6 +919,10 @@ void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid& grid, const Si
 
   const LocalTileSize tiles_per_block(mat_e.blockSize().rows() / b, 1);
   Matrix<T, D> mat_e_rt = mat_e.retiledSubPipeline(tiles_per_block);
+  std::optional<Matrix<const BaseType<T>, D>> mat_e_real_rt;
+  if (mat_e_real != nullptr)
+    mat_e_real_rt.emplace(mat_e_real->retiledSubPipelineConst(tiles_per_block));
+  EigenvectorsInitializer<D, T> init_e(mat_e_real_rt ? &*mat_e_real_rt : nullptr, mat_e_rt);
 
   const auto& dist_hh = mat_hh.distribution();
   const auto& dist_e_rt = mat_e_rt.distribution();
@@ -785,18 +949,15 @@ void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid& grid, const Si
   const matrix::Distribution dist_ws_w2({nlocal_ws * b, mat_e_rt.size().cols()},
                                         {b, mat_e_rt.blockSize().cols()});
 
-  constexpr std::size_t n_workspaces = 2;
-
-  RoundRobin<Panel<Coord::Col, T, D>> t_panels(n_workspaces, dist_ws_hh);
-  RoundRobin<Panel<Coord::Col, T, Device::CPU>> hh_panels(n_workspaces, dist_ws_hh);
-
-  RoundRobin<Panel<Coord::Col, T, D>> v_panels(n_workspaces, dist_ws_v);
-  RoundRobin<Panel<Coord::Col, T, D>> w_panels(n_workspaces, dist_ws_v);
-
-  RoundRobin<Panel<Coord::Row, T, D>> w2_panels(n_workspaces, dist_ws_w2);
-  RoundRobin<Panel<Coord::Row, T, D>> w2tmp_panels(n_workspaces, dist_ws_w2);
+  setupWorkspace(ws, true, dist_ws_hh, dist_ws_v, dist_ws_w2);
+  auto& t_panels = ws.t_panels;
+  auto& hh_panels = ws.hh_panels;
+  auto& v_panels = ws.v_panels;
+  auto& w_panels = ws.w_panels;
+  auto& w2_panels = ws.w2_panels;
+  auto& w2tmp_panels = ws.w2tmp_panels;
 
-  HHManager<B, D, T> helperBackend(b, n_workspaces, dist_ws_hh, dist_ws_v);
+  HHManager<B, D, T> helperBackend(b, ws);
 
   // Note: This distributed algorithm encompass two communication categories:
   // 1. exchange of HH: broadcast + send p2p
@@ -941,6 +1102,10 @@ void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid& grid, const Si
       auto tile_v = matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_v_unshared)));
       auto tile_w = matrix::shareReadWriteTile(ex::make_unique_any_sender(std::move(tile_w_unshared)));
 
+      init_e.initRow(helper.topIndexE(0).row());
+      if (helper.affectsMultipleTiles())
+        init_e.initRow(helper.bottomIndexE(0).row());
+
       // UPDATE E
       for (SizeType j_e = 0; j_e < ncols_local; ++j_e) {
         const SizeType j_e_g = dist_e_rt.template globalTileFromLocalTile<Coord::Col>(j_e);
@@ -1027,5 +1192,36 @@ void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid& grid, const Si
       mat_w2.reset();
     }
   }
+
+  init_e.initRemainingRows();
+}
+}
+
+template <Backend B, Device D, class T>
+void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid& grid, const SizeType band_size,
+                                          MatrixRef<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh) {
+  BackTransformationT2BWorkspace<B, D, T> ws;
+  call(grid, band_size, mat_e, mat_hh, ws);
+}
+
+template <Backend B, Device D, class T>
+void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid& grid, const SizeType band_size,
+                                          MatrixRef<T, D>& mat_e, Matrix<const T, Device::CPU>& mat_hh,
+                                          BackTransformationT2BWorkspace<B, D, T>& ws) {
+  bt_tridiag::backTransformation(grid, band_size, mat_e, nullptr, mat_hh, ws);
+}
+
+// \overload BackTransformationT2B<B, D, T>::call()
+//
+// Distributed variant of the overload which initializes @p mat_e from the real eigenvectors
+// @p mat_e_real.
+template <Backend B, Device D, class T>
+void BackTransformationT2B<B, D, T>::call(comm::CommunicatorGrid& grid, const SizeType band_size,
+                                          MatrixRef<T, D>& mat_e,
+                                          MatrixRef<const BaseType<T>, D>& mat_e_real,
+                                          Matrix<const T, Device::CPU>& mat_hh,
+                                          BackTransformationT2BWorkspace<B, D, T>& ws) {
+  DLAF_ASSERT(mat_e_real.distribution() == mat_e.distribution(), mat_e_real.size(), mat_e.size());
+  bt_tridiag::backTransformation(grid, band_size, mat_e, &mat_e_real, mat_hh, ws);
 }
 }
@@ -12,6 +12,7 @@
 /// @file
 
 #include <utility>
+#include <vector>
 
 #include <blas.hh>
 
@@ -29,6 +30,9 @@ namespace dlaf {
 /// @pre @p eigenvalues_index_begin == 0
 /// @param[in] eigenvalues_index_end is the index of the last eigenvalue to compute (exclusive)
 /// @pre @p eigenvalues_index_begin <= @p eigenvalues_index_end < N
+///
+/// Only the columns [@p eigenvalues_index_begin, @p eigenvalues_index_end) of @p eigenvectors are
+/// set, therefore @p eigenvectors may have size (N x M) with @p eigenvalues_index_end <= M <= N.
 template <Backend B, Device D, class T>
 void hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat, Matrix<BaseType<T>, D>& eigenvalues,
                            Matrix<T, D>& eigenvectors, const SizeType eigenvalues_index_begin,
@@ -43,15 +47,16 @@ void hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat, Matrix<BaseType<T
   DLAF_ASSERT(matrix::single_tile_per_block(eigenvalues), eigenvalues);
   DLAF_ASSERT(eigenvalues.block_size().rows() == eigenvectors.block_size().rows(), eigenvalues,
               eigenvectors);
-  DLAF_ASSERT(eigenvectors.size() == mat.size(), eigenvectors, mat);
-  DLAF_ASSERT(matrix::square_size(eigenvectors), eigenvectors);
+  DLAF_ASSERT(eigenvectors.size().rows() == mat.size().rows(), eigenvectors, mat);
+  DLAF_ASSERT(eigenvectors.size().cols() <= mat.size().cols(), eigenvectors, mat);
   DLAF_ASSERT(matrix::single_tile_per_block(eigenvectors), eigenvectors);
   DLAF_ASSERT(matrix::square_block_size(eigenvectors), eigenvectors);
   DLAF_ASSERT(eigenvectors.block_size() == mat.block_size(), eigenvectors, mat);
   DLAF_ASSERT(eigenvalues_index_begin == 0, eigenvalues_index_begin);
   DLAF_ASSERT(eigenvalues_index_end >= eigenvalues_index_begin, eigenvalues_index_end,
               eigenvalues_index_begin);
-  DLAF_ASSERT(eigenvalues_index_end <= mat.size().rows(), eigenvalues_index_end, mat.size().rows());
+  DLAF_ASSERT(eigenvalues_index_end <= eigenvectors.size().cols(), eigenvalues_index_end,
+              eigenvectors.size().cols());
 
   eigensolver::internal::Eigensolver<B, D, T>::call(uplo, mat, eigenvalues, eigenvectors,
                                                     eigenvalues_index_begin, eigenvalues_index_end);
@@ -62,8 +67,9 @@ void hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat, Matrix<BaseType<T
 /// It solves the standard eigenvalue problem A * x = lambda * x.
 ///
 /// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
-/// including the diagonal, is destroyed. @p eigenvalues will contain all the eigenvalues
-/// lambda, while @p eigenvectors will contain all the corresponding eigenvectors x.
+/// including the diagonal, is destroyed.
+/// @p eigenvalues will contain all the eigenvalues lambda, while @p eigenvectors will contain all
+/// the corresponding eigenvectors x.
 ///
 /// Implementation on local memory.
 ///
@@ -98,6 +104,8 @@ void hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat, Matrix<BaseType<T
 /// @pre @p eigenvalues_index_begin == 0
 /// @param[in] eigenvalues_index_end is the index of the last eigenvalue to compute (exclusive)
 /// @pre @p eigenvalues_index_begin <= @p eigenvalues_index_end < N
+///
+/// The eigenvectors of the result have size (N x @p eigenvalues_index_end).
 template <Backend B, Device D, class T>
 EigensolverResult<T, D> hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat,
                                               const SizeType eigenvalues_index_begin,
@@ -105,7 +113,7 @@ EigensolverResult<T, D> hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat
   const SizeType size = mat.size().rows();
   matrix::Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(size, 1),
                                              TileElementSize(mat.tile_size().rows(), 1));
-  matrix::Matrix<T, D> eigenvectors(LocalElementSize(size, size), mat.tile_size());
+  matrix::Matrix<T, D> eigenvectors(LocalElementSize(size, eigenvalues_index_end), mat.tile_size());
 
   hermitian_eigensolver<B, D, T>(uplo, mat, eigenvalues, eigenvectors, eigenvalues_index_begin,
                                  eigenvalues_index_end);
@@ -135,6 +143,55 @@ EigensolverResult<T, D> hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat
   return hermitian_eigensolver<B, D, T>(uplo, mat, 0l, mat.size().rows());
 }
 
+/// Batched Standard Eigensolver.
+///
+/// It solves the standard eigenvalue problems A_k * x = lambda * x for all the matrices A_k in @p mats.
+///
+/// The algorithms of all the problems are scheduled before waiting for any of them, so that their
+/// tasks are executed concurrently by the runtime. This allows to use all the available resources
+/// when each single problem is too small to do so.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of each matrix in
+/// @p mats, including the diagonal, is destroyed.
+///
+/// Implementation on local memory.
+///
+/// @return a vector containing the EigensolverResult of each problem, in the same order as @p mats
+///
+/// @param uplo specifies if upper or lower triangular part of the matrices will be referenced
+///
+/// @param[in,out] mats contains the Hermitian matrices A_k
+/// @pre each matrix in @p mats is not distributed
+/// @pre each matrix in @p mats has size (N_k x N_k)
+/// @pre each matrix in @p mats has block size (NB_k x NB_k)
+/// @pre each matrix in @p mats has tile size (NB_k x NB_k)
+template <Backend B, Device D, class T>
+std::vector<EigensolverResult<T, D>> hermitian_eigensolver_batched(blas::Uplo uplo,
+                                                                   std::vector<Matrix<T, D>>& mats) {
+  std::vector<EigensolverResult<T, D>> results;
+  results.reserve(mats.size());
+
+  for (auto& mat : mats) {
+    DLAF_ASSERT(matrix::local_matrix(mat), mat);
+    DLAF_ASSERT(matrix::square_size(mat), mat);
+    DLAF_ASSERT(matrix::single_tile_per_block(mat), mat);
+    DLAF_ASSERT(matrix::square_block_size(mat), mat);
+
+    const SizeType size = mat.size().rows();
+    auto& result = results.emplace_back(
+        EigensolverResult<T, D>{Matrix<BaseType<T>, D>(LocalElementSize(size, 1),
+                                                       TileElementSize(mat.tile_size().rows(), 1)),
+                                Matrix<T, D>(LocalElementSize(size, size), mat.tile_size())});
+
+    // Note: the local eigensolver only schedules its tasks, therefore the pipelines of the different
+    // problems end up in the same task graph.
+    eigensolver::internal::Eigensolver<B, D, T>::call(uplo, mat, result.eigenvalues,
+                                                      result.eigenvectors, 0l, size);
+  }
+
+  return results;
+}
+
 /// @copydoc hermitian_eigensolver(comm::CommunicatorGrid&, blas::Uplo, Matrix<T, D>&,
 /// Matrix<BaseType<T>, D>&, Matrix<T, D>&)
 ///
@@ -142,6 +199,9 @@ EigensolverResult<T, D> hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat
 /// @pre @p eigenvalues_index_begin == 0
 /// @param[in] eigenvalues_index_end is the index of the last eigenvalue to compute (exclusive)
 /// @pre @p eigenvalues_index_begin <= @p eigenvalues_index_end < N
+///
+/// Only the columns [@p eigenvalues_index_begin, @p eigenvalues_index_end) of @p eigenvectors are
+/// set, therefore @p eigenvectors may have size (N x M) with @p eigenvalues_index_end <= M <= N.
 template <Backend B, Device D, class T>
 void hermitian_eigensolver(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix<T, D>& mat,
                            Matrix<BaseType<T>, D>& eigenvalues, Matrix<T, D>& eigenvectors,
@@ -157,15 +217,16 @@ void hermitian_eigensolver(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix
   DLAF_ASSERT(matrix::single_tile_per_block(eigenvalues), eigenvalues);
   DLAF_ASSERT(eigenvalues.block_size().rows() == eigenvectors.block_size().rows(), eigenvalues,
               eigenvectors);
-  DLAF_ASSERT(eigenvectors.size() == mat.size(), eigenvectors, mat);
-  DLAF_ASSERT(matrix::square_size(eigenvectors), eigenvectors);
+  DLAF_ASSERT(eigenvectors.size().rows() == mat.size().rows(), eigenvectors, mat);
+  DLAF_ASSERT(eigenvectors.size().cols() <= mat.size().cols(), eigenvectors, mat);
   DLAF_ASSERT(matrix::single_tile_per_block(eigenvectors), eigenvectors);
   DLAF_ASSERT(matrix::square_block_size(eigenvectors), eigenvectors);
   DLAF_ASSERT(eigenvectors.block_size() == mat.block_size(), eigenvectors, mat);
   DLAF_ASSERT(eigenvalues_index_begin == 0, eigenvalues_index_begin);
   DLAF_ASSERT(eigenvalues_index_end >= eigenvalues_index_begin, eigenvalues_index_end,
               eigenvalues_index_begin);
-  DLAF_ASSERT(eigenvalues_index_end <= mat.size().rows(), eigenvalues_index_end, mat.size().rows());
+  DLAF_ASSERT(eigenvalues_index_end <= eigenvectors.size().cols(), eigenvalues_index_end,
+              eigenvectors.size().cols());
 
   eigensolver::internal::Eigensolver<B, D, T>::call(grid, uplo, mat, eigenvalues, eigenvectors,
                                                     eigenvalues_index_begin, eigenvalues_index_end);
@@ -176,8 +237,9 @@ void hermitian_eigensolver(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix
 /// It solves the standard eigenvalue problem A * x = lambda * x.
 ///
 /// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
-/// including the diagonal, is destroyed. @p eigenvalues will contain all the eigenvalues
-/// lambda, while @p eigenvectors will contain all the corresponding eigenvectors x.
+/// including the diagonal, is destroyed.
+/// @p eigenvalues will contain all the eigenvalues lambda, while @p eigenvectors will contain all
+/// the corresponding eigenvectors x.
 ///
 /// Implementation on distributed memory.
 ///
@@ -214,6 +276,8 @@ void hermitian_eigensolver(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix
 /// @pre @p eigenvalues_index_begin == 0
 /// @param[in] eigenvalues_index_end is the index of the last eigenvalue to compute (exclusive)
 /// @pre @p eigenvalues_index_begin <= @p eigenvalues_index_end < N
+///
+/// The eigenvectors of the result have size (N x @p eigenvalues_index_end).
 template <Backend B, Device D, class T>
 EigensolverResult<T, D> hermitian_eigensolver(comm::CommunicatorGrid& grid, blas::Uplo uplo,
                                               Matrix<T, D>& mat, const SizeType eigenvalues_index_begin,
@@ -221,7 +285,8 @@ EigensolverResult<T, D> hermitian_eigensolver(comm::CommunicatorGrid& grid, blas
   const SizeType size = mat.size().rows();
   matrix::Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(size, 1),
                                              TileElementSize(mat.tile_size().rows(), 1));
-  matrix::Matrix<T, D> eigenvectors(GlobalElementSize(size, size), mat.tile_size(), grid);
+  matrix::Matrix<T, D> eigenvectors(GlobalElementSize(size, eigenvalues_index_end), mat.tile_size(),
+                                    grid);
 
   hermitian_eigensolver<B, D, T>(grid, uplo, mat, eigenvalues, eigenvectors, eigenvalues_index_begin,
                                  eigenvalues_index_end);
@@ -253,4 +318,270 @@ EigensolverResult<T, D> hermitian_eigensolver(comm::CommunicatorGrid& grid, blas
                                               Matrix<T, D>& mat) {
   return hermitian_eigensolver<B, D, T>(grid, uplo, mat, 0l, mat.size().rows());
 }
+
+/// Standard Eigensolver (eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the standard eigenvalue problem A * x = lambda * x.
+/// The eigenvectors are not computed, therefore the HH reflectors of the band to tridiagonal
+/// reduction are not stored and the back-transformation steps are skipped.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+/// @p eigenvalues will contain all the eigenvalues lambda.
+///
+/// Implementation on local memory.
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+///
+/// @param[in,out] mat contains the Hermitian matrix A
+/// @pre @p mat is not distributed
+/// @pre @p mat has size (N x N)
+/// @pre @p mat has block size (NB x NB)
+/// @pre @p mat has tile size (NB x NB)
+///
+/// @param[out] eigenvalues contains the eigenvalues
+/// @pre @p eigenvalues is not distributed
+/// @pre @p eigenvalues has size (N x 1)
+/// @pre @p eigenvalues has block size (NB x 1)
+/// @pre @p eigenvalues has tile size (NB x 1)
+template <Backend B, Device D, class T>
+void hermitian_eigenvalues(blas::Uplo uplo, Matrix<T, D>& mat, Matrix<BaseType<T>, D>& eigenvalues) {
+  DLAF_ASSERT(matrix::local_matrix(mat), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(matrix::square_size(mat), mat);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat), mat);
+  DLAF_ASSERT(matrix::square_block_size(mat), mat);
+  DLAF_ASSERT(eigenvalues.size().rows() == mat.size().rows(), eigenvalues, mat);
+  DLAF_ASSERT(eigenvalues.size().cols() == 1, eigenvalues);
+  DLAF_ASSERT(matrix::single_tile_per_block(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.block_size().rows() == mat.block_size().rows(), eigenvalues, mat);
+
+  eigensolver::internal::Eigensolver<B, D, T>::call(uplo, mat, eigenvalues);
+}
+
+/// Standard Eigensolver (eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the standard eigenvalue problem A * x = lambda * x.
+/// The eigenvectors are not computed.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+///
+/// Implementation on local memory.
+///
+/// @return the eigenvalues as a local (N x 1) Matrix
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+///
+/// @param[in,out] mat contains the Hermitian matrix A
+/// @pre @p mat is not distributed
+/// @pre @p mat has size (N x N)
+/// @pre @p mat has block size (NB x NB)
+/// @pre @p mat has tile size (NB x NB)
+template <Backend B, Device D, class T>
+Matrix<BaseType<T>, D> hermitian_eigenvalues(blas::Uplo uplo, Matrix<T, D>& mat) {
+  const SizeType size = mat.size().rows();
+  matrix::Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(size, 1),
+                                             TileElementSize(mat.tile_size().rows(), 1));
+
+  hermitian_eigenvalues<B, D, T>(uplo, mat, eigenvalues);
+  return eigenvalues;
+}
+
+/// Standard Eigensolver (eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the standard eigenvalue problem A * x = lambda * x.
+/// The eigenvectors are not computed, therefore the HH reflectors of the band to tridiagonal
+/// reduction are not stored and the back-transformation steps are skipped.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+/// @p eigenvalues will contain all the eigenvalues lambda.
+///
+/// Implementation on distributed memory.
+///
+/// @param grid is the communicator grid on which the matrix @p mat has been distributed
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+///
+/// @param[in,out] mat contains the Hermitian matrix A
+/// @pre @p mat is distributed according to @p grid
+/// @pre @p mat has size (N x N)
+/// @pre @p mat has block size (NB x NB)
+/// @pre @p mat has tile size (NB x NB)
+///
+/// @param[out] eigenvalues contains the eigenvalues
+/// @pre @p eigenvalues is stored on all ranks
+/// @pre @p eigenvalues has size (N x 1)
+/// @pre @p eigenvalues has block size (NB x 1)
+/// @pre @p eigenvalues has tile size (NB x 1)
+template <Backend B, Device D, class T>
+void hermitian_eigenvalues(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix<T, D>& mat,
+                           Matrix<BaseType<T>, D>& eigenvalues) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat, grid), mat);
+  DLAF_ASSERT(matrix::local_matrix(eigenvalues), eigenvalues);
+  DLAF_ASSERT(matrix::square_size(mat), mat);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat), mat);
+  DLAF_ASSERT(matrix::square_block_size(mat), mat);
+  DLAF_ASSERT(eigenvalues.size().rows() == mat.size().rows(), eigenvalues, mat);
+  DLAF_ASSERT(eigenvalues.size().cols() == 1, eigenvalues);
+  DLAF_ASSERT(matrix::single_tile_per_block(eigenvalues), eigenvalues);
+  DLAF_ASSERT(eigenvalues.block_size().rows() == mat.block_size().rows(), eigenvalues, mat);
+
+  eigensolver::internal::Eigensolver<B, D, T>::call(grid, uplo, mat, eigenvalues);
+}
+
+/// Standard Eigensolver (eigenvalues only).
+///
+/// It computes the eigenvalues lambda of the standard eigenvalue problem A * x = lambda * x.
+/// The eigenvectors are not computed.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+///
+/// Implementation on distributed memory.
+///
+/// @return the eigenvalues as a (N x 1) Matrix stored on all ranks
+///
+/// @param grid is the communicator grid on which the matrix @p mat has been distributed
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+///
+/// @param[in,out] mat contains the Hermitian matrix A
+/// @pre @p mat is distributed according to @p grid
+/// @pre @p mat has size (N x N)
+/// @pre @p mat has block size (NB x NB)
+/// @pre @p mat has tile size (NB x NB)
+template <Backend B, Device D, class T>
+Matrix<BaseType<T>, D> hermitian_eigenvalues(comm::CommunicatorGrid& grid, blas::Uplo uplo,
+                                             Matrix<T, D>& mat) {
+  const SizeType size = mat.size().rows();
+  matrix::Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(size, 1),
+                                             TileElementSize(mat.tile_size().rows(), 1));
+
+  hermitian_eigenvalues<B, D, T>(grid, uplo, mat, eigenvalues);
+  return eigenvalues;
+}
+
+/// Standard Eigensolver using the preallocated workspaces of @p plan.
+///
+/// It solves the standard eigenvalue problem A * x = lambda * x like
+/// hermitian_eigensolver(blas::Uplo, Matrix<T, D>&), but the results and the main intermediate
+/// matrices are the ones owned by @p plan, which can be reused for solving several problems of the
+/// same size and distribution without reallocating them.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+///
+/// Implementation on local memory.
+///
+/// @return a reference to the result owned by @p plan, which is overwritten by the next call using it
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+///
+/// @param[in,out] mat contains the Hermitian matrix A
+/// @pre @p mat is not distributed
+/// @pre @p mat has size (N x N)
+/// @pre @p mat has block size (NB x NB)
+/// @pre @p mat has tile size (NB x NB)
+///
+/// @param plan contains the workspaces
+/// @pre @p plan has been constructed with the distribution of @p mat
+///
+/// @param[in] eigenvalues_index_begin is the index of the first eigenvalue to compute
+/// @pre @p eigenvalues_index_begin == 0
+/// @param[in] eigenvalues_index_end is the index of the last eigenvalue to compute (exclusive)
+/// @pre @p eigenvalues_index_begin <= @p eigenvalues_index_end <= M, where M is the number of
+/// eigenvectors the plan has been constructed for
+template <Backend B, Device D, class T>
+EigensolverResult<T, D>& hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat,
+                                               EigensolverPlan<B, D, T>& plan,
+                                               const SizeType eigenvalues_index_begin,
+                                               const SizeType eigenvalues_index_end) {
+  DLAF_ASSERT(matrix::local_matrix(mat), mat);
+  DLAF_ASSERT(matrix::square_size(mat), mat);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat), mat);
+  DLAF_ASSERT(matrix::square_block_size(mat), mat);
+  DLAF_ASSERT(plan.distribution() == mat.distribution(), mat, plan.result().eigenvectors);
+  DLAF_ASSERT(eigenvalues_index_begin == 0, eigenvalues_index_begin);
+  DLAF_ASSERT(eigenvalues_index_end >= eigenvalues_index_begin, eigenvalues_index_end,
+              eigenvalues_index_begin);
+  DLAF_ASSERT(eigenvalues_index_end <= plan.result().eigenvectors.size().cols(), eigenvalues_index_end,
+              plan.result().eigenvectors.size().cols());
+
+  eigensolver::internal::Eigensolver<B, D, T>::call(uplo, mat, plan, eigenvalues_index_begin,
+                                                    eigenvalues_index_end);
+  return plan.result();
+}
+
+/// @copydoc hermitian_eigensolver(blas::Uplo, Matrix<T, D>&, EigensolverPlan<B, D, T>&, const SizeType,
+///                                const SizeType)
+template <Backend B, Device D, class T>
+EigensolverResult<T, D>& hermitian_eigensolver(blas::Uplo uplo, Matrix<T, D>& mat,
+                                               EigensolverPlan<B, D, T>& plan) {
+  return hermitian_eigensolver<B, D, T>(uplo, mat, plan, 0l,
+                                        plan.result().eigenvectors.size().cols());
+}
+
+/// Standard Eigensolver using the preallocated workspaces of @p plan.
+///
+/// It solves the standard eigenvalue problem A * x = lambda * x like
+/// hermitian_eigensolver(comm::CommunicatorGrid&, blas::Uplo, Matrix<T, D>&), but the results and
+/// the main intermediate matrices are the ones owned by @p plan, which can be reused for solving
+/// several problems of the same size and distribution without reallocating them.
+///
+/// On exit, the lower triangle or the upper triangle (depending on @p uplo) of @p mat_a,
+/// including the diagonal, is destroyed.
+///
+/// Implementation on distributed memory.
+///
+/// @return a reference to the result owned by @p plan, which is overwritten by the next call using it
+///
+/// @param grid is the communicator grid on which the matrix @p mat has been distributed
+///
+/// @param uplo specifies if upper or lower triangular part of @p mat will be referenced
+///
+/// @param[in,out] mat contains the Hermitian matrix A
+/// @pre @p mat is distributed according to @p grid
+/// @pre @p mat has size (N x N)
+/// @pre @p mat has block size (NB x NB)
+/// @pre @p mat has tile size (NB x NB)
+///
+/// @param plan contains the workspaces
+/// @pre @p plan has been constructed with the distribution of @p mat
+///
+/// @param[in] eigenvalues_index_begin is the index of the first eigenvalue to compute
+/// @pre @p eigenvalues_index_begin == 0
+/// @param[in] eigenvalues_index_end is the index of the last eigenvalue to compute (exclusive)
+/// @pre @p eigenvalues_index_begin <= @p eigenvalues_index_end <= M, where M is the number of
+/// eigenvectors the plan has been constructed for
+template <Backend B, Device D, class T>
+EigensolverResult<T, D>& hermitian_eigensolver(comm::CommunicatorGrid& grid, blas::Uplo uplo,
+                                               Matrix<T, D>& mat, EigensolverPlan<B, D, T>& plan,
+                                               const SizeType eigenvalues_index_begin,
+                                               const SizeType eigenvalues_index_end) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat, grid), mat, grid);
+  DLAF_ASSERT(matrix::square_size(mat), mat);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat), mat);
+  DLAF_ASSERT(matrix::square_block_size(mat), mat);
+  DLAF_ASSERT(plan.distribution() == mat.distribution(), mat, plan.result().eigenvectors);
+  DLAF_ASSERT(eigenvalues_index_begin == 0, eigenvalues_index_begin);
+  DLAF_ASSERT(eigenvalues_index_end >= eigenvalues_index_begin, eigenvalues_index_end,
+              eigenvalues_index_begin);
+  DLAF_ASSERT(eigenvalues_index_end <= plan.result().eigenvectors.size().cols(), eigenvalues_index_end,
+              plan.result().eigenvectors.size().cols());
+
+  eigensolver::internal::Eigensolver<B, D, T>::call(grid, uplo, mat, plan, eigenvalues_index_begin,
+                                                    eigenvalues_index_end);
+  return plan.result();
+}
+
+/// @copydoc hermitian_eigensolver(comm::CommunicatorGrid&, blas::Uplo, Matrix<T, D>&,
+///                                EigensolverPlan<B, D, T>&, const SizeType, const SizeType)
+template <Backend B, Device D, class T>
+EigensolverResult<T, D>& hermitian_eigensolver(comm::CommunicatorGrid& grid, blas::Uplo uplo,
+                                               Matrix<T, D>& mat, EigensolverPlan<B, D, T>& plan) {
+  return hermitian_eigensolver<B, D, T>(grid, uplo, mat, plan, 0l,
+                                        plan.result().eigenvectors.size().cols());
+}
 }
@@ -11,15 +11,26 @@
 #pragma once
 
 #include <complex>
+#include <optional>
 
 #include <dlaf/blas/tile.h>
+#include <dlaf/common/round_robin.h>
 #include <dlaf/common/vector.h>
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/eigensolver/band_to_tridiag/api.h>
+#include <dlaf/eigensolver/bt_band_to_tridiag/api.h>
+#include <dlaf/eigensolver/internal/get_band_size.h>
+#include <dlaf/eigensolver/reduction_to_band/api.h>
+#include <dlaf/eigensolver/tridiag_solver/api.h>
+#include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 
 namespace dlaf {
 
+/// Eigenvalues (N x 1) and eigenvectors (N x M) of a standard or generalized eigenvalue problem.
+///
+/// The eigenvectors have M = N columns, unless only the first M eigenvectors have been requested.
 template <class T, Device D>
 struct EigensolverResult {
   Matrix<BaseType<T>, D> eigenvalues;
@@ -28,14 +39,127 @@ struct EigensolverResult {
 
 namespace eigensolver::internal {
 
+// Tiles used as temporary storage by swapTriangles (a few tiles reused in a round-robin fashion).
+template <class T, Device D>
+using SwapTrianglesWorkspace = common::RoundRobin<Matrix<T, D>>;
+}
+
+/// Workspace of the standard eigensolver for repeated calls on matrices with the same distribution.
+///
+/// It owns the results (eigenvalues and eigenvectors), the intermediate matrices of the reduction to
+/// band (taus) and of the band to tridiagonal reduction (tridiagonal matrix and HH reflectors), and the
+/// workspaces internal to the steps (the panels of the reduction to band and of the
+/// back-transformation from tridiagonal to band, the matrices of the tridiagonal eigensolver and the
+/// tiles used to handle matrices stored in the upper triangle).
+/// The results and the intermediate matrices are allocated once on construction, the workspaces by
+/// the first hermitian_eigensolver call taking the plan, and all of them are reused by the following
+/// calls.
+template <Backend B, Device D, class T>
+class EigensolverPlan {
+public:
+  /// Allocates the workspaces for solving the eigenvalue problem of a matrix distributed as @p dist_a.
+  ///
+  /// Only the first @p nr_eigenvectors eigenvectors can be computed by the calls using this plan
+  /// (i.e. their eigenvalues_index_end has to be <= @p nr_eigenvectors), therefore the eigenvectors
+  /// of the result have size (N x @p nr_eigenvectors).
+  ///
+  /// @pre @p dist_a has square size, square block size and a single tile per block.
+  /// @pre 0 <= @p nr_eigenvectors <= N.
+  explicit EigensolverPlan(const matrix::Distribution& dist_a, const SizeType nr_eigenvectors)
+      : dist_a_(dist_a), band_size_(eigensolver::internal::getBandSize(dist_a.block_size().rows())),
+        mat_taus_(eigensolver::internal::reductionToBandTausDistribution(dist_a, band_size_)),
+        tridiag_(eigensolver::internal::makeTridiagResult<T>(dist_a, true)),
+        result_{Matrix<BaseType<T>, D>(LocalElementSize(dist_a.size().rows(), 1),
+                                       TileElementSize(dist_a.tile_size().rows(), 1)),
+                Matrix<T, D>(matrix::Distribution(
+                    GlobalElementSize(dist_a.size().rows(), nr_eigenvectors), dist_a.block_size(),
+                    dist_a.tile_size(), dist_a.grid_size(), dist_a.rank_index(),
+                    dist_a.source_rank_index()))},
+        tridiag_solver_ws_(dist_a) {
+    DLAF_ASSERT(nr_eigenvectors >= 0 && nr_eigenvectors <= dist_a.size().rows(), nr_eigenvectors,
+                dist_a.size().rows());
+  }
+
+  /// Allocates the workspaces for solving the eigenvalue problem of a matrix distributed as @p dist_a,
+  /// including all its (N x N) eigenvectors.
+  ///
+  /// @pre @p dist_a has square size, square block size and a single tile per block.
+  explicit EigensolverPlan(const matrix::Distribution& dist_a)
+      : EigensolverPlan(dist_a, dist_a.size().rows()) {}
+
+  /// Returns the distribution of the matrices that can be solved using this plan.
+  const matrix::Distribution& distribution() const noexcept {
+    return dist_a_;
+  }
+
+  /// Returns the band size used by the reduction to band.
+  SizeType band_size() const noexcept {
+    return band_size_;
+  }
+
+  /// Returns the eigenvalues and eigenvectors computed by the last call using this plan.
+  EigensolverResult<T, D>& result() noexcept {
+    return result_;
+  }
+
+  Matrix<T, D>& taus() noexcept {
+    return mat_taus_;
+  }
+
+  eigensolver::internal::TridiagResult<T, Device::CPU>& tridiag() noexcept {
+    return tridiag_;
+  }
+
+  eigensolver::internal::ReductionToBandWorkspace<B, D, T>& red2band_workspace() noexcept {
+    return red2band_ws_;
+  }
+
+  eigensolver::internal::TridiagSolverWorkspace<BaseType<T>, D>& tridiag_solver_workspace() noexcept {
+    return tridiag_solver_ws_;
+  }
+
+  eigensolver::internal::BackTransformationT2BWorkspace<B, D, T>&
+  bt_band_to_tridiag_workspace() noexcept {
+    return bt_band_to_tridiag_ws_;
+  }
+
+  /// Returns the workspace for matrices stored in the upper triangle, which is allocated by the first
+  /// call with blas::Uplo::Upper.
+  std::optional<eigensolver::internal::SwapTrianglesWorkspace<T, D>>&
+  swap_triangles_workspace() noexcept {
+    return swap_triangles_ws_;
+  }
+
+private:
+  matrix::Distribution dist_a_;
+  SizeType band_size_;
+  Matrix<T, D> mat_taus_;
+  eigensolver::internal::TridiagResult<T, Device::CPU> tridiag_;
+  EigensolverResult<T, D> result_;
+  eigensolver::internal::ReductionToBandWorkspace<B, D, T> red2band_ws_;
+  eigensolver::internal::TridiagSolverWorkspace<BaseType<T>, D> tridiag_solver_ws_;
+  eigensolver::internal::BackTransformationT2BWorkspace<B, D, T> bt_band_to_tridiag_ws_;
+  std::optional<eigensolver::internal::SwapTrianglesWorkspace<T, D>> swap_triangles_ws_;
+};
+
+namespace eigensolver::internal {
+
 template <Backend B, Device D, class T>
 struct Eigensolver {
+  static void call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals);
   static void call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
                    Matrix<T, D>& mat_e, const SizeType eigenvalues_index_begin,
                    const SizeType eigenvalues_index_end);
+  static void call(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                   Matrix<BaseType<T>, D>& evals);
   static void call(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
                    Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
                    const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end);
+  static void call(blas::Uplo uplo, Matrix<T, D>& mat_a, EigensolverPlan<B, D, T>& plan,
+                   const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end);
+  static void call(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
+                   EigensolverPlan<B, D, T>& plan, const SizeType eigenvalues_index_begin,
+                   const SizeType eigenvalues_index_end);
 };
 
 // ETI
@@ -0,0 +1,228 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include <pika/execution.hpp>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/error.h>
+#include <dlaf/matrix/copy.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/hdf5.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
+
+namespace dlaf::eigensolver::internal {
+
+// Stages of the distributed eigensolver after which a checkpoint is stored, in execution order.
+enum class EigensolverStage : SizeType {
+  none = 0,
+  reduction_to_band = 1,
+  band_to_tridiagonal = 2,
+  tridiagonal_eigensolver = 3,
+};
+
+// Checkpoint/restart of the distributed eigensolver in the HDF5 file
+// TuneParameters::eigensolver_checkpoint_file (checkpointing is disabled if it is empty).
+//
+// After each stage the intermediate results needed by the following stages are stored in the file
+// (with save), and once all of them have been written the stage is marked as completed (with
+// markCompleted). A subsequent call on the same problem restores the results of the completed stages
+// (with restore) and resumes from the first stage not completed.
+// Saving the results of a stage which is already completed is a no-op, so that the same code path is
+// used by the initial call and by the restarted one.
+// Once the eigensolver has completed, the checkpoint is marked as finished (with finish), so that the
+// following calls do not restore its results, and the file is discarded by the next call.
+//
+// Note: the file stores the parameters of the problem (size, block size, band size and range of
+// eigenvalues) and it can be used only for restarting exactly the same problem.
+template <class T>
+class EigensolverCheckpoint {
+public:
+  EigensolverCheckpoint(comm::CommunicatorGrid& grid, const matrix::Distribution& dist_a,
+                        const SizeType band_size, const SizeType eigenvalues_index_begin,
+                        const SizeType eigenvalues_index_end) {
+    const std::string& filepath = getTuneParameters().eigensolver_checkpoint_file;
+    if (filepath.empty())
+      return;
+
+#ifdef DLAF_WITH_HDF5
+    using matrix::internal::FileHDF5;
+
+    // The file might be visible only to some of the ranks (e.g. on node-local storage), therefore
+    // rank 0 decides whether it is a restart, so that all ranks open the file in the same mode.
+    comm::Communicator& comm = grid.fullCommunicator();
+    int restart_flag = comm.rank() == 0 && std::filesystem::exists(filepath) ? 1 : 0;
+    DLAF_MPI_CHECK_ERROR(MPI_Bcast(&restart_flag, 1, MPI_INT, 0, comm));
+    bool restart = restart_flag != 0;
+
+    if (restart) {
+      file_.emplace(comm, filepath, FileHDF5::FileMode::append);
+      completed_ = static_cast<EigensolverStage>(file_->readAttribute("stage").value_or(0));
+
+      // Nothing can be restored from a finished (or interrupted before completing any stage) call,
+      // hence the file is discarded, also reclaiming the space of its datasets.
+      if (completed_ == EigensolverStage::none) {
+        file_.reset();
+        if (comm.rank() == 0)
+          std::filesystem::remove(filepath);
+        DLAF_MPI_CHECK_ERROR(MPI_Barrier(comm));
+        restart = false;
+      }
+    }
+
+    if (!restart)
+      file_.emplace(comm, filepath, FileHDF5::FileMode::readwrite);
+
+    // Note: the check is performed also in release builds, since restarting a different problem
+    // would silently produce wrong results. All ranks read the same attributes, hence they all throw.
+    auto check_or_write = [this, restart](const std::string& name, const SizeType value) {
+      if (restart) {
+        const auto value_file = file_->readAttribute(name);
+        if (value_file != value)
+          throw std::runtime_error("The checkpoint file refers to a different problem: " + name +
+                                   " is " + std::to_string(value_file.value_or(-1)) +
+                                   " in the file, but " + std::to_string(value) + " is expected.");
+      }
+      else {
+        file_->writeAttribute(name, value);
+      }
+    };
+
+    check_or_write("type", static_cast<SizeType>(matrix::internal::TypeToString_v<T>[0]));
+    check_or_write("size", dist_a.size().rows());
+    check_or_write("block_size", dist_a.block_size().rows());
+    check_or_write("band_size", band_size);
+    check_or_write("eigenvalues_index_begin", eigenvalues_index_begin);
+    check_or_write("eigenvalues_index_end", eigenvalues_index_end);
+#else
+    dlaf::internal::silenceUnusedWarningFor(grid, dist_a, band_size, eigenvalues_index_begin,
+                                            eigenvalues_index_end);
+    throw std::runtime_error("Checkpointing (eigensolver_checkpoint_file = " + filepath +
+                             ") requires DLA-Future built with HDF5 support.");
+#endif
+  }
+
+  // Returns true if @p stage has been completed by a previous call and its results can be restored.
+  bool completed(const EigensolverStage stage) const noexcept {
+    return completed_ >= stage;
+  }
+
+  // Stores @p mat as the result @p name of @p stage, unless the checkpointing is disabled or the
+  // stage is already completed.
+  //
+  // Note: the write is asynchronous and it only reads the tiles of @p mat, therefore the tasks of the
+  // next stages which only read @p mat can be scheduled before calling it, so that their execution
+  // overlaps with the write. It is completed by markCompleted.
+  template <class U, Device D>
+  void save(const EigensolverStage stage, const std::string& name, Matrix<const U, D>& mat) {
+#ifdef DLAF_WITH_HDF5
+    namespace ex = pika::execution::experimental;
+
+    if (!file_ || completed(stage))
+      return;
+
+    // A previous run might have been interrupted while writing the results of this stage.
+    const std::string dataset_name = datasetName(stage, name);
+    if (file_->exists(dataset_name))
+      file_->remove(dataset_name);
+
+    if constexpr (D == Device::CPU) {
+      writes_.emplace_back(file_->writeAsync(mat, dataset_name));
+    }
+    else {
+      // Note: the host copy is kept alive until it has been written.
+      auto mat_host = std::make_shared<Matrix<U, Device::CPU>>(mat.distribution());
+      matrix::copy(mat, *mat_host);
+      writes_.emplace_back(file_->writeAsync(*mat_host, dataset_name) | ex::then([mat_host]() {}));
+    }
+#else
+    dlaf::internal::silenceUnusedWarningFor(stage, name, mat);
+#endif
+  }
+
+  // Reads the result @p name of @p stage in @p mat.
+  //
+  // @pre completed(@p stage)
+  template <class U, Device D>
+  void restore(const EigensolverStage stage, const std::string& name, Matrix<U, D>& mat) {
+    DLAF_ASSERT(completed(stage), static_cast<SizeType>(stage), static_cast<SizeType>(completed_));
+#ifdef DLAF_WITH_HDF5
+    file_->read(datasetName(stage, name), mat);
+#else
+    dlaf::internal::silenceUnusedWarningFor(name, mat);
+#endif
+  }
+
+  // Marks @p stage as completed, once all its results have been saved.
+  //
+  // Note: it waits for the completion of the pending writes.
+  void markCompleted(const EigensolverStage stage) {
+#ifdef DLAF_WITH_HDF5
+    namespace ex = pika::execution::experimental;
+    namespace tt = pika::this_thread::experimental;
+
+    if (!file_ || completed(stage))
+      return;
+
+    tt::sync_wait(ex::when_all_vector(std::move(writes_)));
+    writes_.clear();
+
+    file_->flush();
+    file_->writeAttribute("stage", static_cast<SizeType>(stage));
+    file_->flush();
+    completed_ = stage;
+#else
+    dlaf::internal::silenceUnusedWarningFor(stage);
+#endif
+  }
+
+  // Marks the checkpoint as finished, once the eigenvectors @p mat_e have been computed, so that the
+  // following calls do not restore stale results (see the constructor).
+  //
+  // Note: it waits for the local tiles of @p mat_e to be ready.
+  template <class U, Device D>
+  void finish(Matrix<U, D>& mat_e) {
+#ifdef DLAF_WITH_HDF5
+    if (!file_)
+      return;
+
+    mat_e.waitLocalTiles();
+    file_->writeAttribute("stage", static_cast<SizeType>(EigensolverStage::none));
+    file_->flush();
+    completed_ = EigensolverStage::none;
+#else
+    dlaf::internal::silenceUnusedWarningFor(mat_e);
+#endif
+  }
+
+private:
+#ifdef DLAF_WITH_HDF5
+  static std::string datasetName(const EigensolverStage stage, const std::string& name) {
+    return "/stage" + std::to_string(static_cast<SizeType>(stage)) + "-" + name;
+  }
+
+  std::optional<matrix::internal::FileHDF5> file_;
+  std::vector<pika::execution::experimental::unique_any_sender<>> writes_;
+#endif
+  EigensolverStage completed_ = EigensolverStage::none;
+};
+}
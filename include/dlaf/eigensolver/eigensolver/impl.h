@@ -14,59 +14,417 @@
 #include <optional>
 #include <sstream>
 
+#include <pika/execution.hpp>
+
 #include <dlaf/blas/tile.h>
+#include <dlaf/common/index2d.h>
+#include <dlaf/common/range2d.h>
+#include <dlaf/common/round_robin.h>
 #include <dlaf/common/vector.h>
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/kernels/p2p.h>
 #include <dlaf/eigensolver/band_to_tridiag.h>
 #include <dlaf/eigensolver/bt_band_to_tridiag.h>
 #include <dlaf/eigensolver/bt_reduction_to_band.h>
 #include <dlaf/eigensolver/eigensolver/api.h>
+#include <dlaf/eigensolver/eigensolver/checkpoint.h>
+#include <dlaf/eigensolver/eigensolver/one_stage.h>
 #include <dlaf/eigensolver/internal/get_band_size.h>
 #include <dlaf/eigensolver/reduction_to_band.h>
 #include <dlaf/eigensolver/tridiag_solver.h>
 #include <dlaf/lapack/tile.h>
 #include <dlaf/matrix/copy.h>
+#include <dlaf/matrix/copy_tile.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/hdf5.h>
 #include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/tile.h>
+#include <dlaf/schedulers.h>
+#include <dlaf/sender/policy.h>
+#include <dlaf/sender/when_all_lift.h>
 #include <dlaf/types.h>
+#include <dlaf/util_math.h>
 #include <dlaf/util_matrix.h>
 
 namespace dlaf::eigensolver::internal {
 
+template <class T, Device D>
+SwapTrianglesWorkspace<T, D> makeSwapTrianglesWorkspace(const matrix::Distribution& dist) {
+  constexpr std::size_t n_workspaces = 4;
+  const SizeType nb = dist.tile_size().rows();
+  return SwapTrianglesWorkspace<T, D>(n_workspaces, LocalElementSize{nb, nb}, TileElementSize{nb, nb});
+}
+
+// Overwrites in place @p mat_a with its conjugate transpose, i.e. the lower and the upper triangles are
+// swapped (and conjugated). As the operation is an involution, calling it twice restores @p mat_a.
+//
+// Each pair of tiles (i, j), (j, i) is swapped through a temporary tile of @p temps.
 template <Backend B, Device D, class T>
-void Eigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
-                                Matrix<T, D>& mat_e, const SizeType eigenvalues_index_begin,
+void swapTriangles(Matrix<T, D>& mat_a, SwapTrianglesWorkspace<T, D>& temps) {
+  namespace ex = pika::execution::experimental;
+  using dlaf::internal::Policy;
+  using dlaf::internal::whenAllLift;
+  using pika::execution::thread_priority;
+
+  const auto& dist = mat_a.distribution();
+  const SizeType n = dist.nr_tiles().cols();
+  const Policy<B> policy(thread_priority::normal);
+
+  // Copies the tile ij of mat_a in a temporary tile and returns a read-only sender of the copy.
+  auto copyToTemp = [&](const GlobalTileIndex ij) {
+    auto& temp = temps.nextResource();
+    const matrix::SubTileSpec spec{{0, 0}, dist.tile_size_of(ij)};
+    auto tile_temp = splitTile(temp.readwrite(LocalTileIndex{0, 0}), spec);
+    ex::start_detached(whenAllLift(mat_a.read(ij), std::move(tile_temp)) | matrix::copy(policy));
+    return splitTile(temp.read(LocalTileIndex{0, 0}), spec);
+  };
+
+  for (SizeType j = 0; j < n; ++j) {
+    const GlobalTileIndex jj{j, j};
+    ex::start_detached(whenAllLift(blas::Uplo::General, copyToTemp(jj), mat_a.readwrite(jj)) |
+                       tile::lacpy_conj_trans(policy));
+
+    for (SizeType i = j + 1; i < n; ++i) {
+      const GlobalTileIndex ij{i, j};
+      const GlobalTileIndex ji{j, i};
+
+      auto tile_ij = copyToTemp(ij);
+      ex::start_detached(whenAllLift(blas::Uplo::General, mat_a.read(ji), mat_a.readwrite(ij)) |
+                         tile::lacpy_conj_trans(policy));
+      ex::start_detached(whenAllLift(blas::Uplo::General, std::move(tile_ij), mat_a.readwrite(ji)) |
+                         tile::lacpy_conj_trans(policy));
+    }
+  }
+}
+
+// Distributed variant of swapTriangles.
+//
+// When tiles (i, j) and (j, i) are owned by different ranks, they are exchanged point-to-point and the
+// received tile is stored in a temporary tile of @p temps before being copied transposed.
+template <Backend B, Device D, class T>
+void swapTriangles(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_a,
+                   SwapTrianglesWorkspace<T, D>& temps) {
+  namespace ex = pika::execution::experimental;
+  using dlaf::internal::Policy;
+  using dlaf::internal::whenAllLift;
+  using pika::execution::thread_priority;
+
+  const auto& dist = mat_a.distribution();
+  const comm::Index2D rank = dist.rank_index();
+  const SizeType n = dist.nr_tiles().cols();
+
+  if (n == 0)
+    return;
+
+  const Policy<B> policy(thread_priority::normal);
+  auto mpi_chain = grid.full_communicator_pipeline();
+
+  // Note: the tag is computed from the local index of the destination tile, which is unique for each
+  // pair of ranks and direction.
+  auto tag = [&dist](const GlobalTileIndex ij) -> comm::IndexT_MPI {
+    const auto size = dist.grid_size();
+    const SizeType ld = dlaf::util::ceilDiv(dist.nr_tiles().rows(), to_SizeType(size.rows()));
+    return to_int(ij.row() / size.rows() + ld * (ij.col() / size.cols()));
+  };
+
+  // Copies the tile ij of mat_a in a temporary tile and returns a read-only sender of the copy.
+  auto copyToTemp = [&](const GlobalTileIndex ij) {
+    auto& temp = temps.nextResource();
+    const matrix::SubTileSpec spec{{0, 0}, dist.tile_size_of(ij)};
+    auto tile_temp = splitTile(temp.readwrite(LocalTileIndex{0, 0}), spec);
+    ex::start_detached(whenAllLift(mat_a.read(ij), std::move(tile_temp)) | matrix::copy(policy));
+    return splitTile(temp.read(LocalTileIndex{0, 0}), spec);
+  };
+
+  // Sends the local tile ij to the rank owning tile ji and overwrites it with the conjugate transpose
+  // of the received tile ji.
+  auto exchange = [&](const GlobalTileIndex ij, const GlobalTileIndex ji) {
+    const comm::IndexT_MPI rank_ji = grid.rankFullCommunicator(dist.rank_global_tile(ji));
+    ex::start_detached(comm::schedule_send(mpi_chain.shared(), rank_ji, tag(ji), mat_a.read(ij)));
+
+    auto& temp = temps.nextResource();
+    auto tile_ji = splitTile(temp.readwrite(LocalTileIndex{0, 0}), {{0, 0}, dist.tile_size_of(ji)});
+    auto recv = comm::schedule_recv(mpi_chain.shared(), rank_ji, tag(ij), std::move(tile_ji));
+    ex::start_detached(whenAllLift(blas::Uplo::General, std::move(recv), mat_a.readwrite(ij)) |
+                       tile::lacpy_conj_trans(policy));
+  };
+
+  for (SizeType j = 0; j < n; ++j) {
+    const GlobalTileIndex jj{j, j};
+    if (dist.rank_global_tile(jj) == rank)
+      ex::start_detached(whenAllLift(blas::Uplo::General, copyToTemp(jj), mat_a.readwrite(jj)) |
+                         tile::lacpy_conj_trans(policy));
+
+    for (SizeType i = j + 1; i < n; ++i) {
+      const GlobalTileIndex ij{i, j};
+      const GlobalTileIndex ji{j, i};
+      const comm::Index2D rank_ij = dist.rank_global_tile(ij);
+      const comm::Index2D rank_ji = dist.rank_global_tile(ji);
+
+      if (rank_ij == rank && rank_ji == rank) {
+        auto tile_ij = copyToTemp(ij);
+        ex::start_detached(whenAllLift(blas::Uplo::General, mat_a.read(ji), mat_a.readwrite(ij)) |
+                           tile::lacpy_conj_trans(policy));
+        ex::start_detached(whenAllLift(blas::Uplo::General, std::move(tile_ij),
+                                       mat_a.readwrite(ji)) |
+                           tile::lacpy_conj_trans(policy));
+      }
+      else if (rank_ij == rank) {
+        exchange(ij, ji);
+      }
+      else if (rank_ji == rank) {
+        exchange(ji, ij);
+      }
+    }
+  }
+}
+
+// Reduction to band and band to tridiagonal only support the Lower variant. If @p uplo == Upper, the
+// triangles of @p mat_a are swapped in place (see swapTriangles), so that the Lower variant can run on
+// @p mat_a without allocating a second matrix. It has to be called a second time after the last use of
+// @p mat_a, which restores the strictly lower triangle (not referenced by the Upper variant).
+// If @p uplo == Lower it is a no-op.
+//
+// Note: @p workspace is allocated on the first call with @p uplo == Upper.
+template <Backend B, Device D, class T>
+void swapStorage(const blas::Uplo uplo, Matrix<T, D>& mat_a,
+                 std::optional<SwapTrianglesWorkspace<T, D>>& workspace) {
+  if (uplo == blas::Uplo::General)
+    DLAF_UNIMPLEMENTED(uplo);
+  if (uplo == blas::Uplo::Lower)
+    return;
+
+  if (!workspace)
+    workspace = makeSwapTrianglesWorkspace<T, D>(mat_a.distribution());
+  swapTriangles<B>(mat_a, *workspace);
+}
+
+// \overload swapStorage
+template <Backend B, Device D, class T>
+void swapStorage(comm::CommunicatorGrid& grid, const blas::Uplo uplo, Matrix<T, D>& mat_a,
+                 std::optional<SwapTrianglesWorkspace<T, D>>& workspace) {
+  if (uplo == blas::Uplo::General)
+    DLAF_UNIMPLEMENTED(uplo);
+  if (uplo == blas::Uplo::Lower)
+    return;
+
+  if (!workspace)
+    workspace = makeSwapTrianglesWorkspace<T, D>(mat_a.distribution());
+  swapTriangles<B>(grid, mat_a, *workspace);
+}
+
+// Returns the matrix where the tridiagonal eigensolver stores the eigenvectors of the tridiagonal matrix
+// which are back-transformed into @p mat_e, i.e. @p mat_e itself for real T and the real eigenvectors
+// workspace of @p tridiag_ws for complex T (the eigenvectors of the tridiagonal matrix are real).
+template <class T, Device D>
+Matrix<BaseType<T>, D>& tridiagEigenvectors(Matrix<T, D>& mat_e,
+                                            TridiagSolverWorkspace<BaseType<T>, D>& tridiag_ws) {
+  if constexpr (isComplex_v<T>)
+    return tridiag_ws.realEigenvectors();
+  else
+    return mat_e;
+}
+
+// Applies the back-transformation from tridiagonal to band to the eigenvectors of the tridiagonal
+// matrix with index in [eigenvalues_index_begin, eigenvalues_index_end) stored in @p mat_e_tridiag (see
+// tridiagEigenvectors), storing them in the corresponding columns of @p mat_e.
+//
+// For complex T the back-transformation casts them to complex one row of tiles at a time, just before it
+// first updates them, so that no (n x n) cast pass over @p mat_e is needed.
+template <Backend B, Device D, class T>
+void backTransformationT2B(const SizeType band_size, TridiagResult<T, Device::CPU>& tridiag,
+                           Matrix<BaseType<T>, D>& mat_e_tridiag, Matrix<T, D>& mat_e,
+                           const SizeType eigenvalues_index_begin,
+                           const SizeType eigenvalues_index_end,
+                           BackTransformationT2BWorkspace<B, D, T>& bt_ws) {
+  auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(mat_e, eigenvalues_index_begin,
+                                                                 eigenvalues_index_end);
+  matrix::internal::MatrixRef mat_e_ref(mat_e, spec);
+  Matrix<const T, Device::CPU>& mat_hh = tridiag.hh_reflectors;
+
+  if constexpr (isComplex_v<T>) {
+    matrix::internal::MatrixRef<const BaseType<T>, D> mat_e_tridiag_ref(mat_e_tridiag, spec);
+    BackTransformationT2B<B, D, T>::call(band_size, mat_e_ref, mat_e_tridiag_ref, mat_hh, bt_ws);
+  }
+  else {
+    BackTransformationT2B<B, D, T>::call(band_size, mat_e_ref, mat_hh, bt_ws);
+  }
+}
+
+// \overload backTransformationT2B
+template <Backend B, Device D, class T>
+void backTransformationT2B(comm::CommunicatorGrid& grid, const SizeType band_size,
+                           TridiagResult<T, Device::CPU>& tridiag,
+                           Matrix<BaseType<T>, D>& mat_e_tridiag, Matrix<T, D>& mat_e,
+                           const SizeType eigenvalues_index_begin,
+                           const SizeType eigenvalues_index_end,
+                           BackTransformationT2BWorkspace<B, D, T>& bt_ws) {
+  auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(mat_e, eigenvalues_index_begin,
+                                                                 eigenvalues_index_end);
+  matrix::internal::MatrixRef mat_e_ref(mat_e, spec);
+  Matrix<const T, Device::CPU>& mat_hh = tridiag.hh_reflectors;
+
+  if constexpr (isComplex_v<T>) {
+    matrix::internal::MatrixRef<const BaseType<T>, D> mat_e_tridiag_ref(mat_e_tridiag, spec);
+    BackTransformationT2B<B, D, T>::call(grid, band_size, mat_e_ref, mat_e_tridiag_ref, mat_hh, bt_ws);
+  }
+  else {
+    BackTransformationT2B<B, D, T>::call(grid, band_size, mat_e_ref, mat_hh, bt_ws);
+  }
+}
+
+// Computes the eigenvectors of the tridiagonal matrix of @p tridiag with index in
+// [eigenvalues_index_begin, eigenvalues_index_end) (and all the eigenvalues) and applies to them the
+// back-transformation from tridiagonal to band, storing them in the corresponding columns of @p mat_e.
+template <Backend B, Device D, class T>
+void tridiagEigensolverAndBackTransformation(
+    const SizeType band_size, TridiagResult<T, Device::CPU>& tridiag, Matrix<BaseType<T>, D>& evals,
+    Matrix<T, D>& mat_e, const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end,
+    TridiagSolverWorkspace<BaseType<T>, D>& tridiag_ws, BackTransformationT2BWorkspace<B, D, T>& bt_ws) {
+  Matrix<BaseType<T>, D>& mat_e_tridiag = tridiagEigenvectors(mat_e, tridiag_ws);
+  TridiagSolver<B, D, BaseType<T>>::call(tridiag.tridiagonal, evals, mat_e_tridiag,
+                                         eigenvalues_index_begin, eigenvalues_index_end, tridiag_ws);
+  backTransformationT2B<B>(band_size, tridiag, mat_e_tridiag, mat_e, eigenvalues_index_begin,
+                           eigenvalues_index_end, bt_ws);
+}
+
+// \overload tridiagEigensolverAndBackTransformation
+template <Backend B, Device D, class T>
+void tridiagEigensolverAndBackTransformation(
+    comm::CommunicatorGrid& grid, const SizeType band_size, TridiagResult<T, Device::CPU>& tridiag,
+    Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e, const SizeType eigenvalues_index_begin,
+    const SizeType eigenvalues_index_end, TridiagSolverWorkspace<BaseType<T>, D>& tridiag_ws,
+    BackTransformationT2BWorkspace<B, D, T>& bt_ws) {
+  Matrix<BaseType<T>, D>& mat_e_tridiag = tridiagEigenvectors(mat_e, tridiag_ws);
+  TridiagSolver<B, D, BaseType<T>>::call(grid, tridiag.tridiagonal, evals, mat_e_tridiag,
+                                         eigenvalues_index_begin, eigenvalues_index_end, tridiag_ws);
+  backTransformationT2B<B>(grid, band_size, tridiag, mat_e_tridiag, mat_e, eigenvalues_index_begin,
+                           eigenvalues_index_end, bt_ws);
+}
+
+// Eigenvalues only: the HH reflectors of the band to tridiagonal step are not stored and both the
+// back-transformations are skipped.
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                Matrix<BaseType<T>, D>& evals) {
+  const SizeType band_size = getBandSize(mat_a.blockSize().rows());
+
+  std::optional<SwapTrianglesWorkspace<T, D>> swap_ws;
+  swapStorage<B>(uplo, mat_a, swap_ws);
+
+  // Small matrices are reduced to tridiagonal form with the one-stage algorithm.
+  if (useOneStageReduction(mat_a.distribution())) {
+    OneStageTridiagReduction<T> one_stage(mat_a.distribution());
+    one_stage.gather(mat_a);
+    one_stage.reduce();
+
+    swapStorage<B>(uplo, mat_a, swap_ws);
+
+    tridiagonal_eigensolver<B>(one_stage.tridiagonal(), evals);
+    return;
+  }
+
+  reduction_to_band<B>(mat_a, band_size);
+  auto ret = band_to_tridiagonal<Backend::MC>(blas::Uplo::Lower, band_size, mat_a, false);
+  swapStorage<B>(uplo, mat_a, swap_ws);
+
+  tridiagonal_eigensolver<B>(ret.tridiagonal, evals);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
+                                const SizeType eigenvalues_index_begin,
                                 const SizeType eigenvalues_index_end) {
   const SizeType band_size = getBandSize(mat_a.blockSize().rows());
 
-  // need uplo check as reduction to band doesn't have the uplo argument yet.
-  if (uplo != blas::Uplo::Lower)
-    DLAF_UNIMPLEMENTED(uplo);
+  std::optional<SwapTrianglesWorkspace<T, D>> swap_ws;
+  swapStorage<B>(uplo, mat_a, swap_ws);
+
+  if (useOneStageReduction(mat_a.distribution())) {
+    OneStageTridiagReduction<T> one_stage(mat_a.distribution());
+    one_stage.gather(mat_a);
+    one_stage.reduce();
+    swapStorage<B>(uplo, mat_a, swap_ws);
+
+    tridiagonal_eigensolver<B>(one_stage.tridiagonal(), evals, mat_e, eigenvalues_index_begin,
+                               eigenvalues_index_end);
+    one_stage.backTransform(mat_e, eigenvalues_index_begin, eigenvalues_index_end);
+    return;
+  }
 
   auto mat_taus = reduction_to_band<B>(mat_a, band_size);
-  auto ret = band_to_tridiagonal<Backend::MC>(uplo, band_size, mat_a);
+  auto ret = band_to_tridiagonal<Backend::MC>(blas::Uplo::Lower, band_size, mat_a);
 
-  tridiagonal_eigensolver<B>(ret.tridiagonal, evals, mat_e);
+  TridiagSolverWorkspace<BaseType<T>, D> tridiag_ws(mat_e.distribution());
+  BackTransformationT2BWorkspace<B, D, T> bt_ws;
+  tridiagEigensolverAndBackTransformation<B>(band_size, ret, evals, mat_e, eigenvalues_index_begin,
+                                             eigenvalues_index_end, tridiag_ws, bt_ws);
 
   auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(mat_e, eigenvalues_index_begin,
                                                                  eigenvalues_index_end);
 
   matrix::internal::MatrixRef mat_e_ref(mat_e, spec);
-  bt_band_to_tridiagonal<B>(band_size, mat_e_ref, ret.hh_reflectors);
   bt_reduction_to_band<B>(band_size, mat_e_ref, mat_a, mat_taus);
+  swapStorage<B>(uplo, mat_a, swap_ws);
 }
 
 template <Backend B, Device D, class T>
-void Eigensolver<B, D, T>::call(comm::CommunicatorGrid& grid, blas::Uplo uplo, Matrix<T, D>& mat_a,
-                                Matrix<BaseType<T>, D>& evals, Matrix<T, D>& mat_e,
-                                const SizeType eigenvalues_index_begin,
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid& grid, blas::Uplo uplo,
+                                Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals) {
+  const SizeType band_size = getBandSize(mat_a.blockSize().rows());
+
+  std::optional<SwapTrianglesWorkspace<T, D>> swap_ws;
+  swapStorage<B>(grid, uplo, mat_a, swap_ws);
+
+#ifdef DLAF_WITH_HDF5
+  static std::atomic<size_t> num_eigenvalues_calls = 0;
+  std::stringstream fname;
+  fname << "eigensolver-evals-" << matrix::internal::TypeToString_v<T> << "-"
+        << std::to_string(num_eigenvalues_calls) << ".h5";
+  std::optional<matrix::internal::FileHDF5> file;
+
+  if (getTuneParameters().debug_dump_eigensolver_data) {
+    file = matrix::internal::FileHDF5(grid.fullCommunicator(), fname.str());
+    file->write(mat_a, "/input");
+  }
+#endif
+
+  if (useOneStageReduction(grid, mat_a.distribution())) {
+    OneStageTridiagReduction<T> one_stage(mat_a.distribution());
+    one_stage.gather(grid, mat_a);
+    one_stage.reduce(grid);
+
+    tridiagonal_eigensolver<B>(grid, one_stage.tridiagonal(), evals);
+  }
+  else {
+    reduction_to_band<B>(grid, mat_a, band_size);
+
+    auto ret = band_to_tridiagonal<Backend::MC>(grid, blas::Uplo::Lower, band_size, mat_a, false);
+
+    tridiagonal_eigensolver<B>(grid, ret.tridiagonal, evals);
+  }
+
+  swapStorage<B>(grid, uplo, mat_a, swap_ws);
+
+#ifdef DLAF_WITH_HDF5
+  if (getTuneParameters().debug_dump_eigensolver_data) {
+    file->write(evals, "/evals");
+  }
+
+  num_eigenvalues_calls++;
+#endif
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid& grid, blas::Uplo uplo,
+                                Matrix<T, D>& mat_a, Matrix<BaseType<T>, D>& evals,
+                                Matrix<T, D>& mat_e, const SizeType eigenvalues_index_begin,
                                 const SizeType eigenvalues_index_end) {
   const SizeType band_size = getBandSize(mat_a.blockSize().rows());
 
-  // need uplo check as reduction to band doesn't have the uplo argument yet.
-  if (uplo != blas::Uplo::Lower)
-    DLAF_UNIMPLEMENTED(uplo);
+  std::optional<SwapTrianglesWorkspace<T, D>> swap_ws;
+  swapStorage<B>(grid, uplo, mat_a, swap_ws);
 
 #ifdef DLAF_WITH_HDF5
   static std::atomic<size_t> num_eigensolver_calls = 0;
@@ -81,18 +439,85 @@ void Eigensolver<B, D, T>::call(comm::CommunicatorGrid& grid, blas::Uplo uplo, M
   }
 #endif
 
-  auto mat_taus = reduction_to_band<B>(grid, mat_a, band_size);
+  if (useOneStageReduction(grid, mat_a.distribution())) {
+    OneStageTridiagReduction<T> one_stage(mat_a.distribution());
+    one_stage.gather(grid, mat_a);
+    one_stage.reduce(grid);
+
+    tridiagonal_eigensolver<B>(grid, one_stage.tridiagonal(), evals, mat_e, eigenvalues_index_begin,
+                               eigenvalues_index_end);
+    one_stage.backTransform(grid, mat_e, eigenvalues_index_begin, eigenvalues_index_end);
+  }
+  else {
+    // The results of each stage are stored in the checkpoint file (if enabled). The writes of the
+    // results which are only read by the next stage are issued after the next stage has been
+    // scheduled, so that they overlap with its execution.
+    using Stage = EigensolverStage;
+    EigensolverCheckpoint<T> checkpoint(grid, mat_a.distribution(), band_size, eigenvalues_index_begin,
+                                        eigenvalues_index_end);
 
-  auto ret = band_to_tridiagonal<Backend::MC>(grid, uplo, band_size, mat_a);
+    Matrix<T, D> mat_taus(reductionToBandTausDistribution(mat_a.distribution(), band_size));
+    if (checkpoint.completed(Stage::reduction_to_band)) {
+      checkpoint.restore(Stage::reduction_to_band, "a", mat_a);
+      checkpoint.restore(Stage::reduction_to_band, "taus", mat_taus);
+    }
+    else {
+      ReductionToBand<B, D, T>::call(grid, mat_a, band_size, mat_taus);
+    }
 
-  tridiagonal_eigensolver<B>(grid, ret.tridiagonal, evals, mat_e);
+    auto ret = makeTridiagResult<T>(mat_a.distribution(), true);
+    if (checkpoint.completed(Stage::band_to_tridiagonal)) {
+      checkpoint.restore(Stage::band_to_tridiagonal, "tridiagonal", ret.tridiagonal);
+      checkpoint.restore(Stage::band_to_tridiagonal, "hh_reflectors", ret.hh_reflectors);
+    }
+    else {
+      band_to_tridiagonal<Backend::MC>(grid, blas::Uplo::Lower, band_size, mat_a, ret);
+    }
 
-  auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(mat_e, eigenvalues_index_begin,
-                                                                 eigenvalues_index_end);
-  matrix::internal::MatrixRef mat_e_ref(mat_e, spec);
+    checkpoint.save(Stage::reduction_to_band, "a", mat_a);
+    checkpoint.save(Stage::reduction_to_band, "taus", mat_taus);
+    checkpoint.markCompleted(Stage::reduction_to_band);
+
+    // Note: the tridiagonal matrix is overwritten by the tridiagonal eigensolver.
+    checkpoint.save(Stage::band_to_tridiagonal, "tridiagonal", ret.tridiagonal);
+
+    // Note: the eigenvectors of the tridiagonal matrix are real, hence for complex T they are computed
+    // (and stored in the checkpoint) in the workspace of the tridiagonal eigensolver, and they are cast
+    // to complex by the back-transformation.
+    TridiagSolverWorkspace<BaseType<T>, D> tridiag_ws(mat_e.distribution());
+    BackTransformationT2BWorkspace<B, D, T> bt_ws;
+    Matrix<BaseType<T>, D>& mat_e_tridiag = tridiagEigenvectors(mat_e, tridiag_ws);
+
+    if (checkpoint.completed(Stage::tridiagonal_eigensolver)) {
+      checkpoint.restore(Stage::tridiagonal_eigensolver, "evals", evals);
+      checkpoint.restore(Stage::tridiagonal_eigensolver, "evecs", mat_e_tridiag);
+    }
+    else {
+      TridiagSolver<B, D, BaseType<T>>::call(grid, ret.tridiagonal, evals, mat_e_tridiag,
+                                             eigenvalues_index_begin, eigenvalues_index_end,
+                                             tridiag_ws);
+    }
+
+    checkpoint.save(Stage::band_to_tridiagonal, "hh_reflectors", ret.hh_reflectors);
+    checkpoint.markCompleted(Stage::band_to_tridiagonal);
+
+    // Note: the eigenvectors are overwritten by the back-transformations.
+    checkpoint.save(Stage::tridiagonal_eigensolver, "evals", evals);
+    checkpoint.save(Stage::tridiagonal_eigensolver, "evecs", mat_e_tridiag);
+    checkpoint.markCompleted(Stage::tridiagonal_eigensolver);
+
+    backTransformationT2B<B>(grid, band_size, ret, mat_e_tridiag, mat_e, eigenvalues_index_begin,
+                             eigenvalues_index_end, bt_ws);
 
-  bt_band_to_tridiagonal<B>(grid, band_size, mat_e_ref, ret.hh_reflectors);
-  bt_reduction_to_band<B>(grid, band_size, mat_e_ref, mat_a, mat_taus);
+    auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(mat_e, eigenvalues_index_begin,
+                                                                   eigenvalues_index_end);
+    matrix::internal::MatrixRef mat_e_ref(mat_e, spec);
+
+    bt_reduction_to_band<B>(grid, band_size, mat_e_ref, mat_a, mat_taus);
+    checkpoint.finish(mat_e);
+  }
+
+  swapStorage<B>(grid, uplo, mat_a, swap_ws);
 
 #ifdef DLAF_WITH_HDF5
   if (getTuneParameters().debug_dump_eigensolver_data) {
@@ -103,4 +528,64 @@ void Eigensolver<B, D, T>::call(comm::CommunicatorGrid& grid, blas::Uplo uplo, M
   num_eigensolver_calls++;
 #endif
 }
+
+// Same as the eigenvectors variant, but the intermediate matrices, the workspaces of the steps and the
+// results are the ones owned by @p plan, so that no allocation of these matrices happens in repeated
+// calls.
+//
+// Note: the plan always uses the two-stage reduction, as it owns its intermediate matrices.
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a,
+                                EigensolverPlan<B, D, T>& plan, const SizeType eigenvalues_index_begin,
+                                const SizeType eigenvalues_index_end) {
+  const SizeType band_size = plan.band_size();
+  auto& evals = plan.result().eigenvalues;
+  auto& mat_e = plan.result().eigenvectors;
+
+  auto& swap_ws = plan.swap_triangles_workspace();
+  swapStorage<B>(uplo, mat_a, swap_ws);
+
+  ReductionToBand<B, D, T>::call(mat_a, band_size, plan.taus(), plan.red2band_workspace());
+  band_to_tridiagonal<Backend::MC>(blas::Uplo::Lower, band_size, mat_a, plan.tridiag());
+
+  tridiagEigensolverAndBackTransformation<B>(band_size, plan.tridiag(), evals, mat_e,
+                                             eigenvalues_index_begin, eigenvalues_index_end,
+                                             plan.tridiag_solver_workspace(),
+                                             plan.bt_band_to_tridiag_workspace());
+
+  auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(mat_e, eigenvalues_index_begin,
+                                                                 eigenvalues_index_end);
+
+  matrix::internal::MatrixRef mat_e_ref(mat_e, spec);
+  bt_reduction_to_band<B>(band_size, mat_e_ref, mat_a, plan.taus());
+  swapStorage<B>(uplo, mat_a, swap_ws);
+}
+
+template <Backend B, Device D, class T>
+void Eigensolver<B, D, T>::call(comm::CommunicatorGrid& grid, blas::Uplo uplo,
+                                Matrix<T, D>& mat_a, EigensolverPlan<B, D, T>& plan,
+                                const SizeType eigenvalues_index_begin,
+                                const SizeType eigenvalues_index_end) {
+  const SizeType band_size = plan.band_size();
+  auto& evals = plan.result().eigenvalues;
+  auto& mat_e = plan.result().eigenvectors;
+
+  auto& swap_ws = plan.swap_triangles_workspace();
+  swapStorage<B>(grid, uplo, mat_a, swap_ws);
+
+  ReductionToBand<B, D, T>::call(grid, mat_a, band_size, plan.taus(), plan.red2band_workspace());
+  band_to_tridiagonal<Backend::MC>(grid, blas::Uplo::Lower, band_size, mat_a, plan.tridiag());
+
+  tridiagEigensolverAndBackTransformation<B>(grid, band_size, plan.tridiag(), evals, mat_e,
+                                             eigenvalues_index_begin, eigenvalues_index_end,
+                                             plan.tridiag_solver_workspace(),
+                                             plan.bt_band_to_tridiag_workspace());
+
+  auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(mat_e, eigenvalues_index_begin,
+                                                                 eigenvalues_index_end);
+  matrix::internal::MatrixRef mat_e_ref(mat_e, spec);
+
+  bt_reduction_to_band<B>(grid, band_size, mat_e_ref, mat_a, plan.taus());
+  swapStorage<B>(grid, uplo, mat_a, swap_ws);
+}
 }
@@ -0,0 +1,349 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <pika/execution.hpp>
+
+#include <blas.hh>
+#include <lapack.hh>
+
+#include <dlaf/common/index2d.h>
+#include <dlaf/common/range2d.h>
+#include <dlaf/common/single_threaded_blas.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/index.h>
+#include <dlaf/communication/kernels/broadcast.h>
+#include <dlaf/communication/kernels/p2p.h>
+#include <dlaf/matrix/allocation.h>
+#include <dlaf/matrix/copy_tile.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/tile.h>
+#include <dlaf/schedulers.h>
+#include <dlaf/sender/policy.h>
+#include <dlaf/sender/transform.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
+#include <dlaf/util_math.h>
+
+namespace dlaf::eigensolver::internal {
+
+// Returns true if the eigenvalue problem of the local matrix @p dist_a is small enough to be reduced to
+// tridiagonal form with the one-stage algorithm (see OneStageTridiagReduction and
+// TuneParameters::eigensolver_one_stage_max_size).
+inline bool useOneStageReduction(const matrix::Distribution& dist_a) noexcept {
+  const auto& params = getTuneParameters();
+  return !dist_a.size().isEmpty() && dist_a.size().rows() <= params.eigensolver_one_stage_max_size;
+}
+
+// Distributed variant of useOneStageReduction, which is used only if enabled (see
+// TuneParameters::eigensolver_one_stage_distributed and eigensolver_one_stage_max_nranks).
+inline bool useOneStageReduction(comm::CommunicatorGrid& grid,
+                                 const matrix::Distribution& dist_a) noexcept {
+  const auto& params = getTuneParameters();
+  const comm::Size2D grid_size = grid.size();
+  return params.eigensolver_one_stage_distributed &&
+         grid_size.rows() * grid_size.cols() <= params.eigensolver_one_stage_max_nranks &&
+         useOneStageReduction(dist_a);
+}
+
+// One-stage reduction of a hermitian matrix to real symmetric tridiagonal form (LAPACK hetrd) and the
+// corresponding back-transformation of the eigenvectors (LAPACK unmtr).
+//
+// The lower triangle of the matrix is gathered in a column major copy on CPU, which is reduced as a
+// whole by a single task. Therefore it is meant only for small matrices, for which the overheads of the
+// two-stage approach (reduction to band, band to tridiagonal and the two back-transformations) are
+// dominant.
+// In the distributed case the matrix is gathered and reduced on rank 0, which broadcasts the result
+// (HH reflectors included) to all the ranks, so that the back-transformation only requires to gather
+// the local columns of the eigenvectors along the column communicator.
+template <class T>
+class OneStageTridiagReduction {
+  using TileCPU = matrix::Tile<T, Device::CPU>;
+
+public:
+  // @pre @p dist_a has square size, square block size and a single tile per block.
+  explicit OneStageTridiagReduction(const matrix::Distribution& dist_a)
+      : mat_a_(LocalElementSize(dist_a.size().rows(), dist_a.size().cols()), dist_a.tile_size(),
+               col_major_compact()),
+        mat_taus_(LocalElementSize(dist_a.size().rows(), 1),
+                  TileElementSize(std::max<SizeType>(1, dist_a.size().rows()), 1)),
+        mat_trid_(LocalElementSize(dist_a.size().rows(), 2),
+                  TileElementSize(dist_a.tile_size().rows(), 2)) {}
+
+  // Returns the tridiagonal matrix computed by reduce(), in the same format of
+  // TridiagResult::tridiagonal (diagonal in the first column, off-diagonal in the second one).
+  Matrix<BaseType<T>, Device::CPU>& tridiagonal() noexcept {
+    return mat_trid_;
+  }
+
+  // Copies the lower triangle of @p mat_a in the local column major workspace.
+  template <Device D>
+  void gather(Matrix<const T, D>& mat_a) {
+    namespace ex = pika::execution::experimental;
+
+    const SizeType n = mat_a.nrTiles().cols();
+    for (SizeType j = 0; j < n; ++j) {
+      for (SizeType i = j; i < n; ++i) {
+        const GlobalTileIndex ij(i, j);
+        ex::start_detached(ex::when_all(mat_a.read(ij), mat_a_.readwrite(ij)) |
+                           matrix::copy(dlaf::internal::Policy<copy_backend<D, Device::CPU>>{}));
+      }
+    }
+  }
+
+  // Distributed variant of gather: the lower triangle of @p mat_a is gathered on rank 0 of the full
+  // communicator.
+  template <Device D>
+  void gather(comm::CommunicatorGrid& grid, Matrix<const T, D>& mat_a) {
+    namespace ex = pika::execution::experimental;
+
+    const auto& dist = mat_a.distribution();
+    const SizeType n = dist.nr_tiles().cols();
+
+    auto mpi_chain = grid.full_communicator_pipeline();
+    const comm::IndexT_MPI rank_full = mpi_chain.rank();
+
+    // Note: the tag is computed from the local index of the tile on the sending rank.
+    auto tag = [&dist](const GlobalTileIndex ij) -> comm::IndexT_MPI {
+      const auto size = dist.grid_size();
+      const SizeType ld = util::ceilDiv(dist.nr_tiles().rows(), to_SizeType(size.rows()));
+      return to_int(ij.row() / size.rows() + ld * (ij.col() / size.cols()));
+    };
+
+    for (SizeType j = 0; j < n; ++j) {
+      for (SizeType i = j; i < n; ++i) {
+        const GlobalTileIndex ij(i, j);
+        const comm::IndexT_MPI rank_ij = grid.rankFullCommunicator(dist.rank_global_tile(ij));
+
+        if (rank_ij == 0 && rank_full == 0) {
+          ex::start_detached(ex::when_all(mat_a.read(ij), mat_a_.readwrite(ij)) |
+                             matrix::copy(dlaf::internal::Policy<copy_backend<D, Device::CPU>>{}));
+        }
+        else if (rank_ij == rank_full) {
+          ex::start_detached(comm::schedule_send(mpi_chain.shared(), 0, tag(ij), mat_a.read(ij)));
+        }
+        else if (rank_full == 0) {
+          ex::start_detached(
+              comm::schedule_recv(mpi_chain.shared(), rank_ij, tag(ij), mat_a_.readwrite(ij)));
+        }
+      }
+    }
+  }
+
+  // Reduces the gathered matrix to tridiagonal form, storing the result in tridiagonal() and the
+  // HH reflectors in the workspace for the back-transformation.
+  void reduce() {
+    namespace ex = pika::execution::experimental;
+    using pika::execution::thread_priority;
+
+    auto hetrd = [](std::vector<TileCPU>&& tiles_a, const TileCPU& tile_taus,
+                    std::vector<matrix::Tile<BaseType<T>, Device::CPU>>&& tiles_trid) {
+      const SizeType m = tile_taus.size().rows();
+      const TileCPU& tile_a = tiles_a[0];
+      std::vector<BaseType<T>> d(to_sizet(m));
+      std::vector<BaseType<T>> e(to_sizet(m), BaseType<T>(0));
+
+      // Note: even if this is the only task of the algorithm, the pika worker threads are busy (e.g.
+      // polling MPI) and a multithreaded BLAS would oversubscribe the cores.
+      common::internal::SingleThreadedBlasScope single;
+      if constexpr (isComplex_v<T>)
+        lapack::hetrd(blas::Uplo::Lower, m, tile_a.ptr(), tile_a.ld(), d.data(), e.data(),
+                      tile_taus.ptr());
+      else
+        lapack::sytrd(blas::Uplo::Lower, m, tile_a.ptr(), tile_a.ld(), d.data(), e.data(),
+                      tile_taus.ptr());
+
+      SizeType i_el = 0;
+      for (const auto& tile_t : tiles_trid) {
+        for (SizeType i = 0; i < tile_t.size().rows(); ++i, ++i_el) {
+          tile_t({i, 0}) = d[to_sizet(i_el)];
+          tile_t({i, 1}) = e[to_sizet(i_el)];
+        }
+      }
+    };
+
+    ex::when_all(ex::when_all_vector(matrix::select(
+                     mat_a_, common::iterate_range2d(mat_a_.distribution().local_nr_tiles()))),
+                 mat_taus_.readwrite(LocalTileIndex(0, 0)),
+                 ex::when_all_vector(matrix::select(
+                     mat_trid_, common::iterate_range2d(mat_trid_.distribution().local_nr_tiles())))) |
+        dlaf::internal::transformDetach(dlaf::internal::Policy<Backend::MC>(thread_priority::high),
+                                        std::move(hetrd));
+  }
+
+  // Distributed variant of reduce: the matrix gathered on rank 0 is reduced there and the results are
+  // broadcast to all the ranks.
+  void reduce(comm::CommunicatorGrid& grid) {
+    namespace ex = pika::execution::experimental;
+
+    auto mpi_chain = grid.full_communicator_pipeline();
+
+    if (mpi_chain.rank() == 0)
+      reduce();
+
+    if (mpi_chain.size() == 1)
+      return;
+
+    auto bcast = [&mpi_chain](auto& mat, const GlobalTileIndex& index) {
+      if (mpi_chain.rank() == 0)
+        ex::start_detached(comm::schedule_bcast_send(mpi_chain.exclusive(), mat.read(index)));
+      else
+        ex::start_detached(comm::schedule_bcast_recv(mpi_chain.exclusive(), 0, mat.readwrite(index)));
+    };
+
+    const SizeType n = mat_a_.nrTiles().cols();
+    for (SizeType j = 0; j < n; ++j)
+      for (SizeType i = j; i < n; ++i)
+        bcast(mat_a_, GlobalTileIndex(i, j));
+    bcast(mat_taus_, GlobalTileIndex(0, 0));
+    for (SizeType i = 0; i < mat_trid_.nrTiles().rows(); ++i)
+      bcast(mat_trid_, GlobalTileIndex(i, 0));
+  }
+
+  // Applies the back-transformation to the columns [eigenvalues_index_begin, eigenvalues_index_end)
+  // of @p mat_e (n x m, with m >= eigenvalues_index_end).
+  template <Device D>
+  void backTransform(Matrix<T, D>& mat_e, const SizeType eigenvalues_index_begin,
+                     const SizeType eigenvalues_index_end) {
+    namespace ex = pika::execution::experimental;
+
+    if (eigenvalues_index_begin == eigenvalues_index_end)
+      return;
+
+    const SizeType m = mat_e.nrTiles().rows();
+    const SizeType nb = mat_e.blockSize().cols();
+    Matrix<T, Device::CPU> mat_e_h(LocalElementSize(mat_e.size().rows(), mat_e.size().cols()),
+                                   mat_e.tile_size(), col_major_compact());
+
+    for (SizeType j = eigenvalues_index_begin / nb; j < util::ceilDiv(eigenvalues_index_end, nb); ++j) {
+      for (SizeType i = 0; i < m; ++i) {
+        const GlobalTileIndex ij(i, j);
+        ex::start_detached(ex::when_all(mat_e.read(ij), mat_e_h.readwrite(ij)) |
+                           matrix::copy(dlaf::internal::Policy<copy_backend<D, Device::CPU>>{}));
+      }
+
+      applyQ(mat_e_h, j, eigenvalues_index_begin, eigenvalues_index_end);
+
+      for (SizeType i = 0; i < m; ++i) {
+        const GlobalTileIndex ij(i, j);
+        ex::start_detached(ex::when_all(mat_e_h.read(ij), mat_e.readwrite(ij)) |
+                           matrix::copy(dlaf::internal::Policy<copy_backend<Device::CPU, D>>{}));
+      }
+    }
+  }
+
+  // Distributed variant of backTransform: each rank gathers the tile columns of the eigenvectors it
+  // owns along the column communicator, applies the back-transformation to them and copies back its
+  // local tiles.
+  template <Device D>
+  void backTransform(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_e,
+                     const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end) {
+    namespace ex = pika::execution::experimental;
+
+    if (eigenvalues_index_begin == eigenvalues_index_end)
+      return;
+
+    const auto& dist = mat_e.distribution();
+    const comm::Index2D rank = dist.rank_index();
+    const SizeType m = dist.nr_tiles().rows();
+    const SizeType nb = dist.block_size().cols();
+    Matrix<T, Device::CPU> mat_e_h(LocalElementSize(mat_e.size().rows(), mat_e.size().cols()),
+                                   mat_e.tile_size(), col_major_compact());
+
+    auto mpi_col_chain = grid.col_communicator_pipeline();
+
+    for (SizeType j = eigenvalues_index_begin / nb; j < util::ceilDiv(eigenvalues_index_end, nb); ++j) {
+      if (dist.rank_global_tile<Coord::Col>(j) != rank.col())
+        continue;
+
+      for (SizeType i = 0; i < m; ++i) {
+        const GlobalTileIndex ij(i, j);
+        const comm::IndexT_MPI rank_row = dist.rank_global_tile<Coord::Row>(i);
+
+        if (rank_row == rank.row()) {
+          ex::start_detached(ex::when_all(mat_e.read(ij), mat_e_h.readwrite(ij)) |
+                             matrix::copy(dlaf::internal::Policy<copy_backend<D, Device::CPU>>{}));
+          if (mpi_col_chain.size() > 1)
+            ex::start_detached(comm::schedule_bcast_send(mpi_col_chain.exclusive(), mat_e_h.read(ij)));
+        }
+        else {
+          ex::start_detached(
+              comm::schedule_bcast_recv(mpi_col_chain.exclusive(), rank_row, mat_e_h.readwrite(ij)));
+        }
+      }
+
+      applyQ(mat_e_h, j, eigenvalues_index_begin, eigenvalues_index_end);
+
+      for (SizeType i = 0; i < m; ++i) {
+        const GlobalTileIndex ij(i, j);
+        if (dist.rank_global_tile<Coord::Row>(i) == rank.row())
+          ex::start_detached(ex::when_all(mat_e_h.read(ij), mat_e.readwrite(ij)) |
+                             matrix::copy(dlaf::internal::Policy<copy_backend<Device::CPU, D>>{}));
+      }
+    }
+  }
+
+private:
+  template <Device Source, Device Destination>
+  static constexpr Backend copy_backend = matrix::internal::CopyBackend_v<Source, Destination>;
+
+  static matrix::AllocationSpec col_major_compact() {
+    return matrix::AllocationSpec(matrix::AllocationLayout::ColMajor, matrix::Ld::Compact);
+  }
+
+  // Applies Q to the columns [j_el_begin, j_el_end) of the tile column @p j of @p mat_e_h, where
+  // [j_el_begin, j_el_end) is the intersection of the tile column with [index_begin, index_end).
+  void applyQ(Matrix<T, Device::CPU>& mat_e_h, const SizeType j, const SizeType index_begin,
+              const SizeType index_end) {
+    namespace ex = pika::execution::experimental;
+    using pika::execution::thread_priority;
+
+    const SizeType nb = mat_e_h.blockSize().cols();
+    const SizeType j_el_begin = std::max(index_begin, j * nb);
+    const SizeType j_el_end = std::min(index_end, (j + 1) * nb);
+    const SizeType m = mat_e_h.nrTiles().rows();
+
+    auto unmtr = [jj_el = j_el_begin - j * nb, k = j_el_end - j_el_begin](
+                     auto&& tiles_a, const matrix::Tile<const T, Device::CPU>& tile_taus,
+                     std::vector<TileCPU>&& tiles_e) {
+      const auto& tile_a = tiles_a[0].get();
+      const TileCPU& tile_e = tiles_e[0];
+
+      common::internal::SingleThreadedBlasScope single;
+      if constexpr (isComplex_v<T>)
+        lapack::unmtr(lapack::Side::Left, blas::Uplo::Lower, blas::Op::NoTrans,
+                      tile_taus.size().rows(), k, tile_a.ptr(), tile_a.ld(), tile_taus.ptr(),
+                      tile_e.ptr({0, jj_el}), tile_e.ld());
+      else
+        lapack::ormtr(lapack::Side::Left, blas::Uplo::Lower, blas::Op::NoTrans,
+                      tile_taus.size().rows(), k, tile_a.ptr(), tile_a.ld(), tile_taus.ptr(),
+                      tile_e.ptr({0, jj_el}), tile_e.ld());
+    };
+
+    ex::when_all(ex::when_all_vector(matrix::selectRead(
+                     mat_a_, common::iterate_range2d(mat_a_.distribution().local_nr_tiles()))),
+                 mat_taus_.read(LocalTileIndex(0, 0)),
+                 ex::when_all_vector(matrix::select(
+                     mat_e_h, common::iterate_range2d(LocalTileIndex(0, j), LocalTileSize(m, 1))))) |
+        dlaf::internal::transformDetach(dlaf::internal::Policy<Backend::MC>(thread_priority::normal),
+                                        std::move(unmtr));
+  }
+
+  Matrix<T, Device::CPU> mat_a_;
+  Matrix<T, Device::CPU> mat_taus_;
+  Matrix<BaseType<T>, Device::CPU> mat_trid_;
+};
+}
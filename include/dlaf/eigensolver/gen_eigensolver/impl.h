@@ -44,8 +44,10 @@ void GenEigensolver<B, D, T>::call(blas::Uplo uplo, Matrix<T, D>& mat_a, Matrix<
   auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(eigenvectors, eigenvalues_index_begin,
                                                                  eigenvalues_index_end);
   matrix::internal::MatrixRef eigenvectors_ref(eigenvectors, spec);
-  solver::internal::triangular_solver<B>(blas::Side::Left, uplo, blas::Op::ConjTrans,
-                                         blas::Diag::NonUnit, T(1), mat_b, eigenvectors_ref);
+  // x = L^-H y (B = L L^H) or x = U^-1 y (B = U^H U)
+  const blas::Op op = (uplo == blas::Uplo::Lower) ? blas::Op::ConjTrans : blas::Op::NoTrans;
+  solver::internal::triangular_solver<B>(blas::Side::Left, uplo, op, blas::Diag::NonUnit, T(1),
+                                         mat_b, eigenvectors_ref);
 }
 
 template <Backend B, Device D, class T>
@@ -90,8 +92,10 @@ void GenEigensolver<B, D, T>::call(comm::CommunicatorGrid& grid, blas::Uplo uplo
   auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(eigenvectors, eigenvalues_index_begin,
                                                                  eigenvalues_index_end);
   matrix::internal::MatrixRef eigenvectors_ref(eigenvectors, spec);
-  solver::internal::triangular_solver<B>(grid, blas::Side::Left, uplo, blas::Op::ConjTrans,
-                                         blas::Diag::NonUnit, T(1), mat_b, eigenvectors_ref);
+  // x = L^-H y (B = L L^H) or x = U^-1 y (B = U^H U)
+  const blas::Op op = (uplo == blas::Uplo::Lower) ? blas::Op::ConjTrans : blas::Op::NoTrans;
+  solver::internal::triangular_solver<B>(grid, blas::Side::Left, uplo, op, blas::Diag::NonUnit, T(1),
+                                         mat_b, eigenvectors_ref);
 
 #ifdef DLAF_WITH_HDF5
   if (getTuneParameters().debug_dump_generalized_eigensolver_data) {
@@ -10,19 +10,80 @@
 
 #pragma once
 
+#include <algorithm>
 #include <complex>
+#include <optional>
 
 #include <pika/execution.hpp>
 
+#include <dlaf/common/round_robin.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/panel.h>
 #include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
 
+// Returns the distribution of the taus vector computed by the reduction to band of a matrix distributed
+// according to @p dist_a.
+//
+// It is a column vector distributed over the columns of the grid, which exists locally on all the rows.
+inline matrix::Distribution reductionToBandTausDistribution(const matrix::Distribution& dist_a,
+                                                            const SizeType band_size) {
+  // Note:
+  // Reflector of size = 1 is not considered whatever T is (i.e. neither real nor complex)
+  const SizeType nrefls = std::max<SizeType>(0, dist_a.size().rows() - band_size - 1);
+
+  return matrix::Distribution(GlobalElementSize(nrefls, 1),
+                              TileElementSize(dist_a.block_size().cols(), 1),
+                              comm::Size2D(dist_a.grid_size().cols(), 1),
+                              comm::Index2D(dist_a.rank_index().col(), 0),
+                              comm::Index2D(dist_a.source_rank_index().col(), 0));
+}
+
+// Workspace of the reduction to band, holding the panels used by the steps of the algorithm.
+//
+// The panels are allocated by the first call taking the workspace and they are reused by the following
+// calls (e.g. the ones of EigensolverPlan), unless the distribution of the matrix, the band size or the
+// variant of the algorithm (local or distributed) change, in which case they are allocated again.
+//
+// Note: the members are managed by ReductionToBand::call.
+template <Backend B, Device D, class T>
+struct ReductionToBandWorkspace {
+  template <Coord C, Device PD = D, matrix::StoreTransposed S = matrix::StoreTransposed::No>
+  using Panels = common::RoundRobin<matrix::Panel<C, T, PD, S>>;
+
+  matrix::Distribution dist_a;
+  SizeType band_size = 0;
+  bool distributed = false;
+
+  Panels<Coord::Col> panels_v;
+  Panels<Coord::Col> panels_w;
+  Panels<Coord::Col> panels_x;
+  Panels<Coord::Col> panels_ws;
+
+  // Used just by the distributed variant
+  Panels<Coord::Row, D, matrix::StoreTransposed::Yes> panels_vt;
+  Panels<Coord::Row, D, matrix::StoreTransposed::Yes> panels_wt;
+  Panels<Coord::Row, D, matrix::StoreTransposed::Yes> panels_xt;
+
+  // Used just by the GPU backend for computing the reflectors of the panel on CPU
+  Panels<Coord::Col, Device::CPU> panels_v_h;
+  std::optional<Matrix<T, Device::CPU>> mat_taus_h;
+};
+
 template <Backend B, Device D, class T>
 struct ReductionToBand {
   static Matrix<T, D> call(Matrix<T, D>& mat_a, const SizeType band_size);
+  static void call(Matrix<T, D>& mat_a, const SizeType band_size, Matrix<T, D>& mat_taus);
+  static void call(Matrix<T, D>& mat_a, const SizeType band_size, Matrix<T, D>& mat_taus,
+                   ReductionToBandWorkspace<B, D, T>& workspace);
   static Matrix<T, D> call(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_a, const SizeType band_size);
+  static void call(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_a, const SizeType band_size,
+                   Matrix<T, D>& mat_taus);
+  static void call(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_a, const SizeType band_size,
+                   Matrix<T, D>& mat_taus, ReductionToBandWorkspace<B, D, T>& workspace);
 };
 
 // ETI
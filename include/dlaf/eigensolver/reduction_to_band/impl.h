@@ -861,12 +861,90 @@ void her2kUpdateTrailingMatrix(const matrix::SubMatrixView& view, Matrix<T, D>&
 }
 }
 
+// Allocates the panels of @p ws for the reduction to band of a matrix distributed as @p dist_a with
+// band size @p band_size, unless they have been already allocated for the same problem by a previous
+// call. @p dist_taus is the distribution of the taus retiled with band size blocks.
+template <Backend B, Device D, class T>
+void setupWorkspace(ReductionToBandWorkspace<B, D, T>& ws, const matrix::Distribution& dist_a,
+                    const SizeType band_size, const bool distributed,
+                    const matrix::Distribution& dist_taus) {
+  if (ws.panels_v.size() > 0 && ws.dist_a == dist_a && ws.band_size == band_size &&
+      ws.distributed == distributed)
+    return;
+
+  ws.dist_a = dist_a;
+  ws.band_size = band_size;
+  ws.distributed = distributed;
+
+  // Note:
+  // The local variant uses panels which are just band_size wide, while the distributed one uses panels
+  // with the same distribution of the matrix.
+  const matrix::Distribution dist =
+      distributed ? dist_a
+                  : matrix::Distribution({dist_a.size().rows(), band_size},
+                                         {dist_a.tile_size().rows(), band_size});
+  const matrix::Distribution dist_ws = [&]() {
+    using dlaf::factorization::internal::get_tfactor_num_workers;
+    const SizeType nworkspaces = to_SizeType(std::max<std::size_t>(0, get_tfactor_num_workers<B>() - 1));
+    const SizeType nrefls_step = band_size;
+    return matrix::Distribution{{nworkspaces * nrefls_step, nrefls_step}, {nrefls_step, nrefls_step}};
+  }();
+
+  constexpr std::size_t n_workspaces = 2;
+  ws.panels_v = decltype(ws.panels_v)(n_workspaces, dist);
+  ws.panels_w = decltype(ws.panels_w)(n_workspaces, dist);
+  ws.panels_x = decltype(ws.panels_x)(n_workspaces, dist);
+  ws.panels_ws = decltype(ws.panels_ws)(n_workspaces, dist_ws);
+
+  if (distributed) {
+    ws.panels_vt = decltype(ws.panels_vt)(n_workspaces, dist);
+    ws.panels_wt = decltype(ws.panels_wt)(n_workspaces, dist);
+    ws.panels_xt = decltype(ws.panels_xt)(n_workspaces, dist);
+  }
+  else {
+    ws.panels_vt = decltype(ws.panels_vt)();
+    ws.panels_wt = decltype(ws.panels_wt)();
+    ws.panels_xt = decltype(ws.panels_xt)();
+  }
+
+  // Note:
+  // Here dist_a is given with full panel size instead of dist with just the part actually needeed,
+  // because the GPU Helper internally exploits Panel data-structure. Indeed, the full size panel is
+  // needed in order to mimick Matrix with Panel, so it is possible to apply a SubPanelView to it.
+  //
+  // It is a bit hacky usage, because SubPanelView is not meant to be used with Panel, but just with
+  // Matrix. This results in a variable waste of memory, depending no the ratio band_size/nb.
+  if constexpr (B == Backend::GPU) {
+    ws.panels_v_h = decltype(ws.panels_v_h)(n_workspaces, dist_a);
+    ws.mat_taus_h.emplace(dist_taus);
+  }
+}
+
+// Resets all the panels of @p panels, so that they do not keep references to tiles of the matrix after
+// the end of the algorithm.
+template <class PanelT>
+void resetPanels(common::RoundRobin<PanelT>& panels) {
+  for (std::size_t i = 0; i < panels.size(); ++i)
+    panels.nextResource().reset();
+}
+
+template <Backend B, Device D, class T>
+void resetPanels(ReductionToBandWorkspace<B, D, T>& ws) {
+  resetPanels(ws.panels_v);
+  resetPanels(ws.panels_w);
+  resetPanels(ws.panels_x);
+  resetPanels(ws.panels_ws);
+  resetPanels(ws.panels_vt);
+  resetPanels(ws.panels_wt);
+  resetPanels(ws.panels_xt);
+}
+
 template <Backend B, Device D, class T>
 struct ComputePanelHelper;
 
 template <class T>
 struct ComputePanelHelper<Backend::MC, Device::CPU, T> {
-  ComputePanelHelper(const std::size_t, matrix::Distribution, matrix::Distribution) {}
+  ComputePanelHelper(ReductionToBandWorkspace<Backend::MC, Device::CPU, T>&) {}
 
   void call(Matrix<T, Device::CPU>& mat_a, Matrix<T, Device::CPU>& mat_taus, const SizeType j_sub,
             const matrix::SubPanelView& panel_view) {
@@ -888,9 +966,8 @@ struct ComputePanelHelper<Backend::MC, Device::CPU, T> {
 #ifdef DLAF_WITH_GPU
 template <class T>
 struct ComputePanelHelper<Backend::GPU, Device::GPU, T> {
-  ComputePanelHelper(const std::size_t n_workspaces, matrix::Distribution dist_a,
-                     matrix::Distribution dist_taus)
-      : panels_v(n_workspaces, dist_a), mat_taus_cpu(dist_taus) {}
+  ComputePanelHelper(ReductionToBandWorkspace<Backend::GPU, Device::GPU, T>& ws)
+      : panels_v(ws.panels_v_h), mat_taus_cpu(*ws.mat_taus_h) {}
 
   void call(Matrix<T, Device::GPU>& mat_a, Matrix<T, Device::GPU>& mat_taus, const SizeType j_sub,
             const matrix::SubPanelView& panel_view) {
@@ -939,8 +1016,8 @@ struct ComputePanelHelper<Backend::GPU, Device::GPU, T> {
   }
 
 protected:
-  common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>> panels_v;
-  matrix::Matrix<T, Device::CPU> mat_taus_cpu;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, Device::CPU>>& panels_v;
+  matrix::Matrix<T, Device::CPU>& mat_taus_cpu;
 
   void copyToCPU(const matrix::SubPanelView panel_view, matrix::Matrix<T, Device::GPU>& mat_a,
                  matrix::Panel<Coord::Col, T, Device::CPU>& v) {
@@ -991,6 +1068,22 @@ protected:
 // Local implementation of reduction to band
 template <Backend B, Device D, class T>
 Matrix<T, D> ReductionToBand<B, D, T>::call(Matrix<T, D>& mat_a, const SizeType band_size) {
+  Matrix<T, D> mat_taus(reductionToBandTausDistribution(mat_a.distribution(), band_size));
+  call(mat_a, band_size, mat_taus);
+  return mat_taus;
+}
+
+template <Backend B, Device D, class T>
+void ReductionToBand<B, D, T>::call(Matrix<T, D>& mat_a, const SizeType band_size,
+                                    Matrix<T, D>& mat_taus) {
+  ReductionToBandWorkspace<B, D, T> workspace;
+  call(mat_a, band_size, mat_taus, workspace);
+}
+
+template <Backend B, Device D, class T>
+void ReductionToBand<B, D, T>::call(Matrix<T, D>& mat_a, const SizeType band_size,
+                                    Matrix<T, D>& mat_taus,
+                                    ReductionToBandWorkspace<B, D, T>& workspace) {
   using dlaf::matrix::Matrix;
   using dlaf::matrix::Panel;
 
@@ -1011,14 +1104,11 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(Matrix<T, D>& mat_a, const SizeType
 
   // Row-vector that is distributed over columns, but exists locally on all rows of the grid
   DLAF_ASSERT(mat_a.blockSize().cols() % band_size == 0, mat_a.blockSize().cols(), band_size);
-  Matrix<T, D> mat_taus(matrix::Distribution(GlobalElementSize(nrefls, 1),
-                                             TileElementSize(mat_a.blockSize().cols(), 1),
-                                             comm::Size2D(mat_a.commGridSize().cols(), 1),
-                                             comm::Index2D(mat_a.rankIndex().col(), 0),
-                                             comm::Index2D(mat_a.sourceRankIndex().col(), 0)));
+  DLAF_ASSERT(mat_taus.distribution() == reductionToBandTausDistribution(dist_a, band_size),
+              mat_taus, band_size);
 
   if (nrefls == 0)
-    return mat_taus;
+    return;
 
   Matrix<T, D> mat_taus_retiled =
       mat_taus.retiledSubPipeline(LocalTileSize(mat_a.blockSize().cols() / band_size, 1));
@@ -1028,28 +1118,13 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(Matrix<T, D>& mat_a, const SizeType
 
   const bool is_full_band = (band_size == dist_a.tile_size().cols());
 
-  constexpr std::size_t n_workspaces = 2;
-  common::RoundRobin<Panel<Coord::Col, T, D>> panels_v(n_workspaces, dist);
-  common::RoundRobin<Panel<Coord::Col, T, D>> panels_w(n_workspaces, dist);
-  common::RoundRobin<Panel<Coord::Col, T, D>> panels_x(n_workspaces, dist);
+  red2band::setupWorkspace(workspace, dist_a, band_size, false, mat_taus_retiled.distribution());
+  auto& panels_v = workspace.panels_v;
+  auto& panels_w = workspace.panels_w;
+  auto& panels_x = workspace.panels_x;
+  auto& panels_ws = workspace.panels_ws;
 
-  const auto dist_ws = [&]() {
-    using dlaf::factorization::internal::get_tfactor_num_workers;
-    const SizeType nworkspaces = to_SizeType(std::max<std::size_t>(0, get_tfactor_num_workers<B>() - 1));
-    const SizeType nrefls_step = dist.tile_size().cols();
-    return matrix::Distribution{{nworkspaces * nrefls_step, nrefls_step}, {nrefls_step, nrefls_step}};
-  }();
-  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panels_ws(n_workspaces, dist_ws);
-
-  // Note:
-  // Here dist_a is given with full panel size instead of dist with just the part actually needeed,
-  // because the GPU Helper internally exploits Panel data-structure. Indeed, the full size panel is
-  // needed in order to mimick Matrix with Panel, so it is possible to apply a SubPanelView to it.
-  //
-  // It is a bit hacky usage, because SubPanelView is not meant to be used with Panel, but just with
-  // Matrix. This results in a variable waste of memory, depending no the ratio band_size/nb.
-  red2band::ComputePanelHelper<B, D, T> compute_panel_helper(n_workspaces, dist_a,
-                                                             mat_taus_retiled.distribution());
+  red2band::ComputePanelHelper<B, D, T> compute_panel_helper(workspace);
 
   for (SizeType j_sub = 0; j_sub < ntiles; ++j_sub) {
     const auto i_sub = j_sub + 1;
@@ -1142,13 +1217,31 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(Matrix<T, D>& mat_a, const SizeType
     v.reset();
   }
 
-  return mat_taus;
+  // Note: the panels of the workspace must not keep references to the tiles of mat_a (e.g. v after the
+  // last step).
+  red2band::resetPanels(workspace);
 }
 
 // Distributed implementation of reduction to band
 template <Backend B, Device D, class T>
 Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_a,
                                             const SizeType band_size) {
+  Matrix<T, D> mat_taus(reductionToBandTausDistribution(mat_a.distribution(), band_size));
+  call(grid, mat_a, band_size, mat_taus);
+  return mat_taus;
+}
+
+template <Backend B, Device D, class T>
+void ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_a,
+                                    const SizeType band_size, Matrix<T, D>& mat_taus) {
+  ReductionToBandWorkspace<B, D, T> workspace;
+  call(grid, mat_a, band_size, mat_taus, workspace);
+}
+
+template <Backend B, Device D, class T>
+void ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_a,
+                                    const SizeType band_size, Matrix<T, D>& mat_taus,
+                                    ReductionToBandWorkspace<B, D, T>& workspace) {
   using namespace red2band::distributed;
 
   using common::iterate_range2d;
@@ -1171,6 +1264,10 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
   auto mpi_col_chain = grid.col_communicator_pipeline();
   auto mpi_col_chain_panel = grid.col_communicator_pipeline();
 
+  const auto bcast_algorithm = getTuneParameters().red2band_broadcast_panel_ring
+                                   ? comm::BroadcastPanelAlgorithm::ring
+                                   : comm::BroadcastPanelAlgorithm::collective;
+
 #ifdef DLAF_WITH_HDF5
   static std::atomic<size_t> num_reduction_to_band_calls = 0;
   std::stringstream fname;
@@ -1193,11 +1290,8 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
 
   // Row-vector that is distributed over columns, but exists locally on all rows of the grid
   DLAF_ASSERT(mat_a.blockSize().cols() % band_size == 0, mat_a.blockSize().cols(), band_size);
-  Matrix<T, D> mat_taus(matrix::Distribution(GlobalElementSize(nrefls, 1),
-                                             TileElementSize(mat_a.blockSize().cols(), 1),
-                                             comm::Size2D(mat_a.commGridSize().cols(), 1),
-                                             comm::Index2D(mat_a.rankIndex().col(), 0),
-                                             comm::Index2D(mat_a.sourceRankIndex().col(), 0)));
+  DLAF_ASSERT(mat_taus.distribution() == reductionToBandTausDistribution(dist, band_size),
+              mat_taus, band_size);
 
   if (nrefls == 0) {
 #ifdef DLAF_WITH_HDF5
@@ -1208,7 +1302,7 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
     num_reduction_to_band_calls++;
 #endif
 
-    return mat_taus;
+    return;
   }
 
   Matrix<T, D> mat_taus_retiled =
@@ -1220,18 +1314,15 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
 
   const bool is_full_band = (band_size == dist.tile_size().cols());
 
-  constexpr std::size_t n_workspaces = 2;
-  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panels_v(n_workspaces, dist);
-  common::RoundRobin<matrix::Panel<Coord::Row, T, D, matrix::StoreTransposed::Yes>> panels_vt(
-      n_workspaces, dist);
-
-  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panels_w(n_workspaces, dist);
-  common::RoundRobin<matrix::Panel<Coord::Row, T, D, matrix::StoreTransposed::Yes>> panels_wt(
-      n_workspaces, dist);
+  red2band::setupWorkspace(workspace, dist, band_size, true, mat_taus_retiled.distribution());
+  auto& panels_v = workspace.panels_v;
+  auto& panels_vt = workspace.panels_vt;
+  auto& panels_w = workspace.panels_w;
+  auto& panels_wt = workspace.panels_wt;
+  auto& panels_x = workspace.panels_x;
+  auto& panels_xt = workspace.panels_xt;
+  auto& panels_ws = workspace.panels_ws;
 
-  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panels_x(n_workspaces, dist);
-  common::RoundRobin<matrix::Panel<Coord::Row, T, D, matrix::StoreTransposed::Yes>> panels_xt(
-      n_workspaces, dist);
   const SizeType nr_tiles = dist.nr_tiles().rows();
   auto set_range_panelT = [nr_tiles, mb = dist.tile_size().rows()](auto& panelT,
                                                                    const GlobalElementIndex& at_offset) {
@@ -1245,16 +1336,7 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
     }
   };
 
-  const auto dist_ws = [&]() {
-    using dlaf::factorization::internal::get_tfactor_num_workers;
-    const SizeType nworkspaces = to_SizeType(std::max<std::size_t>(0, get_tfactor_num_workers<B>() - 1));
-    const SizeType nrefls_step = band_size;
-    return matrix::Distribution{{nworkspaces * nrefls_step, nrefls_step}, {nrefls_step, nrefls_step}};
-  }();
-  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panels_ws(n_workspaces, dist_ws);
-
-  red2band::ComputePanelHelper<B, D, T> compute_panel_helper(n_workspaces, dist,
-                                                             mat_taus_retiled.distribution());
+  red2band::ComputePanelHelper<B, D, T> compute_panel_helper(workspace);
 
   ex::unique_any_sender<> trigger_panel{ex::just()};
   for (SizeType j_sub = 0; j_sub < nr_sub_tiles; ++j_sub) {
@@ -1318,7 +1400,7 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
 
     const matrix::SubMatrixView trailing_matrix_view(dist, at_offset);
 
-    comm::broadcast(rank_v0.col(), v, vt, mpi_row_chain, mpi_col_chain);
+    comm::broadcast(rank_v0.col(), v, vt, mpi_row_chain, mpi_col_chain, bcast_algorithm);
 
     // W = V . T
     auto& w = panels_w.nextResource();
@@ -1333,7 +1415,7 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
     if (is_panel_rank_col)
       red2band::local::trmmComputeW<B, D>(w, v, t.read(t_idx));
 
-    comm::broadcast(rank_v0.col(), w, wt, mpi_row_chain, mpi_col_chain);
+    comm::broadcast(rank_v0.col(), w, wt, mpi_row_chain, mpi_col_chain, bcast_algorithm);
 
     // X = At . W
     auto& x = panels_x.nextResource();
@@ -1398,7 +1480,7 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
 
     xt.setHeight(nrefls_tile);
 
-    comm::broadcast(rank_v0.col(), x, xt, mpi_row_chain, mpi_col_chain);
+    comm::broadcast(rank_v0.col(), x, xt, mpi_row_chain, mpi_col_chain, bcast_algorithm);
 
     // TRAILING MATRIX UPDATE
 
@@ -1503,6 +1585,10 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
     v.reset();
   }
 
+  // Note: the panels of the workspace must not keep references to the tiles of mat_a (e.g. v after the
+  // last step).
+  red2band::resetPanels(workspace);
+
 #ifdef DLAF_WITH_HDF5
   if (getTuneParameters().debug_dump_reduction_to_band_data) {
     file->write(mat_a, "/band");
@@ -1510,7 +1596,5 @@ Matrix<T, D> ReductionToBand<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix
 
   num_reduction_to_band_calls++;
 #endif
-
-  return mat_taus;
 }
 }
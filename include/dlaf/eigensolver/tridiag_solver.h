@@ -20,6 +20,41 @@
 
 namespace dlaf::eigensolver::internal {
 
+/// Finds the eigenvalues of the local symmetric tridiagonal matrix @p tridiag.
+///
+/// @param tridiag local matrix with the diagonal and off-diagonal of the symmetric tridiagonal
+///                matrix in the first column and second columns respectively. The last entry of the
+///                second column is not used.
+/// @pre @p tridiag is not distributed
+/// @pre @p tridiag has size (N x 2)
+/// @pre @p tridiag has block size (NB x 2)
+/// @pre @p tridiag has tile size (NB x 2)
+///
+/// @param[out] evals contains the eigenvalues of the symmetric tridiagonal matrix
+/// @pre @p evals is not distributed
+/// @pre @p evals has size (N x 1)
+/// @pre @p evals has block size (NB x 1)
+/// @pre @p evals has tile size (NB x 1)
+template <Backend backend, Device device, class T>
+void tridiagonal_eigensolver(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals) {
+  static_assert(!isComplex_v<T>, "tridiag and evals have to be real");
+
+  DLAF_ASSERT(matrix::local_matrix(tridiag), tridiag);
+  DLAF_ASSERT(tridiag.size().cols() == 2, tridiag);
+  DLAF_ASSERT(tridiag.block_size().cols() == 2, tridiag);
+  DLAF_ASSERT(matrix::single_tile_per_block(tridiag), tridiag);
+
+  DLAF_ASSERT(matrix::local_matrix(evals), evals);
+  DLAF_ASSERT(evals.size().cols() == 1, evals);
+  DLAF_ASSERT(matrix::single_tile_per_block(evals), evals);
+
+  DLAF_ASSERT(tridiag.block_size().rows() == evals.block_size().rows(), tridiag.block_size().rows(),
+              evals.block_size().rows());
+  DLAF_ASSERT(tridiag.size().rows() == evals.size().rows(), tridiag.size().rows(), evals.size().rows());
+
+  TridiagSolver<backend, device, T>::call(tridiag, evals);
+}
+
 /// Finds the eigenvalues and eigenvectors of the local symmetric tridiagonal matrix @p tridiag.
 ///
 /// @param tridiag local matrix with the diagonal and off-diagonal of the symmetric tridiagonal
@@ -69,6 +104,103 @@ void tridiagonal_eigensolver(Matrix<BaseType<T>, Device::CPU>& tridiag,
   TridiagSolver<backend, device, BaseType<T>>::call(tridiag, evals, evecs);
 }
 
+/// Finds all the eigenvalues and the eigenvectors with index in [@p evals_begin, @p evals_end) of the
+/// local symmetric tridiagonal matrix @p tridiag.
+///
+/// If the number of requested eigenvectors is small compared to N (see
+/// TuneParameters::tridiag_partial_spectrum_threshold), only the requested eigenvectors are computed
+/// with the MRRR algorithm, otherwise all of them are computed with the D&C algorithm.
+///
+/// @param tridiag local matrix with the diagonal and off-diagonal of the symmetric tridiagonal
+///                matrix in the first column and second columns respectively. The last entry of the
+///                second column is not used.
+/// @pre @p tridiag is not distributed
+/// @pre @p tridiag has size (N x 2)
+/// @pre @p tridiag has block size (NB x 2)
+/// @pre @p tridiag has tile size (NB x 2)
+///
+/// @param[out] evals contains the eigenvalues of the symmetric tridiagonal matrix
+/// @pre @p evals is not distributed
+/// @pre @p evals has size (N x 1)
+/// @pre @p evals has block size (NB x 1)
+/// @pre @p evals has tile size (NB x 1)
+///
+/// @param[out] evecs contains in the columns [@p evals_begin, @p evals_end) the corresponding
+///             eigenvectors of the symmetric tridiagonal matrix, the other columns are unspecified
+/// @pre @p evecs is not distributed
+/// @pre @p evecs has size (N x M) with @p evals_end <= M <= N
+/// @pre @p evecs has block size (NB x NB)
+/// @pre @p evecs has tile size (NB x NB)
+///
+/// @pre 0 <= @p evals_begin <= @p evals_end <= N
+template <Backend backend, Device device, class T>
+void tridiagonal_eigensolver(Matrix<BaseType<T>, Device::CPU>& tridiag,
+                             Matrix<BaseType<T>, device>& evals, Matrix<T, device>& evecs,
+                             const SizeType evals_begin, const SizeType evals_end) {
+  DLAF_ASSERT(matrix::local_matrix(tridiag), tridiag);
+  DLAF_ASSERT(tridiag.size().cols() == 2, tridiag);
+  DLAF_ASSERT(tridiag.block_size().cols() == 2, tridiag);
+  DLAF_ASSERT(matrix::single_tile_per_block(tridiag), tridiag);
+
+  DLAF_ASSERT(matrix::local_matrix(evals), evals);
+  DLAF_ASSERT(evals.size().cols() == 1, evals);
+
+  DLAF_ASSERT(matrix::local_matrix(evecs), evecs);
+  DLAF_ASSERT(evecs.size().cols() <= evecs.size().rows(), evecs);
+  DLAF_ASSERT(matrix::square_block_size(evecs), evecs);
+
+  DLAF_ASSERT(matrix::single_tile_per_block(evecs), evecs);
+  DLAF_ASSERT(matrix::single_tile_per_block(evals), evals);
+
+  DLAF_ASSERT(tridiag.block_size().rows() == evecs.block_size().rows(), evecs.block_size().rows(),
+              tridiag.block_size().rows());
+  DLAF_ASSERT(tridiag.block_size().rows() == evals.block_size().rows(), tridiag.block_size().rows(),
+              evals.block_size().rows());
+  DLAF_ASSERT(tridiag.size().rows() == evecs.size().rows(), evecs.size().rows(), tridiag.size().rows());
+  DLAF_ASSERT(tridiag.size().rows() == evals.size().rows(), tridiag.size().rows(), evals.size().rows());
+
+  DLAF_ASSERT(0 <= evals_begin && evals_begin <= evals_end, evals_begin, evals_end);
+  DLAF_ASSERT(evals_end <= evecs.size().cols(), evals_end, evecs.size().cols());
+
+  TridiagSolver<backend, device, BaseType<T>>::call(tridiag, evals, evecs, evals_begin, evals_end);
+}
+
+/// Finds the eigenvalues of the symmetric tridiagonal matrix @p tridiag stored locally on each rank.
+/// The resulting eigenvalues @p evals are stored locally on each rank.
+///
+/// @param tridiag matrix with the diagonal and off-diagonal of the symmetric tridiagonal matrix in the
+///                first column and second columns respectively. The last entry of the second column is
+///                not used.
+/// @pre @p tridiag is not distributed
+/// @pre @p tridiag has size (N x 2)
+/// @pre @p tridiag has block size (NB x 2)
+/// @pre @p tridiag has tile size (NB x 2)
+///
+/// @param[out] evals holds the eigenvalues of the symmetric tridiagonal matrix
+/// @pre @p evals is not distributed
+/// @pre @p evals has size (N x 1)
+/// @pre @p evals has block size (NB x 1)
+/// @pre @p evals has tile size (NB x 1)
+template <Backend B, Device D, class T>
+void tridiagonal_eigensolver(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                             Matrix<T, D>& evals) {
+  static_assert(!isComplex_v<T>, "tridiag and evals have to be real");
+
+  DLAF_ASSERT(matrix::local_matrix(tridiag), tridiag);
+  DLAF_ASSERT(tridiag.size().cols() == 2, tridiag);
+  DLAF_ASSERT(tridiag.block_size().cols() == 2, tridiag);
+  DLAF_ASSERT(matrix::single_tile_per_block(tridiag), tridiag);
+
+  DLAF_ASSERT(matrix::local_matrix(evals), evals);
+  DLAF_ASSERT(evals.size().cols() == 1, evals);
+  DLAF_ASSERT(matrix::single_tile_per_block(evals), evals);
+
+  DLAF_ASSERT(tridiag.block_size().rows() == evals.block_size().rows(), tridiag, evals);
+  DLAF_ASSERT(tridiag.size().rows() == evals.size().rows(), tridiag, evals);
+
+  TridiagSolver<B, D, T>::call(grid, tridiag, evals);
+}
+
 /// Finds the eigenvalues and eigenvectors of the symmetric tridiagonal matrix @p tridiag stored locally
 /// on each rank. The resulting eigenvalues @p evals are stored locally on each rank while the resulting
 /// eigenvectors @p evecs are distributed across ranks in 2D block-cyclic manner.
@@ -118,4 +250,66 @@ void tridiagonal_eigensolver(comm::CommunicatorGrid& grid, Matrix<BaseType<T>, D
   TridiagSolver<B, D, BaseType<T>>::call(grid, tridiag, evals, evecs);
 }
 
+/// Finds all the eigenvalues and the eigenvectors with index in [@p evals_begin, @p evals_end) of the
+/// symmetric tridiagonal matrix @p tridiag stored locally on each rank. The resulting eigenvalues
+/// @p evals are stored locally on each rank while the resulting eigenvectors @p evecs are distributed
+/// across ranks in 2D block-cyclic manner.
+///
+/// If the number of requested eigenvectors is small compared to N (see
+/// TuneParameters::tridiag_partial_spectrum_threshold), each rank computes with the MRRR algorithm only
+/// the requested eigenvectors and stores the ones of its local tiles, otherwise all of them are computed
+/// with the distributed D&C algorithm.
+///
+/// @param tridiag matrix with the diagonal and off-diagonal of the symmetric tridiagonal matrix in the
+///                first column and second columns respectively. The last entry of the second column is
+///                not used.
+/// @pre @p tridiag is not distributed
+/// @pre @p tridiag has size (N x 2)
+/// @pre @p tridiag has block size (NB x 2)
+/// @pre @p tridiag has tile size (NB x 2)
+///
+/// @param[out] evals holds the eigenvalues of the symmetric tridiagonal matrix
+/// @pre @p evals is not distributed
+/// @pre @p evals has size (N x 1)
+/// @pre @p evals has block size (NB x 1)
+/// @pre @p evals has tile size (NB x 1)
+///
+/// @param[out] evecs holds in the columns [@p evals_begin, @p evals_end) the corresponding eigenvectors
+///             of the symmetric tridiagonal matrix, the other columns are unspecified
+/// @pre @p evecs is distributed according to @p grid
+/// @pre @p evecs has size (N x M) with @p evals_end <= M <= N
+/// @pre @p evecs has block size (NB x NB)
+/// @pre @p evecs has tile size (NB x NB)
+///
+/// @pre 0 <= @p evals_begin <= @p evals_end <= N
+template <Backend B, Device D, class T>
+void tridiagonal_eigensolver(comm::CommunicatorGrid& grid, Matrix<BaseType<T>, Device::CPU>& tridiag,
+                             Matrix<BaseType<T>, D>& evals, Matrix<T, D>& evecs,
+                             const SizeType evals_begin, const SizeType evals_end) {
+  DLAF_ASSERT(matrix::local_matrix(tridiag), tridiag);
+  DLAF_ASSERT(tridiag.size().cols() == 2, tridiag);
+  DLAF_ASSERT(tridiag.block_size().cols() == 2, tridiag);
+  DLAF_ASSERT(matrix::single_tile_per_block(tridiag), tridiag);
+
+  DLAF_ASSERT(matrix::local_matrix(evals), evals);
+  DLAF_ASSERT(evals.size().cols() == 1, evals);
+
+  DLAF_ASSERT(evecs.size().cols() <= evecs.size().rows(), evecs);
+  DLAF_ASSERT(matrix::square_block_size(evecs), evecs);
+  DLAF_ASSERT(matrix::equal_process_grid(evecs, grid), evecs, grid);
+
+  DLAF_ASSERT(matrix::single_tile_per_block(evecs), evecs);
+  DLAF_ASSERT(matrix::single_tile_per_block(evals), evals);
+
+  DLAF_ASSERT(tridiag.block_size().rows() == evecs.block_size().rows(), evecs, tridiag);
+  DLAF_ASSERT(tridiag.block_size().rows() == evals.block_size().rows(), tridiag, evals);
+  DLAF_ASSERT(tridiag.size().rows() == evecs.size().rows(), evecs, tridiag);
+  DLAF_ASSERT(tridiag.size().rows() == evals.size().rows(), tridiag, evals);
+
+  DLAF_ASSERT(0 <= evals_begin && evals_begin <= evals_end, evals_begin, evals_end);
+  DLAF_ASSERT(evals_end <= evecs.size().cols(), evals_end, evecs.size().cols());
+
+  TridiagSolver<B, D, BaseType<T>>::call(grid, tridiag, evals, evecs, evals_begin, evals_end);
+}
+
 }
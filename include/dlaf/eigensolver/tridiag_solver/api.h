@@ -10,21 +10,123 @@
 #pragma once
 
 #include <complex>
+#include <optional>
 
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/eigensolver/tridiag_solver/coltype.h>
+#include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/types.h>
 
 namespace dlaf::eigensolver::internal {
 
+// Returns the distribution of all the (n x n) eigenvectors of a problem whose eigenvectors are stored
+// in a (n x m) matrix distributed as @p dist_evecs (m <= n), i.e. the one with the same block size,
+// tile size and process grid of @p dist_evecs.
+inline matrix::Distribution allEigenvectorsDistribution(const matrix::Distribution& dist_evecs) {
+  const SizeType n = dist_evecs.size().rows();
+  return matrix::Distribution(GlobalElementSize(n, n), dist_evecs.block_size(), dist_evecs.tile_size(),
+                              dist_evecs.grid_size(), dist_evecs.rank_index(),
+                              dist_evecs.source_rank_index());
+}
+
+// Workspace of the D&C tridiagonal eigensolver for eigenvectors distributed as `dist_evecs`.
+//
+// It holds the matrices used by the merges of the D&C algorithm, so that repeated calls taking the same
+// workspace (e.g. the ones of EigensolverPlan) do not allocate them again.
+// The eigenvectors passed to the solver may have less than n columns (see TridiagSolver), the
+// workspace is always sized for all the (n x n) eigenvectors (see allEigenvectorsDistribution).
+//
+// Note: the (n x n) matrices and the host mirrors of the device matrices are allocated on first use,
+//       as the ones needed depend on the variant of the algorithm (local or distributed), on the type of
+//       the eigenvectors (real or complex), on the number of eigenvectors stored and on the device.
+template <class T, Device D>
+struct TridiagSolverWorkspace {
+  explicit TridiagSolverWorkspace(const matrix::Distribution& dist_evecs)
+      : dist_evecs(allEigenvectorsDistribution(dist_evecs)),
+        dist_vec(LocalElementSize(dist_evecs.size().rows(), 1),
+                 TileElementSize(dist_evecs.tile_size().rows(), 1)),
+        z0(dist_vec), z1(dist_vec), i2(dist_vec), i5(dist_vec),
+        i5b(matrix::Distribution(LocalElementSize(this->dist_evecs.local_size().cols(), 1),
+                                 dist_evecs.tile_size())),
+        i6(dist_vec), d0(dist_vec), c(dist_vec), i1(dist_vec), i3(dist_vec), i4(dist_vec) {}
+
+  matrix::Distribution dist_evecs;
+  matrix::Distribution dist_vec;
+
+  // Returns `evecs`, allocating it on first use.
+  Matrix<T, D>& realEigenvectors() {
+    if (!evecs.has_value())
+      evecs.emplace(dist_evecs);
+    return *evecs;
+  }
+
+  // (n x n)
+  std::optional<Matrix<T, D>> e0;
+  std::optional<Matrix<T, D>> e1;
+  // All the real eigenvectors, for the problems with complex eigenvectors (see BackTransformationT2B)
+  // or when the D&C algorithm is used and only some of the eigenvectors are stored.
+  std::optional<Matrix<T, D>> evecs;
+
+  // (n x 1)
+  Matrix<T, D> z0;
+  Matrix<T, D> z1;
+  Matrix<SizeType, D> i2;
+  Matrix<SizeType, D> i5;
+  Matrix<SizeType, D> i5b;
+  Matrix<SizeType, D> i6;
+
+  Matrix<T, Device::CPU> d0;
+  Matrix<ColType, Device::CPU> c;
+  Matrix<SizeType, Device::CPU> i1;
+  Matrix<SizeType, Device::CPU> i3;
+  Matrix<SizeType, Device::CPU> i4;
+
+  // Host mirrors for CPU-only kernels (used just if D == Device::GPU)
+  std::optional<Matrix<T, Device::CPU>> e0_h;
+  std::optional<Matrix<T, Device::CPU>> e2_h;
+  std::optional<Matrix<T, Device::CPU>> d1_h;
+  std::optional<Matrix<T, Device::CPU>> z0_h;
+  std::optional<Matrix<T, Device::CPU>> z1_h;
+  std::optional<Matrix<SizeType, Device::CPU>> i2_h;
+  std::optional<Matrix<SizeType, Device::CPU>> i5_h;
+  std::optional<Matrix<SizeType, Device::CPU>> i5b_h;
+  std::optional<Matrix<SizeType, Device::CPU>> i6_h;
+};
+
 template <Backend backend, Device device, class T>
 struct TridiagSolver {
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals);
   static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals, Matrix<T, device>& evecs);
   static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals,
                    Matrix<std::complex<T>, device>& evecs);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals, Matrix<T, device>& evecs,
+                   SizeType evals_begin, SizeType evals_end);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals,
+                   Matrix<std::complex<T>, device>& evecs, SizeType evals_begin, SizeType evals_end);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals, Matrix<T, device>& evecs,
+                   SizeType evals_begin, SizeType evals_end, TridiagSolverWorkspace<T, device>& ws);
+  static void call(Matrix<T, Device::CPU>& tridiag, Matrix<T, device>& evals,
+                   Matrix<std::complex<T>, device>& evecs, SizeType evals_begin, SizeType evals_end,
+                   TridiagSolverWorkspace<T, device>& ws);
+  static void call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                   Matrix<T, device>& evals);
   static void call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
                    Matrix<T, device>& evals, Matrix<T, device>& evecs);
   static void call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
                    Matrix<T, device>& evals, Matrix<std::complex<T>, device>& evecs);
+  static void call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                   Matrix<T, device>& evals, Matrix<T, device>& evecs, SizeType evals_begin,
+                   SizeType evals_end);
+  static void call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                   Matrix<T, device>& evals, Matrix<std::complex<T>, device>& evecs,
+                   SizeType evals_begin, SizeType evals_end);
+  static void call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                   Matrix<T, device>& evals, Matrix<T, device>& evecs, SizeType evals_begin,
+                   SizeType evals_end, TridiagSolverWorkspace<T, device>& ws);
+  static void call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                   Matrix<T, device>& evals, Matrix<std::complex<T>, device>& evecs,
+                   SizeType evals_begin, SizeType evals_end, TridiagSolverWorkspace<T, device>& ws);
 };
 
 // ETI
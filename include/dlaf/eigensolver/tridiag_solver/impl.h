@@ -11,9 +11,14 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <complex>
+#include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -25,20 +30,27 @@
 #endif
 
 #include <dlaf/common/callable_object.h>
+#include <dlaf/common/single_threaded_blas.h>
+#include <dlaf/common/timer.h>
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/communication/communicator_pipeline.h>
 #include <dlaf/communication/index.h>
 #include <dlaf/eigensolver/tridiag_solver/api.h>
 #include <dlaf/eigensolver/tridiag_solver/kernels_async.h>
 #include <dlaf/eigensolver/tridiag_solver/merge.h>
+#include <dlaf/eigensolver/tridiag_solver/tile_collector.h>
 #include <dlaf/lapack/tile.h>
+#include <dlaf/matrix/copy.h>
 #include <dlaf/matrix/copy_tile.h>
 #include <dlaf/matrix/hdf5.h>
+#include <dlaf/matrix/matrix_ref.h>
 #include <dlaf/permutations/general.h>
 #include <dlaf/permutations/general/impl.h>
 #include <dlaf/sender/make_sender_algorithm_overloads.h>
 #include <dlaf/sender/policy.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
 
 namespace dlaf::eigensolver::internal {
 
@@ -75,6 +87,158 @@ inline std::vector<std::tuple<SizeType, SizeType, SizeType>> generateSubproblemI
   return indices;
 }
 
+// Groups the triads generated by generateSubproblemIndices by level of the D&C tree, i.e. level 0
+// contains the merges of two leaves and each merge belongs to the level above the highest one of the
+// merges of its two subproblems. Within each level, triads are in the same order as in
+// generateSubproblemIndices.
+//
+inline std::vector<std::vector<std::tuple<SizeType, SizeType, SizeType>>> groupSubproblemIndicesByLevel(
+    const SizeType n) {
+  std::vector<std::vector<std::tuple<SizeType, SizeType, SizeType>>> levels;
+  for (const auto& indices : generateSubproblemIndices(n)) {
+    const auto [i_begin, i_split, i_end] = indices;
+
+    // Since intervals are split in the middle, an interval of m tiles is merged at level
+    // ceil(log2(m)) - 1.
+    std::size_t level = 0;
+    for (SizeType m = i_end - i_begin; m > 2; m = util::ceilDiv<SizeType>(m, 2))
+      ++level;
+
+    if (levels.size() <= level)
+      levels.resize(level + 1);
+    levels[level].push_back(indices);
+  }
+  return levels;
+}
+
+// Per-level statistics of the merges of the D&C tree.
+//
+// For each level it reports the number of merges, the size (in tiles) of the largest one and the time
+// (since the construction of the object) at which the first and the last merge of the level completed.
+class MergeTreeStats {
+public:
+  MergeTreeStats(const std::vector<std::vector<std::tuple<SizeType, SizeType, SizeType>>>& levels) {
+    levels_.reserve(levels.size());
+    for (const auto& level : levels) {
+      SizeType max_nrtiles = 0;
+      for (const auto& [i_begin, i_split, i_end] : level)
+        max_nrtiles = std::max(max_nrtiles, i_end - i_begin);
+      levels_.push_back({to_SizeType(level.size()), max_nrtiles, 0, 0, 0});
+    }
+  }
+
+  void mergeDone(const std::size_t level) {
+    const double time = timer_.elapsed();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    LevelStats& stats = levels_[level];
+    stats.first_done = stats.nr_done == 0 ? time : std::min(stats.first_done, time);
+    stats.last_done = std::max(stats.last_done, time);
+    ++stats.nr_done;
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const MergeTreeStats& stats) {
+    for (std::size_t level = 0; level < stats.levels_.size(); ++level) {
+      const LevelStats& level_stats = stats.levels_[level];
+      os << "[tridiag_solver] merge level " << level << ": " << level_stats.nr_merges
+         << " merges of up to " << level_stats.max_nrtiles << " tiles, completed in ["
+         << level_stats.first_done << "s, " << level_stats.last_done << "s]" << std::endl;
+    }
+    return os;
+  }
+
+private:
+  struct LevelStats {
+    SizeType nr_merges;
+    SizeType max_nrtiles;
+    SizeType nr_done;
+    double first_done;
+    double last_done;
+  };
+
+  common::Timer<> timer_;
+  std::mutex mutex_;
+  std::vector<LevelStats> levels_;
+};
+
+// Returns a sender which completes when the merge of the subproblem [i_begin, i_end) is done, i.e. when
+// the tiles of @p evecs and @p index in the range, which are the last ones written by the merge, are
+// available.
+template <class T, Device D>
+auto subproblemMerged(const SizeType i_begin, const SizeType i_end, Matrix<const T, D>& evecs,
+                      Matrix<const SizeType, Device::CPU>& index) {
+  namespace ex = pika::execution::experimental;
+
+  TileCollector tc{i_begin, i_end};
+  return ex::when_all(ex::when_all_vector(tc.read(evecs)), ex::when_all_vector(tc.read(index))) |
+         ex::drop_value();
+}
+
+// Makes all the steps of the merge of the subproblem [i_begin, i_end), which are scheduled afterwards,
+// wait for the completion of the sender @p dep.
+//
+// The tiles of the subproblem of each of @p mats are accessed in read-write mode until @p dep completes,
+// therefore @p mats have to include, for each step of the merge, at least one matrix accessed by the
+// step or by one of the steps it depends on.
+template <class... Ts, Device... Ds>
+void waitBeforeMerge(const SizeType i_begin, const SizeType i_end,
+                     pika::execution::experimental::unique_any_sender<> dep, Matrix<Ts, Ds>&... mats) {
+  namespace ex = pika::execution::experimental;
+
+  TileCollector tc{i_begin, i_end};
+  ex::start_detached(ex::when_all(std::move(dep), ex::when_all_vector(tc.readwrite(mats))...) |
+                     ex::drop_value());
+}
+
+// Schedules the merges of the D&C tree of @p nrtiles leaves, level by level starting from the leaves.
+//
+// @p merge_fn(i_begin, i_split, i_end, dep, track) has to schedule the merge of the subproblems
+// [i_begin, i_split) and [i_split, i_end) such that none of its steps starts before the sender `dep`
+// completes (see waitBeforeMerge), and it has to return a sender which completes when the merge is
+// done (if `track` is false the returned sender is not used and it can be ex::just()).
+//
+// Merges access only the tiles of their subproblem, therefore each merge depends just on the merges of
+// its two subproblems: merges of the same level, as well as merges of independent sub-trees at
+// different levels, can run concurrently. The number of merges running concurrently can be limited
+// with getTuneParameters().tridiag_max_concurrent_merges: each merge waits for the completion of the
+// one scheduled tridiag_max_concurrent_merges merges before it.
+//
+// If getTuneParameters().debug_tridiag_solver_merge_stats is enabled and @p print_stats_rank is true,
+// the statistics of the merges of each level are printed once all merges are done.
+template <class MergeFn>
+void mergeSubproblemsTree(const SizeType nrtiles, const bool print_stats_rank, MergeFn&& merge_fn) {
+  namespace ex = pika::execution::experimental;
+
+  const std::size_t max_concurrent_merges = to_sizet(getTuneParameters().tridiag_max_concurrent_merges);
+  const bool print_stats = getTuneParameters().debug_tridiag_solver_merge_stats && print_stats_rank;
+  const bool track = max_concurrent_merges > 0 || print_stats;
+
+  const auto levels = groupSubproblemIndicesByLevel(nrtiles);
+  auto stats = print_stats ? std::make_shared<MergeTreeStats>(levels) : nullptr;
+
+  std::vector<ex::any_sender<>> merges_done;
+  for (std::size_t level = 0; level < levels.size(); ++level) {
+    for (const auto& [i_begin, i_split, i_end] : levels[level]) {
+      ex::unique_any_sender<> dep = ex::just();
+      if (max_concurrent_merges > 0 && merges_done.size() >= max_concurrent_merges)
+        dep = merges_done[merges_done.size() - max_concurrent_merges];
+
+      ex::unique_any_sender<> merge_done = merge_fn(i_begin, i_split, i_end, std::move(dep), track);
+      if (!track)
+        continue;
+
+      if (stats)
+        merge_done = std::move(merge_done) | ex::then([stats, level]() { stats->mergeDone(level); });
+      // Note: the sender is eagerly started, since it might not be waited by any later merge.
+      merges_done.push_back(ex::split(ex::ensure_started(std::move(merge_done))));
+    }
+  }
+
+  if (stats)
+    ex::start_detached(ex::when_all_vector(std::move(merges_done)) |
+                       ex::then([stats]() { std::cout << *stats; }));
+}
+
 template <class T>
 auto cuppensDecomposition(Matrix<T, Device::CPU>& tridiag) {
   namespace ex = pika::execution::experimental;
@@ -138,6 +302,264 @@ void offloadDiagonal(Matrix<const T, Device::CPU>& tridiag, Matrix<T, D>& evals)
   }
 }
 
+// Cast the columns [@p evals_begin, @p evals_end) of all the (n x n) real eigenvectors @p src into the
+// same columns of the complex matrix @p dst (n x m, with m >= @p evals_end).
+template <class T, Device D>
+void castEigenvectorsToComplex(Matrix<const T, D>& src, Matrix<std::complex<T>, D>& dst,
+                               const SizeType evals_begin, const SizeType evals_end) {
+  const auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(dst, evals_begin, evals_end);
+  matrix::internal::MatrixRef<const T, D> src_ref(src, spec);
+  matrix::internal::MatrixRef<std::complex<T>, D> dst_ref(dst, spec);
+  for (auto tile_wrt_local : iterate_range2d(dst_ref.distribution().local_nr_tiles())) {
+    castToComplexAsync<D>(src_ref.read(tile_wrt_local), dst_ref.readwrite(tile_wrt_local));
+  }
+}
+
+// Computes the eigenvalues of the local tridiagonal matrix @p tridiag (n x 2) with `sterf()` and stores
+// them in @p evals (n x 1).
+//
+// Note: `sterf()` does not compute eigenvectors, therefore the whole problem is solved in a single task
+//       and none of the (n x n) workspaces needed by the D&C algorithm is allocated.
+template <class T>
+void solveEigenvaluesOnly(Matrix<const T, Device::CPU>& tridiag, Matrix<T, Device::CPU>& evals) {
+  namespace ex = pika::execution::experimental;
+  namespace di = dlaf::internal;
+  using pika::execution::thread_priority;
+
+  const SizeType n = tridiag.size().rows();
+  auto sterf_fn = [n](const auto& tridiag_tiles, const auto& evals_tiles) {
+    std::vector<T> d(to_sizet(n));
+    std::vector<T> e(to_sizet(n));
+
+    SizeType offset = 0;
+    for (const auto& tile_wrapper : tridiag_tiles) {
+      const matrix::Tile<const T, Device::CPU>& tile = tile_wrapper.get();
+      const SizeType m = tile.size().rows();
+      std::copy_n(tile.ptr(TileElementIndex(0, 0)), m, d.data() + offset);
+      std::copy_n(tile.ptr(TileElementIndex(0, 1)), m, e.data() + offset);
+      offset += m;
+    }
+
+    common::internal::SingleThreadedBlasScope single;
+    lapack::sterf(n, d.data(), e.data());
+
+    offset = 0;
+    for (const auto& tile : evals_tiles) {
+      const SizeType m = tile.size().rows();
+      std::copy_n(d.data() + offset, m, tile.ptr(TileElementIndex(0, 0)));
+      offset += m;
+    }
+  };
+
+  const auto range = common::iterate_range2d(LocalTileSize(tridiag.nrTiles().rows(), 1));
+  ex::start_detached(ex::when_all(ex::when_all_vector(matrix::selectRead(tridiag, range)),
+                                  ex::when_all_vector(matrix::select(evals, range))) |
+                     di::transform(di::Policy<Backend::MC>(thread_priority::high), std::move(sterf_fn)));
+}
+
+// Returns true if the eigenvectors with index in [@p evals_begin, @p evals_end) of a problem of size
+// @p n are computed with the partial-spectrum solver instead of the D&C algorithm.
+inline bool usePartialSpectrum(const SizeType n, const SizeType evals_begin, const SizeType evals_end) {
+  const SizeType k = evals_end - evals_begin;
+  return k < n &&
+         static_cast<double>(k) <= getTuneParameters().tridiag_partial_spectrum_threshold * n;
+}
+
+// Returns the boundaries of the groups of consecutive eigenvalues with index in
+// [@p evals_begin, @p evals_end) whose eigenvectors are computed by a single `stemr()` call (the first
+// boundary is @p evals_begin and the last one is @p evals_end).
+//
+// A group is closed only between two eigenvalues of @p w (all the n eigenvalues in ascending order)
+// whose distance is larger than @p ortol and only once it contains at least @p min_group_size
+// eigenvalues. Therefore a cluster of eigenvalues is never split among different calls.
+//
+// Note: the groups only depend on the eigenvalues, therefore each task computing a subset of the
+//       eigenvectors gets the same groups and performs the same `stemr()` calls for the shared groups.
+template <class T>
+std::vector<SizeType> partialSpectrumGroups(const std::vector<T>& w, const T ortol,
+                                            const SizeType evals_begin, const SizeType evals_end,
+                                            const SizeType min_group_size) {
+  std::vector<SizeType> bounds{evals_begin};
+  for (SizeType j = evals_begin + 1; j < evals_end; ++j) {
+    if (j - bounds.back() >= min_group_size && w[to_sizet(j)] - w[to_sizet(j - 1)] > ortol)
+      bounds.push_back(j);
+  }
+  bounds.push_back(evals_end);
+  return bounds;
+}
+
+// Computes with the MRRR algorithm (`stemr()`) the eigenvectors of the local tridiagonal matrix
+// @p tridiag (n x 2) associated to the eigenvalues with index in [@p evals_begin, @p evals_begin + k)
+// and stores them in the (possibly distributed) matrix @p evecs (n x k).
+// @p evals (n x 1) contains all the eigenvalues of @p tridiag in ascending order.
+//
+// Each rank computes only the eigenvectors of its local columns of @p evecs, with one task for each
+// local tile column, which allocates a workspace for the eigenvectors of a few groups of eigenvalues
+// (see partialSpectrumGroups) instead of the (n x k) workspace of all the requested eigenvectors.
+// The eigenvectors of clustered eigenvalues are computed by the same `stemr()` call, so that they are
+// computed from the same representation tree and are orthogonal. Eigenvalues of different groups are
+// separated by more than 1e-3 * ||T||_1, the threshold below which `stein()` reorthogonalizes the
+// eigenvectors, therefore computing their eigenvectors by separate calls does not affect the
+// orthogonality. As @p tridiag is replicated on all ranks, no communication is needed.
+//
+// Note: @p U is either T or std::complex<T> (in which case the imaginary part is set to zero).
+template <class T, class U>
+void solvePartialSpectrumMRRR(Matrix<const T, Device::CPU>& tridiag, Matrix<const T, Device::CPU>& evals,
+                              matrix::internal::MatrixRef<U, Device::CPU>& evecs,
+                              const SizeType evals_begin) {
+  namespace ex = pika::execution::experimental;
+  namespace di = dlaf::internal;
+  using pika::execution::thread_priority;
+
+  const SizeType n = tridiag.size().rows();
+  const SizeType k = evecs.size().cols();
+  const matrix::Distribution& dist = evecs.distribution();
+  const SizeType min_group_size = dist.tile_size().cols();
+
+  if (dist.local_nr_tiles().isEmpty())
+    return;
+
+  // Global row indices of the first element of the local tile rows of @p evecs.
+  std::vector<SizeType> tiles_row_origin;
+  for (SizeType i = 0; i < dist.local_nr_tiles().rows(); ++i)
+    tiles_row_origin.push_back(dist.global_element_from_local_tile_and_tile_element<Coord::Row>(i, 0));
+
+  const auto tridiag_range = common::iterate_range2d(LocalTileSize(tridiag.nrTiles().rows(), 1));
+
+  for (SizeType j = 0; j < dist.local_nr_tiles().cols(); ++j) {
+    // Eigenvalue indices of the eigenvectors stored in the local tile column.
+    const SizeType j_el_begin =
+        evals_begin + dist.global_element_from_local_tile_and_tile_element<Coord::Col>(j, 0);
+    const SizeType j_el_end = j_el_begin + dist.tile_size_of(LocalTileIndex(0, j)).cols();
+
+    auto stemr_fn = [n, evals_begin, evals_end = evals_begin + k, min_group_size, j_el_begin,
+                     j_el_end, tiles_row_origin](const auto& tridiag_tiles, const auto& evals_tiles,
+                                                 const auto& evecs_tiles) {
+      std::vector<T> d(to_sizet(n));
+      std::vector<T> e(to_sizet(n));
+      std::vector<T> w(to_sizet(n));
+
+      SizeType offset = 0;
+      for (const auto& tile_wrapper : tridiag_tiles) {
+        const matrix::Tile<const T, Device::CPU>& tile = tile_wrapper.get();
+        const SizeType m = tile.size().rows();
+        std::copy_n(tile.ptr(TileElementIndex(0, 0)), m, d.data() + offset);
+        std::copy_n(tile.ptr(TileElementIndex(0, 1)), m, e.data() + offset);
+        offset += m;
+      }
+
+      offset = 0;
+      for (const auto& tile_wrapper : evals_tiles) {
+        const matrix::Tile<const T, Device::CPU>& tile = tile_wrapper.get();
+        std::copy_n(tile.ptr(TileElementIndex(0, 0)), tile.size().rows(), w.data() + offset);
+        offset += tile.size().rows();
+      }
+
+      // Same threshold used by `stein()` for the reorthogonalization of clustered eigenvectors.
+      T norm_t = 0;
+      for (SizeType i = 0; i < n; ++i) {
+        const T e_prev = i > 0 ? std::abs(e[to_sizet(i - 1)]) : T{0};
+        const T e_next = i < n - 1 ? std::abs(e[to_sizet(i)]) : T{0};
+        norm_t = std::max(norm_t, std::abs(d[to_sizet(i)]) + e_prev + e_next);
+      }
+      const T ortol = T(1e-3) * norm_t;
+
+      const std::vector<SizeType> bounds =
+          partialSpectrumGroups(w, ortol, evals_begin, evals_end, min_group_size);
+
+      const SizeType ldz = std::max<SizeType>(1, n);
+      std::vector<T> d_group(to_sizet(n));
+      std::vector<T> e_group(to_sizet(n));
+      std::vector<T> w_group(to_sizet(n));
+      std::vector<T> z;
+      std::vector<int64_t> isuppz;
+
+      for (std::size_t g = 0; g + 1 < bounds.size(); ++g) {
+        const SizeType g_begin = bounds[g];
+        const SizeType g_end = bounds[g + 1];
+        if (g_end <= j_el_begin || g_begin >= j_el_end)
+          continue;
+
+        const SizeType g_size = g_end - g_begin;
+        z.resize(to_sizet(ldz * g_size));
+        isuppz.resize(to_sizet(2 * g_size));
+        std::copy(d.begin(), d.end(), d_group.begin());
+        std::copy(e.begin(), e.end(), e_group.begin());
+        int64_t nfound = 0;
+        bool tryrac = true;
+
+        {
+          common::internal::SingleThreadedBlasScope single;
+          lapack::stemr(lapack::Job::Vec, lapack::Range::Index, n, d_group.data(), e_group.data(),
+                        T{0}, T{0}, g_begin + 1, g_end, &nfound, w_group.data(), z.data(), ldz,
+                        g_size, isuppz.data(), &tryrac);
+        }
+        DLAF_ASSERT(nfound == g_size, nfound, g_size);
+
+        // Copy the eigenvectors of the group stored in the local tile column.
+        const SizeType jj_begin = std::max(g_begin, j_el_begin);
+        const SizeType jj_end = std::min(g_end, j_el_end);
+        for (std::size_t t = 0; t < evecs_tiles.size(); ++t) {
+          const auto& tile = evecs_tiles[t];
+          for (SizeType jj = jj_begin; jj < jj_end; ++jj) {
+            const T* z_ptr = z.data() + tiles_row_origin[t] + (jj - g_begin) * ldz;
+            for (SizeType ii = 0; ii < tile.size().rows(); ++ii)
+              tile(TileElementIndex(ii, jj - j_el_begin)) = z_ptr[ii];
+          }
+        }
+      }
+    };
+
+    const auto evecs_range =
+        common::iterate_range2d(LocalTileIndex(0, j), LocalTileSize(dist.local_nr_tiles().rows(), 1));
+    ex::start_detached(
+        ex::when_all(ex::when_all_vector(matrix::selectRead(tridiag, tridiag_range)),
+                     ex::when_all_vector(matrix::selectRead(evals, tridiag_range)),
+                     ex::when_all_vector(matrix::select(evecs, evecs_range))) |
+        di::transform(di::Policy<Backend::MC>(thread_priority::high), std::move(stemr_fn)));
+  }
+}
+
+// Computes all the eigenvalues of the local tridiagonal matrix @p tridiag (n x 2) and the eigenvectors
+// with index in [@p evals_begin, @p evals_end), which are stored in the corresponding columns of
+// @p evecs (n x m, with m >= @p evals_end). The other columns of @p evecs are left untouched.
+//
+// Note: the eigenvectors are computed on host memory, if @p evecs is allocated on device they are
+//       computed in a host buffer holding only the requested columns and copied afterwards.
+template <class T, class U, Device D>
+void solvePartialSpectrum(Matrix<const T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                          Matrix<U, D>& evecs, const SizeType evals_begin, const SizeType evals_end) {
+  const auto spec =
+      matrix::util::internal::sub_matrix_spec_slice_cols(evecs, evals_begin, evals_end);
+  matrix::internal::MatrixRef<U, D> evecs_ref(evecs, spec);
+
+  if constexpr (D == Device::CPU) {
+    solveEigenvaluesOnly(tridiag, evals);
+    solvePartialSpectrumMRRR(tridiag, evals, evecs_ref, evals_begin);
+  }
+  else {
+    Matrix<T, Device::CPU> h_evals(evals.distribution());
+    solveEigenvaluesOnly(tridiag, h_evals);
+    copy(h_evals, evals);
+
+    Matrix<U, Device::CPU> h_evecs(evecs_ref.distribution());
+    matrix::internal::MatrixRef<U, Device::CPU> h_evecs_ref(h_evecs);
+    solvePartialSpectrumMRRR(tridiag, h_evals, h_evecs_ref, evals_begin);
+    matrix::internal::copy(h_evecs_ref, evecs_ref);
+  }
+}
+
+// Copies the columns [@p evals_begin, @p evals_end) of all the (n x n) eigenvectors @p src into the
+// same columns of @p dst (n x m, with m >= @p evals_end).
+template <class T, Device D>
+void copyEigenvectors(Matrix<const T, D>& src, Matrix<T, D>& dst, const SizeType evals_begin,
+                      const SizeType evals_end) {
+  const auto spec = matrix::util::internal::sub_matrix_spec_slice_cols(dst, evals_begin, evals_end);
+  matrix::internal::MatrixRef<const T, D> src_ref(src, spec);
+  matrix::internal::MatrixRef<T, D> dst_ref(dst, spec);
+  matrix::internal::copy(src_ref, dst_ref);
+}
+
 // Notation:
 //
 // nb - the block/tile size of all matrices and vectors
@@ -195,17 +617,21 @@ void offloadDiagonal(Matrix<const T, Device::CPU>& tridiag, Matrix<T, D>& evals)
 // 3. The overlap region is due to deflation via Givens rotations of a column vector from Q1 with a
 //    column vector of Q2.
 //
+// @p ws_evecs is the (n x n) matrix used as workspace by the algorithm, while @p evecs is where the
+// eigenvectors are stored by the last permutation of the algorithm. The other workspaces are the ones of
+// @p tws.
 template <Backend B, Device D, class T>
-void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
-                                  Matrix<T, D>& evecs) {
+void solveDC(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals, Matrix<T, D>& ws_evecs,
+             Matrix<T, D>& evecs, TridiagSolverWorkspace<T, D>& tws) {
+  namespace ex = pika::execution::experimental;
   using pika::execution::thread_priority;
 
   // Quick return for empty matrix
-  if (evecs.size().isEmpty())
+  if (ws_evecs.size().isEmpty())
     return;
 
   // If the matrix is composed by a single tile simply call stedc.
-  if (evecs.nrTiles().linear_size() == 1) {
+  if (ws_evecs.nrTiles().linear_size() == 1) {
     if constexpr (D == Device::CPU) {
       solveLeaf(tridiag, evecs);
     }
@@ -217,31 +643,30 @@ void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>&
     return;
   }
 
-  // Auxiliary matrix used for the D&C algorithm
-  const matrix::Distribution& distr = evecs.distribution();
-  const LocalElementSize vec_size(distr.size().rows(), 1);
-  const TileElementSize vec_tile_size(distr.tile_size().rows(), 1);
-  WorkSpace<T, D> ws{Matrix<T, D>(distr),                            // e0
-                     Matrix<T, D>(distr),                            // e1
-                     evecs,                                          // e2
-                     evals,                                          // d1
-                     Matrix<T, D>(vec_size, vec_tile_size),          // z0
-                     Matrix<T, D>(vec_size, vec_tile_size),          // z1
-                     Matrix<SizeType, D>(vec_size, vec_tile_size),   // i2
-                     Matrix<SizeType, D>(vec_size, vec_tile_size),   // i5
-                     Matrix<SizeType, D>(vec_size, vec_tile_size),   // i5b
-                     Matrix<SizeType, D>(vec_size, vec_tile_size)};  // i6
-
-  WorkSpaceHost<T> ws_h{Matrix<T, Device::CPU>(vec_size, vec_tile_size),          // d0
-                        Matrix<ColType, Device::CPU>(vec_size, vec_tile_size),    // c
-                        Matrix<SizeType, Device::CPU>(vec_size, vec_tile_size),   // i1
-                        Matrix<SizeType, Device::CPU>(vec_size, vec_tile_size),   // i3
-                        Matrix<SizeType, Device::CPU>(vec_size, vec_tile_size)};  // i4
+  const matrix::Distribution& distr = ws_evecs.distribution();
+  DLAF_ASSERT(tws.dist_evecs == distr, distr.size(), tws.dist_evecs.size());
+
+  // Note: `ws_evecs` is used for both `e0` and `e2`, since `e0` (the eigenvectors of the sub-problems)
+  // is not needed anymore once it has been permuted in `e1`, when `e2` gets computed. The product
+  // `e1 . e2` is then computed back in `e0` one column of tiles at a time (see multiplyEigenvectors).
+  // `evecs` is used as `e1`, so that the last permutation stores the eigenvectors in place.
+  WorkSpace<T, D> ws{ws_evecs,  // e0
+                     evecs,     // e1
+                     ws_evecs,  // e2
+                     evals,                               // d1
+                     tws.z0,
+                     tws.z1,
+                     tws.i2,
+                     tws.i5,
+                     tws.i5b,
+                     tws.i6};
+
+  WorkSpaceHost<T> ws_h{tws.d0, tws.c, tws.i1, tws.i3, tws.i4};
 
   // Mirror workspace on host memory for CPU-only kernels
-  WorkSpaceHostMirror<T, D> ws_hm{initMirrorMatrix(ws.e2), initMirrorMatrix(ws.d1),
-                                  initMirrorMatrix(ws.z0), initMirrorMatrix(ws.z1),
-                                  initMirrorMatrix(ws.i2), initMirrorMatrix(ws.i5)};
+  WorkSpaceHostMirror<T, D> ws_hm{initMirrorMatrix(ws.e2, tws.e2_h), initMirrorMatrix(ws.d1, tws.d1_h),
+                                  initMirrorMatrix(ws.z0, tws.z0_h), initMirrorMatrix(ws.z1, tws.z1_h),
+                                  initMirrorMatrix(ws.i2, tws.i2_h), initMirrorMatrix(ws.i5, tws.i5_h)};
 
   // Set `ws.e0` to `zero` (needed for Given's rotation to make sure no random values are picked up)
   matrix::util::set0<B, T, D>(thread_priority::normal, ws.e0);
@@ -262,32 +687,124 @@ void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>&
   offloadDiagonal(tridiag, ws_h.d0);
 
   // Each triad represents two subproblems to be merged
-  for (auto [i_begin, i_split, i_end] : generateSubproblemIndices(distr.nrTiles().rows())) {
-    mergeSubproblems<B>(i_begin, i_split, i_end, offdiag_vals[to_sizet(i_split - 1)], ws, ws_h, ws_hm);
-  }
+  mergeSubproblemsTree(distr.nrTiles().rows(), true,
+                       [&](const SizeType i_begin, const SizeType i_split, const SizeType i_end,
+                           ex::unique_any_sender<> dep, const bool track) -> ex::unique_any_sender<> {
+                         waitBeforeMerge(i_begin, i_end, std::move(dep), ws.e0, ws.z0, ws_h.d0, ws_h.c,
+                                         ws_h.i1);
+                         auto rho = offdiag_vals[to_sizet(i_split - 1)];
+                         mergeSubproblems<B>(i_begin, i_split, i_end, std::move(rho), ws, ws_h, ws_hm);
+                         if (!track)
+                           return ex::just();
+                         return subproblemMerged(i_begin, i_end, ws.e0, ws_h.i1);
+                       });
 
-  const SizeType n = evecs.nrTiles().rows();
+  const SizeType n = ws_evecs.nrTiles().rows();
   copy(ws_hm.i2, ws.i2);
 
   // Note: ws_hm.d1 is the mirror of ws.d1 which is evals
   applyIndex(0, n, ws_hm.i2, ws_h.d0, ws_hm.d1);
   copy(ws_hm.d1, evals);
 
-  dlaf::permutations::permute<B, D, T, Coord::Col>(0, n, ws.i2, ws.e0, evecs);
+  // Note: ws.e1 is evecs, the permutation stores the eigenvectors in their final position
+  dlaf::permutations::permute<B, D, T, Coord::Col>(0, n, ws.i2, ws.e0, ws.e1);
+}
+
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<T, D>& evecs) {
+  TridiagSolverWorkspace<T, D> ws(evecs.distribution());
+  TridiagSolver<B, D, T>::call(tridiag, evals, evecs, 0, evecs.size().cols(), ws);
+}
+
+// Eigenvalues-only overload: the eigenvalues are computed on host memory with `sterf()`.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals) {
+  // Quick return for empty matrix
+  if (evals.size().isEmpty())
+    return;
+
+  if constexpr (D == Device::CPU) {
+    solveEigenvaluesOnly(tridiag, evals);
+  }
+  else {
+    Matrix<T, Device::CPU> h_evals(evals.distribution());
+    solveEigenvaluesOnly(tridiag, h_evals);
+    copy(h_evals, evals);
+  }
+}
+
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<T, D>& evecs, const SizeType evals_begin,
+                                  const SizeType evals_end) {
+  TridiagSolverWorkspace<T, D> ws(evecs.distribution());
+  TridiagSolver<B, D, T>::call(tridiag, evals, evecs, evals_begin, evals_end, ws);
+}
+
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<std::complex<T>, D>& evecs, const SizeType evals_begin,
+                                  const SizeType evals_end) {
+  TridiagSolverWorkspace<T, D> ws(evecs.distribution());
+  TridiagSolver<B, D, T>::call(tridiag, evals, evecs, evals_begin, evals_end, ws);
 }
 
-// Overload which provides the eigenvector matrix as complex values where the imaginery part is set to zero.
 template <Backend B, Device D, class T>
 void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
                                   Matrix<std::complex<T>, D>& evecs) {
-  Matrix<T, D> real_evecs(evecs.distribution());
-  TridiagSolver<B, D, T>::call(tridiag, evals, real_evecs);
+  TridiagSolverWorkspace<T, D> ws(evecs.distribution());
+  TridiagSolver<B, D, T>::call(tridiag, evals, evecs, 0, evecs.size().cols(), ws);
+}
 
-  // Convert real to complex numbers
-  const matrix::Distribution& dist = evecs.distribution();
-  for (auto tile_wrt_local : iterate_range2d(dist.localNrTiles())) {
-    castToComplexAsync<D>(real_evecs.read(tile_wrt_local), evecs.readwrite(tile_wrt_local));
+// Partial-spectrum overload: if the number of requested eigenvectors is small enough (see
+// TuneParameters::tridiag_partial_spectrum_threshold) all the eigenvalues are computed with `sterf()`
+// and only the eigenvectors with index in [evals_begin, evals_end) are computed with MRRR, otherwise
+// the full D&C algorithm is used with the workspaces of @p ws.
+//
+// @p evecs (n x m) stores the eigenvectors with index in [evals_begin, evals_end) in the corresponding
+// columns (m >= evals_end). If m < n and the D&C algorithm is used, all the eigenvectors are computed
+// in the workspace `ws.evecs` and the requested ones are copied into @p evecs.
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<T, D>& evecs, const SizeType evals_begin,
+                                  const SizeType evals_end, TridiagSolverWorkspace<T, D>& ws) {
+  const SizeType n = tridiag.size().rows();
+  if (usePartialSpectrum(n, evals_begin, evals_end)) {
+    solvePartialSpectrum(tridiag, evals, evecs, evals_begin, evals_end);
+    return;
+  }
+
+  if (evecs.size().cols() == n) {
+    solveDC<B>(tridiag, evals, initWorkspaceMatrix(ws.e0, ws.dist_evecs), evecs, ws);
+    return;
+  }
+
+  Matrix<T, D>& evecs_all = ws.realEigenvectors();
+  solveDC<B>(tridiag, evals, initWorkspaceMatrix(ws.e0, ws.dist_evecs), evecs_all, ws);
+  copyEigenvectors(evecs_all, evecs, evals_begin, evals_end);
+}
+
+// \overload TridiagSolver<B, D, T>::call()
+//
+// Overload which provides the eigenvector matrix as complex values where the imaginery part is set to
+// zero. The eigenvectors computed by MRRR are directly stored as complex values, while the D&C algorithm
+// computes them in the real workspace `ws.evecs` before casting them into @p evecs.
+//
+// Note: the eigensolver avoids the cast, as the back-transformation from tridiagonal to band reads the
+//       real eigenvectors directly (see BackTransformationT2B).
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                                  Matrix<std::complex<T>, D>& evecs, const SizeType evals_begin,
+                                  const SizeType evals_end, TridiagSolverWorkspace<T, D>& ws) {
+  if (usePartialSpectrum(tridiag.size().rows(), evals_begin, evals_end)) {
+    solvePartialSpectrum(tridiag, evals, evecs, evals_begin, evals_end);
+    return;
   }
+
+  Matrix<T, D>& evecs_real = ws.realEigenvectors();
+  solveDC<B>(tridiag, evals, initWorkspaceMatrix(ws.e0, ws.dist_evecs), evecs_real, ws);
+  castEigenvectorsToComplex(evecs_real, evecs, evals_begin, evals_end);
 }
 
 // Solve for each tile of the local matrix @p tridiag (n x 2) with `stedc()` and save the result in the
@@ -358,11 +875,12 @@ void solveDistLeaf(comm::CommunicatorPipeline<comm::CommunicatorType::Full>& ful
 }
 #endif
 
-// Distributed tridiagonal eigensolver
+// Distributed tridiagonal eigensolver using the workspaces of @p tws.
 //
 template <Backend B, Device D, class T>
-void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
-                                  Matrix<T, D>& evals, Matrix<T, D>& evecs) {
+void solveDistDC(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag, Matrix<T, D>& evals,
+                 Matrix<T, D>& evecs, TridiagSolverWorkspace<T, D>& tws) {
+  namespace ex = pika::execution::experimental;
   using pika::execution::thread_priority;
 
   auto full_task_chain = grid.full_communicator_pipeline();
@@ -397,34 +915,38 @@ void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device
     return;
   }
 
-  // Auxiliary matrix used for the D&C algorithm
   const matrix::Distribution& dist_evecs = evecs.distribution();
-  const matrix::Distribution& dist_evals = evals.distribution();
-  const matrix::Distribution dist_local({dist_evecs.local_size().cols(), 1}, dist_evecs.tile_size());
-
-  WorkSpace<T, D> ws{Matrix<T, D>(dist_evecs),          // e0
-                     Matrix<T, D>(dist_evecs),          // e1
-                     evecs,                             // e2
-                     evals,                             // d1
-                     Matrix<T, D>(dist_evals),          // z0
-                     Matrix<T, D>(dist_evals),          // z1
-                     Matrix<SizeType, D>(dist_evals),   // i2
-                     Matrix<SizeType, D>(dist_evals),   // i5
-                     Matrix<SizeType, D>(dist_local),   // i5b
-                     Matrix<SizeType, D>(dist_evals)};  // i6
-
-  WorkSpaceHost<T> ws_h{Matrix<T, Device::CPU>(dist_evals),          // d0
-                        Matrix<ColType, Device::CPU>(dist_evals),    // c
-                        Matrix<SizeType, Device::CPU>(dist_evals),   // i1
-                        Matrix<SizeType, Device::CPU>(dist_evals),   // i3
-                        Matrix<SizeType, Device::CPU>(dist_evals)};  // i4
+  DLAF_ASSERT(tws.dist_evecs == dist_evecs, dist_evecs.size(), tws.dist_evecs.size());
+
+  // Note: differently from solveDC, `e0` and `e2` cannot share the same matrix. The local merge
+  // computes `e0 = e1 . e2` one column of tiles at a time, each panel depending only on the same columns
+  // of `e2`. With the distributed GEMM each panel would broadcast again the whole `e1` over the rows of
+  // the grid, which turns the O(n^2) communication of the product into O(n^3 / nb). Computing the
+  // product by panels of rows, overwriting `e1`, has the same issue with `e2`. For this reason the
+  // distributed variant uses `evecs` as `e2`, i.e. it needs one workspace (n x n) more than solveDC.
+  WorkSpace<T, D> ws{initWorkspaceMatrix(tws.e0, dist_evecs),  // e0
+                     initWorkspaceMatrix(tws.e1, dist_evecs),  // e1
+                     evecs,                                    // e2
+                     evals,                                    // d1
+                     tws.z0,
+                     tws.z1,
+                     tws.i2,
+                     tws.i5,
+                     tws.i5b,
+                     tws.i6};
+
+  WorkSpaceHost<T> ws_h{tws.d0, tws.c, tws.i1, tws.i3, tws.i4};
 
   // Mirror workspace on host memory for CPU-only kernels
-  DistWorkSpaceHostMirror<T, D> ws_hm{initMirrorMatrix(ws.e0), initMirrorMatrix(ws.e2),
-                                      initMirrorMatrix(ws.d1), initMirrorMatrix(ws.z0),
-                                      initMirrorMatrix(ws.z1), initMirrorMatrix(ws.i2),
-                                      initMirrorMatrix(ws.i5), initMirrorMatrix(ws.i5b),
-                                      initMirrorMatrix(ws.i6)};
+  DistWorkSpaceHostMirror<T, D> ws_hm{initMirrorMatrix(ws.e0, tws.e0_h),
+                                      initMirrorMatrix(ws.e2, tws.e2_h),
+                                      initMirrorMatrix(ws.d1, tws.d1_h),
+                                      initMirrorMatrix(ws.z0, tws.z0_h),
+                                      initMirrorMatrix(ws.z1, tws.z1_h),
+                                      initMirrorMatrix(ws.i2, tws.i2_h),
+                                      initMirrorMatrix(ws.i5, tws.i5_h),
+                                      initMirrorMatrix(ws.i5b, tws.i5b_h),
+                                      initMirrorMatrix(ws.i6, tws.i6_h)};
 
   // Set `ws.e0` to `zero` (needed for Given's rotation to make sure no random values are picked up)
   matrix::util::set0<B, T, D>(thread_priority::normal, ws.e0);
@@ -432,9 +954,6 @@ void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device
   // Cuppen's decomposition
   auto offdiag_vals = cuppensDecomposition(tridiag);
 
-  auto row_task_chain = grid.row_communicator_pipeline();
-  auto col_task_chain = grid.col_communicator_pipeline();
-
   // Solve with stedc for each tile of `tridiag` (nb x 2) and save eigenvectors in diagonal tiles of
   // `evecs` (nb x nb)
   if constexpr (D == Device::CPU) {
@@ -448,11 +967,27 @@ void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device
   offloadDiagonal(tridiag, ws_h.d0);
 
   // Each triad represents two subproblems to be merged
+  // Note: all ranks schedule the merges in the same order, hence they get the communicator pipelines
+  // in the same order too and communications are matched. Each merge gets its own pipelines from the
+  // grid, so that merges using different communicator clones (see
+  // getTuneParameters().communicator_grid_num_pipelines) are not serialized by the communications.
   SizeType nrtiles = dist_evecs.nrTiles().rows();
-  for (auto [i_begin, i_split, i_end] : generateSubproblemIndices(nrtiles)) {
-    mergeDistSubproblems<B>(full_task_chain, row_task_chain, col_task_chain, i_begin, i_split, i_end,
-                            offdiag_vals[to_sizet(i_split - 1)], ws, ws_h, ws_hm);
-  }
+  const bool print_stats_rank = grid.rank() == comm::Index2D(0, 0);
+  mergeSubproblemsTree(nrtiles, print_stats_rank, [&](const SizeType i_begin, const SizeType i_split,
+                                                      const SizeType i_end, ex::unique_any_sender<> dep,
+                                                      const bool track) -> ex::unique_any_sender<> {
+    auto merge_full_chain = grid.full_communicator_pipeline();
+    auto merge_row_chain = grid.row_communicator_pipeline();
+    auto merge_col_chain = grid.col_communicator_pipeline();
+
+    waitBeforeMerge(i_begin, i_end, std::move(dep), ws.e0, ws.z0, ws_h.d0, ws_h.c, ws_h.i1, ws_hm.e2);
+    auto rho = offdiag_vals[to_sizet(i_split - 1)];
+    mergeDistSubproblems<B>(merge_full_chain, merge_row_chain, merge_col_chain, i_begin, i_split, i_end,
+                            std::move(rho), ws, ws_h, ws_hm);
+    if (!track)
+      return ex::just();
+    return subproblemMerged(i_begin, i_end, ws.e0, ws_h.i1);
+  });
 
   const SizeType n = evecs.nrTiles().rows();
   copy(ws.e0, ws_hm.e0);
@@ -461,6 +996,8 @@ void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device
   applyIndex(0, n, ws_h.i1, ws_h.d0, ws_hm.d1);
   copy(ws_hm.d1, evals);
 
+  auto row_task_chain = grid.row_communicator_pipeline();
+
   // Note: ws_hm.e2 is the mirror of ws.e2 which is evecs
   dlaf::permutations::permute<Backend::MC, Device::CPU, T, Coord::Col>(row_task_chain, 0, n, ws_h.i1,
                                                                        ws_hm.e0, ws_hm.e2);
@@ -476,22 +1013,98 @@ void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device
 #endif
 }
 
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                                  Matrix<T, D>& evals, Matrix<T, D>& evecs) {
+  TridiagSolverWorkspace<T, D> ws(evecs.distribution());
+  TridiagSolver<B, D, T>::call(grid, tridiag, evals, evecs, 0, evecs.size().cols(), ws);
+}
+
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                                  Matrix<T, D>& evals, Matrix<std::complex<T>, D>& evecs) {
+  TridiagSolverWorkspace<T, D> ws(evecs.distribution());
+  TridiagSolver<B, D, T>::call(grid, tridiag, evals, evecs, 0, evecs.size().cols(), ws);
+}
+
 // \overload TridiagSolver<B, D, T>::call()
 //
-// This overload of the distributed tridiagonal version of the algorithm provides the eigenvector matrix
-// as complex values where the imaginery part is set to zero.
+// Eigenvalues-only overload of the distributed version of the algorithm.
+// As @p tridiag and @p evals are replicated on all ranks, each rank computes the eigenvalues locally
+// and no communication is needed.
 //
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid&, Matrix<T, Device::CPU>& tridiag,
+                                  Matrix<T, D>& evals) {
+  TridiagSolver<B, D, T>::call(tridiag, evals);
+}
+
 template <Backend B, Device D, class T>
 void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
-                                  Matrix<T, D>& evals, Matrix<std::complex<T>, D>& evecs) {
-  Matrix<T, D> real_evecs(evecs.distribution());
-  TridiagSolver<B, D, T>::call(grid, tridiag, evals, real_evecs);
+                                  Matrix<T, D>& evals, Matrix<T, D>& evecs,
+                                  const SizeType evals_begin, const SizeType evals_end) {
+  TridiagSolverWorkspace<T, D> ws(evecs.distribution());
+  TridiagSolver<B, D, T>::call(grid, tridiag, evals, evecs, evals_begin, evals_end, ws);
+}
 
-  // Convert real to complex numbers
-  const matrix::Distribution& dist = evecs.distribution();
-  for (auto tile_wrt_local : iterate_range2d(dist.localNrTiles())) {
-    castToComplexAsync<D>(real_evecs.read(tile_wrt_local), evecs.readwrite(tile_wrt_local));
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                                  Matrix<T, D>& evals, Matrix<std::complex<T>, D>& evecs,
+                                  const SizeType evals_begin, const SizeType evals_end) {
+  TridiagSolverWorkspace<T, D> ws(evecs.distribution());
+  TridiagSolver<B, D, T>::call(grid, tridiag, evals, evecs, evals_begin, evals_end, ws);
+}
+
+// \overload TridiagSolver<B, D, T>::call()
+//
+// Partial-spectrum overload of the distributed version of the algorithm.
+// As @p tridiag is replicated on all ranks, each rank computes with MRRR only the requested
+// eigenvectors stored in its local tile columns of @p evecs (see solvePartialSpectrumMRRR) and no
+// communication is needed. Otherwise the full D&C algorithm is used with the workspaces of @p ws.
+//
+// @p evecs (n x m) stores the eigenvectors with index in [evals_begin, evals_end) in the corresponding
+// columns (m >= evals_end). If m < n and the D&C algorithm is used, all the eigenvectors are computed
+// in the workspace `ws.evecs` and the requested ones are copied into @p evecs.
+//
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                                  Matrix<T, D>& evals, Matrix<T, D>& evecs,
+                                  const SizeType evals_begin, const SizeType evals_end,
+                                  TridiagSolverWorkspace<T, D>& ws) {
+  const SizeType n = tridiag.size().rows();
+  if (usePartialSpectrum(n, evals_begin, evals_end)) {
+    solvePartialSpectrum(tridiag, evals, evecs, evals_begin, evals_end);
+    return;
+  }
+
+  if (evecs.size().cols() == n) {
+    solveDistDC<B>(grid, tridiag, evals, evecs, ws);
+    return;
   }
+
+  Matrix<T, D>& evecs_all = ws.realEigenvectors();
+  solveDistDC<B>(grid, tridiag, evals, evecs_all, ws);
+  copyEigenvectors(evecs_all, evecs, evals_begin, evals_end);
+}
+
+// \overload TridiagSolver<B, D, T>::call()
+//
+// Partial-spectrum overload of the distributed version of the algorithm which provides the eigenvector
+// matrix as complex values where the imaginery part is set to zero.
+//
+template <Backend B, Device D, class T>
+void TridiagSolver<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, Device::CPU>& tridiag,
+                                  Matrix<T, D>& evals, Matrix<std::complex<T>, D>& evecs,
+                                  const SizeType evals_begin, const SizeType evals_end,
+                                  TridiagSolverWorkspace<T, D>& ws) {
+  if (usePartialSpectrum(tridiag.size().rows(), evals_begin, evals_end)) {
+    solvePartialSpectrum(tridiag, evals, evecs, evals_begin, evals_end);
+    return;
+  }
+
+  Matrix<T, D>& evecs_real = ws.realEigenvectors();
+  solveDistDC<B>(grid, tridiag, evals, evecs_real, ws);
+  castEigenvectorsToComplex(evecs_real, evecs, evals_begin, evals_end);
 }
 
 }
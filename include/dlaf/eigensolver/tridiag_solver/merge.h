@@ -14,6 +14,7 @@
 #include <cstddef>
 #include <functional>
 #include <numeric>
+#include <optional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -45,6 +46,7 @@
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_ref.h>
 #include <dlaf/memory/memory_view.h>
+#include <dlaf/metrics.h>
 #include <dlaf/multiplication/general.h>
 #include <dlaf/multiplication/general/api.h>
 #include <dlaf/permutations/general.h>
@@ -113,37 +115,39 @@ namespace dlaf::eigensolver::internal {
 //        post_sorted <--- matmul
 //
 
+// Note: the workspaces are views of the matrices owned by TridiagSolverWorkspace (or by the caller), so
+// that they are not allocated by each call of the algorithm.
 template <class T, Device D>
 struct WorkSpace {
-  Matrix<T, D> e0;
-  Matrix<T, D> e1;
-  Matrix<T, D>& e2;  // Reference to reuse evecs
+  Matrix<T, D>& e0;
+  Matrix<T, D>& e1;
+  Matrix<T, D>& e2;
 
   Matrix<T, D>& d1;  // Reference to reuse evals
 
-  Matrix<T, D> z0;
-  Matrix<T, D> z1;
+  Matrix<T, D>& z0;
+  Matrix<T, D>& z1;
 
-  Matrix<SizeType, D> i2;
-  Matrix<SizeType, D> i5;
-  Matrix<SizeType, D> i5b;
-  Matrix<SizeType, D> i6;
+  Matrix<SizeType, D>& i2;
+  Matrix<SizeType, D>& i5;
+  Matrix<SizeType, D>& i5b;
+  Matrix<SizeType, D>& i6;
 };
 
 template <class T>
 struct WorkSpaceHost {
-  Matrix<T, Device::CPU> d0;
+  Matrix<T, Device::CPU>& d0;
 
-  Matrix<ColType, Device::CPU> c;
+  Matrix<ColType, Device::CPU>& c;
 
-  Matrix<SizeType, Device::CPU> i1;
-  Matrix<SizeType, Device::CPU> i3;
-  Matrix<SizeType, Device::CPU> i4;
+  Matrix<SizeType, Device::CPU>& i1;
+  Matrix<SizeType, Device::CPU>& i3;
+  Matrix<SizeType, Device::CPU>& i4;
 };
 
+// Host mirror of a device workspace: the workspace itself on CPU, a host copy of it on GPU.
 template <class T, Device D>
-using HostMirrorMatrix =
-    std::conditional_t<D == Device::CPU, Matrix<T, Device::CPU>&, Matrix<T, Device::CPU>>;
+using HostMirrorMatrix = Matrix<T, Device::CPU>&;
 
 template <class T, Device D>
 struct WorkSpaceHostMirror {
@@ -174,13 +178,26 @@ struct DistWorkSpaceHostMirror {
   HostMirrorMatrix<SizeType, D> i6;
 };
 
+// Returns the workspace @p mat, allocating it with distribution @p dist on first use.
+template <class T, Device D>
+Matrix<T, D>& initWorkspaceMatrix(std::optional<Matrix<T, D>>& mat, const matrix::Distribution& dist) {
+  if (!mat.has_value())
+    mat.emplace(dist);
+  DLAF_ASSERT(mat->distribution() == dist, *mat, dist.size(), dist.tile_size());
+  return *mat;
+}
+
+// Returns the host mirror @p mirror of @p mat, allocating it on first use.
 template <class T>
-Matrix<T, Device::CPU> initMirrorMatrix(Matrix<T, Device::GPU>& mat) {
-  return Matrix<T, Device::CPU>(mat.distribution());
+Matrix<T, Device::CPU>& initMirrorMatrix(Matrix<T, Device::GPU>& mat,
+                                         std::optional<Matrix<T, Device::CPU>>& mirror) {
+  return initWorkspaceMatrix(mirror, mat.distribution());
 }
 
+// Returns @p mat, as memory on host does not need a mirror.
 template <class T>
-Matrix<T, Device::CPU>& initMirrorMatrix(Matrix<T, Device::CPU>& mat) {
+Matrix<T, Device::CPU>& initMirrorMatrix(Matrix<T, Device::CPU>& mat,
+                                         std::optional<Matrix<T, Device::CPU>>&) {
   return mat;
 }
 
@@ -284,6 +301,19 @@ inline std::size_t ev_sort_order(const ColType coltype) {
   return DLAF_UNREACHABLE(std::size_t);
 }
 
+// Sorts the indices in [@p begin, @p end) by ascending eigenvalue @p evals, where the indices of equal
+// eigenvalues end up in reverse order (i.e. as if each index were inserted before the ones with an
+// equal or greater eigenvalue).
+//
+// Note: inserting each deflated index in the sorted sequence is quadratic in the number of deflated
+//       eigenvalues, while this is O(d log d).
+template <class T>
+void sortDeflatedIndices(SizeType* begin, SizeType* end, const T* evals) {
+  std::reverse(begin, end);
+  std::stable_sort(begin, end,
+                   [evals](const SizeType i, const SizeType j) { return evals[i] < evals[j]; });
+}
+
 // This function returns number of non-deflated eigenvectors and a tuple with number of upper, dense
 // and lower non-deflated eigenvectors, together with two permutations:
 // - @p index_sorted          (sort(non-deflated)|sorted(deflated) -> initial.
@@ -302,6 +332,10 @@ inline std::size_t ev_sort_order(const ColType coltype) {
 //
 // @return k                    number of non-deflated eigenvectors
 // @return n_udl                tuple with number of upper, dense and lower eigenvectors
+//
+// Note: differently from the deflation (see DeflationChunk), this function is sequential, as it is
+//       made of a few O(n) passes over the indices and a sort of the deflated ones, which are
+//       negligible with respect to the O(n^2) work on the eigenvectors of the merge.
 template <class T>
 auto stablePartitionIndexForDeflationArrays(const SizeType n, const ColType* types, const T* evals,
                                             const SizeType* perm_sorted, SizeType* index_sorted,
@@ -344,25 +378,13 @@ auto stablePartitionIndexForDeflationArrays(const SizeType n, const ColType* typ
       index_sorted[i1] = ii;
       ++i1;
     }
-    // deflated are the ones that can have been moved "out-of-order" by deflation...
-    // ... so each time insert it in the right place based on eigenvalue value
+    // deflated are the ones that can have been moved "out-of-order" by deflation, they get sorted below
     else {
-      const T a = evals[ii];
-
-      SizeType j = i2;
-      // shift to right all greater values (shift just indices)
-      for (; j > k; --j) {
-        const T b = evals[index_sorted[j - 1]];
-        if (a > b) {
-          break;
-        }
-        index_sorted[j] = index_sorted[j - 1];
-      }
-      // and insert the current index in the empty place, such that eigenvalues are sorted.
-      index_sorted[j] = ii;
+      index_sorted[i2] = ii;
       ++i2;
     }
   }
+  sortDeflatedIndices(index_sorted + k, index_sorted + n, evals);
 
   // Create the permutation (upper|dense|lower|sort(deflated)) -> initial
   // Note:
@@ -449,25 +471,13 @@ auto stablePartitionIndexForDeflationArrays(const matrix::Distribution& dist_sub
       index_sorted[i_nd] = ii;
       ++i_nd;
     }
-    // deflated are the ones that can have been moved "out-of-order" by deflation...
-    // ... so each time insert it in the right place based on eigenvalue value
+    // deflated are the ones that can have been moved "out-of-order" by deflation, they get sorted below
     else {
-      const T a = evals[ii];
-
-      SizeType j = i_x;
-      // shift to right all greater values (just the indices)
-      for (; j > k; --j) {
-        const T b = evals[index_sorted[j - 1]];
-        if (a > b) {
-          break;
-        }
-        index_sorted[j] = index_sorted[j - 1];
-      }
-      // and insert the current index in the empty place, such that eigenvalues are sorted.
-      index_sorted[j] = ii;
+      index_sorted[i_x] = ii;
       ++i_x;
     }
   }
+  sortDeflatedIndices(index_sorted + k, index_sorted + n, evals);
 
   // Create the permutation (sort(upper)|sort(dense)|sort(lower)|sort(deflated)) -> initial
   // Note:
@@ -685,26 +695,23 @@ inline void initColTypes(const SizeType i_begin, const SizeType i_split, const S
   }
 }
 
-// Assumption 1: The algorithm assumes that the arrays `d_ptr`, `z_ptr` and `c_ptr` are of equal length
-// `len` and are sorted in ascending order of `d_ptr` elements with `i_ptr`.
+// Performs the iterations i2 in [i2_begin, i2_end) of the deflation scan, where `i1` is the sorted index
+// of the first element of the current Givens rotation, and returns the value of `i1` after the last
+// iteration.
 //
-// Note: parallelizing this algorithm is non-trivial because the deflation regions due to Givens
-// rotations can cross over tiles and are of unknown length. However such algorithm is unlikely to
-// benefit much from parallelization anyway as it is quite light on flops and it appears memory bound.
-//
-// Returns an array of Given's rotations used to update the colunmns of the eigenvector matrix Q
-template <class T>
-std::vector<GivensRotation<T>> applyDeflationToArrays(T rho, T tol, const SizeType len,
-                                                      const SizeType* i_ptr, T* d_ptr, T* z_ptr,
-                                                      ColType* c_ptr) {
-  std::vector<GivensRotation<T>> rots;
-  rots.reserve(to_sizet(len));
-
-  SizeType i1 = 0;  // index of 1st element in the Givens rotation
-  // Iterate over the indices of the sorted elements in pair (i1, i2) where i1 < i2 for every iteration
-  for (SizeType i2 = 1; i2 < len; ++i2) {
-    const SizeType i1s = i_ptr[i1];
-    const SizeType i2s = i_ptr[i2];
+// The element with sorted index `i` is stored at position `index(i)` of the arrays `d_ptr`, `z_ptr` and
+// `c_ptr`, and Givens rotations are saved in @p rots using such positions.
+// If @p i1_after is not null, the value of `i1` after the iteration `i2` is stored in
+// `i1_after[i2 - i2_begin]`.
+template <class T, class IndexFn>
+SizeType deflateSortedRange(const T rho, const T tol, SizeType i1, const SizeType i2_begin,
+                            const SizeType i2_end, IndexFn&& index, T* d_ptr, T* z_ptr,
+                            ColType* c_ptr, std::vector<GivensRotation<T>>& rots,
+                            SizeType* i1_after = nullptr) {
+  // Returns the index `i1` for the next iteration
+  auto deflate_step = [&](const SizeType i2) -> SizeType {
+    const SizeType i1s = index(i1);
+    const SizeType i2s = index(i2);
     T& d1 = d_ptr[i1s];
     T& d2 = d_ptr[i2s];
     T& z1 = z_ptr[i1s];
@@ -715,14 +722,13 @@ std::vector<GivensRotation<T>> applyDeflationToArrays(T rho, T tol, const SizeTy
     // if z1 nearly zero deflate the element and move i1 forward to i2
     if (std::abs(rho * z1) <= tol) {
       c1 = ColType::Deflated;
-      i1 = i2;
-      continue;
+      return i2;
     }
 
     // Deflate the second element if z2 nearly zero
     if (std::abs(rho * z2) <= tol) {
       c2 = ColType::Deflated;
-      continue;
+      return i1;
     }
 
     // Given's deflation condition is the same as the one used in LAPACK's stedc implementation [1].
@@ -735,10 +741,8 @@ std::vector<GivensRotation<T>> applyDeflationToArrays(T rho, T tol, const SizeTy
     T s = z2 / r;
 
     // If d1 is not nearly equal to d2, move i1 forward to i2
-    if (std::abs(c * s * (d2 - d1)) > tol) {
-      i1 = i2;
-      continue;
-    }
+    if (std::abs(c * s * (d2 - d1)) > tol)
+      return i2;
 
     // When d1 is nearly equal to d2 apply Givens rotation
     z1 = r;
@@ -755,6 +759,150 @@ std::vector<GivensRotation<T>> applyDeflationToArrays(T rho, T tol, const SizeTy
       c1 = ColType::Dense;
     }
     c2 = ColType::Deflated;
+    return i1;
+  };
+
+  // Iterate over the indices of the sorted elements in pair (i1, i2) where i1 < i2 for every iteration
+  for (SizeType i2 = i2_begin; i2 < i2_end; ++i2) {
+    i1 = deflate_step(i2);
+    if (i1_after != nullptr)
+      i1_after[i2 - i2_begin] = i1;
+  }
+
+  return i1;
+}
+
+// Assumption 1: The algorithm assumes that the arrays `d_ptr`, `z_ptr` and `c_ptr` are of equal length
+// `len` and are sorted in ascending order of `d_ptr` elements with `i_ptr`.
+//
+// Note: this is the sequential version of the algorithm, see DeflationChunk for the parallel one.
+//
+// Returns an array of Given's rotations used to update the colunmns of the eigenvector matrix Q
+template <class T>
+std::vector<GivensRotation<T>> applyDeflationToArrays(T rho, T tol, const SizeType len,
+                                                      const SizeType* i_ptr, T* d_ptr, T* z_ptr,
+                                                      ColType* c_ptr) {
+  std::vector<GivensRotation<T>> rots;
+  rots.reserve(to_sizet(len));
+
+  deflateSortedRange(
+      rho, tol, 0, 1, len, [i_ptr](const SizeType i) { return i_ptr[i]; }, d_ptr, z_ptr, c_ptr, rots);
+
+  return rots;
+}
+
+// Parallel deflation
+//
+// Parallelizing the deflation scan is non-trivial because the deflation regions due to Givens rotations
+// can cross over tiles and are of unknown length. Therefore the sorted indices are split in contiguous
+// chunks, and the scan of each chunk is computed speculatively on a copy of its elements, as if a
+// Givens rotation started at its first element (see speculateDeflation).
+//
+// The actual scan and the speculative one of a chunk are identical from the first index `i` for which
+// both of them move `i1` forward to `i` at iteration `i`. The actual scan is then replayed sequentially
+// just for the indices of the chunk preceding it, which are usually a few as deflation regions are short
+// (see resolveDeflation). The result is exactly the same as the one of applyDeflationToArrays.
+template <class T>
+struct DeflationChunk {
+  SizeType begin;                       // first sorted index of the chunk
+  SizeType end;                         // sorted index following the last one of the chunk
+  std::vector<T> d;                     // speculative values of d
+  std::vector<T> z;                     // speculative values of z
+  std::vector<ColType> c;               // speculative values of c
+  std::vector<SizeType> i1_after;       // speculative `i1` after each iteration (relative to begin)
+  std::vector<GivensRotation<T>> rots;  // speculative rotations (relative to begin)
+  SizeType i1_end;                      // speculative `i1` at the end of the chunk
+};
+
+// Splits the sorted indices [0, len) in (at most) @p nchunks chunks of similar size.
+template <class T>
+std::vector<DeflationChunk<T>> initDeflationChunks(const SizeType len, const std::size_t nchunks) {
+  const SizeType nr_chunks = std::max<SizeType>(1, std::min(to_SizeType(nchunks), len));
+
+  std::vector<DeflationChunk<T>> chunks(to_sizet(nr_chunks));
+  for (SizeType k = 0; k < nr_chunks; ++k) {
+    chunks[to_sizet(k)].begin = k * len / nr_chunks;
+    chunks[to_sizet(k)].end = (k + 1) * len / nr_chunks;
+  }
+  return chunks;
+}
+
+// Computes the speculative deflation of @p chunk, without modifying the arrays `d_ptr`, `z_ptr` and
+// `c_ptr` (see DeflationChunk).
+template <class T>
+void speculateDeflation(const T rho, const T tol, const SizeType* i_ptr, const T* d_ptr,
+                        const T* z_ptr, const ColType* c_ptr, DeflationChunk<T>& chunk) {
+  const SizeType len = chunk.end - chunk.begin;
+
+  chunk.d.resize(to_sizet(len));
+  chunk.z.resize(to_sizet(len));
+  chunk.c.resize(to_sizet(len));
+  chunk.i1_after.resize(to_sizet(len));
+  chunk.rots.clear();
+  chunk.i1_end = chunk.begin;
+
+  if (len == 0)
+    return;
+
+  for (SizeType i = 0; i < len; ++i) {
+    const SizeType is = i_ptr[chunk.begin + i];
+    chunk.d[to_sizet(i)] = d_ptr[is];
+    chunk.z[to_sizet(i)] = z_ptr[is];
+    chunk.c[to_sizet(i)] = c_ptr[is];
+  }
+
+  chunk.i1_after[0] = 0;
+  chunk.i1_end += deflateSortedRange(
+      rho, tol, 0, 1, len, [](const SizeType i) { return i; }, chunk.d.data(), chunk.z.data(),
+      chunk.c.data(), chunk.rots, chunk.i1_after.data() + 1);
+}
+
+// Computes the actual deflation from the speculative deflation of @p chunks (see DeflationChunk),
+// updating the arrays `d_ptr`, `z_ptr` and `c_ptr`.
+//
+// Returns an array of Given's rotations used to update the colunmns of the eigenvector matrix Q
+template <class T>
+std::vector<GivensRotation<T>> resolveDeflation(const T rho, const T tol, const SizeType* i_ptr,
+                                                T* d_ptr, T* z_ptr, ColType* c_ptr,
+                                                const std::vector<DeflationChunk<T>>& chunks) {
+  auto index = [i_ptr](const SizeType i) { return i_ptr[i]; };
+
+  std::vector<GivensRotation<T>> rots;
+  rots.reserve(to_sizet(chunks.back().end));
+
+  SizeType i1 = 0;
+  for (std::size_t k = 0; k < chunks.size(); ++k) {
+    const DeflationChunk<T>& chunk = chunks[k];
+
+    // Replay the actual scan until it matches the speculative one.
+    // Note: the speculative scan of the first chunk is the actual one.
+    SizeType i_match = chunk.begin;
+    if (k != 0) {
+      for (; i_match < chunk.end; ++i_match) {
+        i1 = deflateSortedRange(rho, tol, i1, i_match, i_match + 1, index, d_ptr, z_ptr, c_ptr, rots);
+        if (i1 == i_match && chunk.i1_after[to_sizet(i_match - chunk.begin)] == i_match - chunk.begin)
+          break;
+      }
+    }
+
+    // The whole chunk has been replayed, the speculative result is not used
+    if (i_match == chunk.end)
+      continue;
+
+    for (SizeType i = i_match; i < chunk.end; ++i) {
+      const SizeType is = i_ptr[i];
+      d_ptr[is] = chunk.d[to_sizet(i - chunk.begin)];
+      z_ptr[is] = chunk.z[to_sizet(i - chunk.begin)];
+      c_ptr[is] = chunk.c[to_sizet(i - chunk.begin)];
+    }
+
+    for (const GivensRotation<T>& rot : chunk.rots) {
+      if (chunk.begin + rot.j > i_match)
+        rots.push_back(GivensRotation<T>{i_ptr[chunk.begin + rot.i], i_ptr[chunk.begin + rot.j],
+                                         rot.c, rot.s});
+    }
+
+    i1 = chunk.i1_end;
   }
 
   return rots;
@@ -766,27 +914,56 @@ auto applyDeflation(const SizeType i_begin, const SizeType i_end, RhoSender&& rh
                     Matrix<T, Device::CPU>& z, Matrix<ColType, Device::CPU>& c) {
   namespace ex = pika::execution::experimental;
   namespace di = dlaf::internal;
-  using pika::execution::thread_stacksize;
 
   const SizeType n = problemSize(i_begin, i_end, index.distribution());
 
-  auto deflate_fn = [n](auto rho, auto tol, auto index_tiles, auto d_tiles, auto z_tiles, auto c_tiles) {
-    const TileElementIndex zero_idx(0, 0);
-    const SizeType* i_ptr = index_tiles[0].get().ptr(zero_idx);
-    T* d_ptr = d_tiles[0].ptr(zero_idx);
-    T* z_ptr = z_tiles[0].ptr(zero_idx);
-    ColType* c_ptr = c_tiles[0].ptr(zero_idx);
-    return applyDeflationToArrays(rho, tol, n, i_ptr, d_ptr, z_ptr, c_ptr);
-  };
+  // Note: at least two tiles per-worker, in the range [1, getTridiagRank1NWorkers()]
+  const std::size_t nthreads = [nrtiles = (i_end - i_begin)]() {
+    const std::size_t min_workers = 1;
+    const std::size_t available_workers = get_tridiag_rank1_num_workers();
+    const std::size_t ideal_workers = util::ceilDiv(to_sizet(nrtiles), to_sizet(2));
+    return std::clamp(ideal_workers, min_workers, available_workers);
+  }();
 
   TileCollector tc{i_begin, i_end};
 
-  auto sender = ex::when_all(std::forward<RhoSender>(rho), std::forward<TolSender>(tol),
-                             ex::when_all_vector(tc.read(index)), ex::when_all_vector(tc.readwrite(d)),
-                             ex::when_all_vector(tc.readwrite(z)), ex::when_all_vector(tc.readwrite(c)));
-
-  return di::transform(di::Policy<Backend::MC>(thread_stacksize::nostack), std::move(deflate_fn),
-                       std::move(sender)) |
+  const auto scheduler = di::getBackendScheduler<Backend::MC>();
+  return ex::when_all(std::forward<RhoSender>(rho), std::forward<TolSender>(tol),
+                      ex::when_all_vector(tc.read(index)), ex::when_all_vector(tc.readwrite(d)),
+                      ex::when_all_vector(tc.readwrite(z)), ex::when_all_vector(tc.readwrite(c))) |
+         ex::continues_on(scheduler) |
+         ex::let_value([scheduler, nthreads, n](auto& rho, auto& tol, auto& index_tiles, auto& d_tiles,
+                                                auto& z_tiles, auto& c_tiles) {
+           return ex::just(std::make_unique<pika::barrier<>>(nthreads),
+                           initDeflationChunks<T>(n, nthreads), std::vector<GivensRotation<T>>()) |
+                  ex::continues_on(scheduler) |
+                  ex::bulk(nthreads, [=, &rho, &tol, &index_tiles, &d_tiles, &z_tiles,
+                                      &c_tiles](const std::size_t thread_idx, auto& barrier_ptr,
+                                                auto& chunks, auto& rots) {
+                    const TileElementIndex zero_idx(0, 0);
+                    const SizeType* i_ptr = index_tiles[0].get().ptr(zero_idx);
+                    T* d_ptr = d_tiles[0].ptr(zero_idx);
+                    T* z_ptr = z_tiles[0].ptr(zero_idx);
+                    ColType* c_ptr = c_tiles[0].ptr(zero_idx);
+
+                    if (nthreads == 1) {
+                      rots = applyDeflationToArrays(rho, tol, n, i_ptr, d_ptr, z_ptr, c_ptr);
+                      return;
+                    }
+
+                    // STEP 1: Speculative deflation of each chunk (multi-thread)
+                    if (thread_idx < chunks.size())
+                      speculateDeflation<T>(rho, tol, i_ptr, d_ptr, z_ptr, c_ptr, chunks[thread_idx]);
+
+                    barrier_ptr->arrive_and_wait(getTridiagRank1BarrierBusyWait());
+
+                    // STEP 2: Resolve the actual deflation from the speculative one (single-thread)
+                    if (thread_idx == 0)
+                      rots = resolveDeflation<T>(rho, tol, i_ptr, d_ptr, z_ptr, c_ptr, chunks);
+                  }) |
+                  // Note: ignore the barrier and the chunks sent by the bulk and just return rots
+                  ex::then([](auto&&, auto&&, auto&& rots) { return std::move(rots); });
+         }) |
          // TODO: This releases the tiles that are kept in the operation state.
          // This is a temporary fix and needs to be replaced by a different
          // adaptor or different lifetime guarantees. This is tracked in
@@ -973,10 +1150,10 @@ void solveRank1Problem(const SizeType i_begin, const SizeType i_end, KSender&& k
 
 template <Backend B, class T, Device D, class KSender, class UDLSenders>
 void multiplyEigenvectors(const SizeType sub_offset, const SizeType n, const SizeType n_upper,
-                          const SizeType n_lower, Matrix<T, D>& e0, Matrix<T, D>& e1, Matrix<T, D>& e2,
-                          KSender&& k, UDLSenders&& n_udl) {
+                          const SizeType n_lower, Matrix<T, D>& e0, Matrix<T, D>& e1, KSender&& k,
+                          UDLSenders&& n_udl) {
   // Note:
-  // This function computes E0 = E1 . E2
+  // This function computes E0 = E1 . U, where U is stored in E0 itself on input
   //
   // where E1 is the matrix with eigenvectors and it looks like this
   //
@@ -1029,18 +1206,33 @@ void multiplyEigenvectors(const SizeType sub_offset, const SizeType n, const Siz
   // │000│  BR    │ D  │  │  GEMM 2    │ Y  │
   // │000│        │    │  │            │    │
   // └───┴────────┴────┘  └────────────┴────┘
+  //
+  // Since a column of the result depends just on the same column of U, the result is computed one
+  // column of tiles at a time in a panel workspace and then copied back in E0, overwriting the columns
+  // of U that are not needed anymore. In this way no additional n x n workspace is needed.
+  // Two panels are used alternately, so that the copy of a panel overlaps with the GEMMs of the next.
+  //
+  // Only the tiles of the sub-problem are sub-pipelined, so that merges of other sub-problems are not
+  // sequenced after this one.
 
   namespace ex = pika::execution::experimental;
+  using dlaf::matrix::internal::MatrixRef;
   using pika::execution::thread_priority;
 
+  const TileElementSize tile_size = e0.distribution().tile_size();
+  std::array<Matrix<T, D>, 2> panels{Matrix<T, D>(LocalElementSize(n, tile_size.cols()), tile_size),
+                                     Matrix<T, D>(LocalElementSize(n, tile_size.cols()), tile_size)};
+
+  const matrix::internal::SubMatrixSpec sub_spec{{sub_offset, sub_offset}, {n, n}};
+  MatrixRef<T, D> e0_ref(e0, sub_spec);
+  MatrixRef<const T, D> e1_ref(e1, sub_spec);
+
   ex::start_detached(
       ex::when_all(std::forward<KSender>(k), std::forward<UDLSenders>(n_udl)) |
       ex::continues_on(dlaf::internal::getBackendScheduler<Backend::MC>(thread_priority::high)) |
-      ex::then([sub_offset, n, n_upper, n_lower, e0 = e0.sub_pipeline(), e1 = e1.sub_pipeline_const(),
-                e2 = e2.sub_pipeline_const()](const SizeType k,
-                                              std::array<std::size_t, 3> n_udl) mutable {
-        using dlaf::matrix::internal::MatrixRef;
-
+      ex::then([n, n_upper, n_lower, e0 = e0_ref.retiled_sub_pipeline({1, 1}),
+                e1 = e1_ref.retiled_sub_pipeline_const({1, 1}),
+                panels = std::move(panels)](const SizeType k, std::array<std::size_t, 3> n_udl) mutable {
         const SizeType n_uh = to_SizeType(n_udl[ev_sort_order(ColType::UpperHalf)]);
         const SizeType n_de = to_SizeType(n_udl[ev_sort_order(ColType::Dense)]);
         const SizeType n_lh = to_SizeType(n_udl[ev_sort_order(ColType::LowerHalf)]);
@@ -1049,24 +1241,32 @@ void multiplyEigenvectors(const SizeType sub_offset, const SizeType n, const Siz
         const SizeType b = n_de + n_lh;
 
         using GEMM = dlaf::multiplication::internal::General<B, D, T>;
-        {
-          MatrixRef<const T, D> e1_sub(e1, {{sub_offset, sub_offset}, {n_upper, a}});
-          MatrixRef<const T, D> e2_sub(e2, {{sub_offset, sub_offset}, {a, k}});
-          MatrixRef<T, D> e0_sub(e0, {{sub_offset, sub_offset}, {n_upper, k}});
-          GEMM::callNN(T(1), e1_sub, e2_sub, T(0), e0_sub);
-        }
+        const SizeType nb = panels[0].distribution().tile_size().cols();
+        for (SizeType j = 0; j < k; j += nb) {
+          const SizeType nj = std::min(nb, k - j);
+          auto& panel = panels[to_sizet((j / nb) % 2)];
+
+          {
+            MatrixRef<const T, D> e1_sub(e1, {{0, 0}, {n_upper, a}});
+            MatrixRef<const T, D> u_sub(e0, {{0, j}, {a, nj}});
+            MatrixRef<T, D> panel_sub(panel, {{0, 0}, {n_upper, nj}});
+            GEMM::callNN(T(1), e1_sub, u_sub, T(0), panel_sub);
+          }
 
-        {
-          MatrixRef<const T, D> e1_sub(e1, {{sub_offset + n_upper, sub_offset + n_uh}, {n_lower, b}});
-          MatrixRef<const T, D> e2_sub(e2, {{sub_offset + n_uh, sub_offset}, {b, k}});
-          MatrixRef<T, D> e0_sub(e0, {{sub_offset + n_upper, sub_offset}, {n_lower, k}});
+          {
+            MatrixRef<const T, D> e1_sub(e1, {{n_upper, n_uh}, {n_lower, b}});
+            MatrixRef<const T, D> u_sub(e0, {{n_uh, j}, {b, nj}});
+            MatrixRef<T, D> panel_sub(panel, {{n_upper, 0}, {n_lower, nj}});
+            GEMM::callNN(T(1), e1_sub, u_sub, T(0), panel_sub);
+          }
 
-          GEMM::callNN(T(1), e1_sub, e2_sub, T(0), e0_sub);
+          MatrixRef<const T, D> panel_sub(panel, {{0, 0}, {n, nj}});
+          MatrixRef<T, D> e0_sub(e0, {{0, j}, {n, nj}});
+          copy(panel_sub, e0_sub);
         }
 
         {
-          const matrix::internal::SubMatrixSpec deflated_submat{{sub_offset, sub_offset + k},
-                                                                {n, n - k}};
+          const matrix::internal::SubMatrixSpec deflated_submat{{0, k}, {n, n - k}};
           MatrixRef<T, D> sub_e0(e0, deflated_submat);
           MatrixRef<const T, D> sub_e1(e1, deflated_submat);
 
@@ -1149,7 +1349,8 @@ void mergeSubproblems(const SizeType i_begin, const SizeType i_split, const Size
   // - reorder `d0 -> d1`, `z0 -> z1`, using `i3` such that deflated entries are at the bottom.
   // - compute permutation `i4`: sorted by col type ---> deflated
   // - solve rank-1 problem and save eigenvalues in `d0` and `d1` (copy) and eigenvectors in `e2` (sorted
-  // by coltype)
+  // by coltype). Note: `e2` is the same matrix as `e0`, whose values are not needed anymore after the
+  // permutation to `e1`.
   // - set deflated diagonal entries of `U` to 1 (temporary solution until optimized GEMM is implemented)
   //
   //  | U | U | D | D |   |   | DF | DF |  U:  UpperHalf
@@ -1197,7 +1398,7 @@ void mergeSubproblems(const SizeType i_begin, const SizeType i_split, const Size
   // prepared for the deflated system.
   const SizeType sub_offset = dist.template globalTileElementDistance<Coord::Row>(0, i_begin);
 
-  multiplyEigenvectors<B>(sub_offset, n, n_upper, n_lower, ws.e0, ws.e1, ws.e2, k, std::move(n_udl));
+  multiplyEigenvectors<B>(sub_offset, n, n_upper, n_lower, ws.e0, ws.e1, k, std::move(n_udl));
 
   // Step #4: Final permutation to sort eigenvalues and eigenvectors
   //
@@ -1321,6 +1522,8 @@ void solveRank1ProblemDist(CommSender&& row_comm, CommSender&& col_comm, const S
     auto msg = comm::make_message(data);
     DLAF_MPI_CHECK_ERROR(MPI_Iallreduce(MPI_IN_PLACE, msg.data(), msg.count(), msg.mpi_type(), reduce_op,
                                         comm, req));
+    comm::internal::addBytesSent(comm, msg.mpi_type(), msg.count());
+    comm::internal::addBytesReceived(comm, msg.mpi_type(), msg.count());
   };
 
   const auto hp_scheduler = di::getBackendScheduler<Backend::MC>(thread_priority::high);
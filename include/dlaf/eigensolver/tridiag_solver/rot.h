@@ -13,6 +13,7 @@
 #include <whip.hpp>
 #endif
 
+#include <algorithm>
 #include <cstddef>
 #include <utility>
 #include <vector>
@@ -28,6 +29,7 @@
 #include <dlaf/communication/datatypes.h>
 #include <dlaf/communication/index.h>
 #include <dlaf/communication/kernels/p2p.h>
+#include <dlaf/eigensolver/internal/get_tridiag_rank1_nworkers.h>
 #include <dlaf/eigensolver/tridiag_solver/index_manipulation.h>
 #include <dlaf/eigensolver/tridiag_solver/kernels.h>
 #include <dlaf/eigensolver/tridiag_solver/tile_collector.h>
@@ -37,10 +39,14 @@
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/panel.h>
 #include <dlaf/memory/memory_view.h>
+#include <dlaf/metrics.h>
+#include <dlaf/schedulers.h>
 #include <dlaf/sender/policy.h>
 #include <dlaf/sender/transform.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/sender/when_all_lift.h>
+#include <dlaf/types.h>
+#include <dlaf/util_math.h>
 
 namespace dlaf::eigensolver::internal {
 
@@ -53,6 +59,7 @@ void sendCol(const comm::Communicator& comm, const comm::IndexT_MPI rank_dest,
 
   DLAF_MPI_CHECK_ERROR(MPI_Isend(col_data, static_cast<int>(n), dlaf::comm::mpi_datatype<T>::type,
                                  rank_dest, tag, comm, req));
+  comm::internal::addBytesSent(comm, dlaf::comm::mpi_datatype<T>::type, static_cast<int>(n));
 }
 
 template <Device D, class T>
@@ -62,6 +69,7 @@ void recvCol(const comm::Communicator& comm, const comm::IndexT_MPI rank_dest,
 
   DLAF_MPI_CHECK_ERROR(MPI_Irecv(col_data, static_cast<int>(n), dlaf::comm::mpi_datatype<T>::type,
                                  rank_dest, tag, comm, req));
+  comm::internal::addBytesReceived(comm, dlaf::comm::mpi_datatype<T>::type, static_cast<int>(n));
 }
 
 template <Device D, class T, class CommSender>
@@ -145,6 +153,42 @@ struct GivensRotation {
   T s;         // sine
 };
 
+// Apply GivenRotations @p rots, in order, to the first @p m rows of the columns pointed by `col_ptr(j)`,
+// where `j` is a column index used by the rotations.
+//
+// Note: rows are independent, so blocks of rows can be rotated in parallel. The rotations are fused:
+// the rows are processed in strips short enough to stay in L1 cache, and all the rotations are applied
+// to a strip before moving to the next one, so that each involved column is streamed from memory once,
+// even if it is involved in more rotations (e.g. in a deflation region). The update of a strip is a
+// simple loop over contiguous elements, which the compiler vectorizes.
+template <class T, class ColPtrFn>
+void applyGivensRotationsToRows(const SizeType m, const std::vector<GivensRotation<T>>& rots,
+                                ColPtrFn&& col_ptr) {
+  static_assert(!isComplex_v<T>, "Givens rotations of the tridiagonal solver are real");
+  constexpr SizeType strip_size = 64;
+
+  std::vector<std::pair<T*, T*>> cols;
+  cols.reserve(rots.size());
+  for (const GivensRotation<T>& rot : rots)
+    cols.emplace_back(col_ptr(rot.i), col_ptr(rot.j));
+
+  for (SizeType r_begin = 0; r_begin < m; r_begin += strip_size) {
+    const SizeType r_end = std::min(r_begin + strip_size, m);
+    for (std::size_t k = 0; k < rots.size(); ++k) {
+      const T c = rots[k].c;
+      const T s = rots[k].s;
+      T* x = cols[k].first;
+      T* y = cols[k].second;
+      for (SizeType r = r_begin; r < r_end; ++r) {
+        const T x_r = x[r];
+        const T y_r = y[r];
+        x[r] = c * x_r + s * y_r;
+        y[r] = c * y_r - s * x_r;
+      }
+    }
+  }
+}
+
 // Apply GivenRotations to tiles of the square sub-matrix identified by tile in range [i_begin, i_end).
 //
 // @param i_begin global tile index for both row and column identifying the start of the sub-matrix
@@ -159,7 +203,8 @@ void applyGivensRotationsToMatrixColumns(const SizeType i_begin, const SizeType
                                          Matrix<T, D>& mat) {
   // Note:
   // a column index may be paired to more than one other index, this may lead to a race
-  // condition if parallelized trivially. Current implementation is serial.
+  // condition if parallelized trivially over the rotations. On CPU rows of tiles are processed in
+  // parallel instead, each one applying all the rotations in order.
 
   namespace ex = pika::execution::experimental;
   namespace di = dlaf::internal;
@@ -167,38 +212,67 @@ void applyGivensRotationsToMatrixColumns(const SizeType i_begin, const SizeType
   const SizeType n = problemSize(i_begin, i_end, mat.distribution());
   const SizeType nb = mat.distribution().tile_size().rows();
 
-  auto givens_rots_fn = [n, nb](const auto& rots, const auto& tiles, [[maybe_unused]] auto&&... ts) {
-    // Distribution of the merged subproblems
-    matrix::Distribution distr(LocalElementSize(n, n), TileElementSize(nb, nb));
+  TileCollector tc{i_begin, i_end};
 
-    common::internal::SingleThreadedBlasScope single;
+  auto sender = ex::when_all(std::forward<RotsSender>(rots), ex::when_all_vector(tc.readwrite(mat)));
 
-    for (const GivensRotation<T>& rot : rots) {
-      // Get the index of the tile that has column `rot.i` and the index of the column within the tile.
-      const SizeType i_tile = distr.globalTileLinearIndex(GlobalElementIndex(0, rot.i));
-      const SizeType i_el = distr.tileElementFromGlobalElement<Coord::Col>(rot.i);
-      T* x = tiles[to_sizet(i_tile)].ptr(TileElementIndex(0, i_el));
-
-      // Get the index of the tile that has column `rot.j` and the index of the column within the tile.
-      const SizeType j_tile = distr.globalTileLinearIndex(GlobalElementIndex(0, rot.j));
-      const SizeType j_el = distr.tileElementFromGlobalElement<Coord::Col>(rot.j);
-      T* y = tiles[to_sizet(j_tile)].ptr(TileElementIndex(0, j_el));
-
-      // Apply Givens rotations
-      if constexpr (D == Device::CPU) {
-        blas::rot(n, x, 1, y, 1, rot.c, rot.s);
+  if constexpr (D == Device::CPU) {
+    // Note: at least a row of tiles per-worker, in the range [1, getTridiagRank1NWorkers()]
+    const std::size_t nthreads = [nrtiles = (i_end - i_begin)]() {
+      const std::size_t min_workers = 1;
+      const std::size_t available_workers = get_tridiag_rank1_num_workers();
+      return std::clamp(to_sizet(nrtiles), min_workers, available_workers);
+    }();
+
+    auto givens_rots_fn = [n, nb, nthreads](const std::size_t thread_idx, const auto& rots,
+                                            const auto& tiles) {
+      // Distribution of the merged subproblems
+      const matrix::Distribution distr(LocalElementSize(n, n), TileElementSize(nb, nb));
+      const SizeType nrtiles = distr.nr_tiles().rows();
+
+      const SizeType batch_size = util::ceilDiv(nrtiles, to_SizeType(nthreads));
+      const SizeType begin = std::min(to_SizeType(thread_idx) * batch_size, nrtiles);
+      const SizeType end = std::min(begin + batch_size, nrtiles);
+
+      for (SizeType i_tile = begin; i_tile < end; ++i_tile) {
+        // Get the pointer to the part of column `j` in the `i_tile` row of tiles.
+        auto col_ptr = [&distr, &tiles, nrtiles, i_tile](const SizeType j) {
+          const SizeType j_tile = distr.global_tile_from_global_element<Coord::Col>(j);
+          const SizeType j_el = distr.tile_element_from_global_element<Coord::Col>(j);
+          return tiles[to_sizet(i_tile + j_tile * nrtiles)].ptr(TileElementIndex(0, j_el));
+        };
+
+        applyGivensRotationsToRows(distr.global_tile_size_of<Coord::Row>(i_tile), rots, col_ptr);
       }
-      else {
+    };
+
+    ex::start_detached(std::move(sender) | ex::continues_on(di::getBackendScheduler<Backend::MC>()) |
+                       ex::bulk(nthreads, std::move(givens_rots_fn)));
+  }
+  else {
+    auto givens_rots_fn = [n, nb](const auto& rots, const auto& tiles, auto&&... ts) {
+      // Distribution of the merged subproblems
+      matrix::Distribution distr(LocalElementSize(n, n), TileElementSize(nb, nb));
+
+      for (const GivensRotation<T>& rot : rots) {
+        // Get the index of the tile that has column `rot.i` and the index of the column within the tile.
+        const SizeType i_tile = distr.globalTileLinearIndex(GlobalElementIndex(0, rot.i));
+        const SizeType i_el = distr.tileElementFromGlobalElement<Coord::Col>(rot.i);
+        T* x = tiles[to_sizet(i_tile)].ptr(TileElementIndex(0, i_el));
+
+        // Get the index of the tile that has column `rot.j` and the index of the column within the tile.
+        const SizeType j_tile = distr.globalTileLinearIndex(GlobalElementIndex(0, rot.j));
+        const SizeType j_el = distr.tileElementFromGlobalElement<Coord::Col>(rot.j);
+        T* y = tiles[to_sizet(j_tile)].ptr(TileElementIndex(0, j_el));
+
+        // Apply Givens rotations
         givensRotationOnDevice(n, x, y, rot.c, rot.s, ts...);
       }
-    }
-  };
-
-  TileCollector tc{i_begin, i_end};
+    };
 
-  auto sender = ex::when_all(std::forward<RotsSender>(rots), ex::when_all_vector(tc.readwrite(mat)));
-  di::transformDetach(di::Policy<DefaultBackend_v<D>>(pika::execution::thread_stacksize::nostack),
-                      std::move(givens_rots_fn), std::move(sender));
+    di::transformDetach(di::Policy<DefaultBackend_v<D>>(pika::execution::thread_stacksize::nostack),
+                        std::move(givens_rots_fn), std::move(sender));
+  }
 }
 
 /// Apply GivenRotations to tiles of the distributed square sub-matrix identified by tile in range
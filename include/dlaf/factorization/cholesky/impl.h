@@ -25,6 +25,7 @@
 #include <dlaf/common/pipeline.h>
 #include <dlaf/common/range2d.h>
 #include <dlaf/common/round_robin.h>
+#include <dlaf/common/trace.h>
 #include <dlaf/communication/broadcast_panel.h>
 #include <dlaf/communication/communicator.h>
 #include <dlaf/communication/communicator_grid.h>
@@ -150,6 +151,7 @@ void gemmTrailingMatrixTile(pika::execution::thread_priority priority, PanelTile
 template <Backend backend, Device device, class T>
 void Cholesky<backend, device, T>::call_L(Matrix<T, device>& mat_a) {
   using namespace cholesky_l;
+  using dlaf::common::internal::TraceTileScope;
   using pika::execution::thread_priority;
 
   // Number of tile (rows = cols)
@@ -159,10 +161,14 @@ void Cholesky<backend, device, T>::call_L(Matrix<T, device>& mat_a) {
     // Cholesky decomposition on mat_a.readwrite(k,k) r/w potrf (lapack operation)
     auto kk = LocalTileIndex{k, k};
 
-    potrfDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk));
+    {
+      const TraceTileScope trace_tile(kk);
+      potrfDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk));
+    }
 
     for (SizeType i = k + 1; i < nrtile; ++i) {
       // Update panel mat_a.readwrite(i,k) with trsm (blas operation), using data mat_a.read(k,k)
+      const TraceTileScope trace_tile(i, k);
       trsmPanelTile<backend>(thread_priority::high, mat_a.read(kk),
                              mat_a.readwrite(LocalTileIndex{i, k}));
     }
@@ -174,12 +180,16 @@ void Cholesky<backend, device, T>::call_L(Matrix<T, device>& mat_a) {
 
       // Update trailing matrix: diagonal element mat_a.readwrite(j,j), reading
       // mat_a.read(j,k), using herk (blas operation)
-      herkTrailingDiagTile<backend>(trailing_matrix_priority, mat_a.read(LocalTileIndex{j, k}),
-                                    mat_a.readwrite(LocalTileIndex{j, j}));
+      {
+        const TraceTileScope trace_tile(j, j);
+        herkTrailingDiagTile<backend>(trailing_matrix_priority, mat_a.read(LocalTileIndex{j, k}),
+                                      mat_a.readwrite(LocalTileIndex{j, j}));
+      }
 
       for (SizeType i = j + 1; i < nrtile; ++i) {
         // Update remaining trailing matrix mat_a.readwrite(i,j), reading
         // mat_a.read(i,k) and mat_a.read(j,k), using gemm (blas operation)
+        const TraceTileScope trace_tile(i, j);
         gemmTrailingMatrixTile<backend>(trailing_matrix_priority, mat_a.read(LocalTileIndex{i, k}),
                                         mat_a.read(LocalTileIndex{j, k}),
                                         mat_a.readwrite(LocalTileIndex{i, j}));
@@ -191,6 +201,7 @@ void Cholesky<backend, device, T>::call_L(Matrix<T, device>& mat_a) {
 template <Backend backend, Device device, class T>
 void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid& grid, Matrix<T, device>& mat_a) {
   using namespace cholesky_l;
+  using dlaf::common::internal::TraceTileScope;
   using pika::execution::thread_priority;
 
 #ifdef DLAF_WITH_HDF5
@@ -212,6 +223,10 @@ void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid& grid, Matrix<T
 
   const comm::Index2D this_rank = grid.rank();
 
+  const auto bcast_algorithm = getTuneParameters().cholesky_broadcast_panel_ring
+                                   ? comm::BroadcastPanelAlgorithm::ring
+                                   : comm::BroadcastPanelAlgorithm::collective;
+
   const matrix::Distribution& distr = mat_a.distribution();
   const SizeType nrtile = mat_a.nrTiles().cols();
 
@@ -225,8 +240,10 @@ void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid& grid, Matrix<T
     const comm::Index2D kk_rank = distr.rankGlobalTile(kk_idx);
 
     // Factorization of diagonal tile and broadcast it along the k-th column
-    if (kk_rank == this_rank)
+    if (kk_rank == this_rank) {
+      const TraceTileScope trace_tile(kk_idx);
       potrfDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk_idx));
+    }
 
     // If there is no trailing matrix
     const SizeType kt = k + 1;
@@ -256,6 +273,7 @@ void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid& grid, Matrix<T
         const LocalTileIndex local_idx(Coord::Row, i);
         const LocalTileIndex ik_idx(i, distr.localTileFromGlobalTile<Coord::Col>(k));
 
+        const TraceTileScope trace_tile(distr.globalTileFromLocalTile<Coord::Row>(i), k);
         trsmPanelTile<backend>(thread_priority::high, panelT.read(diag_wp_idx), mat_a.readwrite(ik_idx));
 
         panel.setTile(local_idx, mat_a.read(ik_idx));
@@ -267,7 +285,7 @@ void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid& grid, Matrix<T
 
     panelT.setRange({kt, kt}, {nrtile - 1, nrtile - 1});
 
-    broadcast(kk_rank.col(), panel, panelT, mpi_row_task_chain, mpi_col_task_chain);
+    broadcast(kk_rank.col(), panel, panelT, mpi_row_task_chain, mpi_col_task_chain, bcast_algorithm);
 
     // TRAILING MATRIX
     for (SizeType jt_idx = kt; jt_idx < nrtile; ++jt_idx) {
@@ -282,6 +300,7 @@ void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid& grid, Matrix<T
       if (this_rank.row() == owner.row()) {
         const auto i = distr.localTileFromGlobalTile<Coord::Row>(jt_idx);
 
+        const TraceTileScope trace_tile(jt_idx, jt_idx);
         herkTrailingDiagTile<backend>(trailing_matrix_priority, panel.read({Coord::Row, i}),
                                       mat_a.readwrite(LocalTileIndex{i, j}));
       }
@@ -293,6 +312,7 @@ void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid& grid, Matrix<T
           continue;
 
         const auto i = distr.localTileFromGlobalTile<Coord::Row>(i_idx);
+        const TraceTileScope trace_tile(i_idx, jt_idx);
         gemmTrailingMatrixTile<backend>(trailing_matrix_priority, panel.read({Coord::Row, i}),
                                         panelT.read({Coord::Col, j}),
                                         mat_a.readwrite(LocalTileIndex{i, j}));
@@ -316,6 +336,7 @@ void Cholesky<backend, device, T>::call_L(comm::CommunicatorGrid& grid, Matrix<T
 template <Backend backend, Device device, class T>
 void Cholesky<backend, device, T>::call_U(Matrix<T, device>& mat_a) {
   using namespace cholesky_u;
+  using dlaf::common::internal::TraceTileScope;
   using pika::execution::thread_priority;
 
   // Number of tile (rows = cols)
@@ -324,9 +345,13 @@ void Cholesky<backend, device, T>::call_U(Matrix<T, device>& mat_a) {
   for (SizeType k = 0; k < nrtile; ++k) {
     auto kk = LocalTileIndex{k, k};
 
-    potrfDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk));
+    {
+      const TraceTileScope trace_tile(kk);
+      potrfDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk));
+    }
 
     for (SizeType j = k + 1; j < nrtile; ++j) {
+      const TraceTileScope trace_tile(k, j);
       trsmPanelTile<backend>(thread_priority::high, mat_a.read(kk),
                              mat_a.readwrite(LocalTileIndex{k, j}));
     }
@@ -335,10 +360,14 @@ void Cholesky<backend, device, T>::call_U(Matrix<T, device>& mat_a) {
       const auto trailing_matrix_priority =
           (i == k + 1) ? thread_priority::high : thread_priority::normal;
 
-      herkTrailingDiagTile<backend>(trailing_matrix_priority, mat_a.read(LocalTileIndex{k, i}),
-                                    mat_a.readwrite(LocalTileIndex{i, i}));
+      {
+        const TraceTileScope trace_tile(i, i);
+        herkTrailingDiagTile<backend>(trailing_matrix_priority, mat_a.read(LocalTileIndex{k, i}),
+                                      mat_a.readwrite(LocalTileIndex{i, i}));
+      }
 
       for (SizeType j = i + 1; j < nrtile; ++j) {
+        const TraceTileScope trace_tile(i, j);
         gemmTrailingMatrixTile<backend>(trailing_matrix_priority, mat_a.read(LocalTileIndex{k, i}),
                                         mat_a.read(LocalTileIndex{k, j}),
                                         mat_a.readwrite(LocalTileIndex{i, j}));
@@ -350,6 +379,7 @@ void Cholesky<backend, device, T>::call_U(Matrix<T, device>& mat_a) {
 template <Backend backend, Device device, class T>
 void Cholesky<backend, device, T>::call_U(comm::CommunicatorGrid& grid, Matrix<T, device>& mat_a) {
   using namespace cholesky_u;
+  using dlaf::common::internal::TraceTileScope;
   using pika::execution::thread_priority;
 
   // Set up MPI executor pipelines
@@ -358,6 +388,10 @@ void Cholesky<backend, device, T>::call_U(comm::CommunicatorGrid& grid, Matrix<T
 
   const comm::Index2D this_rank = grid.rank();
 
+  const auto bcast_algorithm = getTuneParameters().cholesky_broadcast_panel_ring
+                                   ? comm::BroadcastPanelAlgorithm::ring
+                                   : comm::BroadcastPanelAlgorithm::collective;
+
   const matrix::Distribution& distr = mat_a.distribution();
   const SizeType nrtile = mat_a.nrTiles().cols();
 
@@ -372,6 +406,7 @@ void Cholesky<backend, device, T>::call_U(comm::CommunicatorGrid& grid, Matrix<T
 
     // Factorization of diagonal tile and broadcast it along the k-th column
     if (kk_rank == this_rank) {
+      const TraceTileScope trace_tile(kk_idx);
       potrfDiagTile<backend>(thread_priority::high, mat_a.readwrite(kk_idx));
     }
 
@@ -402,6 +437,7 @@ void Cholesky<backend, device, T>::call_U(comm::CommunicatorGrid& grid, Matrix<T
         const LocalTileIndex local_idx(Coord::Col, j);
         const LocalTileIndex kj_idx(distr.localTileFromGlobalTile<Coord::Row>(k), j);
 
+        const TraceTileScope trace_tile(k, distr.globalTileFromLocalTile<Coord::Col>(j));
         trsmPanelTile<backend>(thread_priority::high, panelT.read(diag_wp_idx), mat_a.readwrite(kj_idx));
 
         panel.setTile(local_idx, mat_a.read(kj_idx));
@@ -413,7 +449,7 @@ void Cholesky<backend, device, T>::call_U(comm::CommunicatorGrid& grid, Matrix<T
 
     panelT.setRange({kt, kt}, {nrtile - 1, nrtile - 1});
 
-    broadcast(kk_rank.row(), panel, panelT, mpi_row_task_chain, mpi_col_task_chain);
+    broadcast(kk_rank.row(), panel, panelT, mpi_row_task_chain, mpi_col_task_chain, bcast_algorithm);
 
     // TRAILING MATRIX
     for (SizeType it_idx = kt; it_idx < nrtile; ++it_idx) {
@@ -428,6 +464,7 @@ void Cholesky<backend, device, T>::call_U(comm::CommunicatorGrid& grid, Matrix<T
       if (this_rank.col() == owner.col()) {
         const auto j = distr.localTileFromGlobalTile<Coord::Col>(it_idx);
 
+        const TraceTileScope trace_tile(it_idx, it_idx);
         herkTrailingDiagTile<backend>(trailing_matrix_priority, panel.read({Coord::Col, j}),
                                       mat_a.readwrite(LocalTileIndex{i, j}));
       }
@@ -440,6 +477,7 @@ void Cholesky<backend, device, T>::call_U(comm::CommunicatorGrid& grid, Matrix<T
 
         const auto j = distr.localTileFromGlobalTile<Coord::Col>(j_idx);
 
+        const TraceTileScope trace_tile(it_idx, j_idx);
         gemmTrailingMatrixTile<backend>(trailing_matrix_priority, panelT.read({Coord::Row, i}),
                                         panel.read({Coord::Col, j}),
                                         mat_a.readwrite(LocalTileIndex{i, j}));
@@ -13,10 +13,16 @@
 
 /// @file
 
+#include <blas.hh>
+
+#include <dlaf/communication/communicator_grid.h>
 #include <dlaf/communication/communicator_pipeline.h>
 #include <dlaf/factorization/qr/api.h>
 #include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
 
 namespace dlaf::factorization::internal {
 
@@ -112,3 +118,188 @@ void computeTFactor(matrix::Panel<Coord::Col, T, device>& hh_panel,
 }
 
 }
+
+namespace dlaf {
+
+/// QR factorization of a general (m x n) matrix A.
+///
+/// The factorization has the form A = Q R, where Q is a unitary (m x m) matrix and R is an upper
+/// trapezoidal (m x n) matrix.
+/// Q is represented as a product of elementary reflectors Q = H(0) H(1) ... H(k-1), with
+/// k = min(m - 1, n), where H(j) = I - tau(j) v_j v_j^H and v_j = (0, ..., 0, 1, A(j+1 : m, j)).
+///
+/// Note: differently from LAPACK, reflectors of size 1 are not computed, i.e. when m <= n the last
+/// diagonal element of R is not made real.
+///
+/// @param mat_a on entry it contains the matrix A, on exit the upper trapezoidal part contains R and
+/// the elements below the diagonal contain the Householder reflectors.
+/// @param mat_taus on exit it contains the scaling factors tau of the elementary reflectors,
+/// @pre @p mat_a is not distributed
+/// @pre @p mat_a has block size (NB x NB)
+/// @pre @p mat_a has tile size (NB x NB)
+/// @pre @p mat_taus has distribution factorization::internal::qrTausDistribution(mat_a.distribution())
+template <Backend backend, Device device, class T>
+void qr_factorization(Matrix<T, device>& mat_a, Matrix<T, device>& mat_taus) {
+  DLAF_ASSERT(matrix::square_block_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_a), mat_a);
+  DLAF_ASSERT(matrix::local_matrix(mat_a), mat_a);
+  DLAF_ASSERT(mat_taus.distribution() ==
+                  factorization::internal::qrTausDistribution(mat_a.distribution()),
+              mat_taus, mat_a);
+
+  factorization::internal::QR<backend, device, T>::call(mat_a, mat_taus);
+}
+
+/// \overload qr_factorization
+///
+/// @return the scaling factors tau of the elementary reflectors.
+template <Backend backend, Device device, class T>
+Matrix<T, device> qr_factorization(Matrix<T, device>& mat_a) {
+  Matrix<T, device> mat_taus(factorization::internal::qrTausDistribution(mat_a.distribution()));
+  qr_factorization<backend>(mat_a, mat_taus);
+  return mat_taus;
+}
+
+/// QR factorization of a general (m x n) distributed matrix A.
+///
+/// See the local version of qr_factorization for the description of the output.
+///
+/// @param grid is the communicator grid on which the matrix A has been distributed,
+/// @param mat_a on entry it contains the matrix A, on exit the upper trapezoidal part contains R and
+/// the elements below the diagonal contain the Householder reflectors.
+/// @param mat_taus on exit it contains the scaling factors tau of the elementary reflectors,
+/// @pre @p mat_a is distributed according to @p grid
+/// @pre @p mat_a has block size (NB x NB)
+/// @pre @p mat_a has tile size (NB x NB)
+/// @pre @p mat_taus has distribution factorization::internal::qrTausDistribution(mat_a.distribution())
+/// @pre @p grid has at least 2 communicator pipelines
+template <Backend backend, Device device, class T>
+void qr_factorization(comm::CommunicatorGrid& grid, Matrix<T, device>& mat_a,
+                      Matrix<T, device>& mat_taus) {
+  DLAF_ASSERT(matrix::square_block_size(mat_a), mat_a);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_a), mat_a);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_a, grid), mat_a);
+  DLAF_ASSERT(mat_taus.distribution() ==
+                  factorization::internal::qrTausDistribution(mat_a.distribution()),
+              mat_taus, mat_a);
+
+  factorization::internal::QR<backend, device, T>::call(grid, mat_a, mat_taus);
+}
+
+/// \overload qr_factorization
+///
+/// @return the scaling factors tau of the elementary reflectors.
+template <Backend backend, Device device, class T>
+Matrix<T, device> qr_factorization(comm::CommunicatorGrid& grid, Matrix<T, device>& mat_a) {
+  Matrix<T, device> mat_taus(factorization::internal::qrTausDistribution(mat_a.distribution()));
+  qr_factorization<backend>(grid, mat_a, mat_taus);
+  return mat_taus;
+}
+
+/// Applies the unitary matrix Q of a QR factorization to a matrix C from the left.
+///
+/// It computes C = op(Q) C, where op(Q) = Q (op = NoTrans) or op(Q) = Q^H (op = ConjTrans).
+///
+/// @param op specifies if Q or Q^H is applied,
+/// @param mat_v is the (m x n) matrix returned by qr_factorization, which contains the Householder
+/// reflectors below the diagonal,
+/// @param mat_taus contains the scaling factors as returned by qr_factorization,
+/// @param mat_c contains the (m x k) matrix C, while on exit it contains op(Q) C.
+/// @pre @p op is either blas::Op::NoTrans or blas::Op::ConjTrans
+/// @pre @p mat_v and @p mat_c are not distributed
+/// @pre @p mat_v and @p mat_c have block size (NB x NB)
+/// @pre @p mat_v and @p mat_c have tile size (NB x NB)
+/// @pre @p mat_v and @p mat_c have the same number of rows
+template <Backend backend, Device device, class T>
+void qr_apply_q(blas::Op op, Matrix<const T, device>& mat_v, Matrix<const T, device>& mat_taus,
+                Matrix<T, device>& mat_c) {
+  DLAF_ASSERT(op == blas::Op::NoTrans || op == blas::Op::ConjTrans, op);
+  DLAF_ASSERT(matrix::local_matrix(mat_v), mat_v);
+  DLAF_ASSERT(matrix::local_matrix(mat_c), mat_c);
+  DLAF_ASSERT(matrix::square_block_size(mat_v), mat_v);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_v), mat_v);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_c), mat_c);
+  DLAF_ASSERT(mat_c.size().rows() == mat_v.size().rows(), mat_c, mat_v);
+  DLAF_ASSERT(mat_c.blockSize().rows() == mat_v.blockSize().rows(), mat_c, mat_v);
+
+  factorization::internal::QR<backend, device, T>::apply_q(op, mat_v, mat_taus, mat_c);
+}
+
+/// Applies the unitary matrix Q of a distributed QR factorization to a matrix C from the left.
+///
+/// See the local version of qr_apply_q.
+///
+/// @pre @p op is either blas::Op::NoTrans or blas::Op::ConjTrans
+/// @pre @p mat_v and @p mat_c are distributed according to @p grid
+/// @pre @p mat_v and @p mat_c have block size (NB x NB)
+/// @pre @p mat_v and @p mat_c have tile size (NB x NB)
+/// @pre @p mat_v and @p mat_c have the same number of rows and the same source rank row
+template <Backend backend, Device device, class T>
+void qr_apply_q(comm::CommunicatorGrid& grid, blas::Op op, Matrix<const T, device>& mat_v,
+                Matrix<const T, device>& mat_taus, Matrix<T, device>& mat_c) {
+  DLAF_ASSERT(op == blas::Op::NoTrans || op == blas::Op::ConjTrans, op);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_v, grid), mat_v);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_c, grid), mat_c);
+  DLAF_ASSERT(matrix::square_block_size(mat_v), mat_v);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_v), mat_v);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_c), mat_c);
+  DLAF_ASSERT(mat_c.size().rows() == mat_v.size().rows(), mat_c, mat_v);
+  DLAF_ASSERT(mat_c.blockSize().rows() == mat_v.blockSize().rows(), mat_c, mat_v);
+  DLAF_ASSERT(mat_c.distribution().source_rank_index().row() ==
+                  mat_v.distribution().source_rank_index().row(),
+              mat_c, mat_v);
+
+  factorization::internal::QR<backend, device, T>::apply_q(grid, op, mat_v, mat_taus, mat_c);
+}
+
+/// Forms explicitly the first k columns of the unitary matrix Q of a QR factorization.
+///
+/// @param mat_v is the (m x n) matrix returned by qr_factorization, which contains the Householder
+/// reflectors below the diagonal,
+/// @param mat_taus contains the scaling factors as returned by qr_factorization,
+/// @param mat_q on exit it contains the (m x k) matrix Q(:, 0 : k).
+/// @pre @p mat_v and @p mat_q are not distributed
+/// @pre @p mat_v and @p mat_q have block size (NB x NB)
+/// @pre @p mat_v and @p mat_q have tile size (NB x NB)
+/// @pre @p mat_v and @p mat_q have the same number of rows
+template <Backend backend, Device device, class T>
+void qr_form_q(Matrix<const T, device>& mat_v, Matrix<const T, device>& mat_taus,
+               Matrix<T, device>& mat_q) {
+  DLAF_ASSERT(matrix::local_matrix(mat_v), mat_v);
+  DLAF_ASSERT(matrix::local_matrix(mat_q), mat_q);
+  DLAF_ASSERT(matrix::square_block_size(mat_v), mat_v);
+  DLAF_ASSERT(matrix::square_block_size(mat_q), mat_q);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_v), mat_v);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_q), mat_q);
+  DLAF_ASSERT(mat_q.size().rows() == mat_v.size().rows(), mat_q, mat_v);
+  DLAF_ASSERT(mat_q.blockSize() == mat_v.blockSize(), mat_q, mat_v);
+
+  factorization::internal::QR<backend, device, T>::form_q(mat_v, mat_taus, mat_q);
+}
+
+/// Forms explicitly the first k columns of the unitary matrix Q of a distributed QR factorization.
+///
+/// See the local version of qr_form_q.
+///
+/// @pre @p mat_v and @p mat_q are distributed according to @p grid
+/// @pre @p mat_v and @p mat_q have block size (NB x NB)
+/// @pre @p mat_v and @p mat_q have tile size (NB x NB)
+/// @pre @p mat_v and @p mat_q have the same number of rows and the same source rank row
+template <Backend backend, Device device, class T>
+void qr_form_q(comm::CommunicatorGrid& grid, Matrix<const T, device>& mat_v,
+               Matrix<const T, device>& mat_taus, Matrix<T, device>& mat_q) {
+  DLAF_ASSERT(matrix::equal_process_grid(mat_v, grid), mat_v);
+  DLAF_ASSERT(matrix::equal_process_grid(mat_q, grid), mat_q);
+  DLAF_ASSERT(matrix::square_block_size(mat_v), mat_v);
+  DLAF_ASSERT(matrix::square_block_size(mat_q), mat_q);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_v), mat_v);
+  DLAF_ASSERT(matrix::single_tile_per_block(mat_q), mat_q);
+  DLAF_ASSERT(mat_q.size().rows() == mat_v.size().rows(), mat_q, mat_v);
+  DLAF_ASSERT(mat_q.blockSize() == mat_v.blockSize(), mat_q, mat_v);
+  DLAF_ASSERT(mat_q.distribution().source_rank_index().row() ==
+                  mat_v.distribution().source_rank_index().row(),
+              mat_q, mat_v);
+
+  factorization::internal::QR<backend, device, T>::form_q(grid, mat_v, mat_taus, mat_q);
+}
+}
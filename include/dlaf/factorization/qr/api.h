@@ -10,11 +10,17 @@
 
 #pragma once
 
+#include <algorithm>
 #include <complex>
 
+#include <blas.hh>
+
 #include <pika/execution.hpp>
 
+#include <dlaf/communication/communicator_grid.h>
 #include <dlaf/communication/communicator_pipeline.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/panel.h>
 #include <dlaf/matrix/tile.h>
 #include <dlaf/matrix/views.h>
@@ -22,8 +28,38 @@
 
 namespace dlaf::factorization::internal {
 
+// Distribution of the taus of the QR factorization of a matrix distributed as @p dist_a.
+//
+// Taus are stored in a column vector, which is distributed over the columns of the grid, i.e. the taus
+// of the j-th panel are stored in the rank column owning the j-th column of tiles of A.
+inline matrix::Distribution qrTausDistribution(const matrix::Distribution& dist_a) {
+  // Note:
+  // Reflector of size = 1 is not considered whatever T is (i.e. neither real nor complex)
+  const SizeType nrefls =
+      std::max<SizeType>(0, std::min(dist_a.size().rows() - 1, dist_a.size().cols()));
+
+  return matrix::Distribution(GlobalElementSize(nrefls, 1),
+                              TileElementSize(dist_a.block_size().cols(), 1),
+                              comm::Size2D(dist_a.grid_size().cols(), 1),
+                              comm::Index2D(dist_a.rank_index().col(), 0),
+                              comm::Index2D(dist_a.source_rank_index().col(), 0));
+}
+
 template <Backend backend, Device device, class T>
-struct QR {};
+struct QR {
+  static void call(Matrix<T, device>& mat_a, Matrix<T, device>& mat_taus);
+  static void call(comm::CommunicatorGrid& grid, Matrix<T, device>& mat_a, Matrix<T, device>& mat_taus);
+
+  static void apply_q(blas::Op op, Matrix<const T, device>& mat_v, Matrix<const T, device>& mat_taus,
+                      Matrix<T, device>& mat_c);
+  static void apply_q(comm::CommunicatorGrid& grid, blas::Op op, Matrix<const T, device>& mat_v,
+                      Matrix<const T, device>& mat_taus, Matrix<T, device>& mat_c);
+
+  static void form_q(Matrix<const T, device>& mat_v, Matrix<const T, device>& mat_taus,
+                     Matrix<T, device>& mat_q);
+  static void form_q(comm::CommunicatorGrid& grid, Matrix<const T, device>& mat_v,
+                     Matrix<const T, device>& mat_taus, Matrix<T, device>& mat_q);
+};
 
 template <Backend backend, Device device, class T>
 struct QR_Tfactor {
@@ -37,6 +73,21 @@ struct QR_Tfactor {
 };
 
 // ETI
+#define DLAF_FACTORIZATION_QR_ETI(KWORD, BACKEND, DEVICE, DATATYPE) \
+  KWORD template struct QR<BACKEND, DEVICE, DATATYPE>;
+
+DLAF_FACTORIZATION_QR_ETI(extern, Backend::MC, Device::CPU, float)
+DLAF_FACTORIZATION_QR_ETI(extern, Backend::MC, Device::CPU, double)
+DLAF_FACTORIZATION_QR_ETI(extern, Backend::MC, Device::CPU, std::complex<float>)
+DLAF_FACTORIZATION_QR_ETI(extern, Backend::MC, Device::CPU, std::complex<double>)
+
+#ifdef DLAF_WITH_GPU
+DLAF_FACTORIZATION_QR_ETI(extern, Backend::GPU, Device::GPU, float)
+DLAF_FACTORIZATION_QR_ETI(extern, Backend::GPU, Device::GPU, double)
+DLAF_FACTORIZATION_QR_ETI(extern, Backend::GPU, Device::GPU, std::complex<float>)
+DLAF_FACTORIZATION_QR_ETI(extern, Backend::GPU, Device::GPU, std::complex<double>)
+#endif
+
 #define DLAF_FACTORIZATION_QR_TFACTOR_ETI(KWORD, BACKEND, DEVICE, DATATYPE) \
   KWORD template struct QR_Tfactor<BACKEND, DEVICE, DATATYPE>;
 
@@ -0,0 +1,534 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+
+#include <blas.hh>
+
+#include <pika/execution.hpp>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/common/range2d.h>
+#include <dlaf/common/round_robin.h>
+#include <dlaf/communication/broadcast_panel.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/index.h>
+#include <dlaf/communication/kernels/all_reduce.h>
+#include <dlaf/eigensolver/bt_reduction_to_band/impl.h>
+#include <dlaf/eigensolver/reduction_to_band/impl.h>
+#include <dlaf/factorization/qr.h>
+#include <dlaf/factorization/qr/api.h>
+#include <dlaf/factorization/qr/internal/get_tfactor_num_workers.h>
+#include <dlaf/lapack/tile.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/panel.h>
+#include <dlaf/matrix/views.h>
+#include <dlaf/schedulers.h>
+#include <dlaf/sender/policy.h>
+#include <dlaf/sender/when_all_lift.h>
+#include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
+
+namespace dlaf::factorization::internal {
+
+namespace qr {
+
+// Workspaces needed by computeTFactor for panels (at most) nb wide.
+inline matrix::Distribution tfactorWorkspaceDistribution(const std::size_t nworkers,
+                                                         const SizeType nb) {
+  const SizeType nworkspaces = to_SizeType(std::max<std::size_t>(1, nworkers) - 1);
+  return matrix::Distribution{{nworkspaces * nb, nb}, {nb, nb}};
+}
+
+// Set up the panel V of the reflectors of the k-th panel stored in mat_v, making the head tile
+// well-formed (1s on the diagonal and 0s in the upper part).
+template <Backend B, Device D, class T>
+void setupReflectorPanelV(const matrix::SubPanelView& panel_view, const SizeType k,
+                          matrix::Panel<Coord::Col, T, D>& v, Matrix<const T, D>& mat_v) {
+  using eigensolver::internal::bt_red_band::copyAndSetHHUpperTiles;
+
+  const matrix::Distribution& dist_v = mat_v.distribution();
+  for (const auto& i : panel_view.iteratorLocal()) {
+    auto tile_v = splitTile(mat_v.read(i), panel_view(i));
+    if (dist_v.template global_tile_from_local_tile<Coord::Row>(i.row()) == k)
+      copyAndSetHHUpperTiles<B>(0, std::move(tile_v), v.readwrite(i));
+    else
+      v.setTile(i, std::move(tile_v));
+  }
+}
+
+// W = V T^H (op == NoTrans) or W = V T (op == ConjTrans), so that op(H) C = C - V W^H C
+template <Backend B, Device D, class T>
+void computeW(const blas::Op op, matrix::Panel<Coord::Col, T, D>& w,
+              matrix::Panel<Coord::Col, T, D>& v, matrix::ReadOnlyTileSender<T, D> tile_t) {
+  using eigensolver::internal::bt_red_band::trmmPanel;
+  using eigensolver::internal::red2band::local::trmmComputeW;
+
+  if (op == blas::Op::ConjTrans) {
+    trmmComputeW<B>(w, v, std::move(tile_t));
+    return;
+  }
+
+  for (const auto& idx : w.iteratorLocal())
+    trmmPanel<B>(pika::execution::thread_priority::high, tile_t, v.read(idx), w.readwrite(idx));
+  pika::execution::experimental::start_detached(std::move(tile_t));
+}
+
+template <Backend B, Device D, class T>
+void setIdentity(Matrix<T, D>& mat) {
+  namespace ex = pika::execution::experimental;
+  using pika::execution::thread_priority;
+  using pika::execution::thread_stacksize;
+
+  const matrix::Distribution& dist = mat.distribution();
+  for (const auto& ij_lc : common::iterate_range2d(dist.local_nr_tiles())) {
+    const GlobalTileIndex ij = dist.global_tile_index(ij_lc);
+    const T diag = (ij.row() == ij.col()) ? T(1) : T(0);
+    ex::start_detached(dlaf::internal::whenAllLift(blas::Uplo::General, T(0), diag,
+                                                   mat.readwrite(ij_lc)) |
+                       tile::laset(dlaf::internal::Policy<B>(thread_priority::normal,
+                                                             thread_stacksize::nostack)));
+  }
+}
+}
+
+// Implementation based on:
+// G. H. Golub and C. F. Van Loan, Matrix Computations, chapter 5, The Johns Hopkins University Press
+//
+// The panel factorization and the trailing matrix update reuse the building blocks of the reduction to
+// band (i.e. a reduction to band with band_size = nb, where the panel starts on the diagonal and the
+// trailing matrix is updated with a one-sided update A = Q^H A).
+
+template <Backend B, Device D, class T>
+void QR<B, D, T>::call(Matrix<T, D>& mat_a, Matrix<T, D>& mat_taus) {
+  using dlaf::matrix::Panel;
+  using eigensolver::internal::bt_red_band::gemmTrailingMatrix;
+  using eigensolver::internal::bt_red_band::gemmUpdateW2;
+  using eigensolver::internal::red2band::ComputePanelHelper;
+  using eigensolver::internal::red2band::local::setupReflectorPanelV;
+  using eigensolver::internal::red2band::local::trmmComputeW;
+
+  const auto hp = pika::execution::thread_priority::high;
+  const auto np = pika::execution::thread_priority::normal;
+
+  const auto& dist_a = mat_a.distribution();
+  const SizeType nb = dist_a.block_size().cols();
+
+  DLAF_ASSERT(mat_taus.distribution() == qrTausDistribution(dist_a), mat_taus, mat_a);
+
+  const SizeType nr_panels = mat_taus.nrTiles().rows();
+  if (nr_panels == 0)
+    return;
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_v(n_workspaces, dist_a);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_w(n_workspaces, dist_a);
+  common::RoundRobin<Panel<Coord::Row, T, D>> panels_w2(n_workspaces, dist_a);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_ws(
+      n_workspaces, qr::tfactorWorkspaceDistribution(get_tfactor_num_workers<B>(), nb));
+
+  ComputePanelHelper<B, D, T> compute_panel_helper(n_workspaces, dist_a, mat_taus.distribution());
+
+  for (SizeType k = 0; k < nr_panels; ++k) {
+    const GlobalElementIndex ij_offset(k * nb, k * nb);
+    const SizeType panel_width = std::min(nb, dist_a.size().cols() - ij_offset.col());
+    const SizeType nrefls_tile = mat_taus.tileSize(GlobalTileIndex(k, 0)).rows();
+
+    const matrix::SubPanelView panel_view(dist_a, ij_offset, panel_width);
+
+    auto& ws = panels_ws.nextResource();
+    auto& v = panels_v.nextResource();
+    v.setRangeStart(ij_offset);
+    ws.setWidth(nrefls_tile);
+    v.setWidth(nrefls_tile);
+
+    // PANEL
+    compute_panel_helper.call(mat_a, mat_taus, k, panel_view);
+
+    constexpr bool has_reflector_head = true;
+    setupReflectorPanelV<B, D, T>(has_reflector_head, panel_view, nrefls_tile, v, mat_a);
+
+    const LocalTileIndex t_idx(0, 0);
+    Matrix<T, D> t(LocalElementSize(nrefls_tile, nrefls_tile), TileElementSize(nb, nb));
+    computeTFactor<B>(v, mat_taus.read(GlobalTileIndex(k, 0)), t.readwrite(t_idx), ws);
+    ws.reset();
+
+    // PREPARATION FOR TRAILING MATRIX UPDATE
+    const GlobalElementIndex at_offset(ij_offset.row(), ij_offset.col() + panel_width);
+
+    // Note: if there is no trailing matrix, algorithm has finished
+    if (!at_offset.isIn(mat_a.size()))
+      break;
+
+    const matrix::SubMatrixView trailing_matrix_view(dist_a, at_offset);
+
+    // W = V . T
+    auto& w = panels_w.nextResource();
+    w.setRangeStart(ij_offset);
+    w.setWidth(nrefls_tile);
+
+    trmmComputeW<B>(w, v, t.read(t_idx));
+
+    // W2 = W* . At
+    auto& w2 = panels_w2.nextResource();
+    w2.setRangeStart(at_offset);
+    w2.setHeight(nrefls_tile);
+
+    matrix::util::set0<B>(hp, w2);
+    for (const auto& ij : trailing_matrix_view.iteratorLocal()) {
+      gemmUpdateW2<B>(np, w.read(ij), splitTile(mat_a.read(ij), trailing_matrix_view(ij)),
+                      w2.readwrite(ij));
+    }
+
+    // TRAILING MATRIX UPDATE
+
+    // At -= V . W2
+    for (const auto& ij : trailing_matrix_view.iteratorLocal()) {
+      gemmTrailingMatrix<B>(np, v.read(ij), w2.read(ij),
+                            splitTile(mat_a.readwrite(ij), trailing_matrix_view(ij)));
+    }
+
+    w2.reset();
+    w.reset();
+    v.reset();
+  }
+}
+
+template <Backend B, Device D, class T>
+void QR<B, D, T>::call(comm::CommunicatorGrid& grid, Matrix<T, D>& mat_a, Matrix<T, D>& mat_taus) {
+  using dlaf::matrix::Panel;
+  using eigensolver::internal::bt_red_band::gemmTrailingMatrix;
+  using eigensolver::internal::bt_red_band::gemmUpdateW2;
+  using eigensolver::internal::red2band::ComputePanelHelper;
+  using eigensolver::internal::red2band::local::setupReflectorPanelV;
+  using eigensolver::internal::red2band::local::trmmComputeW;
+
+  namespace ex = pika::execution::experimental;
+
+  const auto hp = pika::execution::thread_priority::high;
+  const auto np = pika::execution::thread_priority::normal;
+
+  // Note:
+  // As for the reduction to band, the panel and the T factor computations communicate over two
+  // separate column communicators, which have to be independent to avoid deadlocks.
+  DLAF_ASSERT(grid.num_pipelines() >= 2, grid.num_pipelines());
+  auto mpi_row_chain = grid.row_communicator_pipeline();
+  auto mpi_col_chain = grid.col_communicator_pipeline();
+  auto mpi_col_chain_panel = grid.col_communicator_pipeline();
+
+  const auto& dist_a = mat_a.distribution();
+  const comm::Index2D rank = dist_a.rank_index();
+  const SizeType nb = dist_a.block_size().cols();
+
+  DLAF_ASSERT(mat_taus.distribution() == qrTausDistribution(dist_a), mat_taus, mat_a);
+
+  const SizeType nr_panels = mat_taus.nrTiles().rows();
+  if (nr_panels == 0)
+    return;
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_v(n_workspaces, dist_a);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_w(n_workspaces, dist_a);
+  common::RoundRobin<Panel<Coord::Row, T, D>> panels_w2(n_workspaces, dist_a);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_ws(
+      n_workspaces, qr::tfactorWorkspaceDistribution(get_tfactor_num_workers<B>(), nb));
+
+  ComputePanelHelper<B, D, T> compute_panel_helper(n_workspaces, dist_a, mat_taus.distribution());
+
+  for (SizeType k = 0; k < nr_panels; ++k) {
+    const GlobalElementIndex ij_offset(k * nb, k * nb);
+    const SizeType panel_width = std::min(nb, dist_a.size().cols() - ij_offset.col());
+    const SizeType nrefls_tile = mat_taus.tileSize(GlobalTileIndex(k, 0)).rows();
+
+    const comm::Index2D rank_v0{
+        dist_a.template rank_global_tile<Coord::Row>(k),
+        dist_a.template rank_global_tile<Coord::Col>(k),
+    };
+    const bool is_panel_rank_col = rank_v0.col() == rank.col();
+
+    const matrix::SubPanelView panel_view(dist_a, ij_offset, panel_width);
+
+    auto& ws = panels_ws.nextResource();
+    auto& v = panels_v.nextResource();
+    v.setRangeStart(ij_offset);
+    ws.setWidth(nrefls_tile);
+    v.setWidth(nrefls_tile);
+
+    const LocalTileIndex t_idx(0, 0);
+    Matrix<T, D> t(LocalElementSize(nrefls_tile, nrefls_tile), TileElementSize(nb, nb));
+
+    // PANEL
+    if (is_panel_rank_col) {
+      compute_panel_helper.call(ex::just(), rank_v0.row(), mpi_col_chain_panel.exclusive(), mat_a,
+                                mat_taus, k, panel_view);
+
+      setupReflectorPanelV<B, D, T>(rank.row() == rank_v0.row(), panel_view, nrefls_tile, v, mat_a);
+
+      computeTFactor<B>(v, mat_taus.read(GlobalTileIndex(k, 0)), t.readwrite(t_idx), ws,
+                        mpi_col_chain);
+      ws.reset();
+    }
+
+    // PREPARATION FOR TRAILING MATRIX UPDATE
+    const GlobalElementIndex at_offset(ij_offset.row(), ij_offset.col() + panel_width);
+
+    // Note: if there is no trailing matrix, algorithm has finished
+    if (!at_offset.isIn(mat_a.size()))
+      break;
+
+    const matrix::SubMatrixView trailing_matrix_view(dist_a, at_offset);
+
+    // W = V . T
+    auto& w = panels_w.nextResource();
+    w.setRangeStart(ij_offset);
+    w.setWidth(nrefls_tile);
+
+    if (is_panel_rank_col)
+      trmmComputeW<B>(w, v, t.read(t_idx));
+
+    comm::broadcast(rank_v0.col(), w, mpi_row_chain);
+
+    // W2 = W* . At
+    auto& w2 = panels_w2.nextResource();
+    w2.setRangeStart(at_offset);
+    w2.setHeight(nrefls_tile);
+
+    matrix::util::set0<B>(hp, w2);
+    for (const auto& ij : trailing_matrix_view.iteratorLocal()) {
+      gemmUpdateW2<B>(np, w.read(ij), splitTile(mat_a.read(ij), trailing_matrix_view(ij)),
+                      w2.readwrite(ij));
+    }
+
+    if (mpi_col_chain.size() > 1) {
+      for (const auto& kj_panel : w2.iteratorLocal()) {
+        ex::start_detached(comm::schedule_all_reduce_in_place(mpi_col_chain.exclusive(), MPI_SUM,
+                                                              w2.readwrite(kj_panel)));
+      }
+    }
+
+    comm::broadcast(rank_v0.col(), v, mpi_row_chain);
+
+    // TRAILING MATRIX UPDATE
+
+    // At -= V . W2
+    for (const auto& ij : trailing_matrix_view.iteratorLocal()) {
+      gemmTrailingMatrix<B>(np, v.read(ij), w2.read(ij),
+                            splitTile(mat_a.readwrite(ij), trailing_matrix_view(ij)));
+    }
+
+    w2.reset();
+    w.reset();
+    v.reset();
+  }
+}
+
+template <Backend B, Device D, class T>
+void QR<B, D, T>::apply_q(const blas::Op op, Matrix<const T, D>& mat_v,
+                          Matrix<const T, D>& mat_taus, Matrix<T, D>& mat_c) {
+  using dlaf::matrix::Panel;
+  using eigensolver::internal::bt_red_band::gemmTrailingMatrix;
+  using eigensolver::internal::bt_red_band::gemmUpdateW2;
+
+  const auto hp = pika::execution::thread_priority::high;
+  const auto np = pika::execution::thread_priority::normal;
+
+  const auto& dist_v = mat_v.distribution();
+  const auto& dist_c = mat_c.distribution();
+  const SizeType nb = dist_v.block_size().cols();
+
+  DLAF_ASSERT(mat_taus.distribution() == qrTausDistribution(dist_v), mat_taus, mat_v);
+
+  const SizeType nr_panels = mat_taus.nrTiles().rows();
+  if (nr_panels == 0 || mat_c.size().isEmpty())
+    return;
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_v(n_workspaces, dist_v);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_w(n_workspaces, dist_v);
+  common::RoundRobin<Panel<Coord::Row, T, D>> panels_w2(n_workspaces, dist_c);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_ws(
+      n_workspaces, qr::tfactorWorkspaceDistribution(get_tfactor_num_workers<B>(), nb));
+
+  // Note:
+  // Q = H_0 H_1 ... H_(nr_panels - 1), hence Q C applies the blocks of reflectors starting from the last
+  // one, while Q^H C starts from the first one.
+  for (SizeType step = 0; step < nr_panels; ++step) {
+    const SizeType k = (op == blas::Op::NoTrans) ? nr_panels - 1 - step : step;
+    const SizeType nrefls_tile = mat_taus.tileSize(GlobalTileIndex(k, 0)).rows();
+
+    const GlobalElementIndex v_offset(k * nb, k * nb);
+    const GlobalElementIndex c_offset(k * nb, 0);
+
+    const matrix::SubPanelView panel_view(dist_v, v_offset, nrefls_tile);
+    const matrix::SubMatrixView mat_c_view(dist_c, c_offset);
+
+    auto& ws = panels_ws.nextResource();
+    auto& v = panels_v.nextResource();
+    auto& w = panels_w.nextResource();
+    auto& w2 = panels_w2.nextResource();
+
+    v.setRangeStart(v_offset);
+    w.setRangeStart(v_offset);
+
+    ws.setWidth(nrefls_tile);
+    v.setWidth(nrefls_tile);
+    w.setWidth(nrefls_tile);
+    w2.setHeight(nrefls_tile);
+
+    qr::setupReflectorPanelV<B>(panel_view, k, v, mat_v);
+
+    const LocalTileIndex t_idx(0, 0);
+    Matrix<T, D> t(LocalElementSize(nrefls_tile, nrefls_tile), TileElementSize(nb, nb));
+    computeTFactor<B>(v, mat_taus.read(GlobalTileIndex(k, 0)), t.readwrite(t_idx), ws);
+
+    qr::computeW<B>(op, w, v, t.read(t_idx));
+
+    // W2 = W* . C
+    matrix::util::set0<B>(hp, w2);
+    for (const auto& ij : mat_c_view.iteratorLocal()) {
+      gemmUpdateW2<B>(np, w.read(ij), splitTile(mat_c.read(ij), mat_c_view(ij)), w2.readwrite(ij));
+    }
+
+    // C -= V . W2
+    for (const auto& ij : mat_c_view.iteratorLocal()) {
+      gemmTrailingMatrix<B>(np, v.read(ij), w2.read(ij),
+                            splitTile(mat_c.readwrite(ij), mat_c_view(ij)));
+    }
+
+    v.reset();
+    w.reset();
+    w2.reset();
+    ws.reset();
+  }
+}
+
+template <Backend B, Device D, class T>
+void QR<B, D, T>::apply_q(comm::CommunicatorGrid& grid, const blas::Op op,
+                          Matrix<const T, D>& mat_v, Matrix<const T, D>& mat_taus,
+                          Matrix<T, D>& mat_c) {
+  using dlaf::matrix::Panel;
+  using eigensolver::internal::bt_red_band::gemmTrailingMatrix;
+  using eigensolver::internal::bt_red_band::gemmUpdateW2;
+
+  namespace ex = pika::execution::experimental;
+
+  const auto hp = pika::execution::thread_priority::high;
+  const auto np = pika::execution::thread_priority::normal;
+
+  auto mpi_row_chain = grid.row_communicator_pipeline();
+  auto mpi_col_chain = grid.col_communicator_pipeline();
+
+  const auto& dist_v = mat_v.distribution();
+  const auto& dist_c = mat_c.distribution();
+  const comm::Index2D rank = dist_v.rank_index();
+  const SizeType nb = dist_v.block_size().cols();
+
+  DLAF_ASSERT(mat_taus.distribution() == qrTausDistribution(dist_v), mat_taus, mat_v);
+
+  const SizeType nr_panels = mat_taus.nrTiles().rows();
+  if (nr_panels == 0 || mat_c.size().isEmpty())
+    return;
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_v(n_workspaces, dist_v);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_w(n_workspaces, dist_v);
+  common::RoundRobin<Panel<Coord::Row, T, D>> panels_w2(n_workspaces, dist_c);
+  common::RoundRobin<Panel<Coord::Col, T, D>> panels_ws(
+      n_workspaces, qr::tfactorWorkspaceDistribution(get_tfactor_num_workers<B>(), nb));
+
+  // Note:
+  // Q = H_0 H_1 ... H_(nr_panels - 1), hence Q C applies the blocks of reflectors starting from the last
+  // one, while Q^H C starts from the first one.
+  for (SizeType step = 0; step < nr_panels; ++step) {
+    const SizeType k = (op == blas::Op::NoTrans) ? nr_panels - 1 - step : step;
+    const SizeType nrefls_tile = mat_taus.tileSize(GlobalTileIndex(k, 0)).rows();
+
+    const GlobalElementIndex v_offset(k * nb, k * nb);
+    const GlobalElementIndex c_offset(k * nb, 0);
+
+    const matrix::SubPanelView panel_view(dist_v, v_offset, nrefls_tile);
+    const matrix::SubMatrixView mat_c_view(dist_c, c_offset);
+
+    auto& ws = panels_ws.nextResource();
+    auto& v = panels_v.nextResource();
+    auto& w = panels_w.nextResource();
+    auto& w2 = panels_w2.nextResource();
+
+    v.setRangeStart(v_offset);
+    w.setRangeStart(v_offset);
+
+    ws.setWidth(nrefls_tile);
+    v.setWidth(nrefls_tile);
+    w.setWidth(nrefls_tile);
+    w2.setHeight(nrefls_tile);
+
+    const comm::IndexT_MPI k_rank_col = dist_v.template rank_global_tile<Coord::Col>(k);
+
+    if (rank.col() == k_rank_col) {
+      qr::setupReflectorPanelV<B>(panel_view, k, v, mat_v);
+
+      const LocalTileIndex t_idx(0, 0);
+      Matrix<T, D> t(LocalElementSize(nrefls_tile, nrefls_tile), TileElementSize(nb, nb));
+      computeTFactor<B>(v, mat_taus.read(GlobalTileIndex(k, 0)), t.readwrite(t_idx), ws,
+                        mpi_col_chain);
+
+      qr::computeW<B>(op, w, v, t.read(t_idx));
+    }
+
+    matrix::util::set0<B>(hp, w2);
+
+    comm::broadcast(k_rank_col, w, mpi_row_chain);
+
+    // W2 = W* . C
+    for (const auto& ij : mat_c_view.iteratorLocal()) {
+      gemmUpdateW2<B>(np, w.read(ij), splitTile(mat_c.read(ij), mat_c_view(ij)), w2.readwrite(ij));
+    }
+
+    if (mpi_col_chain.size() > 1) {
+      for (const auto& kj_panel : w2.iteratorLocal()) {
+        ex::start_detached(comm::schedule_all_reduce_in_place(mpi_col_chain.exclusive(), MPI_SUM,
+                                                              w2.readwrite(kj_panel)));
+      }
+    }
+
+    comm::broadcast(k_rank_col, v, mpi_row_chain);
+
+    // C -= V . W2
+    for (const auto& ij : mat_c_view.iteratorLocal()) {
+      gemmTrailingMatrix<B>(np, v.read(ij), w2.read(ij),
+                            splitTile(mat_c.readwrite(ij), mat_c_view(ij)));
+    }
+
+    v.reset();
+    w.reset();
+    w2.reset();
+    ws.reset();
+  }
+}
+
+template <Backend B, Device D, class T>
+void QR<B, D, T>::form_q(Matrix<const T, D>& mat_v, Matrix<const T, D>& mat_taus,
+                         Matrix<T, D>& mat_q) {
+  qr::setIdentity<B>(mat_q);
+  apply_q(blas::Op::NoTrans, mat_v, mat_taus, mat_q);
+}
+
+template <Backend B, Device D, class T>
+void QR<B, D, T>::form_q(comm::CommunicatorGrid& grid, Matrix<const T, D>& mat_v,
+                         Matrix<const T, D>& mat_taus, Matrix<T, D>& mat_q) {
+  qr::setIdentity<B>(mat_q);
+  apply_q(grid, blas::Op::NoTrans, mat_v, mat_taus, mat_q);
+}
+}
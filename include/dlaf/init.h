@@ -52,6 +52,25 @@ struct configuration {
   double umpire_device_memory_pool_coalescing_reallocation_ratio = 1.0;
   std::size_t num_gpu_blas_handles = 16;
   std::size_t num_gpu_lapack_handles = 16;
+  // If true, the C API keeps the pika runtime running between calls instead of resuming and
+  // suspending it in each call (see dlaf_initialize).
+  bool c_api_persistent_runtime = false;
+  // Name of the pika thread pool where the asynchronous HDF5 I/O runs (the default pool is used, with a
+  // warning, if it does not exist). A dedicated pool has to be created by the application with the pika
+  // resource partitioner (see matrix::internal::getIOScheduler), so that the blocking I/O calls do not
+  // occupy the worker threads of the default pool.
+  std::string hdf5_io_pool = "io";
+  // If not empty, the tasks run by DLA-Future (kernels and MPI operations) are recorded and, at
+  // finalization, each rank writes its timeline in "<trace_file>.<rank>.json" in the Chrome trace
+  // event format (see common/trace.h). Ignored if DLA-Future is not built with DLAF_WITH_TRACE.
+  // Note: the tile index of the events is recorded only for the Cholesky factorization.
+  std::string trace_file = "";
+  // Maximum number of events recorded by each thread when tracing is enabled (further events are
+  // dropped and their number is reported in the trace).
+  std::size_t trace_max_events_per_thread = 1 << 20;
+  // If true, the FLOPs of the tile kernels, the bytes communicated and the bytes allocated are
+  // counted and can be queried with getMetrics (see metrics.h).
+  bool metrics = false;
 };
 
 std::ostream& operator<<(std::ostream& os, const configuration& cfg);
@@ -0,0 +1,45 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#ifdef DLAF_WITH_GPU
+
+#include <complex>
+
+#include <blas.hh>
+#include <whip.hpp>
+
+#include <dlaf/gpu/blas/api.h>
+#include <dlaf/types.h>
+
+namespace dlaf::gpulapack {
+
+/// Copies the conjugate transpose of the (m x n) matrix @p a into the (n x m) matrix @p b.
+///
+/// Only the elements of @p b in the triangle specified by @p uplo (diagonal included) are set.
+/// If @p uplo != General, @p a and @p b may refer to the same square matrix (i.e. the @p uplo triangle
+/// is set from the conjugate transpose of the opposite triangle).
+template <class T>
+void lacpy_conj_trans(const blas::Uplo uplo, const SizeType m, const SizeType n, const T* a,
+                      const SizeType lda, T* b, const SizeType ldb, const whip::stream_t stream);
+
+#define DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(kword, Type)                                          \
+  kword template void lacpy_conj_trans(const blas::Uplo uplo, const SizeType m, const SizeType n, \
+                                       const Type* a, const SizeType lda, Type* b,              \
+                                       const SizeType ldb, const whip::stream_t stream)
+
+DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(extern, float);
+DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(extern, double);
+DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(extern, std::complex<float>);
+DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(extern, std::complex<double>);
+}
+
+#endif
@@ -29,6 +29,7 @@
 #include <dlaf/lapack/enum_output.h>
 #include <dlaf/matrix/index.h>
 #include <dlaf/matrix/tile.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/make_sender_algorithm_overloads.h>
 #include <dlaf/sender/policy.h>
 #include <dlaf/sender/transform.h>
@@ -45,6 +46,7 @@
 #include <dlaf/gpu/lapack/assert_info.h>
 #include <dlaf/gpu/lapack/error.h>
 #include <dlaf/lapack/gpu/lacpy.h>
+#include <dlaf/lapack/gpu/lacpy_conj_trans.h>
 #include <dlaf/lapack/gpu/laset.h>
 #include <dlaf/util_cublas.h>
 #endif
@@ -150,6 +152,42 @@ dlaf::BaseType<T> lantr(const dlaf::internal::Policy<B>& p, Sender&& s);
 template <Backend B>
 dlaf::BaseType<T> lantr(const dlaf::internal::Policy<B>& p);
 
+/// Copies the conjugate transpose of Tile @param a into Tile @param b, setting only the elements of
+/// @param b in the triangle specified by @param uplo (diagonal included).
+///
+/// @pre a.size() == transposed(b.size()),
+/// @pre square_size(a) if uplo != blas::Uplo::General.
+///
+/// This overload blocks until completion of the algorithm.
+template <Backend B, class T, Device D>
+void lacpy_conj_trans(const dlaf::internal::Policy<B>& p, const blas::Uplo uplo,
+                      const Tile<const T, D>& a, const Tile<T, D>& b);
+
+/// \overload lacpy_conj_trans
+///
+/// In-place variant: it sets the @param uplo triangle (diagonal included) of the square Tile
+/// @param a with the conjugate transpose of the opposite triangle, i.e. it makes @param a Hermitian.
+///
+/// @pre square_size(a),
+/// @pre uplo != blas::Uplo::General.
+template <Backend B, class T, Device D>
+void lacpy_conj_trans(const dlaf::internal::Policy<B>& p, const blas::Uplo uplo, const Tile<T, D>& a);
+
+/// \overload lacpy_conj_trans
+///
+/// This overload takes a policy argument and a sender which must send all required arguments for the
+/// algorithm. Returns a sender which signals a connected receiver when the algorithm is done.
+template <Backend B, typename Sender,
+          typename = std::enable_if_t<pika::execution::experimental::is_sender_v<Sender>>>
+void lacpy_conj_trans(const dlaf::internal::Policy<B>& p, Sender&& s);
+
+/// \overload lacpy_conj_trans
+///
+/// This overload partially applies the algorithm with a policy for later use with operator| with a
+/// sender on the left-hand side.
+template <Backend B>
+void lacpy_conj_trans(const dlaf::internal::Policy<B>& p);
+
 /// Set off-diagonal (@param alpha) and diagonal (@param beta) elements of Tile @param tile.
 ///
 /// This overload blocks until completion of the algorithm.
@@ -383,6 +421,32 @@ auto trtri(const dlaf::internal::Policy<B>& p);
 
 namespace internal {
 
+// Number of floating point operations of the LAPACK kernels for matrices of order n (see LAWN 41).
+// Note: potrf and lauum have the same number of operations.
+template <class T>
+double potrfFlops(const SizeType n) {
+  const double n_ = static_cast<double>(n);
+  return total_ops<T>(n_ * n_ * n_ / 6 - n_ / 6, n_ * n_ * n_ / 6 + n_ * n_ / 2 + n_ / 3);
+}
+
+template <class T>
+double trtriFlops(const SizeType n) {
+  const double n_ = static_cast<double>(n);
+  return total_ops<T>(n_ * n_ * n_ / 6 - n_ * n_ / 2 + n_ / 3,
+                      n_ * n_ * n_ / 6 + n_ * n_ / 2 + n_ / 3);
+}
+
+// Note: LAWN 41 does not list hegst, its operations are counted (with the same conventions, e.g.
+// divisions count as multiplications) from the unblocked reference algorithm (xHEGS2).
+template <class T>
+double hegstFlops(const SizeType n) {
+  if (n == 0)
+    return 0;
+  const double n_ = static_cast<double>(n);
+  return total_ops<T>(n_ * n_ * n_ / 2 + n_ * n_ / 2 - n_,
+                      n_ * n_ * n_ / 2 + 5 * n_ * n_ / 2 + n_ - 2);
+}
+
 template <class T>
 dlaf::BaseType<T> lange(const lapack::Norm norm, const Tile<T, Device::CPU>& a) noexcept {
   common::internal::SingleThreadedBlasScope single;
@@ -407,6 +471,33 @@ dlaf::BaseType<T> lantr(const lapack::Norm norm, const blas::Uplo uplo, const bl
   return lapack::lantr(norm, uplo, diag, a.size().rows(), a.size().cols(), a.ptr(), a.ld());
 }
 
+template <class T>
+void lacpy_conj_trans(const blas::Uplo uplo, const Tile<const T, Device::CPU>& a,
+                      const Tile<T, Device::CPU>& b) {
+  DLAF_ASSERT(a.size() == transposed(b.size()), a, b);
+  DLAF_ASSERT(uplo == blas::Uplo::General || square_size(a), uplo, a);
+
+  for (SizeType j = 0; j < b.size().cols(); ++j) {
+    const SizeType i_begin = (uplo == blas::Uplo::Lower) ? j : 0;
+    const SizeType i_end = (uplo == blas::Uplo::Upper) ? j + 1 : b.size().rows();
+    for (SizeType i = i_begin; i < i_end; ++i)
+      b(TileElementIndex(i, j)) = dlaf::conj(a(TileElementIndex(j, i)));
+  }
+}
+
+template <class T>
+void lacpy_conj_trans(const blas::Uplo uplo, const Tile<T, Device::CPU>& a) {
+  DLAF_ASSERT(square_size(a), a);
+  DLAF_ASSERT(uplo != blas::Uplo::General, uplo);
+
+  for (SizeType j = 0; j < a.size().cols(); ++j) {
+    const SizeType i_begin = (uplo == blas::Uplo::Lower) ? j : 0;
+    const SizeType i_end = (uplo == blas::Uplo::Upper) ? j + 1 : a.size().rows();
+    for (SizeType i = i_begin; i < i_end; ++i)
+      a(TileElementIndex(i, j)) = dlaf::conj(a(TileElementIndex(j, i)));
+  }
+}
+
 template <class T>
 void laset(const blas::Uplo uplo, T alpha, T beta, const Tile<T, Device::CPU>& tile) {
   const SizeType m = tile.size().rows();
@@ -419,6 +510,7 @@ void laset(const blas::Uplo uplo, T alpha, T beta, const Tile<T, Device::CPU>& t
 template <class T>
 void lauum(const blas::Uplo uplo, const Tile<T, Device::CPU>& a) {
   DLAF_ASSERT(square_size(a), a);
+  dlaf::internal::addFlops(potrfFlops<T>(a.size().rows()));
 
   common::internal::SingleThreadedBlasScope single;
   auto info = lapack::lauum(uplo, a.size().rows(), a.ptr(), a.ld());
@@ -437,6 +529,7 @@ void hegst(const int itype, const blas::Uplo uplo, const Tile<T, Device::CPU>& a
   DLAF_ASSERT(square_size(b), b);
   DLAF_ASSERT(a.size() == b.size(), a, b);
   DLAF_ASSERT(itype >= 1 && itype <= 3, itype);
+  dlaf::internal::addFlops(hegstFlops<T>(a.size().cols()));
 
   common::internal::SingleThreadedBlasScope single;
   [[maybe_unused]] auto info =
@@ -448,6 +541,7 @@ void hegst(const int itype, const blas::Uplo uplo, const Tile<T, Device::CPU>& a
 template <class T>
 long long potrfInfo(const blas::Uplo uplo, const Tile<T, Device::CPU>& a) {
   DLAF_ASSERT(square_size(a), a);
+  dlaf::internal::addFlops(potrfFlops<T>(a.size().rows()));
 
   common::internal::SingleThreadedBlasScope single;
   auto info = lapack::potrf(uplo, a.size().rows(), a.ptr(), a.ld());
@@ -489,6 +583,7 @@ void scaleCol(T alpha, SizeType col, const Tile<T, Device::CPU>& tile) {
 template <class T>
 long long trtri_info(const blas::Uplo uplo, const blas::Diag diag, const Tile<T, Device::CPU>& a) {
   DLAF_ASSERT(square_size(a), a);
+  dlaf::internal::addFlops(trtriFlops<T>(a.size().rows()));
 
   common::internal::SingleThreadedBlasScope single;
   auto info = lapack::trtri(uplo, diag, a.size().rows(), a.ptr(), a.ld());
@@ -641,6 +736,25 @@ dlaf::BaseType<T> lantr(cusolverDnHandle_t handle, const lapack::Norm norm, cons
   dlaf::internal::silenceUnusedWarningFor(handle, norm, uplo, diag, a);
 }
 
+template <class T>
+void lacpy_conj_trans(const blas::Uplo uplo, const Tile<const T, Device::GPU>& a,
+                      const Tile<T, Device::GPU>& b, whip::stream_t stream) {
+  DLAF_ASSERT(a.size() == transposed(b.size()), a, b);
+  DLAF_ASSERT(uplo == blas::Uplo::General || square_size(a), uplo, a);
+
+  gpulapack::lacpy_conj_trans(uplo, a.size().rows(), a.size().cols(), a.ptr(), a.ld(), b.ptr(), b.ld(),
+                              stream);
+}
+
+template <class T>
+void lacpy_conj_trans(const blas::Uplo uplo, const Tile<T, Device::GPU>& a, whip::stream_t stream) {
+  DLAF_ASSERT(square_size(a), a);
+  DLAF_ASSERT(uplo != blas::Uplo::General, uplo);
+
+  gpulapack::lacpy_conj_trans(uplo, a.size().rows(), a.size().cols(), a.ptr(), a.ld(), a.ptr(), a.ld(),
+                              stream);
+}
+
 template <class T>
 void laset(const blas::Uplo uplo, T alpha, T beta, const Tile<T, Device::GPU>& tile,
            whip::stream_t stream) {
@@ -663,6 +777,7 @@ void hegst(cusolverDnHandle_t handle, const int itype, const blas::Uplo uplo,
   DLAF_ASSERT(square_size(b), b);
   DLAF_ASSERT(a.size() == b.size(), a, b);
   const auto n = a.size().rows();
+  dlaf::internal::addFlops(hegstFlops<T>(n));
 
 #ifdef DLAF_WITH_CUDA
   int workspace_size;
@@ -698,6 +813,7 @@ internal::CusolverInfo<T> potrfInfo(cusolverDnHandle_t handle, const blas::Uplo
                                     const matrix::Tile<T, Device::GPU>& a) {
   DLAF_ASSERT(square_size(a), a);
   const auto n = a.size().rows();
+  dlaf::internal::addFlops(potrfFlops<T>(n));
 
 #ifdef DLAF_WITH_CUDA
   int workspace_size;
@@ -736,6 +852,7 @@ internal::CusolverInfo<T> trtri_info(cusolverDnHandle_t handle, const blas::Uplo
   dlaf::internal::silenceUnusedWarningFor(handle, uplo, diag, a, n);
 
 #elif defined(DLAF_WITH_HIP)
+  dlaf::internal::addFlops(trtriFlops<T>(n));
   internal::CusolverTrtri<T>::call(handle, util::blasToRocblas(uplo), util::blasToRocblas(diag),
                                    to_int(n), util::blasToRocblasCast(a.ptr()), to_int(a.ld()),
                                    info.info());
@@ -754,6 +871,7 @@ void trtri(cusolverDnHandle_t handle, const blas::Uplo uplo, const blas::Diag di
 
 DLAF_MAKE_CALLABLE_OBJECT(lange);
 DLAF_MAKE_CALLABLE_OBJECT(lantr);
+DLAF_MAKE_CALLABLE_OBJECT(lacpy_conj_trans);
 DLAF_MAKE_CALLABLE_OBJECT(laset);
 DLAF_MAKE_CALLABLE_OBJECT(set0);
 DLAF_MAKE_CALLABLE_OBJECT(hegst);
@@ -770,6 +888,8 @@ DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::La
                                      internal::lange_o)
 DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Lapack, lantr,
                                      internal::lantr_o)
+DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Plain, lacpy_conj_trans,
+                                     internal::lacpy_conj_trans_o)
 DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Plain, laset,
                                      internal::laset_o)
 DLAF_MAKE_SENDER_ALGORITHM_OVERLOADS(::dlaf::internal::TransformDispatchType::Plain, set0,
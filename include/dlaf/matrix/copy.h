@@ -136,6 +136,8 @@ void copy(MatrixRef<const T, Source>& src, Matrix<T, Destination>& dst) {
 ///      dst.blockSize().cols() % nb == 0
 /// @pre src has equal tile and block sizes.
 /// @pre dst has equal tile and block sizes.
+///
+/// Note: see redistribute() in dlaf/matrix/redistribution.h for arbitrary block sizes and process grids.
 template <class T, Device Source, Device Destination>
 void copy(Matrix<const T, Source>& src, Matrix<T, Destination>& dst, comm::CommunicatorGrid& grid) {
   namespace ex = pika::execution::experimental;
@@ -12,22 +12,33 @@
 
 #ifdef DLAF_WITH_HDF5
 
+#include <algorithm>
 #include <complex>
 #include <cstddef>
 #include <cstdint>
+#include <iostream>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <typeinfo>
 #include <utility>
+#include <variant>
+#include <vector>
 
 #include <H5Cpp.h>
 #include <mpi.h>
 
+#include <pika/execution.hpp>
+#include <pika/runtime.hpp>
+
 #include "dlaf/common/assert.h"
+#include "dlaf/common/pipeline.h"
 #include "dlaf/common/range2d.h"
 #include "dlaf/communication/communicator.h"
 #include "dlaf/communication/communicator_grid.h"
 #include "dlaf/communication/index.h"
+#include "dlaf/init.h"
 #include "dlaf/matrix/index.h"
 #include "dlaf/matrix/matrix.h"
 #include "dlaf/matrix/matrix_mirror.h"
@@ -157,14 +168,92 @@ void to_dataset(dlaf::Matrix<const T, Device::CPU>& matrix, const H5::DataSet& d
                                      std::move(dataset_write));
 }
 
+// Returns a scheduler for the pika thread pool configuration::hdf5_io_pool.
+//
+// The pool has to be created by the application with the pika resource partitioner before starting
+// the runtime (DLA-Future cannot create it, since it is initialized after pika), e.g. with
+//    p.rp_callback = [](auto& rp, auto&) {
+//      rp.create_thread_pool("io");
+//      rp.add_resource(rp.numa_domains()[0].cores()[0].pus()[0], "io");
+//    };
+// If it does not exist, the I/O runs on the default pool (a warning is printed the first time), where
+// the blocking HDF5 calls occupy worker threads, reducing the overlap with the computation.
+inline auto getIOScheduler() {
+  namespace ex = pika::execution::experimental;
+
+  const std::string& pool_name = dlaf::internal::getConfiguration().hdf5_io_pool;
+  if (pika::resource::pool_exists(pool_name))
+    return ex::thread_pool_scheduler{&pika::resource::get_thread_pool(pool_name)};
+
+  [[maybe_unused]] static const bool warned = [&pool_name]() {
+    std::cerr << "[WARNING] The thread pool \"" << pool_name
+              << "\" for the HDF5 I/O does not exist, the default pool is used instead.\n";
+    return true;
+  }();
+  return ex::thread_pool_scheduler{&pika::resource::get_thread_pool("default")};
+}
+
+// Returns the pipeline serializing all the HDF5 calls of the process, on any file (the HDF5 library
+// is not guaranteed to be thread-safe). The asynchronous I/O accesses it when scheduled, while the
+// synchronous calls wait for their turn (see acquireIO), therefore all the HDF5 calls are executed in
+// the order they are issued.
+inline common::Pipeline<std::monostate>& getIOPipeline() {
+  static common::Pipeline<std::monostate> io(std::monostate{});
+  return io;
+}
+
+// Waits for the completion of all the HDF5 calls issued so far and returns the wrapper of the I/O
+// pipeline, which gives exclusive access to the HDF5 library until it is destroyed.
+inline auto acquireIO() {
+  return pika::this_thread::experimental::sync_wait(getIOPipeline().readwrite());
+}
+
+// Helper function that maps the local tile column @p j_lc of a matrix distributed as @p dist with
+// the dataset, selecting in @p ds_file the union of the hyperslabs of all its local tiles.
+// It returns the memory dataspace of a column major buffer, which stores the local tiles one below
+// the other (i.e. with leading dimension equal to the number of local rows of the matrix).
+template <class T>
+H5::DataSpace map_local_tile_column_with_dataset(const Distribution& dist, const SizeType j_lc,
+                                                 const H5::DataSpace& ds_file) {
+  const SizeType nrows = dist.local_size().rows();
+  const SizeType ncols = dist.tile_size_of(LocalTileIndex(0, j_lc)).cols();
+
+  for (SizeType i_lc = 0; i_lc < dist.local_nr_tiles().rows(); ++i_lc) {
+    const GlobalTileIndex ij = dist.global_tile_index(LocalTileIndex(i_lc, j_lc));
+    const GlobalElementIndex tl = dist.global_element_index(ij, {0, 0});
+    const TileElementSize tile_size = dist.tile_size_of(ij);
+
+    const hsize_t file_counts[3] = {
+        to_sizet(tile_size.cols()),
+        to_sizet(tile_size.rows()),
+        internal::hdf5_datatype<T>::dims,
+    };
+    const hsize_t file_offsets[3] = {
+        to_sizet(tl.col()),
+        to_sizet(tl.row()),
+        0,
+    };
+    ds_file.selectHyperslab(i_lc == 0 ? H5S_SELECT_SET : H5S_SELECT_OR, file_counts, file_offsets);
+  }
+
+  const hsize_t memory_dims[3] = {
+      to_sizet(ncols),
+      to_sizet(nrows),
+      internal::hdf5_datatype<T>::dims,
+  };
+  return H5::DataSpace(3, memory_dims);
+}
+
 class FileHDF5 final {
 public:
   /// File access modes:
   /// - readonly, the file will be opened (if should already exist)
   /// - readwrite, the file will be created (if should not exist)
+  /// - append, the file will be opened for reading and writing (it should already exist)
   enum class FileMode {
     readonly,
     readwrite,
+    append,
   };
 
   /// Create/open a local file.
@@ -174,7 +263,8 @@ public:
   ///
   /// @post if mode == READWRITE, being a local file it will not support parallel-write
   FileHDF5(const std::string& filepath, const FileMode& mode) {
-    file_ = H5::H5File(filepath, mode2flags(mode));
+    [[maybe_unused]] const auto io = internal::acquireIO();
+    file_ = openFile(filepath, mode2flags(mode));
   }
 
   /// Create a file that, besides read, supports writing in parallel from different ranks.
@@ -184,10 +274,23 @@ public:
   ///
   /// @pre @p filepath should not exist
   /// @post file created will support parallel-write
-  FileHDF5(comm::Communicator comm, const std::string& filepath) {
+  FileHDF5(comm::Communicator comm, const std::string& filepath)
+      : FileHDF5(std::move(comm), filepath, FileMode::readwrite) {}
+
+  /// Create/open a file that, besides read, supports writing in parallel from different ranks.
+  ///
+  /// @p comm Communicator grouping all ranks that will be able to write in parallel to the file
+  /// @p filepath filepath where the file to be opened is or where it will be created
+  /// @p mode file access mode (see FileMode for more details)
+  ///
+  /// @pre @p mode != FileMode::readonly
+  /// @post file opened/created will support parallel-write
+  FileHDF5(comm::Communicator comm, const std::string& filepath, const FileMode& mode) {
+    DLAF_ASSERT(mode != FileMode::readonly, "Parallel-write requires a writable file.");
+    [[maybe_unused]] const auto io = internal::acquireIO();
     H5::FileAccPropList fapl;
     DLAF_ASSERT(H5Pset_fapl_mpio(fapl.getId(), comm, MPI_INFO_NULL) >= 0, "Problem setting up MPI-IO.");
-    file_ = H5::H5File(filepath, mode2flags(FileMode::readwrite), {}, fapl);
+    file_ = openFile(filepath, mode2flags(mode), H5::FileCreatPropList::DEFAULT, fapl);
     has_mpio_ = true;
     rank_ = comm.rank();
   }
@@ -198,6 +301,7 @@ public:
   /// @pre if @p matrix is distributed, the file should support parallel-write
   template <class T, Device D>
   void write(matrix::Matrix<const T, D>& matrix, const std::string& dataset_name) const {
+    [[maybe_unused]] const auto io = internal::acquireIO();
     matrix::MatrixMirror<const T, Device::CPU, D> matrix_mirror(matrix);
 
     matrix::Matrix<const T, Device::CPU>& matrix_host = matrix_mirror.get();
@@ -217,7 +321,7 @@ public:
 
     // TODO it might be needed to wait all pika tasks
     H5::DataSet dataset =
-        file_.createDataSet(dataset_name, internal::hdf5_datatype<T>::type, dataspace_file);
+        file_->createDataSet(dataset_name, internal::hdf5_datatype<T>::type, dataspace_file);
 
     if (!is_local_matrix || rank_ == 0)
       internal::to_dataset<T>(matrix_host, dataset);
@@ -226,6 +330,7 @@ public:
   /// Read dataset @p dataset_name in a local matrix with given @p blocksize.
   template <class T, Device D = Device::CPU>
   Matrix<T, D> read(const std::string& dataset_name, const TileElementSize blocksize) const {
+    [[maybe_unused]] const auto io = internal::acquireIO();
     const H5::DataSet dataset = openDataSet<T>(dataset_name);
 
     const LocalElementSize size = FileHDF5::datasetToSize<LocalElementSize>(dataset);
@@ -240,6 +345,7 @@ public:
   template <class T, Device D = Device::CPU>
   Matrix<T, D> read(const std::string& dataset_name, const TileElementSize blocksize,
                     comm::CommunicatorGrid& grid, const dlaf::comm::Index2D src_rank_index) const {
+    [[maybe_unused]] const auto io = internal::acquireIO();
     const H5::DataSet dataset = openDataSet<T>(dataset_name);
 
     const GlobalElementSize size = FileHDF5::datasetToSize<GlobalElementSize>(dataset);
@@ -250,8 +356,197 @@ public:
     return returnMatrixOn<D>(std::move(mat));
   }
 
+  /// Read dataset @p dataset_name in the already allocated @p matrix (either local or distributed).
+  ///
+  /// @pre the dataset has the same size of @p matrix
+  template <class T, Device D>
+  void read(const std::string& dataset_name, Matrix<T, D>& matrix) const {
+    [[maybe_unused]] const auto io = internal::acquireIO();
+    const H5::DataSet dataset = openDataSet<T>(dataset_name);
+
+    const GlobalElementSize size = FileHDF5::datasetToSize<GlobalElementSize>(dataset);
+    DLAF_ASSERT(size == matrix.size(), size, matrix.size());
+
+    matrix::MatrixMirror<T, Device::CPU, D> matrix_mirror(matrix);
+    internal::from_dataset<T>(dataset, matrix_mirror.get());
+  }
+
+  /// Return true if the file contains a dataset (or any other object) named @p name.
+  bool exists(const std::string& name) const {
+    [[maybe_unused]] const auto io = internal::acquireIO();
+    return H5Lexists(file_->getId(), name.c_str(), H5P_DEFAULT) > 0;
+  }
+
+  /// Remove the dataset (or any other object) named @p name from the file.
+  ///
+  /// Note: the space in the file is not reclaimed.
+  /// @pre exists(@p name)
+  void remove(const std::string& name) const {
+    [[maybe_unused]] const auto io = internal::acquireIO();
+    file_->unlink(name);
+  }
+
+  /// Set the integer attribute @p name of the file to @p value (the attribute is created if needed).
+  ///
+  /// @pre if the file supports parallel-write, all the ranks set the same value
+  void writeAttribute(const std::string& name, const SizeType value) const {
+    [[maybe_unused]] const auto io = internal::acquireIO();
+    const std::int64_t value_file = value;
+    const H5::DataSpace dataspace(H5S_SCALAR);
+    H5::Attribute attribute = file_->attrExists(name)
+                                  ? file_->openAttribute(name)
+                                  : file_->createAttribute(name, H5::PredType::NATIVE_INT64, dataspace);
+    attribute.write(H5::PredType::NATIVE_INT64, &value_file);
+  }
+
+  /// Return the integer attribute @p name of the file, or std::nullopt if it is not set.
+  std::optional<SizeType> readAttribute(const std::string& name) const {
+    [[maybe_unused]] const auto io = internal::acquireIO();
+    if (!file_->attrExists(name))
+      return std::nullopt;
+
+    std::int64_t value_file;
+    file_->openAttribute(name).read(H5::PredType::NATIVE_INT64, &value_file);
+    return static_cast<SizeType>(value_file);
+  }
+
+  /// Write asynchronously @p matrix into dataset @p dataset_name.
+  ///
+  /// The local tiles are written a local tile column at a time: as soon as all the tiles of a column
+  /// are ready, they are packed in a buffer and written with a single HDF5 call.
+  /// The dataset creation and the writes are scheduled on the I/O thread pool (see
+  /// configuration::hdf5_io_pool) and they are started eagerly. All the HDF5 calls of the process (on
+  /// any file) are serialized in the order they are issued, and the synchronous methods wait for the
+  /// completion of the pending asynchronous ones.
+  ///
+  /// If the matrix is local, just one rank is going to write on the file.
+  /// @return a sender signalling the completion of the write.
+  /// @pre if @p matrix is distributed, the file should support parallel-write
+  template <class T>
+  [[nodiscard]] auto writeAsync(matrix::Matrix<const T, Device::CPU>& matrix,
+                                const std::string& dataset_name) const {
+    namespace ex = pika::execution::experimental;
+
+    const matrix::Distribution& dist = matrix.distribution();
+    const bool is_local_matrix = matrix::local_matrix(matrix);
+
+    DLAF_ASSERT(is_local_matrix || has_mpio_,
+                "You are trying to store a distributed matrix using a local only file", is_local_matrix,
+                has_mpio_);
+
+    std::vector<ex::unique_any_sender<>> ios;
+
+    ios.emplace_back(internal::getIOPipeline().readwrite() |
+                     ex::continues_on(internal::getIOScheduler()) |
+                     ex::then([file = file_, size = matrix.size(), dataset_name](auto) {
+                       const hsize_t dims_file[3] = {
+                           dlaf::to_sizet(size.cols()),
+                           dlaf::to_sizet(size.rows()),
+                           internal::hdf5_datatype<T>::dims,
+                       };
+                       H5::DataSpace dataspace_file(3, dims_file);
+
+                       file->createDataSet(dataset_name, internal::hdf5_datatype<T>::type,
+                                           dataspace_file);
+                     }) |
+                     ex::ensure_started());
+
+    // Note: a rank may own local tile columns without owning any local tile.
+    if ((!is_local_matrix || rank_ == 0) && !dist.local_nr_tiles().isEmpty()) {
+      const SizeType nrows = dist.local_size().rows();
+      const LocalTileSize column_size(dist.local_nr_tiles().rows(), 1);
+
+      for (SizeType j_lc = 0; j_lc < dist.local_nr_tiles().cols(); ++j_lc) {
+        auto tiles = ex::when_all_vector(
+            matrix::selectRead(matrix, common::iterate_range2d(LocalTileIndex(0, j_lc), column_size)));
+
+        auto write_column = [file = file_, dist, j_lc, nrows, dataset_name](auto, auto tiles) {
+          const H5::DataSet dataset = openDataSet<T>(*file, dataset_name);
+          const H5::DataSpace& ds_file = dataset.getSpace();
+          const H5::DataSpace ds_memory =
+              internal::map_local_tile_column_with_dataset<T>(dist, j_lc, ds_file);
+
+          std::vector<T> buffer(to_sizet(nrows * dist.tile_size_of(LocalTileIndex(0, j_lc)).cols()));
+          SizeType i_offset = 0;
+          for (const auto& tile_wrapper : tiles) {
+            const auto& tile = tile_wrapper.get();
+            for (SizeType j = 0; j < tile.size().cols(); ++j)
+              std::copy_n(tile.ptr({0, j}), tile.size().rows(),
+                          buffer.data() + i_offset + j * nrows);
+            i_offset += tile.size().rows();
+          }
+
+          dataset.write(buffer.data(), internal::hdf5_datatype<T>::type, ds_memory, ds_file);
+        };
+
+        ios.emplace_back(ex::when_all(internal::getIOPipeline().readwrite(), std::move(tiles)) |
+                         ex::continues_on(internal::getIOScheduler()) |
+                         ex::then(std::move(write_column)) | ex::ensure_started());
+      }
+    }
+
+    return ex::when_all_vector(std::move(ios));
+  }
+
+  /// Read asynchronously dataset @p dataset_name in the already allocated @p matrix (either local or
+  /// distributed).
+  ///
+  /// The local tiles are read a local tile column at a time with a single HDF5 call, so that the tasks
+  /// using the tiles of a column can start as soon as it has been read, while the rest of the matrix
+  /// is still being read.
+  /// The reads are scheduled on the I/O thread pool and serialized with the other HDF5 calls as
+  /// described in writeAsync.
+  ///
+  /// @return a sender signalling the completion of the read.
+  /// @pre the dataset has the same size of @p matrix
+  template <class T>
+  [[nodiscard]] auto readAsync(const std::string& dataset_name,
+                               matrix::Matrix<T, Device::CPU>& matrix) const {
+    namespace ex = pika::execution::experimental;
+
+    const matrix::Distribution& dist = matrix.distribution();
+    const SizeType nrows = dist.local_size().rows();
+    const LocalTileSize column_size(dist.local_nr_tiles().rows(), 1);
+
+    std::vector<ex::unique_any_sender<>> ios;
+    if (dist.local_nr_tiles().isEmpty())
+      return ex::when_all_vector(std::move(ios));
+
+    for (SizeType j_lc = 0; j_lc < dist.local_nr_tiles().cols(); ++j_lc) {
+      auto tiles = ex::when_all_vector(
+          matrix::select(matrix, common::iterate_range2d(LocalTileIndex(0, j_lc), column_size)));
+
+      auto read_column = [file = file_, dist, j_lc, nrows, dataset_name](auto, auto tiles) {
+        const H5::DataSet dataset = openDataSet<T>(*file, dataset_name);
+        DLAF_ASSERT(FileHDF5::datasetToSize<GlobalElementSize>(dataset) == dist.size(),
+                    FileHDF5::datasetToSize<GlobalElementSize>(dataset), dist.size());
+
+        const H5::DataSpace& ds_file = dataset.getSpace();
+        const H5::DataSpace ds_memory =
+            internal::map_local_tile_column_with_dataset<T>(dist, j_lc, ds_file);
+
+        std::vector<T> buffer(to_sizet(nrows * dist.tile_size_of(LocalTileIndex(0, j_lc)).cols()));
+        dataset.read(buffer.data(), internal::hdf5_datatype<T>::type, ds_memory, ds_file);
+
+        SizeType i_offset = 0;
+        for (auto& tile : tiles) {
+          for (SizeType j = 0; j < tile.size().cols(); ++j)
+            std::copy_n(buffer.data() + i_offset + j * nrows, tile.size().rows(), tile.ptr({0, j}));
+          i_offset += tile.size().rows();
+        }
+      };
+
+      ios.emplace_back(ex::when_all(internal::getIOPipeline().readwrite(), std::move(tiles)) |
+                       ex::continues_on(internal::getIOScheduler()) | ex::then(std::move(read_column)) |
+                       ex::ensure_started());
+    }
+
+    return ex::when_all_vector(std::move(ios));
+  }
+
   void flush() const {
-    file_.flush(H5F_SCOPE_LOCAL);
+    [[maybe_unused]] const auto io = internal::acquireIO();
+    file_->flush(H5F_SCOPE_LOCAL);
   }
 
 private:
@@ -261,6 +556,8 @@ private:
         return H5F_ACC_RDONLY;
       case FileMode::readwrite:
         return H5F_ACC_RDWR | H5F_ACC_CREAT;
+      case FileMode::append:
+        return H5F_ACC_RDWR;
     }
     return DLAF_UNREACHABLE(unsigned int);
   }
@@ -278,7 +575,12 @@ private:
 
   template <class T>
   H5::DataSet openDataSet(const std::string& dataset_name) const {
-    const H5::DataSet dataset = file_.openDataSet(dataset_name);
+    return openDataSet<T>(*file_, dataset_name);
+  }
+
+  template <class T>
+  static H5::DataSet openDataSet(const H5::H5File& file, const std::string& dataset_name) {
+    const H5::DataSet dataset = file.openDataSet(dataset_name);
 
     const auto hdf5_t = internal::hdf5_datatype<BaseType<T>>::type;
     DLAF_ASSERT(hdf5_t == dataset.getDataType(), "HDF5 type mismatch");
@@ -299,7 +601,23 @@ private:
     return target;
   }
 
-  H5::H5File file_;
+  // Opens the file (the caller has to hold the access to the I/O pipeline).
+  //
+  // The returned file is shared by the copies of FileHDF5 and by the pending asynchronous I/O. When the
+  // last reference is released, the file is closed asynchronously on the I/O pipeline, hence after all
+  // the HDF5 calls issued before.
+  template <class... Args>
+  static std::shared_ptr<const H5::H5File> openFile(Args&&... args) {
+    return std::shared_ptr<const H5::H5File>(
+        new const H5::H5File(std::forward<Args>(args)...), [](const H5::H5File* file) {
+          namespace ex = pika::execution::experimental;
+          ex::start_detached(internal::getIOPipeline().readwrite() |
+                             ex::continues_on(internal::getIOScheduler()) |
+                             ex::then([file](auto) { delete file; }));
+        });
+  }
+
+  std::shared_ptr<const H5::H5File> file_;
   bool has_mpio_ = false;
   comm::IndexT_MPI rank_ = 0;
 };
@@ -0,0 +1,408 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// @file
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+#include <pika/execution.hpp>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/common/data_descriptor.h>
+#include <dlaf/common/range2d.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/communicator_pipeline.h>
+#include <dlaf/communication/error.h>
+#include <dlaf/communication/index.h>
+#include <dlaf/communication/message.h>
+#include <dlaf/lapack/tile.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/metrics.h>
+#include <dlaf/sender/policy.h>
+#include <dlaf/sender/transform.h>
+#include <dlaf/sender/transform_mpi.h>
+#include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
+
+namespace dlaf::matrix {
+
+/// Communication pattern for redistributing a matrix between two arbitrary distributions.
+///
+/// The source and the destination distributions may have any block size, source rank index and
+/// process grid, as long as the two grids are built over the same set of ranks (e.g. a 1xP and a
+/// PrxPc grid of the same communicator).
+/// The pattern, i.e. which part of each tile is sent to which rank, is computed once at construction
+/// and can be reused for redistributing any matrix with the same pair of distributions.
+///
+/// The redistribution is pipelined in chunks, the k-th chunk containing the columns of the k-th
+/// tile column of the destination distribution: packing of a chunk overlaps with the communication
+/// of the previous one and with the unpacking of the one before that.
+///
+/// Note: the construction is collective over the ranks of the grids.
+class RedistributionPlan {
+public:
+  /// Range of consecutive rows (or columns) belonging to a single tile both in the source and in the
+  /// destination distribution.
+  struct Segment {
+    SizeType size;
+    /// rank index (along the corresponding coordinate) of the tile in the source grid
+    comm::IndexT_MPI src_rank;
+    /// global tile index in the source distribution and element index within the tile
+    SizeType src_tile;
+    SizeType src_tile_element;
+    /// rank index (along the corresponding coordinate) of the tile in the destination grid
+    comm::IndexT_MPI dst_rank;
+    /// global tile index in the destination distribution and element index within the tile
+    SizeType dst_tile;
+    SizeType dst_tile_element;
+  };
+
+  /// @param src_grid the grid @p src_dist is distributed on, its full communicator is used for the
+  ///        communications,
+  /// @param dst_grid the grid @p dst_dist is distributed on,
+  /// @pre src_dist.size() == dst_dist.size(),
+  /// @pre src_dist is distributed on src_grid and dst_dist is distributed on dst_grid,
+  /// @pre src_grid and dst_grid contain the same ranks.
+  RedistributionPlan(comm::CommunicatorGrid& src_grid, const Distribution& src_dist,
+                     comm::CommunicatorGrid& dst_grid, const Distribution& dst_dist);
+
+  const Distribution& src_distribution() const noexcept {
+    return src_dist_;
+  }
+
+  const Distribution& dst_distribution() const noexcept {
+    return dst_dist_;
+  }
+
+  const std::vector<Segment>& row_segments() const noexcept {
+    return row_segments_;
+  }
+
+  const std::vector<Segment>& col_segments() const noexcept {
+    return col_segments_;
+  }
+
+  /// Return the number of chunks the redistribution is split in.
+  SizeType nr_chunks() const noexcept {
+    return dst_dist_.nr_tiles().cols();
+  }
+
+  /// Return the range [begin, end) of the column segments belonging to the chunk @p k.
+  std::pair<std::size_t, std::size_t> chunk_col_segments(const SizeType k) const noexcept {
+    DLAF_ASSERT_HEAVY(k >= 0 && k < nr_chunks(), k, nr_chunks());
+    return {chunk_begin_[to_sizet(k)], chunk_begin_[to_sizet(k) + 1]};
+  }
+
+  /// Return the number of elements of chunk @p k that the current rank sends to each rank.
+  const std::vector<int>& send_counts(const SizeType k) const noexcept {
+    return send_counts_[to_sizet(k)];
+  }
+
+  /// Return the number of elements of chunk @p k that the current rank receives from each rank.
+  const std::vector<int>& recv_counts(const SizeType k) const noexcept {
+    return recv_counts_[to_sizet(k)];
+  }
+
+  /// Return the rank in the full communicator of the source grid of the rank with index @p index in the
+  /// source grid.
+  comm::IndexT_MPI src_comm_rank(const comm::Index2D& index) const noexcept {
+    const comm::Size2D& grid_size = src_dist_.grid_size();
+    return common::computeLinearIndex<comm::IndexT_MPI>(comm::internal::FULL_COMMUNICATOR_ORDER, index,
+                                                        {grid_size.rows(), grid_size.cols()});
+  }
+
+  /// Return the rank in the full communicator of the source grid of the rank with index @p index in the
+  /// destination grid.
+  comm::IndexT_MPI dst_comm_rank(const comm::Index2D& index) const noexcept {
+    const comm::Size2D& grid_size = dst_dist_.grid_size();
+    return dst_to_src_comm_rank_[to_sizet(common::computeLinearIndex<comm::IndexT_MPI>(
+        comm::internal::FULL_COMMUNICATOR_ORDER, index, {grid_size.rows(), grid_size.cols()}))];
+  }
+
+private:
+  Distribution src_dist_;
+  Distribution dst_dist_;
+  std::vector<Segment> row_segments_;
+  std::vector<Segment> col_segments_;
+  std::vector<std::size_t> chunk_begin_;
+  std::vector<std::vector<int>> send_counts_;
+  std::vector<std::vector<int>> recv_counts_;
+  std::vector<comm::IndexT_MPI> dst_to_src_comm_rank_;
+};
+
+namespace internal {
+
+// Packs the elements of the chunk @p k of the source matrix that the current rank sends.
+// The data for each rank is stored contiguously (ordered by rank), and it is composed by the pieces
+// (intersection of a row and a column segment) ordered by column segment first and by row segment
+// then, each of them stored in column-major order.
+// @p tiles contains all the local tile rows of the local tile columns [j_lc_begin, ...).
+template <class T>
+std::vector<T> packRedistributionChunk(
+    const RedistributionPlan& plan, const SizeType k, const SizeType j_lc_begin,
+    const std::vector<matrix::internal::TileAsyncRwMutexReadOnlyWrapper<T, Device::CPU>>& tiles) {
+  const Distribution& dist = plan.src_distribution();
+  const comm::Index2D rank = dist.rank_index();
+  const SizeType ld_tiles = dist.local_nr_tiles().rows();
+
+  const std::vector<int>& counts = plan.send_counts(k);
+  std::vector<int> displs(counts.size());
+  std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), 0);
+  std::vector<T> buffer(to_sizet(std::accumulate(counts.begin(), counts.end(), 0)));
+
+  const auto [cs_begin, cs_end] = plan.chunk_col_segments(k);
+  for (std::size_t cs_index = cs_begin; cs_index < cs_end; ++cs_index) {
+    const auto& cs = plan.col_segments()[cs_index];
+    if (cs.src_rank != rank.col())
+      continue;
+
+    const SizeType j_lc = dist.local_tile_from_global_tile<Coord::Col>(cs.src_tile) - j_lc_begin;
+    for (const auto& rs : plan.row_segments()) {
+      if (rs.src_rank != rank.row())
+        continue;
+
+      const SizeType i_lc = dist.local_tile_from_global_tile<Coord::Row>(rs.src_tile);
+      const auto& tile = tiles[to_sizet(i_lc + j_lc * ld_tiles)].get();
+      int& displ = displs[to_sizet(plan.dst_comm_rank({rs.dst_rank, cs.dst_rank}))];
+
+      lapack::lacpy(blas::Uplo::General, rs.size, cs.size,
+                    tile.ptr(TileElementIndex(rs.src_tile_element, cs.src_tile_element)), tile.ld(),
+                    buffer.data() + displ, rs.size);
+      displ += to_int(rs.size * cs.size);
+    }
+  }
+
+  return buffer;
+}
+
+// Unpacks the elements of the chunk @p k received by the current rank into the destination matrix.
+// @p tiles contains all the local tile rows of the tile column k.
+// See packRedistributionChunk for the layout of @p buffer.
+template <class T>
+void unpackRedistributionChunk(const RedistributionPlan& plan, const SizeType k,
+                               const std::vector<T>& buffer,
+                               const std::vector<matrix::Tile<T, Device::CPU>>& tiles) {
+  const Distribution& dist = plan.dst_distribution();
+  const comm::Index2D rank = dist.rank_index();
+
+  const std::vector<int>& counts = plan.recv_counts(k);
+  std::vector<int> displs(counts.size());
+  std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), 0);
+
+  const auto [cs_begin, cs_end] = plan.chunk_col_segments(k);
+  for (std::size_t cs_index = cs_begin; cs_index < cs_end; ++cs_index) {
+    const auto& cs = plan.col_segments()[cs_index];
+    DLAF_ASSERT_HEAVY(cs.dst_rank == rank.col(), cs.dst_rank, rank);
+
+    for (const auto& rs : plan.row_segments()) {
+      if (rs.dst_rank != rank.row())
+        continue;
+
+      const SizeType i_lc = dist.local_tile_from_global_tile<Coord::Row>(rs.dst_tile);
+      const auto& tile = tiles[to_sizet(i_lc)];
+      int& displ = displs[to_sizet(plan.src_comm_rank({rs.src_rank, cs.src_rank}))];
+
+      lapack::lacpy(blas::Uplo::General, rs.size, cs.size, buffer.data() + displ, rs.size,
+                    tile.ptr(TileElementIndex(rs.dst_tile_element, cs.dst_tile_element)), tile.ld());
+      displ += to_int(rs.size * cs.size);
+    }
+  }
+}
+
+// Exchanges the packed buffers of the chunk @p k between all the ranks.
+template <class T>
+std::vector<T> exchangeRedistributionChunk(
+    comm::CommunicatorPipeline<comm::CommunicatorType::Full>& pcomm, const RedistributionPlan& plan,
+    const SizeType k, const std::vector<T>& send_buffer) {
+  namespace ex = pika::execution::experimental;
+
+  using dlaf::common::DataDescriptor;
+
+  const std::vector<int>& send_counts = plan.send_counts(k);
+  const std::vector<int>& recv_counts = plan.recv_counts(k);
+
+  std::vector<int> send_displs(send_counts.size());
+  std::vector<int> recv_displs(recv_counts.size());
+  std::exclusive_scan(send_counts.begin(), send_counts.end(), send_displs.begin(), 0);
+  std::exclusive_scan(recv_counts.begin(), recv_counts.end(), recv_displs.begin(), 0);
+
+  std::vector<T> recv_buffer(to_sizet(std::accumulate(recv_counts.begin(), recv_counts.end(), 0)));
+
+  const T* send_ptr = send_buffer.data();
+  T* recv_ptr = recv_buffer.data();
+
+  std::vector<ex::unique_any_sender<>> all_comms;
+  all_comms.reserve(to_sizet(pcomm.size() - 1) * 2);
+  const comm::IndexT_MPI rank = pcomm.rank();
+  for (comm::IndexT_MPI rank_partner = 0; rank_partner < pcomm.size(); ++rank_partner) {
+    const auto rank_partner_index = to_sizet(rank_partner);
+
+    if (rank == rank_partner) {
+      DLAF_ASSERT_HEAVY(send_counts[rank_partner_index] == recv_counts[rank_partner_index],
+                        send_counts[rank_partner_index], recv_counts[rank_partner_index]);
+      std::copy_n(send_ptr + send_displs[rank_partner_index], send_counts[rank_partner_index],
+                  recv_ptr + recv_displs[rank_partner_index]);
+      continue;
+    }
+
+    if (send_counts[rank_partner_index])
+      all_comms.push_back(
+          pcomm.shared() |
+          dlaf::comm::internal::transformMPI([=](const comm::Communicator& comm, MPI_Request* req) {
+            auto message = dlaf::comm::make_message(DataDescriptor<const T>(
+                send_ptr + send_displs[rank_partner_index], send_counts[rank_partner_index]));
+            DLAF_MPI_CHECK_ERROR(MPI_Isend(message.data(), message.count(), message.mpi_type(),
+                                           rank_partner, 0, comm, req));
+            comm::internal::addBytesSent(comm, message.mpi_type(), message.count());
+          }));
+    if (recv_counts[rank_partner_index])
+      all_comms.push_back(
+          pcomm.shared() |
+          dlaf::comm::internal::transformMPI([=](const comm::Communicator& comm, MPI_Request* req) {
+            auto message = dlaf::comm::make_message(DataDescriptor<T>(
+                recv_ptr + recv_displs[rank_partner_index], recv_counts[rank_partner_index]));
+            DLAF_MPI_CHECK_ERROR(MPI_Irecv(message.data(), message.count(), message.mpi_type(),
+                                           rank_partner, 0, comm, req));
+            comm::internal::addBytesReceived(comm, message.mpi_type(), message.count());
+          }));
+  }
+
+  pika::this_thread::experimental::sync_wait(ex::when_all_vector(std::move(all_comms)));
+
+  return recv_buffer;
+}
+}
+
+/// Redistribute @p src into @p dst according to @p plan.
+///
+/// The elements of @p src are packed in contiguous buffers and exchanged between the ranks with
+/// point-to-point communications (an alltoallv per chunk, see RedistributionPlan).
+///
+/// Note: only matrices allocated on CPU are supported, GPU matrices can be redistributed through a
+///       MatrixMirror.
+/// @param src_grid the grid used to construct @p plan, its full communicator is used,
+/// @pre src.distribution() == plan.src_distribution(),
+/// @pre dst.distribution() == plan.dst_distribution(),
+/// @pre src and dst do not share tiles.
+///
+/// Note: @p src and @p dst can be either Matrix or MatrixRef (e.g. to copy a submatrix which does not
+///       start at a tile boundary from/to a matrix on its own).
+template <template <class, Device> class MatrixLikeSrc, template <class, Device> class MatrixLikeDst,
+          class T>
+void redistribute(comm::CommunicatorGrid& src_grid, const RedistributionPlan& plan,
+                  MatrixLikeSrc<const T, Device::CPU>& src, MatrixLikeDst<T, Device::CPU>& dst) {
+  namespace ex = pika::execution::experimental;
+  namespace di = dlaf::internal;
+
+  DLAF_ASSERT(src.distribution() == plan.src_distribution(), src, plan.src_distribution().size());
+  DLAF_ASSERT(dst.distribution() == plan.dst_distribution(), dst, plan.dst_distribution().size());
+  DLAF_ASSERT(equal_process_grid(src, src_grid), src, src_grid);
+
+  // Note: the tasks might outlive plan, hence they share a copy of it.
+  auto plan_ptr = std::make_shared<const RedistributionPlan>(plan);
+
+  const Distribution& src_dist = plan.src_distribution();
+  const Distribution& dst_dist = plan.dst_distribution();
+  const comm::Index2D src_rank = src_dist.rank_index();
+  const comm::Index2D dst_rank = dst_dist.rank_index();
+
+  auto mpi_chain = src_grid.full_communicator_pipeline();
+
+  for (SizeType k = 0; k < plan.nr_chunks(); ++k) {
+    const std::vector<int>& send_counts = plan.send_counts(k);
+    const std::vector<int>& recv_counts = plan.recv_counts(k);
+    auto positive = [](const int count) { return count > 0; };
+    const bool has_send = std::any_of(send_counts.begin(), send_counts.end(), positive);
+    const bool has_recv = std::any_of(recv_counts.begin(), recv_counts.end(), positive);
+
+    if (!has_send && !has_recv)
+      continue;
+
+    // PACK
+    ex::unique_any_sender<std::vector<T>> send_buffer = ex::just(std::vector<T>());
+    if (has_send) {
+      // Local tile columns of src intersecting the chunk
+      const auto [cs_begin, cs_end] = plan.chunk_col_segments(k);
+      SizeType j_lc_begin = src_dist.local_nr_tiles().cols();
+      SizeType j_lc_end = 0;
+      for (std::size_t cs_index = cs_begin; cs_index < cs_end; ++cs_index) {
+        const auto& cs = plan.col_segments()[cs_index];
+        if (cs.src_rank == src_rank.col()) {
+          const SizeType j_lc = src_dist.local_tile_from_global_tile<Coord::Col>(cs.src_tile);
+          j_lc_begin = std::min(j_lc_begin, j_lc);
+          j_lc_end = std::max(j_lc_end, j_lc + 1);
+        }
+      }
+
+      const LocalTileIndex begin(0, j_lc_begin);
+      const LocalTileSize sz(src_dist.local_nr_tiles().rows(), j_lc_end - j_lc_begin);
+      send_buffer =
+          ex::when_all_vector(matrix::selectRead(src, common::iterate_range2d(begin, sz))) |
+          di::transform(di::Policy<Backend::MC>(),
+                        [plan_ptr, k, j_lc_begin](const auto& tiles) {
+                          return internal::packRedistributionChunk<T>(*plan_ptr, k, j_lc_begin, tiles);
+                        });
+    }
+
+    // COMMUNICATION
+    auto recv_buffer =
+        std::move(send_buffer) |
+        di::transform(di::Policy<Backend::MC>(),
+                      [plan_ptr, k, pcomm = mpi_chain.sub_pipeline()](
+                          const std::vector<T>& send_buffer) mutable {
+                        return internal::exchangeRedistributionChunk<T>(pcomm, *plan_ptr, k,
+                                                                        send_buffer);
+                      });
+
+    // UNPACK
+    if (has_recv) {
+      DLAF_ASSERT_HEAVY(dst_dist.rank_global_tile<Coord::Col>(k) == dst_rank.col(), k, dst_rank);
+
+      const LocalTileIndex begin(0, dst_dist.local_tile_from_global_tile<Coord::Col>(k));
+      const LocalTileSize sz(dst_dist.local_nr_tiles().rows(), 1);
+      ex::when_all(std::move(recv_buffer),
+                   ex::when_all_vector(matrix::select(dst, common::iterate_range2d(begin, sz)))) |
+          di::transformDetach(di::Policy<Backend::MC>(),
+                              [plan_ptr, k](const std::vector<T>& buffer, const auto& tiles) {
+                                internal::unpackRedistributionChunk<T>(*plan_ptr, k, buffer, tiles);
+                              });
+    }
+    else {
+      ex::start_detached(std::move(recv_buffer));
+    }
+  }
+}
+
+/// \overload redistribute()
+///
+/// This overload computes the communication pattern internally.
+/// It is a collective operation over the ranks of the grids.
+/// @pre src is distributed on src_grid and dst is distributed on dst_grid,
+/// @pre src.size() == dst.size(),
+/// @pre src_grid and dst_grid contain the same ranks.
+template <template <class, Device> class MatrixLikeSrc, template <class, Device> class MatrixLikeDst,
+          class T>
+void redistribute(comm::CommunicatorGrid& src_grid, MatrixLikeSrc<const T, Device::CPU>& src,
+                  comm::CommunicatorGrid& dst_grid, MatrixLikeDst<T, Device::CPU>& dst) {
+  const RedistributionPlan plan(src_grid, src.distribution(), dst_grid, dst.distribution());
+  redistribute(src_grid, plan, src, dst);
+}
+}
@@ -21,6 +21,7 @@
 #include <umpire/Allocator.hpp>
 
 #include <dlaf/memory/memory_type.h>
+#include <dlaf/metrics.h>
 #include <dlaf/types.h>
 
 namespace dlaf::memory {
@@ -79,6 +80,7 @@ public:
       std::terminate();
     }
 #endif
+    dlaf::internal::addBytesAllocated(mem_size);
   }
 
   /// Creates a MemoryChunk object from an existing memory allocation.
@@ -0,0 +1,93 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// @file
+
+#include <array>
+#include <cstddef>
+#include <iosfwd>
+
+#include <mpi.h>
+
+#include <dlaf/communication/communicator_type.h>
+
+namespace dlaf {
+/// DLA-Future metrics.
+///
+/// Holds the values of the counters accumulated by the calling rank since DLA-Future initialization
+/// (or since the last call to resetMetrics), when metrics are enabled (see configuration::metrics).
+/// - flops:
+///     Floating point operations performed by the BLAS and LAPACK tile kernels (a complex addition
+///     counts as 2 operations, a complex multiplication as 6).
+///     Kernels without a closed-form operation count (e.g. eigensolvers of tiles) are not counted.
+/// - bytes_sent, bytes_received:
+///     Size of the messages posted by the communication kernels, indexed by the CommunicatorType of
+///     the communicator of a CommunicatorGrid where they were posted. Receives count the size of the
+///     posted buffer, broadcasts and reductions count the message once either as sent (root of a
+///     broadcast, non-root of a reduction) or received, all-reductions count it both as sent and
+///     received. Communications on communicators not belonging to a CommunicatorGrid are not counted.
+/// - bytes_allocated:
+///     Memory allocated through MemoryChunk (on any device).
+struct Metrics {
+  double flops = 0;
+  std::array<std::size_t, 3> bytes_sent = {};
+  std::array<std::size_t, 3> bytes_received = {};
+  std::size_t bytes_allocated = 0;
+
+  std::size_t sent(comm::CommunicatorType type) const noexcept {
+    return bytes_sent[static_cast<std::size_t>(type)];
+  }
+
+  std::size_t received(comm::CommunicatorType type) const noexcept {
+    return bytes_received[static_cast<std::size_t>(type)];
+  }
+};
+
+std::ostream& operator<<(std::ostream& os, const Metrics& metrics);
+
+/// Returns the values of the counters of the calling rank.
+///
+/// Note: values are accumulated by the tasks as they run, therefore to get the metrics of an
+/// algorithm it has to be called after the algorithm completed (e.g. after waiting for its results).
+Metrics getMetrics();
+
+/// Sets all the counters of the calling rank to zero.
+///
+/// @pre no task of DLA-Future is running.
+void resetMetrics();
+
+namespace internal {
+// Counters are stored in per-thread buffers, so that kernels running concurrently do not contend for
+// them, and they are summed up by getMetrics. When metrics are disabled, each call of the functions
+// below reduces to a (relaxed) load of an atomic flag.
+
+// Returns true if the counters have to be updated.
+bool metricsEnabled() noexcept;
+
+// Starts (stops) updating the counters.
+void enableMetrics() noexcept;
+void disableMetrics() noexcept;
+
+void addFlops(double flops) noexcept;
+void addBytesAllocated(std::size_t bytes) noexcept;
+}
+}
+
+namespace dlaf::comm::internal {
+// Marks @p comm as a communicator of the given @p type, so that the messages posted on it (or on its
+// duplicates) are counted in the corresponding metrics.
+void setCommunicatorType(MPI_Comm comm, CommunicatorType type);
+
+// Counts a message of @p count elements of type @p dtype sent (received) on @p comm.
+void addBytesSent(MPI_Comm comm, MPI_Datatype dtype, int count) noexcept;
+void addBytesReceived(MPI_Comm comm, MPI_Datatype dtype, int count) noexcept;
+}
@@ -30,9 +30,9 @@ namespace dlaf::multiplication::internal {
 /// C = alpha * opA(A) * opB(B) + beta * C
 ///
 /// @param  opA specifies the form of opA(A) to be used in the matrix multiplication:
-///         \a currently only NoTrans,
+///         \a NoTrans, \a Trans, \a ConjTrans,
 /// @param  opB specifies the form of opB(B) to be used in the matrix multiplication:
-///         \a currently only NoTrans,
+///         \a NoTrans, \a Trans, \a ConjTrans,
 ///
 /// @param  mat_a contains the input matrix A.
 /// @pre @p mat_a is not distributed
@@ -55,17 +55,22 @@ void generalMatrix(const blas::Op opA, const blas::Op opB, const T alpha, Matrix
   DLAF_ASSERT(matrix::local_matrix(mat_b), mat_b);
   DLAF_ASSERT(matrix::local_matrix(mat_c), mat_c);
 
-  DLAF_ASSERT_HEAVY(matrix::multipliable(mat_a, mat_b, mat_c, blas::Op::NoTrans, blas::Op::NoTrans),
-                    mat_a, mat_b, mat_c);
+  DLAF_ASSERT_HEAVY(matrix::multipliable(mat_a, mat_b, mat_c, opA, opB), mat_a, mat_b, mat_c);
 
-  if (opA == blas::Op::NoTrans && opB == blas::Op::NoTrans)
-    internal::General<B, D, T>::callNN(alpha, mat_a, mat_b, beta, mat_c);
-  else
-    DLAF_UNIMPLEMENTED(opA, opB);
+  internal::General<B, D, T>::call(opA, opB, alpha, mat_a, mat_b, beta, mat_c);
 }
 
 /// General sub-matrix distributed multiplication, computing
-/// C = alpha * A * B + beta * C
+/// C = alpha * opA(A) * opB(B) + beta * C
+///
+/// Tiles of transposed operands are not transposed in memory: at each step the needed row (column)
+/// of tiles is redistributed to the ranks storing the corresponding rows (columns) of C, with two
+/// broadcasts along the two axes of the grid.
+///
+/// @param  opA specifies the form of opA(A) to be used in the matrix multiplication:
+///         \a NoTrans, \a Trans, \a ConjTrans,
+/// @param  opB specifies the form of opB(B) to be used in the matrix multiplication:
+///         \a NoTrans, \a Trans, \a ConjTrans,
 ///
 /// @param  mat_a contains the input matrix A.
 /// @param  mat_b contains the input matrix B.
@@ -73,6 +78,8 @@ void generalMatrix(const blas::Op opA, const blas::Op opB, const T alpha, Matrix
 ///         overwritten with the result, while others are left untouched.
 ///
 /// @pre @p mat_a, @p mat_b and @p mat_c are distributed on the same grid,
+/// @pre the rows of opA(A) are distributed as the rows of @p mat_c, if opA == NoTrans,
+/// @pre the columns of opB(B) are distributed as the columns of @p mat_c, if opB == NoTrans,
 /// @pre multipliable_sizes(mat_a.size(), mat_b.size(), mat_c.size(), opA, opB)
 /// @pre multipliable_sizes(mat_a.tile_size(), mat_b.tile_size(), mat_c.tile_size(), opA, opB)
 /// @pre multipliable_sizes(mat_a.tile_size_of({0, 0}), mat_b.tile_size_of({0, 0}),
@@ -80,8 +87,8 @@ void generalMatrix(const blas::Op opA, const blas::Op opB, const T alpha, Matrix
 template <Backend B, Device D, class T>
 void generalMatrix(comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain,
                    comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain,
-                   const T alpha, MatrixRef<const T, D>& mat_a, MatrixRef<const T, D>& mat_b,
-                   const T beta, MatrixRef<T, D>& mat_c) {
+                   const blas::Op opA, const blas::Op opB, const T alpha, MatrixRef<const T, D>& mat_a,
+                   MatrixRef<const T, D>& mat_b, const T beta, MatrixRef<T, D>& mat_c) {
   DLAF_ASSERT(matrix::equal_process_grid(row_task_chain, col_task_chain), row_task_chain,
               col_task_chain);
 
@@ -89,9 +96,22 @@ void generalMatrix(comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_
   DLAF_ASSERT(matrix::equal_process_grid(mat_b, row_task_chain), mat_b, row_task_chain);
   DLAF_ASSERT(matrix::equal_process_grid(mat_c, row_task_chain), mat_c, row_task_chain);
 
-  DLAF_ASSERT_HEAVY(matrix::multipliable(mat_a, mat_b, mat_c, blas::Op::NoTrans, blas::Op::NoTrans),
-                    mat_a, mat_b, mat_c);
+  DLAF_ASSERT_HEAVY(matrix::multipliable(mat_a, mat_b, mat_c, opA, opB), mat_a, mat_b, mat_c);
 
-  internal::General<B, D, T>::callNN(row_task_chain, col_task_chain, alpha, mat_a, mat_b, beta, mat_c);
+  internal::General<B, D, T>::call(row_task_chain, col_task_chain, opA, opB, alpha, mat_a, mat_b, beta,
+                                   mat_c);
+}
+
+/// General sub-matrix distributed multiplication, computing
+/// C = alpha * A * B + beta * C
+///
+/// It is equivalent to generalMatrix with opA == opB == NoTrans.
+template <Backend B, Device D, class T>
+void generalMatrix(comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain,
+                   comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain,
+                   const T alpha, MatrixRef<const T, D>& mat_a, MatrixRef<const T, D>& mat_b,
+                   const T beta, MatrixRef<T, D>& mat_c) {
+  generalMatrix<B>(row_task_chain, col_task_chain, blas::Op::NoTrans, blas::Op::NoTrans, alpha, mat_a,
+                   mat_b, beta, mat_c);
 }
 }
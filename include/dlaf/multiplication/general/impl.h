@@ -11,6 +11,7 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
 #include <dlaf/blas/tile.h>
 #include <dlaf/blas/tile_extensions.h>
@@ -20,6 +21,7 @@
 #include <dlaf/communication/broadcast_panel.h>
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/communication/communicator_pipeline.h>
+#include <dlaf/communication/kernels/broadcast.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/index.h>
 #include <dlaf/matrix/matrix.h>
@@ -31,12 +33,242 @@
 
 namespace dlaf::multiplication::internal {
 
+namespace general {
+/// Returns the distribution of the workspace for a panel of a transposed operand.
+///
+/// Tiles of the panel are stored with the same shape they have in the operand (see
+/// matrix::StoreTransposed), but the panel is distributed as the @p coord of @p dist_c, i.e. as the
+/// rows of C for op(A) and as the columns of C for op(B).
+///
+/// @param dist_op distribution of the operand, whose @p coord represents the k dimension
+template <Coord coord>
+matrix::Distribution transposedPanelDistribution(const matrix::Distribution& dist_c,
+                                                 const matrix::Distribution& dist_op) {
+  auto mix = [](const auto& c_value, const auto& op_value) {
+    using ValueT = std::decay_t<decltype(c_value)>;
+    return coord == Coord::Row ? ValueT(c_value.row(), op_value.row())
+                               : ValueT(op_value.col(), c_value.col());
+  };
+
+  // Note: the source rank along the k dimension is irrelevant, as the panel has a single tile on it.
+  const comm::Index2D& source_rank_c = dist_c.source_rank_index();
+  const comm::Index2D source_rank = coord == Coord::Row ? comm::Index2D(source_rank_c.row(), 0)
+                                                        : comm::Index2D(0, source_rank_c.col());
+
+  return {mix(dist_c.size(), dist_op.size()),
+          mix(dist_c.block_size(), dist_op.block_size()),
+          mix(dist_c.tile_size(), dist_op.tile_size()),
+          dist_c.grid_size(),
+          dist_c.rank_index(),
+          source_rank,
+          mix(dist_c.offset(), dist_op.offset())};
+}
+
+/// Makes available the k-th column of tiles of A on all ranks storing a row of tiles of C.
+template <class T, Device D>
+void setupPanelA(const SizeType k, MatrixRef<const T, D>& mat_a,
+                 matrix::Panel<Coord::Col, T, D>& panel,
+                 comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain) {
+  const matrix::Distribution& dist_a = mat_a.distribution();
+
+  // Setup the column workspace for the root ranks, i.e. the ones in the current col
+  const auto rank_k_col = dist_a.rank_global_tile<Coord::Col>(k);
+  if (rank_k_col == dist_a.rank_index().col()) {
+    const auto k_local = dist_a.local_tile_from_global_tile<Coord::Col>(k);
+    for (SizeType i = 0; i < dist_a.local_nr_tiles().rows(); ++i) {
+      const LocalTileIndex ik(i, k_local);
+      panel.setTile(ik, mat_a.read(ik));
+    }
+  }
+
+  // Broadcast the column panel from root to others (row-wise)
+  comm::broadcast(rank_k_col, panel, row_task_chain);
+}
+
+/// Makes available the k-th row of tiles of B on all ranks storing a column of tiles of C.
+template <class T, Device D>
+void setupPanelB(const SizeType k, MatrixRef<const T, D>& mat_b,
+                 matrix::Panel<Coord::Row, T, D>& panel,
+                 comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain) {
+  const matrix::Distribution& dist_b = mat_b.distribution();
+
+  // Setup the row workspace for the root ranks, i.e. the ones in the current row
+  const auto rank_k_row = dist_b.rank_global_tile<Coord::Row>(k);
+  if (rank_k_row == dist_b.rank_index().row()) {
+    const auto k_local = dist_b.local_tile_from_global_tile<Coord::Row>(k);
+    for (SizeType j = 0; j < dist_b.local_nr_tiles().cols(); ++j) {
+      const LocalTileIndex kj(k_local, j);
+      panel.setTile(kj, mat_b.read(kj));
+    }
+  }
+
+  // Broadcast the row panel from root to others (col-wise)
+  comm::broadcast(rank_k_row, panel, col_task_chain);
+}
+
+/// Makes available the k-th row (@p coord == Coord::Row) or column (@p coord == Coord::Col) of
+/// tiles of the operand @p mat_op to all ranks storing the corresponding column (row) of tiles of C,
+/// without transposing the tiles.
+///
+/// It happens in two steps (for the sake of example, let's consider the row of A, the column of B is
+/// dual):
+/// 1. the row of tiles of A is broadcasted col-wise into @p panel_aux, so that each column of
+///    ranks has all the tiles of the row it stores;
+/// 2. each tile (k, i) is broadcasted row-wise to the ranks storing the i-th row of tiles of C, by
+///    the rank of the same row that received it in the first step.
+///
+/// @param panel_aux workspace with the shape of the k-th row (column) of tiles of the operand
+/// @param panel_t destination panel, distributed as the columns (rows) of C
+template <Coord coord, class T, Device D>
+void setupTransposedPanel(const SizeType k, MatrixRef<const T, D>& mat_op,
+                          const matrix::Distribution& dist_c,
+                          matrix::Panel<orthogonal(coord), T, D>& panel_aux,
+                          matrix::Panel<coord, T, D, matrix::StoreTransposed::Yes>& panel_t,
+                          comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain,
+                          comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain) {
+  namespace ex = pika::execution::experimental;
+
+  // Note: coord_k is the axis of the operand along which the k index runs
+  constexpr Coord coord_k = orthogonal(coord);
+  const matrix::Distribution& dist_op = mat_op.distribution();
+  const auto& rank = dist_c.rank_index();
+
+  // STEP 1
+  const auto rank_k = dist_op.rank_global_tile<coord_k>(k);
+  if (rank_k == rank.get<coord_k>()) {
+    const auto k_local = dist_op.local_tile_from_global_tile<coord_k>(k);
+    for (SizeType i = 0; i < dist_op.local_nr_tiles().get<coord>(); ++i) {
+      const LocalTileIndex ki =
+          coord_k == Coord::Row ? LocalTileIndex(k_local, i) : LocalTileIndex(i, k_local);
+      panel_aux.setTile(ki, mat_op.read(ki));
+    }
+  }
+  comm::broadcast(rank_k, panel_aux,
+                  comm::internal::get_taskchain<coord>(row_task_chain, col_task_chain));
+
+  // STEP 2
+  auto& chain_step2 = comm::internal::get_taskchain<coord_k>(row_task_chain, col_task_chain);
+  const auto comm_size = dist_c.grid_size().get<coord>();
+
+  for (SizeType i_lc = 0; i_lc < dist_c.local_nr_tiles().get<coord_k>(); ++i_lc) {
+    const SizeType i = dist_c.global_tile_from_local_tile<coord_k>(i_lc);
+    const auto rank_i = dist_op.rank_global_tile<coord>(i);
+    const LocalTileIndex idx_t(coord_k, i_lc);
+
+    if (rank_i == rank.get<coord>()) {
+      const auto i_local = dist_op.local_tile_from_global_tile<coord>(i);
+      panel_t.setTile(idx_t, panel_aux.read(LocalTileIndex(coord, i_local)));
+
+      if (comm_size > 1)
+        ex::start_detached(comm::schedule_bcast_send(chain_step2.exclusive(), panel_t.read(idx_t)));
+    }
+    else {
+      ex::start_detached(
+          comm::schedule_bcast_recv(chain_step2.exclusive(), rank_i, panel_t.readwrite(idx_t)));
+    }
+  }
+}
+
+/// SUMMA-like distributed matrix multiplication.
+///
+/// At each step k, the column of tiles of op(A) and the row of tiles of op(B) are made available on
+/// all ranks that need them, and each rank updates its local tiles of C.
+/// Operands that are not transposed are communicated as in the NoTrans/NoTrans case, i.e. with a
+/// single broadcast, while the tiles of the transposed ones are redistributed as described in
+/// setupTransposedPanel.
+template <Backend B, Device D, class T, matrix::StoreTransposed storageA,
+          matrix::StoreTransposed storageB>
+void callSumma(comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain,
+               comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain,
+               const blas::Op opA, const blas::Op opB, const T alpha, MatrixRef<const T, D>& mat_a,
+               MatrixRef<const T, D>& mat_b, const T beta, MatrixRef<T, D>& mat_c) {
+  namespace ex = pika::execution::experimental;
+  using matrix::StoreTransposed;
+
+  constexpr bool transA = storageA == StoreTransposed::Yes;
+  constexpr bool transB = storageB == StoreTransposed::Yes;
+
+  const matrix::Distribution& dist_a = mat_a.distribution();
+  const matrix::Distribution& dist_b = mat_b.distribution();
+  const matrix::Distribution& dist_c = mat_c.distribution();
+
+  const SizeType nrtiles_k = transA ? mat_a.nr_tiles().rows() : mat_a.nr_tiles().cols();
+
+  constexpr std::size_t n_workspaces = 2;
+  common::RoundRobin<matrix::Panel<Coord::Col, T, D, storageA>> panelsA(
+      n_workspaces, transA ? transposedPanelDistribution<Coord::Row>(dist_c, dist_a) : dist_a);
+  common::RoundRobin<matrix::Panel<Coord::Row, T, D, storageB>> panelsB(
+      n_workspaces, transB ? transposedPanelDistribution<Coord::Col>(dist_c, dist_b) : dist_b);
+
+  // Note: auxiliary workspaces are needed just for transposed operands
+  common::RoundRobin<matrix::Panel<Coord::Row, T, D>> panelsA_aux(transA ? n_workspaces : 0, dist_a);
+  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panelsB_aux(transB ? n_workspaces : 0, dist_b);
+
+  // This loops over the global indices for k, because every rank has to participate in communication
+  for (SizeType k = 0; k < nrtiles_k; ++k) {
+    auto& panelA = panelsA.nextResource();
+    auto& panelB = panelsB.nextResource();
+
+    const SizeType kSize = transA ? dist_a.global_tile_size_of<Coord::Row>(k)
+                                  : dist_a.global_tile_size_of<Coord::Col>(k);
+    DLAF_ASSERT_HEAVY(kSize == (transB ? dist_b.global_tile_size_of<Coord::Col>(k)
+                                       : dist_b.global_tile_size_of<Coord::Row>(k)),
+                      kSize, k);
+    panelA.setWidth(kSize);
+    panelB.setHeight(kSize);
+
+    if constexpr (transA) {
+      auto& panelA_aux = panelsA_aux.nextResource();
+      panelA_aux.setHeight(kSize);
+      setupTransposedPanel<Coord::Col>(k, mat_a, dist_c, panelA_aux, panelA, row_task_chain,
+                                       col_task_chain);
+      panelA_aux.reset();
+    }
+    else {
+      setupPanelA(k, mat_a, panelA, row_task_chain);
+    }
+
+    if constexpr (transB) {
+      auto& panelB_aux = panelsB_aux.nextResource();
+      panelB_aux.setWidth(kSize);
+      setupTransposedPanel<Coord::Row>(k, mat_b, dist_c, panelB_aux, panelB, row_task_chain,
+                                       col_task_chain);
+      panelB_aux.reset();
+    }
+    else {
+      setupPanelB(k, mat_b, panelB, col_task_chain);
+    }
+
+    // This is the core loop where the k step performs the update over the entire local matrix using
+    // the col and row workspaces.
+    // Everything needed for the update is available locally thanks to previous communications.
+    for (SizeType i = 0; i < dist_c.local_nr_tiles().rows(); ++i) {
+      for (SizeType j = 0; j < dist_c.local_nr_tiles().cols(); ++j) {
+        const LocalTileIndex ij(i, j);
+
+        ex::start_detached(dlaf::internal::whenAllLift(opA, opB, alpha, panelA.read(ij),
+                                                       panelB.read(ij), k == 0 ? beta : T(1),
+                                                       mat_c.readwrite(ij)) |
+                           tile::gemm(dlaf::internal::Policy<B>()));
+      }
+    }
+
+    panelA.reset();
+    panelB.reset();
+  }
+}
+}
+
 template <Backend B, Device D, class T>
-void General<B, D, T>::callNN(const T alpha, MatrixRef<const T, D>& mat_a, MatrixRef<const T, D>& mat_b,
-                              const T beta, MatrixRef<T, D>& mat_c) {
+void General<B, D, T>::call(const blas::Op opA, const blas::Op opB, const T alpha,
+                            MatrixRef<const T, D>& mat_a, MatrixRef<const T, D>& mat_b, const T beta,
+                            MatrixRef<T, D>& mat_c) {
   namespace ex = pika::execution::experimental;
 
-  if (mat_a.nr_tiles().cols() == 0) {
+  const SizeType nrtiles_k =
+      opA == blas::Op::NoTrans ? mat_a.nr_tiles().cols() : mat_a.nr_tiles().rows();
+
+  if (nrtiles_k == 0) {
     // Note: if beta == 1, we optimize by not even scheduling anything
     if (beta != T(1)) {
       for (SizeType j = 0; j < mat_c.distribution().local_nr_tiles().cols(); ++j)
@@ -47,12 +279,17 @@ void General<B, D, T>::callNN(const T alpha, MatrixRef<const T, D>& mat_a, Matri
     return;
   }
 
+  // Note: tiles of the operands are accessed with the indices of op(A) and op(B)
+  auto op_index = [](const blas::Op op, const SizeType row, const SizeType col) {
+    return op == blas::Op::NoTrans ? LocalTileIndex(row, col) : LocalTileIndex(col, row);
+  };
+
   for (SizeType j = 0; j < mat_c.distribution().local_nr_tiles().cols(); ++j) {
     for (SizeType i = 0; i < mat_c.distribution().local_nr_tiles().rows(); ++i) {
-      for (SizeType k = 0; k < mat_a.distribution().local_nr_tiles().cols(); ++k) {
-        ex::start_detached(dlaf::internal::whenAllLift(blas::Op::NoTrans, blas::Op::NoTrans, alpha,
-                                                       mat_a.read(LocalTileIndex(i, k)),
-                                                       mat_b.read(LocalTileIndex(k, j)),
+      for (SizeType k = 0; k < nrtiles_k; ++k) {
+        ex::start_detached(dlaf::internal::whenAllLift(opA, opB, alpha,
+                                                       mat_a.read(op_index(opA, i, k)),
+                                                       mat_b.read(op_index(opB, k, j)),
                                                        k == 0 ? beta : T(1),
                                                        mat_c.readwrite(LocalTileIndex(i, j))) |
                            tile::gemm(dlaf::internal::Policy<B>()));
@@ -62,21 +299,21 @@ void General<B, D, T>::callNN(const T alpha, MatrixRef<const T, D>& mat_a, Matri
 }
 
 template <Backend B, Device D, class T>
-void General<B, D, T>::callNN(comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain,
-                              comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain,
-                              const T alpha, MatrixRef<const T, D>& mat_a, MatrixRef<const T, D>& mat_b,
-                              const T beta, MatrixRef<T, D>& mat_c) {
+void General<B, D, T>::call(comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain,
+                            comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain,
+                            const blas::Op opA, const blas::Op opB, const T alpha,
+                            MatrixRef<const T, D>& mat_a, MatrixRef<const T, D>& mat_b, const T beta,
+                            MatrixRef<T, D>& mat_c) {
   namespace ex = pika::execution::experimental;
+  using matrix::StoreTransposed;
 
   if (mat_c.size().isEmpty())
     return;
 
-  const matrix::Distribution& dist_a = mat_a.distribution();
-  const matrix::Distribution& dist_b = mat_b.distribution();
-  const matrix::Distribution& dist_c = mat_c.distribution();
-  const auto rank = dist_c.rank_index();
+  const SizeType nrtiles_k =
+      opA == blas::Op::NoTrans ? mat_a.nr_tiles().cols() : mat_a.nr_tiles().rows();
 
-  if (mat_a.nr_tiles().cols() == 0) {
+  if (nrtiles_k == 0) {
     // Note: if beta == 1, we optimize by not even scheduling anything
     if (beta != T(1)) {
       for (SizeType j = 0; j < mat_c.distribution().local_nr_tiles().cols(); ++j)
@@ -87,67 +324,35 @@ void General<B, D, T>::callNN(comm::CommunicatorPipeline<comm::CommunicatorType:
     return;
   }
 
-  constexpr std::size_t n_workspaces = 2;
-  common::RoundRobin<matrix::Panel<Coord::Col, T, D>> panelsA(n_workspaces, dist_a);
-  common::RoundRobin<matrix::Panel<Coord::Row, T, D>> panelsB(n_workspaces, dist_b);
-
-  DLAF_ASSERT_HEAVY(mat_a.nr_tiles().cols() == mat_b.nr_tiles().rows(), mat_a.nr_tiles(),
-                    mat_b.nr_tiles());
-
-  // This loops over the global indices for k, because every rank has to participate in communication
-  for (SizeType k = 0; k < mat_a.nr_tiles().cols(); ++k) {
-    auto& panelA = panelsA.nextResource();
-    auto& panelB = panelsB.nextResource();
-
-    if (k == 0 || k == mat_a.nr_tiles().cols() - 1) {
-      DLAF_ASSERT_HEAVY(dist_a.global_tile_size_of<Coord::Col>(k) ==
-                            dist_b.global_tile_size_of<Coord::Row>(k),
-                        dist_a.global_tile_size_of<Coord::Col>(k),
-                        dist_b.global_tile_size_of<Coord::Row>(k));
-      const SizeType kSize = dist_a.global_tile_size_of<Coord::Col>(k);
-      panelA.setWidth(kSize);
-      panelB.setHeight(kSize);
-    }
-
-    // Setup the column workspace for the root ranks, i.e. the ones in the current col
-    const auto rank_k_col = dist_a.rank_global_tile<Coord::Col>(k);
-    if (rank_k_col == rank.col()) {
-      const auto k_local = dist_a.local_tile_from_global_tile<Coord::Col>(k);
-      for (SizeType i = 0; i < dist_c.local_nr_tiles().rows(); ++i) {
-        const LocalTileIndex ik(i, k_local);
-        panelA.setTile(ik, mat_a.read(ik));
-      }
-    }
-    // Setup the row workspace for the root ranks, i.e. the ones in the current row
-    const auto rank_k_row = dist_b.rank_global_tile<Coord::Row>(k);
-    if (rank_k_row == rank.row()) {
-      const auto k_local = dist_b.local_tile_from_global_tile<Coord::Row>(k);
-      for (SizeType j = 0; j < dist_c.local_nr_tiles().cols(); ++j) {
-        const LocalTileIndex kj(k_local, j);
-        panelB.setTile(kj, mat_b.read(kj));
-      }
-    }
-
-    // Broadcast both column and row panel from root to others (row-wise and col-wise, respectively)
-    broadcast(rank_k_col, panelA, row_task_chain);
-    broadcast(rank_k_row, panelB, col_task_chain);
+  const bool transA = opA != blas::Op::NoTrans;
+  const bool transB = opB != blas::Op::NoTrans;
 
-    // This is the core loop where the k step performs the update over the entire local matrix using
-    // the col and row workspaces.
-    // Everything needed for the update is available locally thanks to previous broadcasts.
-    for (SizeType i = 0; i < dist_c.local_nr_tiles().rows(); ++i) {
-      for (SizeType j = 0; j < dist_c.local_nr_tiles().cols(); ++j) {
-        const LocalTileIndex ij(i, j);
+  if (!transA && !transB)
+    general::callSumma<B, D, T, StoreTransposed::No, StoreTransposed::No>(
+        row_task_chain, col_task_chain, opA, opB, alpha, mat_a, mat_b, beta, mat_c);
+  else if (!transA && transB)
+    general::callSumma<B, D, T, StoreTransposed::No, StoreTransposed::Yes>(
+        row_task_chain, col_task_chain, opA, opB, alpha, mat_a, mat_b, beta, mat_c);
+  else if (transA && !transB)
+    general::callSumma<B, D, T, StoreTransposed::Yes, StoreTransposed::No>(
+        row_task_chain, col_task_chain, opA, opB, alpha, mat_a, mat_b, beta, mat_c);
+  else
+    general::callSumma<B, D, T, StoreTransposed::Yes, StoreTransposed::Yes>(
+        row_task_chain, col_task_chain, opA, opB, alpha, mat_a, mat_b, beta, mat_c);
+}
 
-        ex::start_detached(dlaf::internal::whenAllLift(blas::Op::NoTrans, blas::Op::NoTrans, alpha,
-                                                       panelA.read(ij), panelB.read(ij),
-                                                       k == 0 ? beta : T(1), mat_c.readwrite(ij)) |
-                           tile::gemm(dlaf::internal::Policy<B>()));
-      }
-    }
+template <Backend B, Device D, class T>
+void General<B, D, T>::callNN(const T alpha, MatrixRef<const T, D>& mat_a, MatrixRef<const T, D>& mat_b,
+                              const T beta, MatrixRef<T, D>& mat_c) {
+  call(blas::Op::NoTrans, blas::Op::NoTrans, alpha, mat_a, mat_b, beta, mat_c);
+}
 
-    panelA.reset();
-    panelB.reset();
-  }
+template <Backend B, Device D, class T>
+void General<B, D, T>::callNN(comm::CommunicatorPipeline<comm::CommunicatorType::Row>& row_task_chain,
+                              comm::CommunicatorPipeline<comm::CommunicatorType::Col>& col_task_chain,
+                              const T alpha, MatrixRef<const T, D>& mat_a, MatrixRef<const T, D>& mat_b,
+                              const T beta, MatrixRef<T, D>& mat_c) {
+  call(row_task_chain, col_task_chain, blas::Op::NoTrans, blas::Op::NoTrans, alpha, mat_a, mat_b, beta,
+       mat_c);
 }
 }
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <numeric>
 #include <tuple>
@@ -37,6 +38,7 @@
 #include <dlaf/matrix/index.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_ref.h>
+#include <dlaf/metrics.h>
 #include <dlaf/permutations/general/api.h>
 #include <dlaf/permutations/general/perms.h>
 #include <dlaf/schedulers.h>
@@ -44,6 +46,7 @@
 #include <dlaf/sender/transform.h>
 #include <dlaf/sender/transform_mpi.h>
 #include <dlaf/sender/when_all_lift.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
 #include <dlaf/util_matrix.h>
 
@@ -258,11 +261,16 @@ auto whenAllReadOnlyTilesArray(Matrix<const T, D>& matrix) {
       matrix, common::iterate_range2d(LocalTileIndex(0, 0), matrix.distribution().localNrTiles())));
 }
 
-template <class T, Device D, Coord C, class SendCountsSender, class RecvCountsSender>
+// @param sz_loc local size of the region to communicate
+// @param send_tiles/recv_tiles senders of the tiles of the region, which has to be a contiguous part
+//        of a packed column-major matrix (i.e. all the tiles or a range of tiles along orthogonal(C))
+template <class T, Device D, Coord C, class SendCountsSender, class SendTilesSender,
+          class RecvCountsSender, class RecvTilesSender>
 void all2allData(
     comm::CommunicatorPipeline<comm::coord_to_communicator_type(orthogonal(C))>& sub_task_chain,
     int nranks, LocalElementSize sz_loc, SendCountsSender&& send_counts_sender,
-    Matrix<const T, D>& send_mat, RecvCountsSender&& recv_counts_sender, Matrix<T, D>& recv_mat) {
+    SendTilesSender&& send_tiles, RecvCountsSender&& recv_counts_sender,
+    RecvTilesSender&& recv_tiles) {
   namespace ex = pika::execution::experimental;
 
   using dlaf::common::DataDescriptor;
@@ -308,6 +316,7 @@ void all2allData(
 
               DLAF_MPI_CHECK_ERROR(MPI_Isend(message.data(), message.count(), message.mpi_type(),
                                              rank_partner, 0, comm, req));
+              comm::internal::addBytesSent(comm, message.mpi_type(), message.count());
             }));
       if (recv_counts[rank_partner_index])
         all_comms.push_back(
@@ -320,6 +329,7 @@ void all2allData(
 
               DLAF_MPI_CHECK_ERROR(MPI_Irecv(message.data(), message.count(), message.mpi_type(),
                                              rank_partner, 0, comm, req));
+              comm::internal::addBytesReceived(comm, message.mpi_type(), message.count());
             }));
     }
 
@@ -327,9 +337,9 @@ void all2allData(
   };
 
   ex::when_all(std::forward<SendCountsSender>(send_counts_sender),
-               ex::just(std::vector<int>(to_sizet(nranks))), whenAllReadOnlyTilesArray(send_mat),
+               ex::just(std::vector<int>(to_sizet(nranks))), std::forward<SendTilesSender>(send_tiles),
                std::forward<RecvCountsSender>(recv_counts_sender),
-               ex::just(std::vector<int>(to_sizet(nranks))), whenAllReadWriteTilesArray(recv_mat)) |
+               ex::just(std::vector<int>(to_sizet(nranks))), std::forward<RecvTilesSender>(recv_tiles)) |
       dlaf::internal::transformDetach(dlaf::internal::Policy<Backend::MC>(), std::move(sendrecv_f));
 }
 
@@ -614,31 +624,60 @@ void permuteOnCPU(
       initPackingIndex<C, true>(nranks, offset_sub, dist, local2global_index, packing_index) |
       ex::split();
 
-  // Pack local rows or columns to be sent from this rank
-  applyPackingIndex<T, D, C>(subm_dist, whenAllReadOnlyTilesArray(packing_index),
-                             whenAllReadOnlyTilesArray(i_loc_begin, i_loc_end, mat_in),
-                             whenAllReadWriteTilesArray(mat_send));
-
-  // Unpacking
-  // separate unpacking:
-  // - locals
-  // - communicated
-  // and then start two different tasks:
-  // - the first depends on mat_send instead of mat_recv (no dependency on comm)
-  // - the last is the same, but it has to skip the part already done for local
-
-  // LOCAL
-  unpackLocalOnCPU<T, C>(subm_dist, dist, send_counts_sender, recv_counts_sender,
-                         whenAllReadOnlyTilesArray(unpacking_index), whenAllReadOnlyTilesArray(mat_send),
-                         whenAllReadWriteTilesArray(i_loc_begin, i_loc_end, mat_out));
-  // COMMUNICATION-dependent
-  all2allData<T, D, C>(sub_task_chain, nranks, sz_loc, send_counts_sender, mat_send, recv_counts_sender,
-                       mat_recv);
-  // OTHERS
-  unpackOthersOnCPU<T, C>(subm_dist, dist, std::move(recv_counts_sender),
-                          whenAllReadOnlyTilesArray(unpacking_index),
-                          whenAllReadOnlyTilesArray(mat_recv),
-                          whenAllReadWriteTilesArray(i_loc_begin, i_loc_end, mat_out));
+  // The permutation is split in chunks of tiles along the orthogonal direction, each one going through
+  // packing, communication and unpacking independently. In this way, the packing of a chunk can overlap
+  // with the communication of the previous one and with the unpacking of the one before that.
+  // Note: all chunks share the same packing/unpacking indices and counts.
+  constexpr auto OC = orthogonal(C);
+  const SizeType ntiles_oc = i_loc_end.get<OC>() - i_loc_begin.get<OC>();
+  const SizeType chunk_ntiles = getTuneParameters().permutations_pipeline_num_tiles > 0
+                                    ? getTuneParameters().permutations_pipeline_num_tiles
+                                    : ntiles_oc;
+
+  for (SizeType k_begin = 0; k_begin < ntiles_oc; k_begin += chunk_ntiles) {
+    const SizeType k_end = std::min(k_begin + chunk_ntiles, ntiles_oc);
+
+    // Local distribution of the chunk used for packing and unpacking
+    const SizeType chunk_sz_oc =
+        std::min(k_end * blk.get<OC>(), sz_loc.get<OC>()) - k_begin * blk.get<OC>();
+    const LocalElementSize chunk_sz_loc(OC, chunk_sz_oc, sz_loc.get<C>());
+    const Distribution chunk_dist(chunk_sz_loc, blk);
+
+    // Range of the chunk in the packed matrices and in the input/output matrices
+    const LocalTileIndex chunk_begin(OC, k_begin, 0);
+    const LocalTileIndex chunk_end(OC, k_end, subm_dist.local_nr_tiles().get<C>());
+    const LocalTileIndex chunk_loc_begin(OC, i_loc_begin.get<OC>() + k_begin, i_loc_begin.get<C>());
+    const LocalTileIndex chunk_loc_end(OC, i_loc_begin.get<OC>() + k_end, i_loc_end.get<C>());
+
+    // Pack local rows or columns to be sent from this rank
+    applyPackingIndex<T, D, C>(chunk_dist, whenAllReadOnlyTilesArray(packing_index),
+                               whenAllReadOnlyTilesArray(chunk_loc_begin, chunk_loc_end, mat_in),
+                               whenAllReadWriteTilesArray(chunk_begin, chunk_end, mat_send));
+
+    // Unpacking
+    // separate unpacking:
+    // - locals
+    // - communicated
+    // and then start two different tasks:
+    // - the first depends on mat_send instead of mat_recv (no dependency on comm)
+    // - the last is the same, but it has to skip the part already done for local
+
+    // LOCAL
+    unpackLocalOnCPU<T, C>(chunk_dist, dist, send_counts_sender, recv_counts_sender,
+                           whenAllReadOnlyTilesArray(unpacking_index),
+                           whenAllReadOnlyTilesArray(chunk_begin, chunk_end, mat_send),
+                           whenAllReadWriteTilesArray(chunk_loc_begin, chunk_loc_end, mat_out));
+    // COMMUNICATION-dependent
+    all2allData<T, D, C>(sub_task_chain, nranks, chunk_sz_loc, send_counts_sender,
+                         whenAllReadOnlyTilesArray(chunk_begin, chunk_end, mat_send),
+                         recv_counts_sender,
+                         whenAllReadWriteTilesArray(chunk_begin, chunk_end, mat_recv));
+    // OTHERS
+    unpackOthersOnCPU<T, C>(chunk_dist, dist, recv_counts_sender,
+                            whenAllReadOnlyTilesArray(unpacking_index),
+                            whenAllReadOnlyTilesArray(chunk_begin, chunk_end, mat_recv),
+                            whenAllReadWriteTilesArray(chunk_loc_begin, chunk_loc_end, mat_out));
+  }
 }
 
 template <Backend B, Device D, class T, Coord C>
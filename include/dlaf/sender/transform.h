@@ -14,6 +14,7 @@
 #include <pika/execution.hpp>
 
 #include <dlaf/common/consume_rvalues.h>
+#include <dlaf/common/trace.h>
 #include <dlaf/common/unwrap.h>
 #include <dlaf/init.h>
 #include <dlaf/schedulers.h>
@@ -47,6 +48,8 @@ enum class TransformDispatchType { Plain, Blas, Lapack };
 //
 // At its core, transform is a convenience wrapper around
 // sender | continues_on(with_priority(scheduler, priority)) | then(ConsumeRvalues(unwrapping(f))).
+//
+// Each call of f is recorded if tracing is enabled (see common::internal::traced).
 
 /// Lazy transform. This does not submit the work and returns a sender.
 template <TransformDispatchType Tag = TransformDispatchType::Plain, Backend B = Backend::MC,
@@ -60,11 +63,12 @@ template <TransformDispatchType Tag = TransformDispatchType::Plain, Backend B =
   auto scheduler = getBackendScheduler<B>(policy.priority(), policy.stacksize());
 
   using dlaf::common::internal::ConsumeRvalues;
+  using dlaf::common::internal::traced;
   using dlaf::common::internal::Unwrapping;
 
   if constexpr (B == Backend::MC) {
     return std::forward<Sender>(sender) | continues_on(std::move(scheduler)) |
-           then(ConsumeRvalues{Unwrapping{std::forward<F>(f)}}) | drop_operation_state();
+           then(ConsumeRvalues{Unwrapping{traced(std::forward<F>(f), "mc")}}) | drop_operation_state();
   }
   else if constexpr (B == Backend::GPU) {
 #if defined(DLAF_WITH_GPU)
@@ -82,17 +86,18 @@ template <TransformDispatchType Tag = TransformDispatchType::Plain, Backend B =
 
     if constexpr (Tag == TransformDispatchType::Plain) {
       return then_with_stream(std::move(transfer_sender),
-                              ConsumeRvalues{Unwrapping{std::forward<F>(f)}}) |
+                              ConsumeRvalues{Unwrapping{traced(std::forward<F>(f), "gpu")}}) |
              drop_operation_state();
     }
     else if constexpr (Tag == TransformDispatchType::Blas) {
-      return then_with_cublas(std::move(transfer_sender), ConsumeRvalues{Unwrapping{std::forward<F>(f)}},
+      return then_with_cublas(std::move(transfer_sender),
+                              ConsumeRvalues{Unwrapping{traced(std::forward<F>(f), "gpu")}},
                               CUBLAS_POINTER_MODE_HOST) |
              drop_operation_state();
     }
     else if constexpr (Tag == TransformDispatchType::Lapack) {
       return then_with_cusolver(std::move(transfer_sender),
-                                ConsumeRvalues{Unwrapping{std::forward<F>(f)}}) |
+                                ConsumeRvalues{Unwrapping{traced(std::forward<F>(f), "gpu")}}) |
              drop_operation_state();
     }
     else {
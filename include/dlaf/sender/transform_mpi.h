@@ -9,13 +9,16 @@
 //
 #pragma once
 
+#include <memory>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 
 #include <pika/execution.hpp>
 #include <pika/mpi.hpp>
 
 #include <dlaf/common/consume_rvalues.h>
+#include <dlaf/common/trace.h>
 #include <dlaf/common/unwrap.h>
 #include <dlaf/communication/communicator.h>
 #include <dlaf/communication/communicator_pipeline.h>
@@ -73,15 +76,35 @@ template <typename F>
 MPICallHelper(F&&) -> MPICallHelper<std::decay_t<F>>;
 
 /// Lazy transformMPI. Returns a sender that will submit the work passed in
+///
+/// If DLA-Future is built with DLAF_WITH_TRACE and tracing is enabled, the MPI operation is recorded
+/// from the call of f to its completion.
 template <typename F, typename Sender,
           typename = std::enable_if_t<pika::execution::experimental::is_sender_v<Sender>>>
 [[nodiscard]] decltype(auto) transformMPI(F&& f, Sender&& sender) {
   using dlaf::common::internal::ConsumeRvalues;
   using pika::execution::experimental::drop_operation_state;
   using pika::mpi::experimental::transform_mpi;
+
+#ifdef DLAF_WITH_TRACE
+  using dlaf::common::internal::TraceClock;
+  using dlaf::common::internal::TracedCompletion;
+  using dlaf::common::internal::TracedStart;
+  using dlaf::common::internal::traceEnabled;
+  using pika::execution::experimental::then;
+
+  auto begin = traceEnabled() ? std::make_shared<TraceClock::time_point>() : nullptr;
+  const std::type_info& name = typeid(std::decay_t<F>);
+
+  return std::forward<Sender>(sender)                                                           //
+         | transform_mpi(ConsumeRvalues{MPICallHelper{TracedStart{std::forward<F>(f), begin}}})  //
+         | then(TracedCompletion{&name, "mpi", begin})                                           //
+         | drop_operation_state();
+#else
   return std::forward<Sender>(sender)                                        //
          | transform_mpi(ConsumeRvalues{MPICallHelper{std::forward<F>(f)}})  //
          | drop_operation_state();
+#endif
 }
 
 template <typename F>
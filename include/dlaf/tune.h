@@ -16,6 +16,9 @@
 #include <exception>
 #include <iosfwd>
 #include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <pika/init.hpp>
 #include <pika/runtime.hpp>
@@ -63,10 +66,19 @@ namespace dlaf {
 ///     Enable dump of tridiagonal solver input/output data to "tridiagonal.h5" file that will be
 ///     created in the working folder (it should not exist before the execution).
 ///     Set with environment variable DLAF_DEBUG_DUMP_TRIDIAG_SOLVER_DATA.
+/// - debug_tridiag_solver_merge_stats:
+///     Print, for each level of the D&C tree of the tridiagonal solver, the number of merges and the
+///     time at which the first and the last of them completed (for the distributed solver only rank
+///     (0, 0) of the grid prints them).
+///     Set with environment variable DLAF_DEBUG_TRIDIAG_SOLVER_MERGE_STATS.
 /// - default_allocation_layout:
 ///     Specify the default AllocationLayout for Matrices.
 ///     Allowed values: ColMajor (default), Blocks, Tiles.
 ///     Set with environment variable DLAF_DEFAULT_ALLOCATION_LAYOUT.
+/// - cholesky_broadcast_panel_ring:
+///     The panels of the distributed Cholesky factorization are broadcast with a pipelined ring of point
+///     to point communications instead of MPI broadcasts. Set with --dlaf:cholesky-broadcast-panel-ring
+///     or env variable DLAF_CHOLESKY_BROADCAST_PANEL_RING.
 /// - tfactor_num_threads:
 ///     The maximum number of threads to use for computing tfactor (e.g. which is used for
 ///     instance in red2band and its backtransformation). Set with --dlaf:tfactor-num-threads or env
@@ -81,6 +93,10 @@ namespace dlaf {
 /// - red2band_panel_num_threads:
 ///     The maximum number of threads to use for computing the panel in the reduction to band algorithm.
 ///     Set with --dlaf:red2band-panel-num-threads or env variable DLAF_RED2BAND_PANEL_NUM_THREADS.
+/// - red2band_broadcast_panel_ring:
+///     The panels of the reduction to band algorithm are broadcast with a pipelined ring of point to
+///     point communications instead of MPI broadcasts. Set with --dlaf:red2band-broadcast-panel-ring or
+///     env variable DLAF_RED2BAND_BROADCAST_PANEL_RING.
 /// - red2band_barrier_busy_wait_us:
 ///     The duration in microseconds to busy-wait in barriers in the reduction to band algorithm.
 ///     Set with --dlaf:red2band-barrier-busy-wait-us or env variable DLAF_RED2BAND_BARRIER_BUSY_WAIT_US.
@@ -91,22 +107,83 @@ namespace dlaf {
 ///     The duration in microseconds to busy-wait in barriers when computing rank1 problem solution in
 ///     the tridiagonal solver algorithm. Set with --dlaf:tridiag-rank1-barrier-busy-wait-us or env
 ///     variable DLAF_TRIDIAG_RANK1_BARRIER_BUSY_WAIT_US.
+/// - tridiag_partial_spectrum_threshold:
+///     The tridiagonal solver computes only the requested eigenvectors with the MRRR algorithm, instead
+///     of computing all of them with the D&C algorithm, if their number is at most
+///     tridiag_partial_spectrum_threshold * N (0, the default, disables the partial-spectrum solver).
+///     Set with --dlaf:tridiag-partial-spectrum-threshold or env variable
+///     DLAF_TRIDIAG_PARTIAL_SPECTRUM_THRESHOLD.
+/// - tridiag_max_concurrent_merges:
+///     The maximum number of merges of the D&C tree of the tridiagonal solver that can run concurrently
+///     (0 means no limit). Set with --dlaf:tridiag-max-concurrent-merges or env variable
+///     DLAF_TRIDIAG_MAX_CONCURRENT_MERGES.
 /// - eigensolver_min_band:
 ///     The minimum value to start looking for a divisor of the block size.
 ///     Set with --dlaf:eigensolver-min-band or env variable DLAF_EIGENSOLVER_MIN_BAND.
+/// - eigensolver_one_stage_max_size:
+///     Matrices up to this size are reduced to tridiagonal form by the eigensolver with the one-stage
+///     algorithm (LAPACK hetrd on a single rank) instead of reduction to band followed by band to
+///     tridiagonal. 0 disables it. Set with --dlaf:eigensolver-one-stage-max-size or env variable
+///     DLAF_EIGENSOLVER_ONE_STAGE_MAX_SIZE.
+/// - eigensolver_one_stage_distributed:
+///     Enable the one-stage algorithm in the distributed eigensolver (for matrices up to
+///     eigensolver_one_stage_max_size). It is disabled by default, as the crossover with the two-stage
+///     algorithm depends on the network and on the number of ranks. Set with
+///     --dlaf:eigensolver-one-stage-distributed or env variable DLAF_EIGENSOLVER_ONE_STAGE_DISTRIBUTED.
+/// - eigensolver_one_stage_max_nranks:
+///     The one-stage algorithm is used for distributed matrices only if the grid has at most this
+///     number of ranks, as each rank gathers and reduces the full matrix. Set with
+///     --dlaf:eigensolver-one-stage-max-nranks or env variable DLAF_EIGENSOLVER_ONE_STAGE_MAX_NRANKS.
+/// - eigensolver_checkpoint_file:
+///     HDF5 file where the distributed eigensolver stores the results of each stage (empty disables
+///     checkpointing). If the file already exists, the eigensolver restores the results of the stages
+///     completed by a previous (possibly interrupted) call on the same problem and resumes from the
+///     first stage not completed. Requires DLA-Future built with HDF5 support. Set with
+///     --dlaf:eigensolver-checkpoint-file or env variable DLAF_EIGENSOLVER_CHECKPOINT_FILE.
 /// - band_to_tridiag_1d_block_size_base:
 ///     The 1D block size for band_to_tridiagonal is computed as 1d_block_size_base / nb * nb. The input
 ///     matrix is distributed with a {nb x nb} block size. Set with
 ///     --dlaf:band-to-tridiag-1d-block-size-base or env variable
 ///     DLAF_BAND_TO_TRIDIAG_1D_BLOCK_SIZE_BASE.
+/// - band_to_tridiag_sweeps_per_task:
+///     Number of consecutive sweeps chased by each task of the local band to tridiagonal reduction on
+///     CPU. Sweeps of the same task are interleaved step by step to reuse the band elements in cache.
+///     The largest divisor of the block size not larger than this value is used. Set with
+///     --dlaf:band-to-tridiag-sweeps-per-task or env variable DLAF_BAND_TO_TRIDIAG_SWEEPS_PER_TASK.
+/// - band_to_tridiag_persistent_requests:
+///     The columns exchanged between ranks by the distributed band to tridiagonal reduction are
+///     communicated with MPI persistent requests, which are created once and restarted at each sweep.
+///     Set with --dlaf:band-to-tridiag-persistent-requests or env variable
+///     DLAF_BAND_TO_TRIDIAG_PERSISTENT_REQUESTS.
 /// - bt_band_to_tridiag_hh_apply_group_size:
 ///     The application of the HH reflector is splitted in smaller applications of the group size
 ///     reflectors. Set with --dlaf:bt-band-to-tridiag-hh-apply-group-size or env variable
 ///     DLAF_BT_BAND_TO_TRIDIAG_HH_APPLY_GROUP_SIZE.
+/// - permutations_pipeline_num_tiles:
+///     Distributed permutations on CPU are split in chunks of this number of tiles (along the direction
+///     orthogonal to the permuted one), such that packing, communication and unpacking of different
+///     chunks overlap. 0 disables the chunking, i.e. the whole range is processed at once. Set with
+///     --dlaf:permutations-pipeline-num-tiles or env variable DLAF_PERMUTATIONS_PIPELINE_NUM_TILES.
+/// - broadcast_panel_aggregate_max_bytes:
+///     Panels on CPU are broadcast with a single collective, packing all their local tiles in a
+///     contiguous buffer, if the size of the local tiles is at most this number of bytes, instead of
+///     broadcasting each tile separately. 0 disables the aggregation. Set with
+///     --dlaf:broadcast-panel-aggregate-max-bytes or env variable
+///     DLAF_BROADCAST_PANEL_AGGREGATE_MAX_BYTES.
 /// - communicator_grid_num_pipelines:
 ///     The default number of row, column, and full communicator pipelins to initialize in
 ///     CommunicatorGrid. Set with --dlaf:communicator-grid-num-pipelines or env variable
 ///     DLAF_COMMUNICATOR_GRID_NUM_PIPELINES.
+/// - c_api_auto_layout:
+///     The C API eigensolver and Cholesky wrappers redistribute the input to a layout chosen by
+///     DLA-Future (the most square grid over the same ranks and a block size selected with
+///     c_api_auto_layout_block_sizes), solve, and redistribute the result back to the caller's
+///     layout. Set with --dlaf:c-api-auto-layout or env variable DLAF_C_API_AUTO_LAYOUT.
+/// - c_api_auto_layout_block_sizes:
+///     List of (min_size, block_size) pairs sorted by min_size: the block size of the entry with the
+///     largest min_size not exceeding the matrix size is used by the C API auto layout. Set with
+///     --dlaf:c-api-auto-layout-block-sizes or env variable DLAF_C_API_AUTO_LAYOUT_BLOCK_SIZES using
+///     the format "min_size:block_size,..." (e.g. "0:64,4096:128").
 /// Note to developers: Users can change these values, therefore consistency has to be ensured by
 /// algorithms.
 ///
@@ -144,22 +221,40 @@ struct TuneParameters {
   bool debug_dump_inverse_from_cholesky_factor_data = false;
   bool debug_dump_triangular_inverse_data = false;
   bool debug_dump_tridiag_solver_data = false;
+  bool debug_tridiag_solver_merge_stats = false;
 
   matrix::AllocationLayout default_allocation_layout = matrix::AllocationLayout::ColMajor;
 
+  bool cholesky_broadcast_panel_ring = false;
+
   std::size_t tfactor_num_threads = 1;
   std::size_t tfactor_num_streams = 4;
   std::size_t tfactor_barrier_busy_wait_us = 0;
   std::size_t red2band_panel_num_threads = 1;
   std::size_t red2band_barrier_busy_wait_us = 1000;
+  bool red2band_broadcast_panel_ring = false;
   std::size_t tridiag_rank1_num_threads = 1;
   std::size_t tridiag_rank1_barrier_busy_wait_us = 0;
+  double tridiag_partial_spectrum_threshold = 0;
+  SizeType tridiag_max_concurrent_merges = 0;
 
   SizeType eigensolver_min_band = 100;
+  SizeType eigensolver_one_stage_max_size = 512;
+  bool eigensolver_one_stage_distributed = false;
+  SizeType eigensolver_one_stage_max_nranks = 4;
+  std::string eigensolver_checkpoint_file = "";
   SizeType band_to_tridiag_1d_block_size_base = 8192;
+  SizeType band_to_tridiag_sweeps_per_task = 1;
+  bool band_to_tridiag_persistent_requests = false;
   SizeType bt_band_to_tridiag_hh_apply_group_size = 64;
+  SizeType permutations_pipeline_num_tiles = 0;
+  SizeType broadcast_panel_aggregate_max_bytes = 0;
 
   std::size_t communicator_grid_num_pipelines = 3;
+
+  bool c_api_auto_layout = false;
+  std::vector<std::pair<SizeType, SizeType>> c_api_auto_layout_block_sizes = {
+      {0, 64}, {4096, 128}, {16384, 256}, {65536, 512}};
 };
 
 std::ostream& operator<<(std::ostream& os, const TuneParameters& params);
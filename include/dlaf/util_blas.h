@@ -172,6 +172,43 @@ trsmSizes getTrsmSizes(const blas::Side side, [[maybe_unused]] const dlaf::matri
   return s;
 }
 
+// Number of floating point operations of the BLAS kernels with the given sizes (see LAWN 41).
+template <class T>
+double gemmFlops(const gemmSizes& s) {
+  const double mnk = static_cast<double>(s.m) * static_cast<double>(s.n) * static_cast<double>(s.k);
+  return total_ops<T>(mnk, mnk);
+}
+
+template <class T>
+double hemmFlops(const blas::Side side, const hemmSizes& s) {
+  const double m = static_cast<double>(s.m);
+  const double n = static_cast<double>(s.n);
+  const double ops = side == blas::Side::Left ? m * m * n : m * n * n;
+  return total_ops<T>(ops, ops);
+}
+
+template <class T>
+double her2kFlops(const her2kSizes& s) {
+  const double n = static_cast<double>(s.n);
+  const double k = static_cast<double>(s.k);
+  return total_ops<T>(k * n * n + n, k * n * n);
+}
+
+template <class T>
+double herkFlops(const herkSizes& s) {
+  const double n = static_cast<double>(s.n);
+  const double k = static_cast<double>(s.k);
+  return total_ops<T>(k * n * (n + 1) / 2, k * n * (n + 1) / 2);
+}
+
+// Note: trmm and trsm have the same number of operations.
+template <class T>
+double trmmFlops(const blas::Side side, const SizeType m, const SizeType n) {
+  const double tri = static_cast<double>(side == blas::Side::Left ? m : n);
+  const double other = static_cast<double>(side == blas::Side::Left ? n : m);
+  return total_ops<T>(other * tri * (tri - 1) / 2, other * tri * (tri + 1) / 2);
+}
+
 }
 }
 }
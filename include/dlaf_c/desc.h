@@ -14,13 +14,13 @@
 
 /// DLA-Future matrix descriptor
 struct DLAF_descriptor {
-  int m;     ///< Number of rows in the global matrix
-  int n;     ///< Number of columns in the global matrix
+  int m;     ///< Number of rows in the (sub)matrix
+  int n;     ///< Number of columns in the (sub)matrix
   int mb;    ///< Row blocking factor
   int nb;    ///< Column blocking factor
   int isrc;  ///< Process row of the first row of the global matrix
   int jsrc;  ///< Process column of the first column of the global matrix
-  int i;     ///< First row of the submatrix within global matrix, has to be 0
-  int j;     ///< First column of the submatrix within global matrix, has to be 0
+  int i;     ///< First row of the submatrix within global matrix
+  int j;     ///< First column of the submatrix within global matrix
   int ld;    ///< Leading dimension of the local matrix
 };
@@ -41,6 +41,9 @@ DLAF_EXTERN_C int dlaf_symmetric_eigensolver_s(const int dlaf_context, const cha
 /// @copydoc dlaf_symmetric_eigensolver_s
 /// @param eigenvalues_index_begin index of the first eigenvalue to compute (has to be 0)
 /// @param eigenvalues_index_end index of the last eigenvalue to compute (exclusive)
+///
+/// Only the first @p eigenvalues_index_end columns of \f$\mathbf{Z}\f$ are set, therefore
+/// @p dlaf_descz may describe a matrix with @p eigenvalues_index_end columns.
 DLAF_EXTERN_C int dlaf_symmetric_eigensolver_partial_spectrum_s(
     const int dlaf_context, const char uplo, float* a, const struct DLAF_descriptor dlaf_desca, float* w,
     float* z, const struct DLAF_descriptor dlaf_descz, const SizeType eigenvalues_index_begin,
@@ -80,6 +83,35 @@ DLAF_EXTERN_C int dlaf_hermitian_eigensolver_partial_spectrum_z(
     double* w, dlaf_complex_z* z, const struct DLAF_descriptor dlaf_descz,
     const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end) DLAF_NOEXCEPT;
 
+/// @copydoc dlaf_symmetric_eigensolver_s
+/// @param jobz indicates whether only the eigenvalues ('N') or also the eigenvectors ('V') are
+/// computed. If @p jobz is 'N', @p z and @p dlaf_descz are not referenced and the
+/// back-transformation steps are skipped.
+DLAF_EXTERN_C int dlaf_symmetric_eigensolver_jobz_s(const int dlaf_context, const char jobz,
+                                                    const char uplo, float* a,
+                                                    const struct DLAF_descriptor dlaf_desca, float* w,
+                                                    float* z, const struct DLAF_descriptor dlaf_descz)
+    DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_symmetric_eigensolver_jobz_s
+DLAF_EXTERN_C int dlaf_symmetric_eigensolver_jobz_d(const int dlaf_context, const char jobz,
+                                                    const char uplo, double* a,
+                                                    const struct DLAF_descriptor dlaf_desca, double* w,
+                                                    double* z, const struct DLAF_descriptor dlaf_descz)
+    DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_symmetric_eigensolver_jobz_s
+DLAF_EXTERN_C int dlaf_hermitian_eigensolver_jobz_c(
+    const int dlaf_context, const char jobz, const char uplo, dlaf_complex_c* a,
+    const struct DLAF_descriptor dlaf_desca, float* w, dlaf_complex_c* z,
+    const struct DLAF_descriptor dlaf_descz) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_symmetric_eigensolver_jobz_s
+DLAF_EXTERN_C int dlaf_hermitian_eigensolver_jobz_z(
+    const int dlaf_context, const char jobz, const char uplo, dlaf_complex_z* a,
+    const struct DLAF_descriptor dlaf_desca, double* w, dlaf_complex_z* z,
+    const struct DLAF_descriptor dlaf_descz) DLAF_NOEXCEPT;
+
 #ifdef DLAF_WITH_SCALAPACK
 
 /// Eigensolver
@@ -90,8 +122,8 @@ DLAF_EXTERN_C int dlaf_hermitian_eigensolver_partial_spectrum_z(
 /// memory. The vector of eigenvalues \f$\mathbf{w}\f$ is assumed to be local (non-distributed) and in
 /// host memory. Moving to and from GPU memory is handled internally.
 ///
-/// @pre Submatrices are currently not supported, so @p n is the size of the full matrices
-/// \f$\mathbf{A}\f$ and \f$\mathbf{Z}\f$ and @p ia, @p ja, @p iz, and @p jz need to be 1.
+/// @remark Submatrices starting at a block boundary of the global matrices are used in place, the
+/// other ones are copied to (and from) matrices allocated internally.
 ///
 /// @post The pika runtime is resumed when this function is called and suspended when the call
 /// terminates.
@@ -101,16 +133,16 @@ DLAF_EXTERN_C int dlaf_hermitian_eigensolver_partial_spectrum_z(
 /// @param n order of the submatrix \f$\mathbf{A}\f$ used in the computation
 /// @param a Local part of the global matrix \f$\mathbf{A}\f$
 /// @param ia row index of the global matrix \f$\mathbf{A}\f$ identifying the first row of the submatrix
-/// \f$\mathbf{A}\f$, has to be 1
+/// \f$\mathbf{A}\f$
 /// @param ja column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{A}\f$, has to be 1
+/// submatrix \f$\mathbf{A}\f$
 /// @param desca ScaLAPACK array descriptor of the global matrix \f$\mathbf{A}\f$
 /// @param w Local vector of eigenvalues (non-distributed)
 /// @param z Local part of the global matrix \f$\mathbf{Z}\f$
 /// @param iz row index of the global matrix \f$\mathbf{Z}\f$ identifying the first row of the submatrix
-/// \f$\mathbf{Z}\f$, has to be 1
+/// \f$\mathbf{Z}\f$
 /// @param jz column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{A}\f$, has to be 1
+/// submatrix \f$\mathbf{A}\f$
 /// @param descz ScaLAPACK array descriptor of the global matrix \f$\mathbf{Z}\f$
 /// @param[out] info 0 if the eigensolver completed normally
 DLAF_EXTERN_C void dlaf_pssyevd(const char uplo, const int n, float* a, const int ia, const int ja,
@@ -120,6 +152,10 @@ DLAF_EXTERN_C void dlaf_pssyevd(const char uplo, const int n, float* a, const in
 // @copydoc dlaf_pssyevd
 /// @param eigenvalues_index_begin index of the first eigenvalue to compute (has to be 1)
 /// @param eigenvalues_index_end index of the last eigenvalue to compute (inclusive)
+///
+/// Only the first @p eigenvalues_index_end columns of the submatrix \f$\mathbf{Z}\f$ are referenced,
+/// therefore the global matrix \f$\mathbf{Z}\f$ needs only @p jz - 1 + @p eigenvalues_index_end
+/// columns.
 DLAF_EXTERN_C void dlaf_pssyevd_partial_spectrum(
     const char uplo, const int n, float* a, const int ia, const int ja, const int desca[9], float* w,
     float* z, const int iz, const int jz, const int descz[9], const SizeType eigenvalues_index_begin,
@@ -160,4 +196,31 @@ DLAF_EXTERN_C void dlaf_pzheevd_partial_spectrum(
     const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end,
     int* info) DLAF_NOEXCEPT;
 
+/// @copydoc dlaf_pssyevd
+/// @param jobz indicates whether only the eigenvalues ('N') or also the eigenvectors ('V') are
+/// computed. If @p jobz is 'N', @p z, @p iz, @p jz and @p descz are not referenced and the
+/// back-transformation steps are skipped.
+DLAF_EXTERN_C void dlaf_pssyevd_jobz(const char jobz, const char uplo, const int n, float* a,
+                                     const int ia, const int ja, const int desca[9], float* w, float* z,
+                                     const int iz, const int jz, const int descz[9],
+                                     int* info) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_pssyevd_jobz
+DLAF_EXTERN_C void dlaf_pdsyevd_jobz(const char jobz, const char uplo, const int n, double* a,
+                                     const int ia, const int ja, const int desca[9], double* w,
+                                     double* z, const int iz, const int jz, const int descz[9],
+                                     int* info) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_pssyevd_jobz
+DLAF_EXTERN_C void dlaf_pcheevd_jobz(const char jobz, const char uplo, const int n, dlaf_complex_c* a,
+                                     const int ia, const int ja, const int desca[9], float* w,
+                                     dlaf_complex_c* z, const int iz, const int jz, const int descz[9],
+                                     int* info) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_pssyevd_jobz
+DLAF_EXTERN_C void dlaf_pzheevd_jobz(const char jobz, const char uplo, const int n, dlaf_complex_z* a,
+                                     const int ia, const int ja, const int desca[9], double* w,
+                                     dlaf_complex_z* z, const int iz, const int jz, const int descz[9],
+                                     int* info) DLAF_NOEXCEPT;
+
 #endif
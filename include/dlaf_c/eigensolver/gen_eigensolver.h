@@ -172,9 +172,8 @@ DLAF_EXTERN_C int dlaf_hermitian_generalized_eigensolver_partial_spectrum_factor
 /// distributed and in host memory. The vector of eigenvalues \f$\mathbf{w}\f$ is assumed to be local
 /// (non-distributed) and in host memory. Moving to and from GPU memory is handled internally.
 ///
-/// @pre Submatrices are currently not supported, so @p n is the size of the full matrices
-/// \f$\mathbf{A}\f$, \f$\mathbf{B}\f$, and \f$\mathbf{Z}\f$ and @p ia, @p ja, @p ib, @p jb, @p iz, and
-/// @p jz need to be 1.
+/// @remark Submatrices starting at a block boundary of the global matrices are used in place, the
+/// other ones are copied to (and from) matrices allocated internally.
 ///
 /// @post The pika runtime is resumed when this function is called and suspended when the call
 /// terminates.
@@ -184,22 +183,22 @@ DLAF_EXTERN_C int dlaf_hermitian_generalized_eigensolver_partial_spectrum_factor
 /// @param n order of the submatrix \f$\mathbf{A}\f$ used in the computation
 /// @param a Local part of the global matrix \f$\mathbf{A}\f$
 /// @param ia row index of the global matrix \f$\mathbf{A}\f$ identifying the first row of the submatrix
-/// $A$, has to be 1
+/// $A$
 /// @param ja column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{A}\f$, has to be 1
+/// submatrix \f$\mathbf{A}\f$
 /// @param desca ScaLAPACK array descriptor of the global matrix \f$\mathbf{A}\f$
 /// @param b Local part of the global matrix \f$\mathbf{B}\f$
 /// @param ib row index of the global matrix \f$\mathbf{B}\f$ identifying the first row of the submatrix
-/// \f$\mathbf{B}\f$, has to be 1
+/// \f$\mathbf{B}\f$
 /// @param jb column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{B}\f$, has to be 1
+/// submatrix \f$\mathbf{B}\f$
 /// @param descb ScaLAPACK array descriptor of the global matrix \f$\mathbf{B}\f$
 /// @param w Local vector of eigenvalues (non-distributed)
 /// @param z Local part of the global matrix \f$\mathbf{Z}\f$
 /// @param iz row index of the global matrix \f$\mathbf{Z}\f$ identifying the first row of the submatrix
-/// \f$\mathbf{Z}\f$, has to be 1
+/// \f$\mathbf{Z}\f$
 /// @param jz column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{A}\f$, has to be 1
+/// submatrix \f$\mathbf{A}\f$
 /// @param descz ScaLAPACK array descriptor of the global matrix \f$\mathbf{Z}\f$
 /// @param[out] info 0 if the eigensolver completed normally
 DLAF_EXTERN_C void dlaf_pssygvd(const char uplo, const int n, float* a, const int ia, const int ja,
@@ -266,9 +265,8 @@ DLAF_EXTERN_C void dlaf_pzhegvd_partial_spectrum(
 /// @pre The matrix \f$\mathbf{B}\f$ is assumed to be factorized; it is the result of a Cholesky
 /// factorization
 ///
-/// @pre Submatrices are currently not supported, so @p n is the size of the full matrices
-/// \f$\mathbf{A}\f$, \f$\mathbf{B}\f$, and \f$\mathbf{Z}\f$ and @p ia, @p ja, @p ib, @p jb, @p iz, and
-/// @p jz need to be 1.
+/// @remark Submatrices starting at a block boundary of the global matrices are used in place, the
+/// other ones are copied to (and from) matrices allocated internally.
 ///
 /// @post The pika runtime is resumed when this function is called and suspended when the call
 /// terminates.
@@ -278,22 +276,22 @@ DLAF_EXTERN_C void dlaf_pzhegvd_partial_spectrum(
 /// @param n order of the submatrix \f$\mathbf{A}\f$ used in the computation
 /// @param a Local part of the global matrix \f$\mathbf{A}\f$
 /// @param ia row index of the global matrix \f$\mathbf{A}\f$ identifying the first row of the submatrix
-/// $A$, has to be 1
+/// $A$
 /// @param ja column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{A}\f$, has to be 1
+/// submatrix \f$\mathbf{A}\f$
 /// @param desca ScaLAPACK array descriptor of the global matrix \f$\mathbf{A}\f$
 /// @param b Local part of the Cholesky factorization of the global matrix \f$\mathbf{B}\f$
 /// @param ib row index of the global matrix \f$\mathbf{B}\f$ identifying the first row of the submatrix
-/// \f$\mathbf{B}\f$, has to be 1
+/// \f$\mathbf{B}\f$
 /// @param jb column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{B}\f$, has to be 1
+/// submatrix \f$\mathbf{B}\f$
 /// @param descb ScaLAPACK array descriptor of the global matrix \f$\mathbf{B}\f$
 /// @param w Local vector of eigenvalues (non-distributed)
 /// @param z Local part of the global matrix \f$\mathbf{Z}\f$
 /// @param iz row index of the global matrix \f$\mathbf{Z}\f$ identifying the first row of the submatrix
-/// \f$\mathbf{Z}\f$, has to be 1
+/// \f$\mathbf{Z}\f$
 /// @param jz column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{A}\f$, has to be 1
+/// submatrix \f$\mathbf{A}\f$
 /// @param descz ScaLAPACK array descriptor of the global matrix \f$\mathbf{Z}\f$
 /// @param[out] info 0 if the eigensolver completed normally
 DLAF_EXTERN_C void dlaf_pssygvd_factorized(const char uplo, const int n, float* a, const int ia,
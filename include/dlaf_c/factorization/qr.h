@@ -0,0 +1,99 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// @file
+
+#include <dlaf_c/desc.h>
+#include <dlaf_c/utils.h>
+
+/// QR factorization
+///
+/// Computes the QR factorization \f$\mathbf{A} = \mathbf{Q}\mathbf{R}\f$ of a general matrix. On exit,
+/// the elements on and above the diagonal of \f$\mathbf{A}\f$ contain \f$\mathbf{R}\f$, while the
+/// elements below the diagonal, together with @p tau, represent \f$\mathbf{Q}\f$ as a product of
+/// elementary reflectors (as in LAPACK).
+///
+/// @pre The matrix \f$\mathbf{A}\f$ is assumed to be distributed and in host memory. Moving to and from
+/// GPU memory is handled internally.
+///
+/// @pre The matrix \f$\mathbf{A}\f$ has square blocks (i.e. mb == nb).
+///
+/// @post The pika runtime is resumed when this function is called and suspended when the call
+/// terminates.
+///
+/// @param dlaf_context context associated to the DLA-Future grid created with @ref dlaf_create_grid
+/// @param a Local part of the global matrix \f$\mathbf{A}\f$
+/// @param dlaf_desca DLA-Future descriptor of the global matrix \f$\mathbf{A}\f$
+/// @param tau Local part of the scaling factors of the elementary reflectors, distributed as the
+/// columns of \f$\mathbf{A}\f$
+/// @return 0 if the factorization completed normally
+DLAF_EXTERN_C int dlaf_qr_factorization_s(const int dlaf_context, float* a,
+                                          const struct DLAF_descriptor dlaf_desca,
+                                          float* tau) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_qr_factorization_s
+DLAF_EXTERN_C int dlaf_qr_factorization_d(const int dlaf_context, double* a,
+                                          const struct DLAF_descriptor dlaf_desca,
+                                          double* tau) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_qr_factorization_s
+DLAF_EXTERN_C int dlaf_qr_factorization_c(const int dlaf_context, dlaf_complex_c* a,
+                                          const struct DLAF_descriptor dlaf_desca,
+                                          dlaf_complex_c* tau) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_qr_factorization_s
+DLAF_EXTERN_C int dlaf_qr_factorization_z(const int dlaf_context, dlaf_complex_z* a,
+                                          const struct DLAF_descriptor dlaf_desca,
+                                          dlaf_complex_z* tau) DLAF_NOEXCEPT;
+
+#ifdef DLAF_WITH_SCALAPACK
+
+/// QR factorization
+///
+/// @remark This function is only available when DLAF_WITH_SCALAPACK=ON.
+///
+/// @pre The matrix \f$\mathbf{A}\f$ is assumed to be distributed and in host memory. Moving to and from
+/// GPU memory is handled internally.
+///
+/// @pre The matrix \f$\mathbf{A}\f$ has square blocks and the submatrix starts at a block boundary.
+///
+/// @post The pika runtime is resumed when this function is called and suspended when the call
+/// terminates.
+///
+/// @param m number of rows of the submatrix \f$\mathbf{A}\f$ used in the computation
+/// @param n number of columns of the submatrix \f$\mathbf{A}\f$ used in the computation
+/// @param a Local part of the global matrix \f$\mathbf{A}\f$
+/// @param ia row index of the global matrix \f$\mathbf{A}\f$ identifying the first row of the submatrix
+/// \f$\mathbf{A}\f$
+/// @param ja column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
+/// submatrix \f$\mathbf{A}\f$
+/// @param desca ScaLAPACK array descriptor of the global matrix \f$\mathbf{A}\f$
+/// @param tau Local part of the scaling factors of the elementary reflectors (as in ScaLAPACK)
+/// @param[out] info 0 if the factorization completed normally
+DLAF_EXTERN_C void dlaf_psgeqrf(const int m, const int n, float* a, const int ia, const int ja,
+                                const int desca[9], float* tau, int* info) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_psgeqrf
+DLAF_EXTERN_C void dlaf_pdgeqrf(const int m, const int n, double* a, const int ia, const int ja,
+                                const int desca[9], double* tau, int* info) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_psgeqrf
+DLAF_EXTERN_C void dlaf_pcgeqrf(const int m, const int n, dlaf_complex_c* a, const int ia,
+                                const int ja, const int desca[9], dlaf_complex_c* tau,
+                                int* info) DLAF_NOEXCEPT;
+
+/// @copydoc dlaf_psgeqrf
+DLAF_EXTERN_C void dlaf_pzgeqrf(const int m, const int n, dlaf_complex_z* a, const int ia,
+                                const int ja, const int desca[9], dlaf_complex_z* tau,
+                                int* info) DLAF_NOEXCEPT;
+
+#endif
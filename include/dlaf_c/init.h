@@ -18,7 +18,19 @@
 ///
 /// @remark If DLA-Future has already been initialized, this function does nothing
 ///
-/// @post The pika runtime is automatically suspended when this function returns
+/// @post The pika runtime is automatically suspended when this function returns, unless the
+/// persistent runtime mode is enabled (see below)
+///
+/// By default each C API call resumes the pika runtime on entry and suspends it on exit, so that
+/// pika worker threads do not consume CPU time between calls. The persistent runtime mode, enabled
+/// with the DLA-Future option --dlaf:c-api-persistent-runtime (or the environment variable
+/// DLAF_C_API_PERSISTENT_RUNTIME=1), keeps the runtime running from dlaf_initialize until
+/// dlaf_finalize, removing the resume/suspend latency from each call.
+///
+/// @remark In persistent mode pika worker threads stay alive (and bound to their cores) between
+/// calls. When idle they back off, but they are not descheduled: threads of the application (e.g.
+/// OpenMP threads) running between DLA-Future calls on the same cores compete with them. In that
+/// case either bind pika and the application threads to disjoint cores or use the default mode.
 ///
 /// @param argc_pika Number of arguments for pika
 /// @param argv_pika Arguments for pika
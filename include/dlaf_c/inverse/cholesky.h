@@ -57,8 +57,8 @@ DLAF_EXTERN_C int dlaf_inverse_from_cholesky_factor_z(
 /// @pre The matrix \f$\mathbf{A}\f$ is assumed to be distributed and in host memory. Moving to and from
 /// GPU memory is handled internally.
 ///
-/// @pre Submatrices are currently not supported, so @p n is the size of the full matrix
-/// \f$\mathbf{A}\f$ and @p ia, and @p ja need to be 1.
+/// @remark A submatrix starting at a block boundary of the global matrix is used in place, otherwise
+/// it is copied to (and from) a matrix allocated internally.
 ///
 /// @post The pika runtime is resumed when this function is called and suspended when the call
 /// terminates.
@@ -68,9 +68,9 @@ DLAF_EXTERN_C int dlaf_inverse_from_cholesky_factor_z(
 /// @param n order of the submatrix \f$\mathbf{A}\f$ used in the computation
 /// @param a Local part of the global matrix \f$\mathbf{A}\f$
 /// @param ia row index of the global matrix \f$\mathbf{A}\f$ identifying the first row of the submatrix
-/// \f$\mathbf{A}\f$, has to be 1
+/// \f$\mathbf{A}\f$
 /// @param ja column index of the global matrix \f$\mathbf{A}\f$ identifying the first column of the
-/// submatrix \f$\mathbf{A}\f$, has to be 1
+/// submatrix \f$\mathbf{A}\f$
 /// @param desca ScaLAPACK array descriptor of the global matrix \f$\mathbf{A}\f$
 /// @param[out] info 0 if the inversion completed normally
 DLAF_EXTERN_C void dlaf_pspotri(const char uplo, const int n, float* a, const int ia, const int ja,
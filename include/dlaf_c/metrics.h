@@ -0,0 +1,45 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+/// @file
+
+#include <stddef.h>
+
+#include <dlaf_c/utils.h>
+
+/// DLA-Future metrics of the calling rank
+///
+/// Metrics are counted only if enabled with the DLA-Future option --dlaf:metrics (or the environment
+/// variable DLAF_METRICS=1). See dlaf::Metrics for the details of what is counted.
+struct DLAF_metrics {
+  double flops;                ///< Floating point operations of the tile kernels
+  size_t bytes_sent_row;       ///< Bytes sent in the row communicators of the grids
+  size_t bytes_sent_col;       ///< Bytes sent in the column communicators of the grids
+  size_t bytes_sent_full;      ///< Bytes sent in the full communicators of the grids
+  size_t bytes_received_row;   ///< Bytes received in the row communicators of the grids
+  size_t bytes_received_col;   ///< Bytes received in the column communicators of the grids
+  size_t bytes_received_full;  ///< Bytes received in the full communicators of the grids
+  size_t bytes_allocated;      ///< Bytes allocated by DLA-Future
+};
+
+/// Get the metrics accumulated by the calling rank since DLA-Future initialization (or since the last
+/// call to dlaf_reset_metrics)
+///
+/// @remark The metrics include all the operations of the DLA-Future calls already returned
+///
+/// @return DLA-Future metrics
+DLAF_EXTERN_C struct DLAF_metrics dlaf_get_metrics() DLAF_NOEXCEPT;
+
+/// Set the metrics of the calling rank to zero
+///
+/// @pre Must be called between DLA-Future calls
+DLAF_EXTERN_C void dlaf_reset_metrics() DLAF_NOEXCEPT;
@@ -0,0 +1,202 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <blas.hh>
+
+#include <dlaf/common/format_short.h>
+#include <dlaf/common/single_threaded_blas.h>
+#include <dlaf/common/timer.h>
+#include <dlaf/eigensolver/tridiag_solver/coltype.h>
+#include <dlaf/eigensolver/tridiag_solver/merge.h>
+#include <dlaf/eigensolver/tridiag_solver/rot.h>
+#include <dlaf/miniapp/dispatch.h>
+#include <dlaf/miniapp/kernel_runner.h>
+#include <dlaf/miniapp/options.h>
+#include <dlaf/types.h>
+#include <dlaf/util_math.h>
+
+using namespace dlaf;
+using namespace dlaf::miniapp;
+using namespace dlaf::eigensolver::internal;
+
+// Benchmark of the deflation step of the tridiagonal D&C merge and of the application of the resulting
+// Givens rotations to the eigenvectors.
+// The deflation is computed sequentially and with the chunked algorithm (`count` chunks whose
+// speculative deflation runs on `nparallel` threads), while the Givens rotations are applied column by
+// column and in blocks of rows (`count` blocks of rows rotated on `nparallel` threads).
+struct Options : MiniappKernelOptions<SupportReal::Yes, SupportComplex::No> {
+  SizeType n;
+  SizeType cluster_size;
+
+  Options(const pika::program_options::variables_map& vm)
+      : MiniappKernelOptions(vm), n(vm["n"].as<SizeType>()),
+        cluster_size(vm["cluster-size"].as<SizeType>()) {
+    DLAF_ASSERT(n > 0, n);
+    DLAF_ASSERT(cluster_size > 0, cluster_size);
+    DLAF_ASSERT(count <= n, count, n);
+  }
+
+  Options(Options&&) = default;
+  Options(const Options&) = default;
+  Options& operator=(Options&&) = default;
+  Options& operator=(const Options&) = default;
+};
+
+struct Test {
+  template <Backend backend, class T>
+  static void run(const Options& opts) {
+    if constexpr (backend != Backend::MC) {
+      DLAF_UNIMPLEMENTED(backend);
+    }
+    else {
+      const SizeType n = opts.n;
+      const T rho = T(1);
+      const T tol = T(8) * std::numeric_limits<T>::epsilon() * T(n);
+
+      // The elements are stored in reverse order with respect to the sorted one.
+      std::vector<SizeType> index(to_sizet(n));
+      std::iota(index.rbegin(), index.rend(), 0);
+
+      // Clusters of `cluster_size` nearly equal values of `d` (which lead to Givens rotations) and some
+      // values of `z` nearly zero.
+      std::vector<T> d_ref(to_sizet(n));
+      std::vector<T> z_ref(to_sizet(n));
+      std::vector<ColType> c_ref(to_sizet(n));
+      for (SizeType i = 0; i < n; ++i) {
+        const std::size_t is = to_sizet(index[to_sizet(i)]);
+        d_ref[is] = T(i / opts.cluster_size) + tol * T(i % opts.cluster_size) / T(4);
+        z_ref[is] = (i % 17 == 0) ? T(0) : T(1) / std::sqrt(T(n)) * (T(1) + T(i % 3) / T(10));
+        c_ref[is] = (i < n / 2) ? ColType::UpperHalf : ColType::LowerHalf;
+      }
+
+      std::vector<T> q_ref(to_sizet(n * n));
+      for (std::size_t i = 0; i < q_ref.size(); ++i)
+        q_ref[i] = T(i % 101) / T(101);
+
+      KernelRunner<backend> runner(opts.count, opts.nparallel);
+
+      for (SizeType run_index = 0; run_index < opts.nruns; ++run_index) {
+        // Sequential deflation
+        std::vector<T> d_seq = d_ref;
+        std::vector<T> z_seq = z_ref;
+        std::vector<ColType> c_seq = c_ref;
+
+        dlaf::common::Timer<> timeit_seq;
+        const auto rots =
+            applyDeflationToArrays(rho, tol, n, index.data(), d_seq.data(), z_seq.data(), c_seq.data());
+        const double elapsed_seq = timeit_seq.elapsed();
+
+        // Chunked deflation
+        std::vector<T> d_chunked = d_ref;
+        std::vector<T> z_chunked = z_ref;
+        std::vector<ColType> c_chunked = c_ref;
+        auto chunks = initDeflationChunks<T>(n, to_sizet(opts.count));
+
+        auto speculate = [&](SizeType i) {
+          speculateDeflation(rho, tol, index.data(), d_chunked.data(), z_chunked.data(),
+                             c_chunked.data(), chunks[to_sizet(i)]);
+        };
+        const double elapsed_speculate = runner.run(speculate) * static_cast<double>(opts.count);
+
+        dlaf::common::Timer<> timeit_resolve;
+        const auto rots_chunked = resolveDeflation(rho, tol, index.data(), d_chunked.data(),
+                                                   z_chunked.data(), c_chunked.data(), chunks);
+        const double elapsed_resolve = timeit_resolve.elapsed();
+
+        // Givens rotations applied column by column (one `rot` per rotation)
+        std::vector<T> q_col = q_ref;
+
+        dlaf::common::Timer<> timeit_col;
+        {
+          dlaf::common::internal::SingleThreadedBlasScope single;
+          for (const auto& rot : rots)
+            blas::rot(n, q_col.data() + rot.i * n, 1, q_col.data() + rot.j * n, 1, rot.c, rot.s);
+        }
+        const double elapsed_col = timeit_col.elapsed();
+
+        // Givens rotations fused and applied in blocks of rows
+        std::vector<T> q_row = q_ref;
+        const SizeType mb = util::ceilDiv(n, to_SizeType(opts.count));
+
+        auto rotate_rows = [&](SizeType i) {
+          const SizeType row = std::min(i * mb, n);
+          applyGivensRotationsToRows(std::min(mb, n - row), rots, [&q_row, n, row](const SizeType j) {
+            return q_row.data() + row + j * n;
+          });
+        };
+        const double elapsed_row = runner.run(rotate_rows) * static_cast<double>(opts.count);
+
+        // Each rotation reads and writes two columns
+        const double rot_bandw = 4. * static_cast<double>(n * to_SizeType(rots.size())) * sizeof(T);
+
+        std::cout << "[" << run_index << "]"
+                  << " deflation " << elapsed_seq << "s (sequential) "
+                  << elapsed_speculate + elapsed_resolve << "s (chunked: " << elapsed_speculate
+                  << "s speculate, " << elapsed_resolve << "s resolve) rotations " << elapsed_col
+                  << "s " << rot_bandw / elapsed_col / 1e9 << "GB/s (by column) " << elapsed_row
+                  << "s " << rot_bandw / elapsed_row / 1e9 << "GB/s (by rows) "
+                  << dlaf::internal::FormatShort{opts.type} << " " << n << " " << opts.cluster_size
+                  << " " << rots.size() << " " << opts.count << " " << opts.nparallel << " " << backend
+                  << std::endl;
+
+        if ((opts.do_check == dlaf::miniapp::CheckIterFreq::Last && run_index == (opts.nruns - 1)) ||
+            opts.do_check == dlaf::miniapp::CheckIterFreq::All) {
+          const bool deflation_ok = d_seq == d_chunked && z_seq == z_chunked && c_seq == c_chunked &&
+                                    rots.size() == rots_chunked.size();
+
+          T error = 0;
+          for (std::size_t i = 0; i < q_col.size(); ++i)
+            error = std::max(error, std::abs(q_col[i] - q_row[i]));
+          error /= std::numeric_limits<T>::epsilon();
+
+          if (!deflation_ok || error > 1)
+            std::cout << "CHECK FAILED!!!: ";
+
+          std::cout << "chunked deflation " << (deflation_ok ? "matches" : "differs")
+                    << ", max | rot_by_rows - rot_by_column | / eps: " << error << std::endl;
+        }
+      }
+    }
+  }
+};
+
+int main(int argc, char** argv) {
+  // options
+  using namespace pika::program_options;
+  options_description desc_commandline("Usage: miniapp_tridiag_deflation [options]");
+  desc_commandline.add(getMiniappKernelOptionsDescription());
+
+  // clang-format off
+  desc_commandline.add_options()
+    ("n",            value<SizeType>() ->default_value(4096), "Size of the merged problem")
+    ("cluster-size", value<SizeType>() ->default_value(   4), "Number of nearly equal eigenvalues per cluster")
+  ;
+  // clang-format on
+
+  variables_map vm;
+  store(parse_command_line(argc, argv, desc_commandline), vm);
+  notify(vm);
+  if (vm.count("help")) {
+    std::cout << desc_commandline << "\n";
+    return 1;
+  }
+  Options options(vm);
+
+  dispatchMiniapp<Test>(options);
+
+  return 0;
+}
@@ -0,0 +1,201 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Compares the time to solution of the C API Cholesky factorization and eigensolver when running on
+// the caller's layout and on the layout chosen by DLA-Future (see
+// dlaf::TuneParameters::c_api_auto_layout). The auto-tuned layout time includes the redistribution of
+// the matrices in and out.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include <pika/program_options.hpp>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/common/timer.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/error.h>
+#include <dlaf/communication/init.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
+#include <dlaf_c/desc.h>
+#include <dlaf_c/eigensolver/eigensolver.h>
+#include <dlaf_c/factorization/cholesky.h>
+#include <dlaf_c/grid.h>
+#include <dlaf_c/init.h>
+
+namespace {
+
+using dlaf::Coord;
+using dlaf::SizeType;
+
+// Sets the local part of a diagonally dominant (thus positive definite) symmetric matrix.
+void set_matrix(const dlaf::matrix::Distribution& dist, std::vector<double>& a, const SizeType lld) {
+  const SizeType n = dist.size().rows();
+  for (SizeType j_lc = 0; j_lc < dist.local_size().cols(); ++j_lc) {
+    const SizeType j = dist.global_element_from_local_element<Coord::Col>(j_lc);
+    for (SizeType i_lc = 0; i_lc < dist.local_size().rows(); ++i_lc) {
+      const SizeType i = dist.global_element_from_local_element<Coord::Row>(i_lc);
+      a[static_cast<std::size_t>(i_lc + j_lc * lld)] =
+          (i == j) ? static_cast<double>(n) : 1. / static_cast<double>(1 + i + j);
+    }
+  }
+}
+
+// Returns the maximum absolute difference between the elements of a and b over all the ranks.
+double max_diff(const std::vector<double>& a, const std::vector<double>& b) {
+  double diff = 0;
+  for (std::size_t i = 0; i < a.size(); ++i)
+    diff = std::max(diff, std::abs(a[i] - b[i]));
+
+  DLAF_MPI_CHECK_ERROR(MPI_Allreduce(MPI_IN_PLACE, &diff, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD));
+  return diff;
+}
+}
+
+int main(int argc, char** argv) {
+  dlaf::comm::mpi_init mpi_initter(argc, argv);
+
+  using namespace pika::program_options;
+  options_description desc_commandline(
+      "Usage: miniapp_c_api_auto_layout [options] [pika and DLA-Future options]");
+
+  // clang-format off
+  desc_commandline.add_options()
+    ("help",        "Print help message")
+    ("matrix-size", value<SizeType>()   ->default_value(1024), "Matrix size")
+    ("block-size",  value<SizeType>()   ->default_value(  16), "Block cyclic distribution size of the caller's layout")
+    ("grid-rows",   value<int>()        ->default_value(   1), "Number of row processes in the 2D communicator of the caller's layout")
+    ("grid-cols",   value<int>()        ->default_value(   1), "Number of column processes in the 2D communicator of the caller's layout")
+    ("algorithm",   value<std::string>()->default_value("all"), "Algorithm to benchmark: cholesky, eigensolver or all")
+    ("nruns",       value<SizeType>()   ->default_value(   1), "Number of runs")
+    ("nwarmups",    value<SizeType>()   ->default_value(   1), "Number of warmup runs")
+  ;
+  // clang-format on
+
+  // Options not recognized by the miniapp are forwarded to pika and DLA-Future.
+  auto parsed = command_line_parser(argc, argv).options(desc_commandline).allow_unregistered().run();
+  variables_map vm;
+  store(parsed, vm);
+  notify(vm);
+
+  dlaf::comm::Communicator world(MPI_COMM_WORLD);
+
+  if (vm.count("help")) {
+    if (world.rank() == 0)
+      std::cout << desc_commandline << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  const std::vector<std::string> forwarded_args =
+      collect_unrecognized(parsed.options, include_positional);
+  std::vector<const char*> forwarded_argv{argv[0]};
+  for (const auto& arg : forwarded_args)
+    forwarded_argv.push_back(arg.c_str());
+  const int forwarded_argc = static_cast<int>(forwarded_argv.size());
+
+  const SizeType m = vm["matrix-size"].as<SizeType>();
+  const SizeType mb = vm["block-size"].as<SizeType>();
+  const int grid_rows = vm["grid-rows"].as<int>();
+  const int grid_cols = vm["grid-cols"].as<int>();
+  const std::string algorithm = vm["algorithm"].as<std::string>();
+  const SizeType nruns = vm["nruns"].as<SizeType>();
+  const SizeType nwarmups = vm["nwarmups"].as<SizeType>();
+
+  DLAF_ASSERT(algorithm == "cholesky" || algorithm == "eigensolver" || algorithm == "all", algorithm);
+
+  dlaf_initialize(forwarded_argc, forwarded_argv.data(), forwarded_argc, forwarded_argv.data());
+
+  const int dlaf_context = dlaf_create_grid(MPI_COMM_WORLD, grid_rows, grid_cols, 'R');
+
+  const dlaf::comm::Index2D rank(world.rank() / grid_cols, world.rank() % grid_cols);
+  const dlaf::matrix::Distribution dist(dlaf::GlobalElementSize(m, m), dlaf::TileElementSize(mb, mb),
+                                        dlaf::comm::Size2D(grid_rows, grid_cols), rank,
+                                        dlaf::comm::Index2D(0, 0));
+  const SizeType lld = std::max<SizeType>(1, dist.local_size().rows());
+  const auto local_nr_elements =
+      static_cast<std::size_t>(std::max<SizeType>(1, lld * dist.local_size().cols()));
+
+  const DLAF_descriptor desc{static_cast<int>(m), static_cast<int>(m), static_cast<int>(mb),
+                             static_cast<int>(mb), 0, 0, 0, 0, static_cast<int>(lld)};
+
+  // Runs the benchmark of the given C API call in both layout modes and checks that the results match.
+  auto benchmark = [&](const std::string& name, auto&& call) {
+    std::vector<double> results[2];
+    for (const bool auto_layout : {false, true}) {
+      dlaf::getTuneParameters().c_api_auto_layout = auto_layout;
+
+      double total_time = 0;
+      for (SizeType run_index = -nwarmups; run_index < nruns; ++run_index) {
+        std::vector<double> result;
+
+        DLAF_MPI_CHECK_ERROR(MPI_Barrier(MPI_COMM_WORLD));
+        dlaf::common::Timer<> timeit;
+        call(result);
+        DLAF_MPI_CHECK_ERROR(MPI_Barrier(MPI_COMM_WORLD));
+        const double elapsed_time = timeit.elapsed();
+
+        if (run_index >= 0)
+          total_time += elapsed_time;
+        results[auto_layout] = std::move(result);
+      }
+
+      if (world.rank() == 0 && nruns > 0) {
+        std::cout << name << " C API " << m << " " << mb << " (" << grid_rows << ", " << grid_cols
+                  << ") " << (auto_layout ? "auto-tuned" : "native") << " layout: "
+                  << total_time / static_cast<double>(nruns) << "s" << std::endl;
+      }
+    }
+    dlaf::getTuneParameters().c_api_auto_layout = false;
+
+    const double diff = max_diff(results[0], results[1]);
+    if (world.rank() == 0)
+      std::cout << name << " max diff native vs auto-tuned: " << diff << std::endl;
+  };
+
+  if (algorithm == "cholesky" || algorithm == "all") {
+    benchmark("Cholesky", [&](std::vector<double>& a) {
+      a.resize(local_nr_elements);
+      set_matrix(dist, a, lld);
+      dlaf_cholesky_factorization_d(dlaf_context, 'L', a.data(), desc);
+
+      // Only the lower triangle is referenced
+      for (SizeType j_lc = 0; j_lc < dist.local_size().cols(); ++j_lc) {
+        const SizeType j = dist.global_element_from_local_element<Coord::Col>(j_lc);
+        for (SizeType i_lc = 0; i_lc < dist.local_size().rows(); ++i_lc) {
+          if (dist.global_element_from_local_element<Coord::Row>(i_lc) < j)
+            a[static_cast<std::size_t>(i_lc + j_lc * lld)] = 0;
+        }
+      }
+    });
+  }
+
+  if (algorithm == "eigensolver" || algorithm == "all") {
+    benchmark("Eigensolver", [&](std::vector<double>& w) {
+      std::vector<double> a(local_nr_elements);
+      std::vector<double> z(local_nr_elements);
+      w.resize(static_cast<std::size_t>(std::max<SizeType>(1, m)));
+      set_matrix(dist, a, lld);
+      dlaf_symmetric_eigensolver_d(dlaf_context, 'L', a.data(), desc, w.data(), z.data(), desc);
+    });
+  }
+
+  dlaf_free_grid(dlaf_context);
+  dlaf_finalize();
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,146 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Measures the per-call overhead of the C API on problems small enough that the runtime
+// resume/suspend latency is a significant fraction of the time to solution.
+// The miniapp should be run with and without --dlaf:c-api-persistent-runtime to compare the two modes.
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include <pika/program_options.hpp>
+
+#include <dlaf/common/timer.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/error.h>
+#include <dlaf/communication/init.h>
+#include <dlaf/init.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/types.h>
+#include <dlaf_c/desc.h>
+#include <dlaf_c/factorization/cholesky.h>
+#include <dlaf_c/grid.h>
+#include <dlaf_c/init.h>
+
+namespace {
+
+using dlaf::Coord;
+using dlaf::SizeType;
+
+// Sets the local part of a diagonally dominant (thus positive definite) symmetric matrix.
+void set_matrix(const dlaf::matrix::Distribution& dist, std::vector<double>& a, const SizeType lld) {
+  const SizeType n = dist.size().rows();
+  for (SizeType j_lc = 0; j_lc < dist.local_size().cols(); ++j_lc) {
+    const SizeType j = dist.global_element_from_local_element<Coord::Col>(j_lc);
+    for (SizeType i_lc = 0; i_lc < dist.local_size().rows(); ++i_lc) {
+      const SizeType i = dist.global_element_from_local_element<Coord::Row>(i_lc);
+      a[static_cast<std::size_t>(i_lc + j_lc * lld)] = (i == j) ? static_cast<double>(n) : 0.5;
+    }
+  }
+}
+}
+
+int main(int argc, char** argv) {
+  dlaf::comm::mpi_init mpi_initter(argc, argv);
+
+  using namespace pika::program_options;
+  options_description desc_commandline(
+      "Usage: miniapp_c_api_overhead [options] [pika and DLA-Future options]");
+
+  // clang-format off
+  desc_commandline.add_options()
+    ("help",        "Print help message")
+    ("matrix-size", value<SizeType>()->default_value(64), "Matrix size")
+    ("block-size",  value<SizeType>()->default_value(32), "Block cyclic distribution size")
+    ("grid-rows",   value<int>()     ->default_value( 1), "Number of row processes in the 2D communicator")
+    ("grid-cols",   value<int>()     ->default_value( 1), "Number of column processes in the 2D communicator")
+    ("nruns",       value<SizeType>()->default_value(1000), "Number of runs")
+    ("nwarmups",    value<SizeType>()->default_value(10), "Number of warmup runs")
+  ;
+  // clang-format on
+
+  // Options not recognized by the miniapp are forwarded to pika and DLA-Future.
+  auto parsed = command_line_parser(argc, argv).options(desc_commandline).allow_unregistered().run();
+  variables_map vm;
+  store(parsed, vm);
+  notify(vm);
+
+  dlaf::comm::Communicator world(MPI_COMM_WORLD);
+
+  if (vm.count("help")) {
+    if (world.rank() == 0)
+      std::cout << desc_commandline << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  const std::vector<std::string> forwarded_args =
+      collect_unrecognized(parsed.options, include_positional);
+  std::vector<const char*> forwarded_argv{argv[0]};
+  for (const auto& arg : forwarded_args)
+    forwarded_argv.push_back(arg.c_str());
+  const int forwarded_argc = static_cast<int>(forwarded_argv.size());
+
+  const SizeType m = vm["matrix-size"].as<SizeType>();
+  const SizeType mb = vm["block-size"].as<SizeType>();
+  const int grid_rows = vm["grid-rows"].as<int>();
+  const int grid_cols = vm["grid-cols"].as<int>();
+  const SizeType nruns = vm["nruns"].as<SizeType>();
+  const SizeType nwarmups = vm["nwarmups"].as<SizeType>();
+
+  dlaf_initialize(forwarded_argc, forwarded_argv.data(), forwarded_argc, forwarded_argv.data());
+  const bool persistent = dlaf::internal::getConfiguration().c_api_persistent_runtime;
+
+  const int dlaf_context = dlaf_create_grid(MPI_COMM_WORLD, grid_rows, grid_cols, 'R');
+
+  const dlaf::comm::Index2D rank(world.rank() / grid_cols, world.rank() % grid_cols);
+  const dlaf::matrix::Distribution dist(dlaf::GlobalElementSize(m, m), dlaf::TileElementSize(mb, mb),
+                                        dlaf::comm::Size2D(grid_rows, grid_cols), rank,
+                                        dlaf::comm::Index2D(0, 0));
+  const SizeType lld = std::max<SizeType>(1, dist.local_size().rows());
+  const SizeType local_nr_elements = std::max<SizeType>(1, lld * dist.local_size().cols());
+  std::vector<double> a(static_cast<std::size_t>(local_nr_elements));
+
+  const DLAF_descriptor desc_a{static_cast<int>(m), static_cast<int>(m), static_cast<int>(mb),
+                               static_cast<int>(mb), 0, 0, 0, 0, static_cast<int>(lld)};
+
+  double total_time = 0;
+  double min_time = 0;
+  for (SizeType run_index = -nwarmups; run_index < nruns; ++run_index) {
+    set_matrix(dist, a, lld);
+
+    DLAF_MPI_CHECK_ERROR(MPI_Barrier(MPI_COMM_WORLD));
+    dlaf::common::Timer<> timeit;
+    dlaf_cholesky_factorization_d(dlaf_context, 'L', a.data(), desc_a);
+    DLAF_MPI_CHECK_ERROR(MPI_Barrier(MPI_COMM_WORLD));
+    const double elapsed_time = timeit.elapsed();
+
+    if (run_index >= 0) {
+      total_time += elapsed_time;
+      min_time = (run_index == 0) ? elapsed_time : std::min(min_time, elapsed_time);
+    }
+  }
+
+  if (world.rank() == 0 && nruns > 0) {
+    std::cout << "Cholesky C API " << m << " " << mb << " (" << grid_rows << ", " << grid_cols
+              << ") " << (persistent ? "persistent" : "resume/suspend") << " runtime: "
+              << total_time / static_cast<double>(nruns) << "s per call (min " << min_time << "s)"
+              << std::endl;
+  }
+
+  dlaf_free_grid(dlaf_context);
+  dlaf_finalize();
+
+  return EXIT_SUCCESS;
+}
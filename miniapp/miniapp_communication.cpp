@@ -8,11 +8,15 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <numeric>
+#include <random>
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <blas/util.hh>
 #include <mpi.h>
@@ -24,7 +28,9 @@
 #include <dlaf/auxiliary/norm.h>
 #include <dlaf/blas/tile.h>
 #include <dlaf/common/format_short.h>
+#include <dlaf/common/round_robin.h>
 #include <dlaf/common/timer.h>
+#include <dlaf/communication/broadcast_panel.h>
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/communication/error.h>
 #include <dlaf/communication/init.h>
@@ -39,8 +45,11 @@
 #include <dlaf/init.h>
 #include <dlaf/matrix/copy.h>
 #include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/panel.h>
 #include <dlaf/miniapp/dispatch.h>
 #include <dlaf/miniapp/options.h>
+#include <dlaf/permutations/general.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
 #include <dlaf/util_matrix.h>
 
@@ -48,8 +57,12 @@ namespace {
 using pika::execution::experimental::start_detached;
 
 using dlaf::Backend;
+using dlaf::Coord;
 using dlaf::DefaultDevice_v;
 using dlaf::Device;
+using dlaf::GlobalElementIndex;
+using dlaf::GlobalElementSize;
+using dlaf::GlobalTileIndex;
 using dlaf::LocalElementSize;
 using dlaf::LocalTileIndex;
 using dlaf::Matrix;
@@ -68,11 +81,17 @@ struct Options
     : dlaf::miniapp::MiniappOptions<dlaf::miniapp::SupportReal::Yes, dlaf::miniapp::SupportComplex::Yes> {
   SizeType m;
   SizeType mb;
+  SizeType permutations_num_tiles;
+  SizeType broadcast_panel_max_bytes;
 
   Options(const pika::program_options::variables_map& vm)
-      : MiniappOptions(vm), m(vm["matrix-size"].as<SizeType>()), mb(vm["block-size"].as<SizeType>()) {
+      : MiniappOptions(vm), m(vm["matrix-size"].as<SizeType>()), mb(vm["block-size"].as<SizeType>()),
+        permutations_num_tiles(vm["permutations-num-tiles"].as<SizeType>()),
+        broadcast_panel_max_bytes(vm["broadcast-panel-max-bytes"].as<SizeType>()) {
     DLAF_ASSERT(m > 0, m);
     DLAF_ASSERT(mb > 0, mb);
+    DLAF_ASSERT(permutations_num_tiles > 0, permutations_num_tiles);
+    DLAF_ASSERT(broadcast_panel_max_bytes > 0, broadcast_panel_max_bytes);
   }
 
   Options(Options&&) = default;
@@ -474,6 +493,126 @@ void benchmark_internal_reduce(int64_t run_index, const Options& opts, Communica
   output(run_index, std::move(s), t, world.rank(), opts, pcomm.size_2d());
 }
 
+// Benchmarks the distributed permutation of the rows or columns (depending on C) of the whole matrix.
+// If num_tiles > 0 the permutation is pipelined in chunks of num_tiles tiles, otherwise all the
+// tiles are packed, communicated and unpacked at once.
+template <Backend B, Coord C, class T>
+void benchmark_permutations(int64_t run_index, const Options& opts, Communicator& world,
+                            CommunicatorGrid& comm_grid, const SizeType num_tiles) {
+  constexpr Device D = DefaultDevice_v<B>;
+  if constexpr (B != Backend::MC || dlaf::isComplex_v<T>) {
+    // Skip benchmark, distributed permutations are available only on CPU for real types.
+    return;
+  }
+  else {
+    const GlobalElementSize size(opts.m, opts.m);
+    const TileElementSize block_size(opts.mb, opts.mb);
+
+    // The same (pseudo-random) permutation is generated on all ranks
+    std::vector<SizeType> perm(dlaf::to_sizet(opts.m));
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), std::mt19937(42));
+
+    Matrix<SizeType, D> perms(LocalElementSize(opts.m, 1), TileElementSize(opts.mb, 1));
+    dlaf::matrix::util::set(perms, [&perm](const GlobalElementIndex& i) {
+      return perm[dlaf::to_sizet(i.row())];
+    });
+    Matrix<T, D> mat_in(size, block_size, comm_grid);
+    dlaf::matrix::util::set_random(mat_in);
+    Matrix<T, D> mat_out(size, block_size, comm_grid);
+    perms.waitLocalTiles();
+    mat_in.waitLocalTiles();
+    mat_out.waitLocalTiles();
+
+    auto& tune_parameters = dlaf::getTuneParameters();
+    const SizeType num_tiles_default = tune_parameters.permutations_pipeline_num_tiles;
+    tune_parameters.permutations_pipeline_num_tiles = num_tiles;
+
+    DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+    dlaf::common::Timer<> timeit;
+
+    dlaf::permutations::permute<B, D, T, C>(comm_grid, 0, mat_in.nrTiles().template get<C>(), perms,
+                                            mat_in, mat_out);
+
+    mat_out.waitLocalTiles();
+    comm_grid.wait_all_communicators();
+    DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+    auto t = timeit.elapsed();
+
+    tune_parameters.permutations_pipeline_num_tiles = num_tiles_default;
+
+    std::stringstream s;
+    s << "Permutations " << (C == Coord::Col ? "cols" : "rows") << " " << D;
+    if (num_tiles > 0)
+      s << " pipelined(" << num_tiles << ")";
+    else
+      s << " bulk";
+    output(run_index, s.str(), t, world.rank(), opts, comm_grid.size());
+  }
+}
+
+// Benchmarks the broadcast along the rows of the grid of the column panels of the whole matrix.
+// If max_bytes > 0 the local tiles of panels up to max_bytes bytes are broadcast with a single
+// collective, otherwise each tile is broadcast separately.
+template <Backend B, class T>
+void benchmark_broadcast_panel(int64_t run_index, const Options& opts, Communicator& world,
+                               CommunicatorGrid& comm_grid, const SizeType max_bytes) {
+  constexpr Device D = DefaultDevice_v<B>;
+  if constexpr (B != Backend::MC) {
+    // Skip benchmark, the aggregated panel broadcast is available only on CPU.
+    return;
+  }
+  else {
+    const GlobalElementSize size(opts.m, opts.m);
+    const TileElementSize block_size(opts.mb, opts.mb);
+
+    Matrix<T, D> matrix(size, block_size, comm_grid);
+    dlaf::matrix::util::set_random(matrix);
+    matrix.waitLocalTiles();
+
+    const dlaf::matrix::Distribution& dist = matrix.distribution();
+    dlaf::common::RoundRobin<dlaf::matrix::Panel<Coord::Col, T, D>> panels(2, dist);
+    auto row_comm = comm_grid.row_communicator_pipeline();
+
+    auto& tune_parameters = dlaf::getTuneParameters();
+    const SizeType max_bytes_default = tune_parameters.broadcast_panel_aggregate_max_bytes;
+    tune_parameters.broadcast_panel_aggregate_max_bytes = max_bytes;
+
+    DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+    dlaf::common::Timer<> timeit;
+
+    for (SizeType k = 0; k < dist.nrTiles().cols(); ++k) {
+      auto& panel = panels.nextResource();
+      panel.setRangeStart(GlobalTileIndex(0, k));
+
+      const auto rank_root = dist.rankGlobalTile<Coord::Col>(k);
+      if (rank_root == dist.rankIndex().col()) {
+        const SizeType j = dist.localTileFromGlobalTile<Coord::Col>(k);
+        for (const auto& index : panel.iteratorLocal())
+          panel.setTile(index, matrix.read(LocalTileIndex(index.row(), j)));
+      }
+      dlaf::comm::broadcast(rank_root, panel, row_comm);
+
+      panel.reset();
+    }
+
+    matrix.waitLocalTiles();
+    comm_grid.wait_all_communicators();
+    DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+    auto t = timeit.elapsed();
+
+    tune_parameters.broadcast_panel_aggregate_max_bytes = max_bytes_default;
+
+    std::stringstream s;
+    s << "BroadcastPanel " << D;
+    if (max_bytes > 0)
+      s << " aggregated(" << max_bytes << ")";
+    else
+      s << " per-tile";
+    output(run_index, s.str(), t, world.rank(), opts, comm_grid.size());
+  }
+}
+
 struct communicationMiniapp {
   template <Backend B, typename T>
   static void run(const Options& opts) {
@@ -572,6 +711,17 @@ struct communicationMiniapp {
       benchmark_internal_reduce<Device::GPU, B>(run_index, opts, world,
                                                 comm_grid.full_communicator_pipeline(), matrix_ref);
 #endif
+
+      benchmark_permutations<B, Coord::Col, T>(run_index, opts, world, comm_grid, 0);
+      benchmark_permutations<B, Coord::Col, T>(run_index, opts, world, comm_grid,
+                                               opts.permutations_num_tiles);
+      benchmark_permutations<B, Coord::Row, T>(run_index, opts, world, comm_grid, 0);
+      benchmark_permutations<B, Coord::Row, T>(run_index, opts, world, comm_grid,
+                                               opts.permutations_num_tiles);
+
+      benchmark_broadcast_panel<B, T>(run_index, opts, world, comm_grid, 0);
+      benchmark_broadcast_panel<B, T>(run_index, opts, world, comm_grid,
+                                      opts.broadcast_panel_max_bytes);
     }
   }
 };
@@ -600,6 +750,8 @@ int main(int argc, char** argv) {
   desc_commandline.add_options()
     ("matrix-size", value<SizeType>()   ->default_value(4096), "Matrix size")
     ("block-size",  value<SizeType>()   ->default_value( 256), "Block cyclic distribution size")
+    ("permutations-num-tiles", value<SizeType>() ->default_value(1), "Number of tiles per chunk in the pipelined permutations benchmark")
+    ("broadcast-panel-max-bytes", value<SizeType>() ->default_value(1 << 24), "Maximum number of bytes of the aggregated broadcast in the panel broadcast benchmark")
   ;
   // clang-format on
 
@@ -0,0 +1,261 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+// Solves a batch of independent small eigenvalue problems on each rank (e.g. one per k-point) and
+// reports the aggregate throughput.
+// With --sequential each problem is waited for before scheduling the next one, which allows to compare
+// with the batched API, where all the problems are scheduled together.
+
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <pika/init.hpp>
+#include <pika/program_options.hpp>
+#include <pika/runtime.hpp>
+
+#include <dlaf/auxiliary/norm.h>
+#include <dlaf/common/format_short.h>
+#include <dlaf/common/index2d.h>
+#include <dlaf/common/timer.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/init.h>
+#include <dlaf/eigensolver/eigensolver.h>
+#include <dlaf/eigensolver/internal/get_band_size.h>
+#include <dlaf/init.h>
+#include <dlaf/matrix/copy.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/miniapp/dispatch.h>
+#include <dlaf/miniapp/options.h>
+#include <dlaf/miniapp/scale_eigenvectors.h>
+#include <dlaf/multiplication/hermitian.h>
+#include <dlaf/types.h>
+
+namespace {
+using dlaf::Backend;
+using dlaf::BaseType;
+using dlaf::DefaultDevice_v;
+using dlaf::Device;
+using dlaf::EigensolverResult;
+using dlaf::GlobalElementSize;
+using dlaf::Matrix;
+using dlaf::SizeType;
+using dlaf::TileElementSize;
+using dlaf::comm::Communicator;
+using dlaf::comm::CommunicatorGrid;
+using dlaf::common::Ordering;
+using dlaf::matrix::MatrixMirror;
+using pika::this_thread::experimental::sync_wait;
+
+/// Check results of the eigensolver
+template <typename T>
+void checkEigensolver(CommunicatorGrid& comm_grid, blas::Uplo uplo, Matrix<const T, Device::CPU>& A,
+                      Matrix<const BaseType<T>, Device::CPU>& evalues, Matrix<const T, Device::CPU>& E);
+
+struct Options
+    : dlaf::miniapp::MiniappOptions<dlaf::miniapp::SupportReal::Yes, dlaf::miniapp::SupportComplex::Yes> {
+  SizeType m;
+  SizeType mb;
+  SizeType batch_size;
+  bool sequential;
+  blas::Uplo uplo;
+
+  Options(const pika::program_options::variables_map& vm)
+      : MiniappOptions(vm), m(vm["matrix-size"].as<SizeType>()), mb(vm["block-size"].as<SizeType>()),
+        batch_size(vm["batch-size"].as<SizeType>()), sequential(vm["sequential"].as<bool>()),
+        uplo(dlaf::miniapp::parseUplo(vm["uplo"].as<std::string>())) {
+    DLAF_ASSERT(m > 0, m);
+    DLAF_ASSERT(mb > 0, mb);
+    DLAF_ASSERT(batch_size > 0, batch_size);
+  }
+
+  Options(Options&&) = default;
+  Options(const Options&) = default;
+  Options& operator=(Options&&) = default;
+  Options& operator=(const Options&) = default;
+};
+}
+
+struct EigensolverBatchedMiniapp {
+  template <Backend backend, typename T>
+  static void run(const Options& opts) {
+    constexpr Device device = DefaultDevice_v<backend>;
+    using MatrixMirrorEvalsType = MatrixMirror<const BaseType<T>, Device::CPU, device>;
+    using MatrixMirrorEvectsType = MatrixMirror<const T, Device::CPU, device>;
+    using HostMatrixType = Matrix<T, Device::CPU>;
+
+    // Each rank solves its own batch of problems: the grid options are ignored.
+    Communicator world(MPI_COMM_WORLD);
+    CommunicatorGrid self_grid(Communicator(MPI_COMM_SELF), 1, 1, Ordering::ColumnMajor);
+
+    HostMatrixType matrix_ref(GlobalElementSize(opts.m, opts.m), TileElementSize(opts.mb, opts.mb),
+                              self_grid);
+    dlaf::matrix::util::set_random_hermitian(matrix_ref);
+
+    const SizeType nr_problems = opts.batch_size * world.size();
+
+    for (int64_t run_index = -opts.nwarmups; run_index < opts.nruns; ++run_index) {
+      if (0 == world.rank() && run_index >= 0)
+        std::cout << "[" << run_index << "]" << std::endl;
+
+      std::vector<Matrix<T, device>> matrices;
+      for (SizeType k = 0; k < opts.batch_size; ++k) {
+        auto& matrix = matrices.emplace_back(matrix_ref.distribution());
+        copy(matrix_ref, matrix);
+        // Wait for matrix to be copied to GPU (if necessary)
+        matrix.waitLocalTiles();
+      }
+      DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+
+      dlaf::common::Timer<> timeit;
+      std::vector<EigensolverResult<T, device>> results;
+      if (opts.sequential) {
+        for (auto& matrix : matrices) {
+          results.emplace_back(dlaf::hermitian_eigensolver<backend>(opts.uplo, matrix));
+          results.back().eigenvectors.waitLocalTiles();
+        }
+      }
+      else {
+        results = dlaf::hermitian_eigensolver_batched<backend>(opts.uplo, matrices);
+      }
+
+      // wait and barrier for all ranks
+      for (auto& result : results)
+        result.eigenvectors.waitLocalTiles();
+      DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+      double elapsed_time = timeit.elapsed();
+
+      const double throughput = static_cast<double>(nr_problems) / elapsed_time;
+
+      // print benchmark results
+      if (0 == world.rank() && run_index >= 0) {
+        std::cout << "[" << run_index << "]" << " " << elapsed_time << "s" << " " << throughput
+                  << "problems/s" << " " << dlaf::internal::FormatShort{opts.type}
+                  << dlaf::internal::FormatShort{opts.uplo} << " " << matrix_ref.size() << " "
+                  << matrix_ref.blockSize() << " "
+                  << dlaf::eigensolver::internal::getBandSize(matrix_ref.blockSize().rows()) << " "
+                  << opts.batch_size << "x" << world.size() << " "
+                  << (opts.sequential ? "sequential" : "batched") << " "
+                  << pika::get_os_thread_count() << " " << backend << std::endl;
+        if (opts.csv_output) {
+          // CSV formatted output with column names that can be read by pandas to simplify
+          // post-processing CSVData{-version}, value_0, title_0, value_1, title_1
+          std::cout << "CSVData-2, "
+                    << "run, " << run_index << ", "
+                    << "time, " << elapsed_time << ", "
+                    << "throughput, " << throughput << ", "
+                    << "type, " << dlaf::internal::FormatShort{opts.type}.value << ", "
+                    << "uplo, " << dlaf::internal::FormatShort{opts.uplo}.value << ", "
+                    << "matrixsize, " << matrix_ref.size().rows() << ", "
+                    << "blocksize, " << matrix_ref.blockSize().rows() << ", "
+                    << "bandsize, "
+                    << dlaf::eigensolver::internal::getBandSize(matrix_ref.blockSize().rows()) << ", "
+                    << "batchsize, " << opts.batch_size << ", "
+                    << "ranks, " << world.size() << ", "
+                    << "sequential, " << opts.sequential << ", "
+                    << "threads, " << pika::get_os_thread_count() << ", "
+                    << "backend, " << backend << ", " << opts.info << std::endl;
+        }
+      }
+      // (optional) run test
+      if ((opts.do_check == dlaf::miniapp::CheckIterFreq::Last && run_index == (opts.nruns - 1)) ||
+          opts.do_check == dlaf::miniapp::CheckIterFreq::All) {
+        for (auto& result : results) {
+          MatrixMirrorEvalsType eigenvalues_host(result.eigenvalues);
+          MatrixMirrorEvectsType eigenvectors_host(result.eigenvectors);
+          checkEigensolver<T>(self_grid, opts.uplo, matrix_ref, eigenvalues_host.get(),
+                              eigenvectors_host.get());
+        }
+      }
+    }
+  }
+};
+
+int pika_main(pika::program_options::variables_map& vm) {
+  pika::scoped_finalize pika_finalizer;
+  dlaf::ScopedInitializer init(vm);
+
+  const Options opts(vm);
+  dlaf::miniapp::dispatchMiniapp<EigensolverBatchedMiniapp>(opts);
+
+  return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv) {
+  // Init MPI
+  dlaf::comm::mpi_init mpi_initter(argc, argv);
+
+  // options
+  using namespace pika::program_options;
+  options_description desc_commandline("Usage: miniapp_eigensolver_batched [options]");
+  desc_commandline.add(dlaf::miniapp::getMiniappOptionsDescription());
+  desc_commandline.add(dlaf::getOptionsDescription());
+
+  // clang-format off
+  desc_commandline.add_options()
+    ("matrix-size", value<SizeType>() ->default_value(512), "Matrix size")
+    ("block-size",  value<SizeType>() ->default_value( 64), "Block size")
+    ("batch-size",  value<SizeType>() ->default_value( 16), "Number of problems solved by each rank")
+    ("sequential",  bool_switch()     ->default_value(false), "Wait for each problem before scheduling the next one")
+  ;
+  // clang-format on
+  dlaf::miniapp::addUploOption(desc_commandline);
+
+  pika::init_params p;
+  p.desc_cmdline = desc_commandline;
+  return pika::init(pika_main, argc, argv, p);
+}
+
+namespace {
+using dlaf::comm::Index2D;
+
+/// Procedure to evaluate the result of the Eigensolver
+///
+/// 1. Check the value of | E D - A E | / | A |
+///
+/// Prints a message with the ratio and a note about the error:
+/// "":        check ok
+/// "ERROR":   error is high, there is an error in the results
+/// "WARNING": error is slightly high, there can be an error in the result
+template <typename T>
+void checkEigensolver(CommunicatorGrid& comm_grid, blas::Uplo uplo, Matrix<const T, Device::CPU>& A,
+                      Matrix<const BaseType<T>, Device::CPU>& evalues, Matrix<const T, Device::CPU>& E) {
+  const Index2D rank_result{0, 0};
+
+  // 1. Compute the max norm of A
+  const auto norm_A =
+      sync_wait(dlaf::auxiliary::max_norm<dlaf::Backend::MC>(comm_grid, rank_result, uplo, A));
+
+  // 2.
+  // Compute C = E D - A E
+  Matrix<T, Device::CPU> C(E.distribution());
+  dlaf::miniapp::scaleEigenvectors(evalues, E, C);
+  dlaf::hermitian_multiplication<Backend::MC>(comm_grid, blas::Side::Left, uplo, T{-1}, A, E, T{1}, C);
+
+  // 3. Compute the max norm of the difference
+  const auto norm_diff = sync_wait(dlaf::auxiliary::max_norm<dlaf::Backend::MC>(comm_grid, rank_result,
+                                                                                blas::Uplo::General, C));
+
+  constexpr auto eps = std::numeric_limits<dlaf::BaseType<T>>::epsilon();
+  const auto n = A.size().rows();
+
+  const auto diff_ratio = norm_diff / norm_A;
+
+  if (diff_ratio > 100 * eps * n)
+    std::cout << "ERROR: ";
+  else if (diff_ratio > eps * n)
+    std::cout << "Warning: ";
+
+  std::cout << "Max Diff / Max A: " << diff_ratio << std::endl;
+}
+}
@@ -0,0 +1,300 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <utility>
+
+#include <blas/util.hh>
+#include <mpi.h>
+
+#include <pika/init.hpp>
+#include <pika/program_options.hpp>
+#include <pika/runtime.hpp>
+
+#include <dlaf/auxiliary/norm.h>
+#include <dlaf/common/format_short.h>
+#include <dlaf/common/index2d.h>
+#include <dlaf/common/range2d.h>
+#include <dlaf/common/timer.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/error.h>
+#include <dlaf/communication/init.h>
+#include <dlaf/factorization/qr.h>
+#include <dlaf/init.h>
+#include <dlaf/matrix/copy.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/miniapp/dispatch.h>
+#include <dlaf/miniapp/options.h>
+#include <dlaf/sender/transform.h>
+#include <dlaf/types.h>
+#include <dlaf/util_matrix.h>
+
+namespace {
+
+using pika::execution::experimental::when_all;
+using pika::this_thread::experimental::sync_wait;
+
+using dlaf::Backend;
+using dlaf::Coord;
+using dlaf::DefaultDevice_v;
+using dlaf::Device;
+using dlaf::GlobalElementIndex;
+using dlaf::GlobalElementSize;
+using dlaf::LocalTileIndex;
+using dlaf::Matrix;
+using dlaf::SizeType;
+using dlaf::TileElementSize;
+using dlaf::comm::Communicator;
+using dlaf::comm::CommunicatorGrid;
+using dlaf::comm::Index2D;
+using dlaf::common::Ordering;
+using dlaf::internal::transformDetach;
+using dlaf::matrix::MatrixMirror;
+
+/// Check QR factorization results
+///
+/// Given a matrix A and its QR factorization (stored in @p mat_qr and @p mat_taus),
+/// this function checks that A == Q R
+template <typename T>
+void checkQR(CommunicatorGrid& comm_grid, Matrix<const T, Device::CPU>& A,
+             Matrix<const T, Device::CPU>& mat_qr, Matrix<const T, Device::CPU>& mat_taus);
+
+struct Options
+    : dlaf::miniapp::MiniappOptions<dlaf::miniapp::SupportReal::Yes, dlaf::miniapp::SupportComplex::Yes> {
+  SizeType m;
+  SizeType n;
+  SizeType mb;
+
+  Options(const pika::program_options::variables_map& vm)
+      : MiniappOptions(vm), m(vm["matrix-size"].as<SizeType>()), n(vm["matrix-cols"].as<SizeType>()),
+        mb(vm["block-size"].as<SizeType>()) {
+    if (n <= 0)
+      n = m;
+
+    DLAF_ASSERT(m > 0, m);
+    DLAF_ASSERT(n > 0, n);
+    DLAF_ASSERT(mb > 0, mb);
+  }
+
+  Options(Options&&) = default;
+  Options(const Options&) = default;
+  Options& operator=(Options&&) = default;
+  Options& operator=(const Options&) = default;
+};
+}
+
+struct QRMiniapp {
+  template <Backend backend, typename T>
+  static void run(const Options& opts) {
+    using MatrixMirrorType = MatrixMirror<T, DefaultDevice_v<backend>, Device::CPU>;
+    using HostMatrixType = Matrix<T, Device::CPU>;
+    using ConstHostMatrixType = Matrix<const T, Device::CPU>;
+
+    Communicator world(MPI_COMM_WORLD);
+    CommunicatorGrid comm_grid(world, opts.grid_rows, opts.grid_cols, Ordering::ColumnMajor);
+
+    // Allocate memory for the matrix
+    GlobalElementSize matrix_size(opts.m, opts.n);
+    TileElementSize block_size(opts.mb, opts.mb);
+
+    ConstHostMatrixType matrix_ref = [matrix_size, block_size, &comm_grid]() {
+      HostMatrixType random(matrix_size, block_size, comm_grid);
+      dlaf::matrix::util::set_random(random);
+
+      return random;
+    }();
+
+    const auto taus_dist =
+        dlaf::factorization::internal::qrTausDistribution(matrix_ref.distribution());
+
+    for (int64_t run_index = -opts.nwarmups; run_index < opts.nruns; ++run_index) {
+      if (0 == world.rank() && run_index >= 0)
+        std::cout << "[" << run_index << "]" << std::endl;
+
+      HostMatrixType matrix_host(matrix_size, block_size, comm_grid);
+      copy(matrix_ref, matrix_host);
+      HostMatrixType taus_host(taus_dist);
+
+      double elapsed_time;
+      {
+        MatrixMirrorType matrix(matrix_host);
+        MatrixMirrorType taus(taus_host);
+
+        // Wait for matrix to be copied to GPU (if necessary)
+        matrix.get().waitLocalTiles();
+        DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+
+        dlaf::common::Timer<> timeit;
+        if (opts.local)
+          dlaf::qr_factorization<backend, DefaultDevice_v<backend>, T>(matrix.get(), taus.get());
+        else
+          dlaf::qr_factorization<backend, DefaultDevice_v<backend>, T>(comm_grid, matrix.get(),
+                                                                       taus.get());
+
+        // wait and barrier for all ranks
+        matrix.get().waitLocalTiles();
+        taus.get().waitLocalTiles();
+        comm_grid.wait_all_communicators();
+
+        elapsed_time = timeit.elapsed();
+      }
+
+      double gigaflops;
+      {
+        // Flop count of geqrf (the panel factorizations are included)
+        double m = std::max(opts.m, opts.n);
+        double k = std::min(opts.m, opts.n);
+        auto add_mul = m * k * k - k * k * k / 3;
+        gigaflops = dlaf::total_ops<T>(add_mul, add_mul) / elapsed_time / 1e9;
+      }
+
+      // print benchmark results
+      if (0 == world.rank() && run_index >= 0) {
+        std::cout << "[" << run_index << "]"
+                  << " " << elapsed_time << "s"
+                  << " " << gigaflops << "GFlop/s"
+                  << " " << dlaf::internal::FormatShort{opts.type} << " " << matrix_host.size() << " "
+                  << matrix_host.blockSize() << " " << comm_grid.size() << " "
+                  << pika::get_os_thread_count() << " " << backend << std::endl;
+        if (opts.csv_output) {
+          // CSV formatted output with column names that can be read by pandas to simplify
+          // post-processing CSVData{-version}, value_0, title_0, value_1, title_1
+          std::cout << "CSVData-2, "
+                    << "run, " << run_index << ", "
+                    << "time, " << elapsed_time << ", "
+                    << "GFlops, " << gigaflops << ", "
+                    << "type, " << dlaf::internal::FormatShort{opts.type}.value << ", "
+                    << "matrixrows, " << matrix_host.size().rows() << ", "
+                    << "matrixcols, " << matrix_host.size().cols() << ", "
+                    << "blocksize, " << block_size.rows() << ", "
+                    << "comm_rows, " << comm_grid.size().rows() << ", "
+                    << "comm_cols, " << comm_grid.size().cols() << ", "
+                    << "threads, " << pika::get_os_thread_count() << ", "
+                    << "backend, " << backend << ", " << opts.info << std::endl;
+        }
+      }
+      // (optional) run test
+      if ((opts.do_check == dlaf::miniapp::CheckIterFreq::Last && run_index == (opts.nruns - 1)) ||
+          opts.do_check == dlaf::miniapp::CheckIterFreq::All) {
+        checkQR<T>(comm_grid, matrix_ref, matrix_host, taus_host);
+      }
+    }
+  }
+};
+
+int pika_main(pika::program_options::variables_map& vm) {
+  pika::scoped_finalize pika_finalizer;
+  dlaf::ScopedInitializer init(vm);
+
+  const Options opts(vm);
+  dlaf::miniapp::dispatchMiniapp<QRMiniapp>(opts);
+
+  return EXIT_SUCCESS;
+}
+
+int main(int argc, char** argv) {
+  // Init MPI
+  dlaf::comm::mpi_init mpi_initter(argc, argv);
+
+  // options
+  using namespace pika::program_options;
+  options_description desc_commandline("Usage: miniapp_qr [options]");
+  desc_commandline.add(dlaf::miniapp::getMiniappOptionsDescription());
+  desc_commandline.add(dlaf::getOptionsDescription());
+
+  // clang-format off
+  desc_commandline.add_options()
+    ("matrix-size", value<SizeType>() ->default_value(4096), "Number of rows of the matrix")
+    ("matrix-cols", value<SizeType>() ->default_value(  -1), "Number of columns of the matrix (default: square matrix)")
+    ("block-size",  value<SizeType>() ->default_value( 256), "Block size")
+  ;
+  // clang-format on
+
+  pika::init_params p;
+  p.desc_cmdline = desc_commandline;
+  return pika::init(pika_main, argc, argv, p);
+}
+
+namespace {
+/// Procedure to evaluate the result of the QR factorization
+///
+/// 1. Compute the max norm of the original matrix
+/// 2. Compute Q R (R is extracted from the upper part of the factorization) and its absolute
+///    difference with the original matrix
+/// 3. Compute the max norm of the difference
+/// 4. Evaluate the correctness of the result using the ratio between the two matrix max norms
+///
+/// Prints a message with the ratio and a note about the error:
+/// "":        check ok
+/// "ERROR":   error is high, there is an error in the factorization
+/// "WARNING": error is slightly high, there can be an error in the factorization
+template <typename T>
+void checkQR(CommunicatorGrid& comm_grid, Matrix<const T, Device::CPU>& A,
+             Matrix<const T, Device::CPU>& mat_qr, Matrix<const T, Device::CPU>& mat_taus) {
+  const Index2D rank_result{0, 0};
+  const auto& dist = A.distribution();
+
+  // 1. Compute the max norm of the original matrix in A
+  const auto norm_A = sync_wait(
+      dlaf::auxiliary::max_norm<Backend::MC>(comm_grid, rank_result, blas::Uplo::General, A));
+
+  // 2.
+  // Extract R, i.e. the upper triangular part of the factorization
+  Matrix<T, Device::CPU> mat_r(dist);
+  for (const auto ij_lc : dlaf::common::iterate_range2d(dist.local_nr_tiles())) {
+    const GlobalElementIndex offset =
+        dist.global_element_index(dist.global_tile_index(ij_lc), dlaf::TileElementIndex(0, 0));
+
+    auto copy_upper = [offset](const auto& qr, const auto& r) {
+      for (const auto el_idx : dlaf::common::iterate_range2d(r.size()))
+        r(el_idx) = (offset.row() + el_idx.row() <= offset.col() + el_idx.col()) ? qr(el_idx) : T(0);
+    };
+    when_all(mat_qr.read(ij_lc), mat_r.readwrite(ij_lc)) |
+        transformDetach(dlaf::internal::Policy<Backend::MC>(), std::move(copy_upper));
+  }
+
+  // compute Q R in-place and the difference with the original matrix
+  dlaf::qr_apply_q<Backend::MC>(comm_grid, blas::Op::NoTrans, mat_qr, mat_taus, mat_r);
+
+  auto tile_abs_diff = [](const auto& a, const auto& b) {
+    for (const auto el_idx : dlaf::common::iterate_range2d(a.size()))
+      a(el_idx) = std::abs(a(el_idx) - b(el_idx));
+  };
+  for (const auto ij_lc : dlaf::common::iterate_range2d(dist.local_nr_tiles())) {
+    when_all(mat_r.readwrite(ij_lc), A.read(ij_lc)) |
+        transformDetach(dlaf::internal::Policy<Backend::MC>(), tile_abs_diff);
+  }
+
+  // 3. Compute the max norm of the difference (it has been computed in-place in mat_r)
+  const auto norm_diff = sync_wait(
+      dlaf::auxiliary::max_norm<Backend::MC>(comm_grid, rank_result, blas::Uplo::General, mat_r));
+
+  // 4.
+  // Evaluation of correctness is done just by the master rank
+  if (comm_grid.rank() != rank_result)
+    return;
+
+  constexpr auto eps = std::numeric_limits<dlaf::BaseType<T>>::epsilon();
+  const auto n = std::max(A.size().rows(), A.size().cols());
+
+  const auto diff_ratio = norm_diff / norm_A;
+
+  if (diff_ratio > 100 * eps * n)
+    std::cout << "ERROR: ";
+  else if (diff_ratio > eps * n)
+    std::cout << "Warning: ";
+
+  std::cout << "Max Diff / Max A: " << diff_ratio << std::endl;
+}
+}
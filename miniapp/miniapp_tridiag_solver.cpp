@@ -8,6 +8,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <cstddef>
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
@@ -31,6 +32,7 @@
 #include <dlaf/matrix/index.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/memory/memory_chunk.h>
 #include <dlaf/miniapp/dispatch.h>
 #include <dlaf/miniapp/options.h>
 #include <dlaf/types.h>
@@ -132,6 +134,11 @@ struct TridiagSolverMiniapp {
 
       copy(tridiag_ref, tridiag);
 
+      // Peak memory allocated during the solver call, on top of the memory already in use
+      // (i.e. the workspace of the tridiagonal solver)
+      std::size_t workspace_host_bytes;
+      std::size_t workspace_device_bytes = 0;
+
       double elapsed_time;
       {
         MatrixMirror<RealT, DefaultDevice_v<backend>, Device::CPU> evals_mirror(evals);
@@ -143,6 +150,13 @@ struct TridiagSolverMiniapp {
         evecs_mirror.get().waitLocalTiles();
         DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
 
+        auto& host_allocator = dlaf::memory::internal::getUmpireHostAllocator();
+        const std::size_t host_bytes_before = host_allocator.getCurrentSize();
+#ifdef DLAF_WITH_GPU
+        auto& device_allocator = dlaf::memory::internal::getUmpireDeviceAllocator();
+        const std::size_t device_bytes_before = device_allocator.getCurrentSize();
+#endif
+
         dlaf::common::Timer<> timeit;
         using dlaf::eigensolver::internal::tridiagonal_eigensolver;
         if (opts.local)
@@ -156,7 +170,15 @@ struct TridiagSolverMiniapp {
         evecs_mirror.get().waitLocalTiles();
         comm_grid.wait_all_communicators();
         elapsed_time = timeit.elapsed();
+
+        // Note: the high watermark is never reset, but the peak is the same for all the runs
+        workspace_host_bytes = host_allocator.getHighWatermark() - host_bytes_before;
+#ifdef DLAF_WITH_GPU
+        workspace_device_bytes = device_allocator.getHighWatermark() - device_bytes_before;
+#endif
       }
+      const double workspace_host_mib = static_cast<double>(workspace_host_bytes) / (1 << 20);
+      const double workspace_device_mib = static_cast<double>(workspace_device_bytes) / (1 << 20);
 
       // print benchmark results
       if (0 == world.rank() && run_index >= 0) {
@@ -165,6 +187,9 @@ struct TridiagSolverMiniapp {
                   << " " << dlaf::internal::FormatShort{opts.type} << " " << tridiag.size() << " "
                   << tridiag.blockSize() << " " << comm_grid.size() << " " << pika::get_os_thread_count()
                   << " " << backend << std::endl;
+        std::cout << "[" << run_index << "]"
+                  << " peak workspace (rank 0): host " << workspace_host_mib << "MiB, device "
+                  << workspace_device_mib << "MiB" << std::endl;
         if (opts.csv_output) {
           // CSV formatted output with column names that can be read by pandas to simplify
           // post-processing CSVData{-version}, value_0, title_0, value_1, title_1
@@ -177,6 +202,8 @@ struct TridiagSolverMiniapp {
                     << "comm_rows, " << comm_grid.size().rows() << ", "
                     << "comm_cols, " << comm_grid.size().cols() << ", "
                     << "threads, " << pika::get_os_thread_count() << ", "
+                    << "workspace_host_MiB, " << workspace_host_mib << ", "
+                    << "workspace_device_MiB, " << workspace_device_mib << ", "
                     << "backend, " << backend << ", " << opts.info << std::endl;
         }
       }
@@ -78,6 +78,34 @@ int dlaf_hermitian_eigensolver_partial_spectrum_z(
                                                      eigenvalues_index_begin, eigenvalues_index_end);
 }
 
+int dlaf_symmetric_eigensolver_jobz_s(const int dlaf_context, const char jobz, const char uplo,
+                                      float* a, const struct DLAF_descriptor dlaf_desca, float* w,
+                                      float* z, const struct DLAF_descriptor dlaf_descz) noexcept {
+  return hermitian_eigensolver_jobz<float>(dlaf_context, jobz, uplo, a, dlaf_desca, w, z, dlaf_descz);
+}
+
+int dlaf_symmetric_eigensolver_jobz_d(const int dlaf_context, const char jobz, const char uplo,
+                                      double* a, const struct DLAF_descriptor dlaf_desca, double* w,
+                                      double* z, const struct DLAF_descriptor dlaf_descz) noexcept {
+  return hermitian_eigensolver_jobz<double>(dlaf_context, jobz, uplo, a, dlaf_desca, w, z, dlaf_descz);
+}
+
+int dlaf_hermitian_eigensolver_jobz_c(const int dlaf_context, const char jobz, const char uplo,
+                                      dlaf_complex_c* a, const struct DLAF_descriptor dlaf_desca,
+                                      float* w, dlaf_complex_c* z,
+                                      const struct DLAF_descriptor dlaf_descz) noexcept {
+  return hermitian_eigensolver_jobz<std::complex<float>>(dlaf_context, jobz, uplo, a, dlaf_desca, w, z,
+                                                         dlaf_descz);
+}
+
+int dlaf_hermitian_eigensolver_jobz_z(const int dlaf_context, const char jobz, const char uplo,
+                                      dlaf_complex_z* a, const struct DLAF_descriptor dlaf_desca,
+                                      double* w, dlaf_complex_z* z,
+                                      const struct DLAF_descriptor dlaf_descz) noexcept {
+  return hermitian_eigensolver_jobz<std::complex<double>>(dlaf_context, jobz, uplo, a, dlaf_desca, w,
+                                                          z, dlaf_descz);
+}
+
 #ifdef DLAF_WITH_SCALAPACK
 
 void dlaf_pssyevd(const char uplo, const int m, float* a, const int ia, const int ja, const int desca[9],
@@ -137,4 +165,28 @@ void dlaf_pzheevd_partial_spectrum(const char uplo, const int m, dlaf_complex_z*
                                 eigenvalues_index_end, *info);
 }
 
+void dlaf_pssyevd_jobz(const char jobz, const char uplo, const int m, float* a, const int ia,
+                       const int ja, const int desca[9], float* w, float* z, const int iz, const int jz,
+                       const int descz[9], int* info) noexcept {
+  pxheevd_jobz<float>(jobz, uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, *info);
+}
+
+void dlaf_pdsyevd_jobz(const char jobz, const char uplo, const int m, double* a, const int ia,
+                       const int ja, const int desca[9], double* w, double* z, const int iz,
+                       const int jz, const int descz[9], int* info) noexcept {
+  pxheevd_jobz<double>(jobz, uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, *info);
+}
+
+void dlaf_pcheevd_jobz(const char jobz, const char uplo, const int m, dlaf_complex_c* a, const int ia,
+                       const int ja, const int desca[9], float* w, dlaf_complex_c* z, const int iz,
+                       const int jz, const int descz[9], int* info) noexcept {
+  pxheevd_jobz<std::complex<float>>(jobz, uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, *info);
+}
+
+void dlaf_pzheevd_jobz(const char jobz, const char uplo, const int m, dlaf_complex_z* a, const int ia,
+                       const int ja, const int desca[9], double* w, dlaf_complex_z* z, const int iz,
+                       const int jz, const int descz[9], int* info) noexcept {
+  pxheevd_jobz<std::complex<double>>(jobz, uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, *info);
+}
+
 #endif
@@ -21,6 +21,7 @@
 #include <dlaf/matrix/create_matrix.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/matrix/redistribution.h>
 #include <dlaf/types.h>
 #include <dlaf_c/desc.h>
 #include <dlaf_c/grid.h>
@@ -37,40 +38,112 @@ int hermitian_eigensolver(const int dlaf_context, const char uplo, T* a,
   using MatrixBaseMirror =
       dlaf::matrix::MatrixMirror<dlaf::BaseType<T>, dlaf::Device::Default, dlaf::Device::CPU>;
 
-  DLAF_ASSERT(dlaf_desca.i == 0, dlaf_desca.i);
-  DLAF_ASSERT(dlaf_desca.j == 0, dlaf_desca.j);
-  DLAF_ASSERT(dlaf_descz.i == 0, dlaf_descz.i);
-  DLAF_ASSERT(dlaf_descz.j == 0, dlaf_descz.j);
+  PikaRunningScope pika_scope;
+
+  auto& communicator_grid = grid_from_context(dlaf_context);
+
+  SubmatrixHost<T> submatrix_host(dlaf_desca, communicator_grid, a);
+  SubmatrixHost<T> eigenvectors_submatrix_host(dlaf_descz, communicator_grid, z, false);
+  MatrixHost& matrix_host = submatrix_host.get();
+  MatrixHost& eigenvectors_host = eigenvectors_submatrix_host.get();
+
+  auto solve = [&](dlaf::comm::CommunicatorGrid& grid, MatrixHost& mat_host,
+                   MatrixHost& evecs_host) {
+    auto eigenvalues_host = dlaf::matrix::create_matrix_from_col_major<dlaf::Device::CPU>(
+        {dlaf_descz.m, 1}, {evecs_host.block_size().rows(), 1}, std::max(dlaf_descz.m, 1), w);
+
+    {
+      MatrixMirror matrix(mat_host);
+      MatrixMirror eigenvectors(evecs_host);
+      MatrixBaseMirror eigenvalues(eigenvalues_host);
+
+      dlaf::hermitian_eigensolver<dlaf::Backend::Default, dlaf::Device::Default, T>(
+          grid, dlaf::internal::char2uplo(uplo), matrix.get(), eigenvalues.get(), eigenvectors.get(),
+          eigenvalues_index_begin, eigenvalues_index_end);
+    }  // Destroy mirror
+
+    // Ensure data is copied back to the host
+    eigenvalues_host.waitLocalTiles();
+  };
+
+  if (auto auto_layout = auto_layout_from_context(dlaf_context, matrix_host.distribution())) {
+    const dlaf::matrix::Distribution& dist_auto = auto_layout->distribution;
+    MatrixHost matrix_auto(dist_auto);
+    // Note: the eigenvectors may have less than m columns (see eigenvalues_index_end).
+    MatrixHost eigenvectors_auto(dlaf::matrix::Distribution(
+        eigenvectors_host.size(), dist_auto.block_size(), dist_auto.tile_size(), dist_auto.grid_size(),
+        dist_auto.rank_index(), dist_auto.source_rank_index()));
+    dlaf::matrix::redistribute(communicator_grid, matrix_host, auto_layout->grid, matrix_auto);
+    solve(auto_layout->grid, matrix_auto, eigenvectors_auto);
+    dlaf::matrix::redistribute(auto_layout->grid, eigenvectors_auto, communicator_grid,
+                               eigenvectors_host);
+  }
+  else {
+    solve(communicator_grid, matrix_host, eigenvectors_host);
+  }
+
+  eigenvectors_submatrix_host.copy_back();
+  eigenvectors_submatrix_host.waitLocalTiles();
+
+  return 0;
+}
+
+template <typename T>
+int hermitian_eigenvalues(const int dlaf_context, const char uplo, T* a,
+                          const DLAF_descriptor dlaf_desca, dlaf::BaseType<T>* w) {
+  using MatrixHost = dlaf::matrix::Matrix<T, dlaf::Device::CPU>;
+  using MatrixMirror = dlaf::matrix::MatrixMirror<T, dlaf::Device::Default, dlaf::Device::CPU>;
+  using MatrixBaseMirror =
+      dlaf::matrix::MatrixMirror<dlaf::BaseType<T>, dlaf::Device::Default, dlaf::Device::CPU>;
 
   PikaRunningScope pika_scope;
 
   auto& communicator_grid = grid_from_context(dlaf_context);
 
-  auto layout_a = make_layout(dlaf_desca, communicator_grid);
-  auto layout_z = make_layout(dlaf_descz, communicator_grid);
+  SubmatrixHost<T> submatrix_host(dlaf_desca, communicator_grid, a);
+  MatrixHost& matrix_host = submatrix_host.get();
+
+  auto solve = [&](dlaf::comm::CommunicatorGrid& grid, MatrixHost& mat_host) {
+    auto eigenvalues_host = dlaf::matrix::create_matrix_from_col_major<dlaf::Device::CPU>(
+        {dlaf_desca.m, 1}, {mat_host.block_size().rows(), 1}, std::max(dlaf_desca.m, 1), w);
 
-  MatrixHost matrix_host(layout_a, a);
-  MatrixHost eigenvectors_host(layout_z, z);
-  auto eigenvalues_host = dlaf::matrix::create_matrix_from_col_major<dlaf::Device::CPU>(
-      {dlaf_descz.m, 1}, {dlaf_descz.mb, 1}, std::max(dlaf_descz.m, 1), w);
+    {
+      MatrixMirror matrix(mat_host);
+      MatrixBaseMirror eigenvalues(eigenvalues_host);
 
-  {
-    MatrixMirror matrix(matrix_host);
-    MatrixMirror eigenvectors(eigenvectors_host);
-    MatrixBaseMirror eigenvalues(eigenvalues_host);
+      dlaf::hermitian_eigenvalues<dlaf::Backend::Default, dlaf::Device::Default, T>(
+          grid, dlaf::internal::char2uplo(uplo), matrix.get(), eigenvalues.get());
+    }  // Destroy mirror
 
-    dlaf::hermitian_eigensolver<dlaf::Backend::Default, dlaf::Device::Default, T>(
-        communicator_grid, dlaf::internal::char2uplo(uplo), matrix.get(), eigenvalues.get(),
-        eigenvectors.get(), eigenvalues_index_begin, eigenvalues_index_end);
-  }  // Destroy mirror
+    // Ensure data is copied back to the host
+    eigenvalues_host.waitLocalTiles();
+  };
 
-  // Ensure data is copied back to the host
-  eigenvalues_host.waitLocalTiles();
-  eigenvectors_host.waitLocalTiles();
+  if (auto auto_layout = auto_layout_from_context(dlaf_context, matrix_host.distribution())) {
+    MatrixHost matrix_auto(auto_layout->distribution);
+    dlaf::matrix::redistribute(communicator_grid, matrix_host, auto_layout->grid, matrix_auto);
+    solve(auto_layout->grid, matrix_auto);
+  }
+  else {
+    solve(communicator_grid, matrix_host);
+  }
 
   return 0;
 }
 
+template <typename T>
+int hermitian_eigensolver_jobz(const int dlaf_context, const char jobz, const char uplo, T* a,
+                               const DLAF_descriptor dlaf_desca, dlaf::BaseType<T>* w, T* z,
+                               const DLAF_descriptor dlaf_descz) {
+  DLAF_ASSERT(jobz == 'N' || jobz == 'n' || jobz == 'V' || jobz == 'v', jobz);
+
+  if (jobz == 'N' || jobz == 'n')
+    return hermitian_eigenvalues<T>(dlaf_context, uplo, a, dlaf_desca, w);
+
+  return hermitian_eigensolver<T>(dlaf_context, uplo, a, dlaf_desca, w, z, dlaf_descz, 0l,
+                                  dlaf_desca.m);
+}
+
 #ifdef DLAF_WITH_SCALAPACK
 
 template <typename T>
@@ -80,22 +153,38 @@ void pxheevd(const char uplo, const int m, T* a, const int ia, const int ja, con
   DLAF_ASSERT(desca[0] == 1, desca[0]);
   DLAF_ASSERT(descz[0] == 1, descz[0]);
   DLAF_ASSERT(desca[1] == descz[1], desca[1], descz[1]);
-  DLAF_ASSERT(ia == 1, ia);
-  DLAF_ASSERT(ja == 1, ja);
-  DLAF_ASSERT(iz == 1, iz);
-  DLAF_ASSERT(jz == 1, jz);
   DLAF_ASSERT(m > 0 ? eigenvalues_index_begin >= 1 : eigenvalues_index_begin == 1, m,
               eigenvalues_index_begin);
   DLAF_ASSERT(m > 0 ? eigenvalues_index_end <= m : eigenvalues_index_end == 0, m, eigenvalues_index_end);
   DLAF_ASSERT(m > 0 ? eigenvalues_index_begin <= eigenvalues_index_end : true, m,
               eigenvalues_index_begin, eigenvalues_index_end);
 
+  // Only the columns of the requested eigenvectors are referenced.
   auto dlaf_desca = make_dlaf_descriptor(m, m, ia, ja, desca);
-  auto dlaf_descz = make_dlaf_descriptor(m, m, iz, jz, descz);
+  auto dlaf_descz = make_dlaf_descriptor(m, static_cast<int>(eigenvalues_index_end), iz, jz, descz);
 
   auto _info = hermitian_eigensolver(desca[1], uplo, a, dlaf_desca, w, z, dlaf_descz,
                                      eigenvalues_index_begin - 1, eigenvalues_index_end);
   info = _info;
 }
 
+template <typename T>
+void pxheevd_jobz(const char jobz, const char uplo, const int m, T* a, const int ia, const int ja,
+                  const int desca[9], dlaf::BaseType<T>* w, T* z, const int iz, int jz,
+                  const int descz[9], int& info) {
+  DLAF_ASSERT(jobz == 'N' || jobz == 'n' || jobz == 'V' || jobz == 'v', jobz);
+
+  if (jobz == 'V' || jobz == 'v') {
+    pxheevd<T>(uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, 1l, m, info);
+    return;
+  }
+
+  DLAF_ASSERT(desca[0] == 1, desca[0]);
+
+  auto dlaf_desca = make_dlaf_descriptor(m, m, ia, ja, desca);
+
+  auto _info = hermitian_eigenvalues(desca[1], uplo, a, dlaf_desca, w);
+  info = _info;
+}
+
 #endif
@@ -32,36 +32,24 @@ int hermitian_generalized_eigensolver(
     const int dlaf_context, const char uplo, T* a, const DLAF_descriptor dlaf_desca, T* b,
     const DLAF_descriptor dlaf_descb, dlaf::BaseType<T>* w, T* z, const DLAF_descriptor dlaf_descz,
     const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end, bool factorized) {
-  using MatrixHost = dlaf::matrix::Matrix<T, dlaf::Device::CPU>;
   using MatrixMirror = dlaf::matrix::MatrixMirror<T, dlaf::Device::Default, dlaf::Device::CPU>;
   using MatrixBaseMirror =
       dlaf::matrix::MatrixMirror<dlaf::BaseType<T>, dlaf::Device::Default, dlaf::Device::CPU>;
 
-  DLAF_ASSERT(dlaf_desca.i == 0, dlaf_desca.i);
-  DLAF_ASSERT(dlaf_desca.j == 0, dlaf_desca.j);
-  DLAF_ASSERT(dlaf_descb.i == 0, dlaf_descb.i);
-  DLAF_ASSERT(dlaf_descb.j == 0, dlaf_descb.j);
-  DLAF_ASSERT(dlaf_descz.i == 0, dlaf_descz.i);
-  DLAF_ASSERT(dlaf_descz.j == 0, dlaf_descz.j);
-
   PikaRunningScope pika_scope;
 
   auto& communicator_grid = grid_from_context(dlaf_context);
 
-  auto layout_a = make_layout(dlaf_desca, communicator_grid);
-  auto layout_b = make_layout(dlaf_descb, communicator_grid);
-  auto layout_z = make_layout(dlaf_descz, communicator_grid);
-
-  MatrixHost matrix_host_a(layout_a, a);
-  MatrixHost matrix_host_b(layout_b, b);
-  MatrixHost eigenvectors_host(layout_z, z);
+  SubmatrixHost<T> submatrix_host_a(dlaf_desca, communicator_grid, a);
+  SubmatrixHost<T> submatrix_host_b(dlaf_descb, communicator_grid, b);
+  SubmatrixHost<T> eigenvectors_submatrix_host(dlaf_descz, communicator_grid, z, false);
   auto eigenvalues_host = dlaf::matrix::create_matrix_from_col_major<dlaf::Device::CPU>(
       {dlaf_descz.m, 1}, {dlaf_descz.mb, 1}, std::max(dlaf_descz.m, 1), w);
 
   {
-    MatrixMirror matrix_a(matrix_host_a);
-    MatrixMirror matrix_b(matrix_host_b);
-    MatrixMirror eigenvectors(eigenvectors_host);
+    MatrixMirror matrix_a(submatrix_host_a.get());
+    MatrixMirror matrix_b(submatrix_host_b.get());
+    MatrixMirror eigenvectors(eigenvectors_submatrix_host.get());
     MatrixBaseMirror eigenvalues(eigenvalues_host);
 
     if (!factorized) {
@@ -77,9 +65,13 @@ int hermitian_generalized_eigensolver(
     }
   }  // Destroy mirror
 
-  // Ensure data is copied back to the host
+  // Ensure data is copied back to the host (B contains its Cholesky factor)
   eigenvalues_host.waitLocalTiles();
-  eigenvectors_host.waitLocalTiles();
+  if (!factorized)
+    submatrix_host_b.copy_back();
+  eigenvectors_submatrix_host.copy_back();
+  submatrix_host_b.waitLocalTiles();
+  eigenvectors_submatrix_host.waitLocalTiles();
 
   return 0;
 }
@@ -116,12 +108,6 @@ void pxhegvd(const char uplo, const int m, T* a, const int ia, const int ja, con
   DLAF_ASSERT(descz[0] == 1, descz[0]);
   DLAF_ASSERT(desca[1] == descb[1], desca[1], descb[1]);
   DLAF_ASSERT(desca[1] == descz[1], desca[1], descz[1]);
-  DLAF_ASSERT(ia == 1, ia);
-  DLAF_ASSERT(ja == 1, ja);
-  DLAF_ASSERT(ib == 1, ib);
-  DLAF_ASSERT(jb == 1, jb);
-  DLAF_ASSERT(iz == 1, iz);
-  DLAF_ASSERT(jz == 1, jz);
   DLAF_ASSERT(m > 0 ? eigenvalues_index_begin >= 1 : eigenvalues_index_begin == 1, m,
               eigenvalues_index_begin);
   DLAF_ASSERT(m > 0 ? eigenvalues_index_end <= m : eigenvalues_index_end == 0, m, eigenvalues_index_end);
@@ -22,6 +22,7 @@
 #include <dlaf/factorization/cholesky.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/matrix/redistribution.h>
 #include <dlaf_c/desc.h>
 #include <dlaf_c/grid.h>
 #include <dlaf_c/utils.h>
@@ -32,27 +33,36 @@
 template <typename T>
 int cholesky_factorization(const int dlaf_context, const char uplo, T* a,
                            const DLAF_descriptor dlaf_desca) {
+  using MatrixHost = dlaf::matrix::Matrix<T, dlaf::Device::CPU>;
   using MatrixMirror = dlaf::matrix::MatrixMirror<T, dlaf::Device::Default, dlaf::Device::CPU>;
 
-  DLAF_ASSERT(dlaf_desca.i == 0, dlaf_desca.i);
-  DLAF_ASSERT(dlaf_desca.j == 0, dlaf_desca.j);
-
   PikaRunningScope pika_scope;
 
   auto& communicator_grid = grid_from_context(dlaf_context);
 
-  auto layout = make_layout(dlaf_desca, communicator_grid);
-
-  dlaf::matrix::Matrix<T, dlaf::Device::CPU> matrix_host(layout, a);
+  SubmatrixHost<T> submatrix_host(dlaf_desca, communicator_grid, a);
+  MatrixHost& matrix_host = submatrix_host.get();
 
-  {
-    MatrixMirror matrix(matrix_host);
+  // Note: the mirror is destroyed when the lambda returns
+  auto factorize = [uplo](dlaf::comm::CommunicatorGrid& grid, MatrixHost& mat_host) {
+    MatrixMirror matrix(mat_host);
 
     dlaf::cholesky_factorization<dlaf::Backend::Default, dlaf::Device::Default, T>(
-        communicator_grid, dlaf::internal::char2uplo(uplo), matrix.get());
-  }  // Destroy mirror
-
-  matrix_host.waitLocalTiles();
+        grid, dlaf::internal::char2uplo(uplo), matrix.get());
+  };
+
+  if (auto auto_layout = auto_layout_from_context(dlaf_context, matrix_host.distribution())) {
+    MatrixHost matrix_auto(auto_layout->distribution);
+    dlaf::matrix::redistribute(communicator_grid, matrix_host, auto_layout->grid, matrix_auto);
+    factorize(auto_layout->grid, matrix_auto);
+    dlaf::matrix::redistribute(auto_layout->grid, matrix_auto, communicator_grid, matrix_host);
+  }
+  else {
+    factorize(communicator_grid, matrix_host);
+  }
+
+  submatrix_host.copy_back();
+  submatrix_host.waitLocalTiles();
 
   return 0;
 }
@@ -63,8 +73,6 @@ template <typename T>
 void pxpotrf(const char uplo, const int n, T* a, const int ia, const int ja, const int desca[9],
              int& info) {
   DLAF_ASSERT(desca[0] == 1, desca[0]);
-  DLAF_ASSERT(ia == 1, ia);
-  DLAF_ASSERT(ja == 1, ja);
 
   auto dlaf_desca = make_dlaf_descriptor(n, n, ia, ja, desca);
 
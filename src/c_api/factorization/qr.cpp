@@ -0,0 +1,60 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <complex>
+
+#include <dlaf_c/factorization/qr.h>
+#include <dlaf_c/utils.h>
+
+#include "qr.h"
+
+int dlaf_qr_factorization_s(const int dlaf_context, float* a, const DLAF_descriptor dlaf_desca,
+                            float* tau) noexcept {
+  return qr_factorization<float>(dlaf_context, a, dlaf_desca, tau);
+}
+
+int dlaf_qr_factorization_d(const int dlaf_context, double* a, const DLAF_descriptor dlaf_desca,
+                            double* tau) noexcept {
+  return qr_factorization<double>(dlaf_context, a, dlaf_desca, tau);
+}
+
+int dlaf_qr_factorization_c(const int dlaf_context, dlaf_complex_c* a,
+                            const DLAF_descriptor dlaf_desca, dlaf_complex_c* tau) noexcept {
+  return qr_factorization<std::complex<float>>(dlaf_context, a, dlaf_desca, tau);
+}
+
+int dlaf_qr_factorization_z(const int dlaf_context, dlaf_complex_z* a,
+                            const DLAF_descriptor dlaf_desca, dlaf_complex_z* tau) noexcept {
+  return qr_factorization<std::complex<double>>(dlaf_context, a, dlaf_desca, tau);
+}
+
+#ifdef DLAF_WITH_SCALAPACK
+
+void dlaf_psgeqrf(const int m, const int n, float* a, const int ia, const int ja, const int desca[9],
+                  float* tau, int* info) noexcept {
+  pxgeqrf<float>(m, n, a, ia, ja, desca, tau, *info);
+}
+
+void dlaf_pdgeqrf(const int m, const int n, double* a, const int ia, const int ja,
+                  const int desca[9], double* tau, int* info) noexcept {
+  pxgeqrf<double>(m, n, a, ia, ja, desca, tau, *info);
+}
+
+void dlaf_pcgeqrf(const int m, const int n, dlaf_complex_c* a, const int ia, const int ja,
+                  const int desca[9], dlaf_complex_c* tau, int* info) noexcept {
+  pxgeqrf<std::complex<float>>(m, n, a, ia, ja, desca, tau, *info);
+}
+
+void dlaf_pzgeqrf(const int m, const int n, dlaf_complex_z* a, const int ia, const int ja,
+                  const int desca[9], dlaf_complex_z* tau, int* info) noexcept {
+  pxgeqrf<std::complex<double>>(m, n, a, ia, ja, desca, tau, *info);
+}
+
+#endif
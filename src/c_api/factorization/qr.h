@@ -0,0 +1,130 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <algorithm>
+
+#include <mpi.h>
+
+#include <pika/init.hpp>
+
+#include <lapack.hh>
+
+#include <dlaf/common/data.h>
+#include <dlaf/communication/sync/broadcast.h>
+#include <dlaf/factorization/qr.h>
+#include <dlaf/matrix/col_major_layout.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/types.h>
+#include <dlaf_c/desc.h>
+#include <dlaf_c/grid.h>
+#include <dlaf_c/utils.h>
+
+#include "../blacs.h"
+#include "../utils.h"
+
+template <typename T>
+int qr_factorization(const int dlaf_context, T* a, const DLAF_descriptor dlaf_desca, T* tau) {
+  using dlaf::Coord;
+  using dlaf::SizeType;
+  using MatrixHost = dlaf::matrix::Matrix<T, dlaf::Device::CPU>;
+  using MatrixMirror = dlaf::matrix::MatrixMirror<T, dlaf::Device::Default, dlaf::Device::CPU>;
+
+  PikaRunningScope pika_scope;
+
+  auto& communicator_grid = grid_from_context(dlaf_context);
+
+  auto layout = make_layout(dlaf_desca, communicator_grid);
+
+  MatrixHost matrix_host(layout, local_submatrix_ptr(dlaf_desca, communicator_grid, a));
+
+  // Note:
+  // tau is distributed as the columns of A (i.e. as in ScaLAPACK).
+  const dlaf::matrix::Distribution& dist_a = matrix_host.distribution();
+  dlaf::matrix::Distribution dist_taus =
+      dlaf::factorization::internal::qrTausDistribution(dist_a);
+  const SizeType ld_taus = std::max<SizeType>(1, dist_taus.local_size().rows());
+  T* tau_lc = tau + local_submatrix_col_offset(dlaf_desca, communicator_grid);
+
+  MatrixHost taus_host(dlaf::matrix::ColMajorLayout(std::move(dist_taus), ld_taus), tau_lc);
+
+  {
+    MatrixMirror matrix(matrix_host);
+    MatrixMirror taus(taus_host);
+
+    dlaf::qr_factorization<dlaf::Backend::Default, dlaf::Device::Default, T>(
+        communicator_grid, matrix.get(), taus.get());
+  }  // Destroy mirror
+
+  matrix_host.waitLocalTiles();
+  taus_host.waitLocalTiles();
+
+  // Note:
+  // DLA-Future does not compute reflectors of size 1, while ScaLAPACK returns min(m, n) taus. If m <= n
+  // the last reflector H(m-1), which acts only on row m-1, is computed here as in LAPACK: it is the
+  // identity (tau = 0) for real types, while for complex types it makes R(m-1, m-1) real and it is
+  // applied to the rest of the row.
+  const SizeType m = dlaf_desca.m;
+  if (m > 0 && m <= dlaf_desca.n) {
+    const dlaf::comm::Index2D rank = dist_a.rank_index();
+    const dlaf::comm::Index2D rank_diag(dist_a.rank_global_element<Coord::Row>(m - 1),
+                                        dist_a.rank_global_element<Coord::Col>(m - 1));
+    T* a_lc = local_submatrix_ptr(dlaf_desca, communicator_grid, a);
+    const SizeType ld = dlaf_desca.ld;
+    const SizeType i_lc = dist_a.local_element_from_global_element<Coord::Row>(m - 1);
+
+    T tau_last(0);
+    if constexpr (dlaf::isComplex_v<T>) {
+      auto& comm = communicator_grid.fullCommunicator();
+      if (rank == rank_diag) {
+        const SizeType j_lc = dist_a.local_element_from_global_element<Coord::Col>(m - 1);
+        T* alpha = a_lc + i_lc + ld * j_lc;
+        lapack::larfg(1, alpha, alpha + 1, 1, &tau_last);
+        dlaf::comm::sync::broadcast::send(comm, dlaf::common::make_data(&tau_last, 1));
+      }
+      else {
+        dlaf::comm::sync::broadcast::receive_from(communicator_grid.rankFullCommunicator(rank_diag),
+                                                  comm, dlaf::common::make_data(&tau_last, 1));
+      }
+
+      // R(m-1, m:n) = H(m-1)^H R(m-1, m:n)
+      if (rank.row() == rank_diag.row() && tau_last != T(0)) {
+        for (SizeType j = m; j < dist_a.size().cols(); ++j) {
+          if (dist_a.rank_global_element<Coord::Col>(j) == rank.col())
+            a_lc[i_lc + ld * dist_a.local_element_from_global_element<Coord::Col>(j)] *=
+                T(1) - dlaf::conj(tau_last);
+        }
+      }
+    }
+
+    if (rank.col() == rank_diag.col())
+      tau_lc[dist_a.local_element_from_global_element<Coord::Col>(m - 1)] = tau_last;
+  }
+
+  return 0;
+}
+
+#ifdef DLAF_WITH_SCALAPACK
+
+template <typename T>
+void pxgeqrf(const int m, const int n, T* a, const int ia, const int ja, const int desca[9], T* tau,
+             int& info) {
+  DLAF_ASSERT(desca[0] == 1, desca[0]);
+
+  auto dlaf_desca = make_dlaf_descriptor(m, n, ia, ja, desca);
+
+  auto _info = qr_factorization(desca[1], a, dlaf_desca, tau);
+  info = _info;
+}
+
+#endif
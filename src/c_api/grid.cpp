@@ -24,6 +24,7 @@
 #include "utils.h"
 
 std::unordered_map<int, dlaf::comm::CommunicatorGrid> dlaf_grids;
+std::unordered_map<int, dlaf::comm::CommunicatorGrid> dlaf_auto_layout_grids;
 
 int dlaf_create_grid(MPI_Comm comm, int nprow, int npcol, char order) noexcept {
   // dlaf_context starts from INT_MAX to reduce the likelihood of clashes with blacs contexts
@@ -40,10 +41,12 @@ int dlaf_create_grid(MPI_Comm comm, int nprow, int npcol, char order) noexcept {
 }
 
 void dlaf_free_grid(int ctxt) noexcept {
+  dlaf_auto_layout_grids.erase(ctxt);
   dlaf_grids.erase(ctxt);
 }
 
 void dlaf_free_all_grids() noexcept {
+  dlaf_auto_layout_grids.clear();
   dlaf_grids.clear();
 }
 
@@ -19,3 +19,9 @@
 /// The grids are indexed by a integer context (DLA-Future context or BLACS
 /// context)
 extern std::unordered_map<int, dlaf::comm::CommunicatorGrid> dlaf_grids;
+
+/// Dictionary of the communication grids used by the C API auto layout
+///
+/// The grids are indexed by the context of the grid they are created from, and
+/// are freed together with it (see dlaf::TuneParameters::c_api_auto_layout).
+extern std::unordered_map<int, dlaf::comm::CommunicatorGrid> dlaf_auto_layout_grids;
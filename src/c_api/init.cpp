@@ -33,13 +33,16 @@ void dlaf_initialize(int argc_pika, const char** argv_pika, int argc_dlaf,
     dlaf::initialize(argc_dlaf, argv_dlaf);
     dlaf_initialized = true;
 
-    pika::suspend();
+    // In persistent mode the runtime is kept running until dlaf_finalize.
+    if (!dlaf::internal::getConfiguration().c_api_persistent_runtime)
+      pika::suspend();
   }
 }
 
 void dlaf_finalize() noexcept {
   if (dlaf_initialized) {
-    pika::resume();
+    if (!dlaf::internal::getConfiguration().c_api_persistent_runtime)
+      pika::resume();
     pika::finalize();
     dlaf::finalize();
     auto pika_stopped = pika::stop();
@@ -34,27 +34,21 @@ int inverse_from_cholesky_factor(const int dlaf_context, const char uplo, T* a,
                                  const DLAF_descriptor dlaf_desca) {
   using MatrixMirror = dlaf::matrix::MatrixMirror<T, dlaf::Device::Default, dlaf::Device::CPU>;
 
-  DLAF_ASSERT(dlaf_desca.i == 0, dlaf_desca.i);
-  DLAF_ASSERT(dlaf_desca.j == 0, dlaf_desca.j);
-
-  pika::resume();
+  PikaRunningScope pika_scope;
 
   auto& communicator_grid = grid_from_context(dlaf_context);
 
-  auto layout = make_layout(dlaf_desca, communicator_grid);
-
-  dlaf::matrix::Matrix<T, dlaf::Device::CPU> matrix_host(layout, a);
+  SubmatrixHost<T> submatrix_host(dlaf_desca, communicator_grid, a);
 
   {
-    MatrixMirror matrix(matrix_host);
+    MatrixMirror matrix(submatrix_host.get());
 
     dlaf::inverse_from_cholesky_factor<dlaf::Backend::Default, dlaf::Device::Default, T>(
         communicator_grid, dlaf::internal::char2uplo(uplo), matrix.get());
   }  // Destroy mirror
 
-  matrix_host.waitLocalTiles();
-
-  pika::suspend();
+  submatrix_host.copy_back();
+  submatrix_host.waitLocalTiles();
 
   return 0;
 }
@@ -65,8 +59,6 @@ template <typename T>
 void pxpotri(const char uplo, const int n, T* a, const int ia, const int ja, const int desca[9],
              int& info) {
   DLAF_ASSERT(desca[0] == 1, desca[0]);
-  DLAF_ASSERT(ia == 1, ia);
-  DLAF_ASSERT(ja == 1, ja);
 
   auto dlaf_desca = make_dlaf_descriptor(n, n, ia, ja, desca);
 
@@ -0,0 +1,34 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <dlaf/communication/communicator_type.h>
+#include <dlaf/metrics.h>
+#include <dlaf_c/metrics.h>
+
+struct DLAF_metrics dlaf_get_metrics() noexcept {
+  using dlaf::comm::CommunicatorType;
+
+  const dlaf::Metrics metrics = dlaf::getMetrics();
+
+  struct DLAF_metrics dlaf_metrics = {metrics.flops,
+                                      metrics.sent(CommunicatorType::Row),
+                                      metrics.sent(CommunicatorType::Col),
+                                      metrics.sent(CommunicatorType::Full),
+                                      metrics.received(CommunicatorType::Row),
+                                      metrics.received(CommunicatorType::Col),
+                                      metrics.received(CommunicatorType::Full),
+                                      metrics.bytes_allocated};
+
+  return dlaf_metrics;
+}
+
+void dlaf_reset_metrics() noexcept {
+  dlaf::resetMetrics();
+}
@@ -8,6 +8,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <algorithm>
+#include <cmath>
 #include <exception>
 #include <iostream>
 #include <optional>
@@ -17,6 +19,7 @@
 #include <utility>
 
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/tune.h>
 #include <dlaf_c/desc.h>
 #include <dlaf_c/utils.h>
 
@@ -25,27 +28,87 @@
 
 struct DLAF_descriptor make_dlaf_descriptor(const int m, const int n, const int i, const int j,
                                             const int desc[9]) noexcept {
-  DLAF_ASSERT(i == 1, i);
-  DLAF_ASSERT(j == 1, j);
+  DLAF_ASSERT(i >= 1, i);
+  DLAF_ASSERT(j >= 1, j);
 
   struct DLAF_descriptor dlaf_desc = {m, n, desc[4], desc[5], desc[6], desc[7], i - 1, j - 1, desc[8]};
 
   return dlaf_desc;
 }
 
-dlaf::matrix::ColMajorLayout make_layout(const struct DLAF_descriptor dlaf_desc,
-                                         dlaf::comm::CommunicatorGrid& grid) {
+bool is_block_aligned(const struct DLAF_descriptor dlaf_desc) noexcept {
+  return dlaf_desc.i % dlaf_desc.mb == 0 && dlaf_desc.j % dlaf_desc.nb == 0;
+}
+
+// Returns the rank owning the block of the global matrix containing the first element of the
+// submatrix. If the submatrix starts at a block boundary of the global matrix it is distributed as a
+// matrix on its own with this source rank.
+static dlaf::comm::Index2D submatrix_src_rank_index(const struct DLAF_descriptor dlaf_desc,
+                                                    dlaf::comm::CommunicatorGrid& grid) {
+  DLAF_ASSERT(dlaf_desc.i >= 0 && dlaf_desc.j >= 0, dlaf_desc.i, dlaf_desc.j);
+
+  const auto grid_size = grid.size();
+  return {(dlaf_desc.isrc + dlaf_desc.i / dlaf_desc.mb) % grid_size.rows(),
+          (dlaf_desc.jsrc + dlaf_desc.j / dlaf_desc.nb) % grid_size.cols()};
+}
+
+dlaf::matrix::Distribution make_submatrix_distribution(const struct DLAF_descriptor dlaf_desc,
+                                                       dlaf::comm::CommunicatorGrid& grid) {
   dlaf::GlobalElementSize matrix_size(dlaf_desc.m, dlaf_desc.n);
   dlaf::TileElementSize block_size(dlaf_desc.mb, dlaf_desc.nb);
 
+  return dlaf::matrix::Distribution(matrix_size, block_size, grid.size(), grid.rank(),
+                                    submatrix_src_rank_index(dlaf_desc, grid));
+}
+
+dlaf::matrix::ColMajorLayout make_layout(const struct DLAF_descriptor dlaf_desc,
+                                         dlaf::comm::CommunicatorGrid& grid) {
+  DLAF_ASSERT(is_block_aligned(dlaf_desc), dlaf_desc.i, dlaf_desc.mb, dlaf_desc.j, dlaf_desc.nb);
+
+  dlaf::matrix::ColMajorLayout layout{make_submatrix_distribution(dlaf_desc, grid), dlaf_desc.ld};
+
+  return layout;
+}
+
+// Returns the local row and column indices of the first element of the submatrix described by
+// dlaf_desc.
+static std::tuple<dlaf::SizeType, dlaf::SizeType> local_submatrix_element_index(
+    const struct DLAF_descriptor dlaf_desc, dlaf::comm::CommunicatorGrid& grid) {
+  using dlaf::Coord;
+
+  if (dlaf_desc.i == 0 && dlaf_desc.j == 0)
+    return {0, 0};
+
+  DLAF_ASSERT(is_block_aligned(dlaf_desc), dlaf_desc.i, dlaf_desc.mb, dlaf_desc.j, dlaf_desc.nb);
+
+  dlaf::GlobalElementSize matrix_size(dlaf_desc.i + dlaf_desc.m, dlaf_desc.j + dlaf_desc.n);
+  dlaf::TileElementSize block_size(dlaf_desc.mb, dlaf_desc.nb);
   dlaf::comm::Index2D src_rank_index(dlaf_desc.isrc, dlaf_desc.jsrc);
 
   dlaf::matrix::Distribution distribution(matrix_size, block_size, grid.size(), grid.rank(),
                                           src_rank_index);
 
-  dlaf::matrix::ColMajorLayout layout{std::move(distribution), dlaf_desc.ld};
+  // All the local blocks preceding the submatrix are complete, therefore the local element index is
+  // given by the local block index.
+  const dlaf::SizeType i_lc =
+      distribution.next_local_tile_from_global_tile<Coord::Row>(dlaf_desc.i / dlaf_desc.mb) *
+      dlaf_desc.mb;
+  const dlaf::SizeType j_lc =
+      distribution.next_local_tile_from_global_tile<Coord::Col>(dlaf_desc.j / dlaf_desc.nb) *
+      dlaf_desc.nb;
 
-  return layout;
+  return {i_lc, j_lc};
+}
+
+dlaf::SizeType local_submatrix_offset(const struct DLAF_descriptor dlaf_desc,
+                                      dlaf::comm::CommunicatorGrid& grid) {
+  const auto [i_lc, j_lc] = local_submatrix_element_index(dlaf_desc, grid);
+  return i_lc + j_lc * dlaf_desc.ld;
+}
+
+dlaf::SizeType local_submatrix_col_offset(const struct DLAF_descriptor dlaf_desc,
+                                          dlaf::comm::CommunicatorGrid& grid) {
+  return std::get<1>(local_submatrix_element_index(dlaf_desc, grid));
 }
 
 dlaf::common::Ordering char2order(const char order) {
@@ -67,3 +130,60 @@ dlaf::comm::CommunicatorGrid& grid_from_context(int dlaf_context) {
     std::terminate();
   }
 }
+
+// Returns the most square grid of nranks ranks, with no more rows than columns.
+static dlaf::comm::Size2D auto_layout_grid_size(const int nranks) {
+  int rows = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(nranks))));
+  while (nranks % rows != 0)
+    --rows;
+  return {rows, nranks / rows};
+}
+
+// Returns the block size for a matrix of size n distributed on a grid of size grid_size.
+// The block size is reduced such that each rank owns at least a block in both directions (when
+// possible), and block_size_default is used when no entry of the table matches.
+static dlaf::SizeType auto_layout_block_size(const dlaf::SizeType n,
+                                             const dlaf::comm::Size2D& grid_size,
+                                             const dlaf::SizeType block_size_default) {
+  dlaf::SizeType nb = block_size_default;
+  for (const auto& [min_size, block_size] : dlaf::getTuneParameters().c_api_auto_layout_block_sizes) {
+    if (n >= min_size)
+      nb = block_size;
+  }
+
+  const dlaf::SizeType max_nb = n / std::max(grid_size.rows(), grid_size.cols());
+  return std::max<dlaf::SizeType>(1, std::min(nb, max_nb));
+}
+
+std::optional<AutoLayout> auto_layout_from_context(const int dlaf_context,
+                                                   const dlaf::matrix::Distribution& dist) {
+  if (!dlaf::getTuneParameters().c_api_auto_layout)
+    return std::nullopt;
+
+  auto& grid = grid_from_context(dlaf_context);
+
+  const dlaf::comm::Size2D grid_size = auto_layout_grid_size(grid.size().rows() * grid.size().cols());
+  const dlaf::SizeType nb = auto_layout_block_size(std::max(dist.size().rows(), dist.size().cols()),
+                                                   grid_size, dist.block_size().rows());
+  const dlaf::TileElementSize block_size(nb, nb);
+
+  if (grid_size == grid.size() && block_size == dist.block_size())
+    return std::nullopt;
+
+  // The grid of the context is reused if it has already the right shape, otherwise a new grid over
+  // the same ranks is created the first time and kept until the context is freed.
+  dlaf::comm::CommunicatorGrid* auto_grid = &grid;
+  if (grid_size != grid.size()) {
+    auto it = dlaf_auto_layout_grids.find(dlaf_context);
+    if (it == dlaf_auto_layout_grids.end())
+      it = dlaf_auto_layout_grids
+               .try_emplace(dlaf_context, grid.fullCommunicator(), grid_size.rows(), grid_size.cols(),
+                            dlaf::common::Ordering::ColumnMajor)
+               .first;
+    auto_grid = &it->second;
+  }
+
+  return AutoLayout{*auto_grid,
+                    dlaf::matrix::Distribution(dist.size(), block_size, auto_grid->size(),
+                                               auto_grid->rank(), dlaf::comm::Index2D(0, 0))};
+}
@@ -10,30 +10,162 @@
 
 #pragma once
 
+#include <optional>
 #include <tuple>
 
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/init.h>
 #include <dlaf/matrix/col_major_layout.h>
 #include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/matrix_ref.h>
+#include <dlaf/matrix/redistribution.h>
+#include <dlaf/types.h>
+#include <dlaf_c/desc.h>
 
+/// Returns true if the submatrix described by @p dlaf_desc starts at a block boundary of the global
+/// matrix.
+bool is_block_aligned(const struct DLAF_descriptor dlaf_desc) noexcept;
+
+/// Returns the distribution of the submatrix described by @p dlaf_desc as a matrix on its own, i.e. with
+/// the same block size as the global matrix and the source rank being the rank owning its first element.
+dlaf::matrix::Distribution make_submatrix_distribution(const struct DLAF_descriptor dlaf_desc,
+                                                       dlaf::comm::CommunicatorGrid& grid);
+
+/// Returns the layout of the submatrix described by @p dlaf_desc in the memory of the global matrix.
+///
+/// @pre is_block_aligned(dlaf_desc).
 dlaf::matrix::ColMajorLayout make_layout(const struct DLAF_descriptor dlaf_desc,
                                          dlaf::comm::CommunicatorGrid& grid);
 
+/// @pre is_block_aligned(dlaf_desc).
+dlaf::SizeType local_submatrix_offset(const struct DLAF_descriptor dlaf_desc,
+                                      dlaf::comm::CommunicatorGrid& grid);
+
+/// Returns the local index of the first column of the submatrix described by @p dlaf_desc, i.e. the
+/// offset of the local part of vectors distributed as the columns of the matrix (e.g. tau of QR).
+///
+/// @pre is_block_aligned(dlaf_desc).
+dlaf::SizeType local_submatrix_col_offset(const struct DLAF_descriptor dlaf_desc,
+                                          dlaf::comm::CommunicatorGrid& grid);
+
+/// Returns the pointer to the first local element of the submatrix described by @p dlaf_desc,
+/// given the pointer @p ptr to the first local element of the global matrix.
+///
+/// @pre is_block_aligned(dlaf_desc).
+template <class T>
+T* local_submatrix_ptr(const struct DLAF_descriptor dlaf_desc, dlaf::comm::CommunicatorGrid& grid,
+                       T* ptr) {
+  const dlaf::SizeType offset = local_submatrix_offset(dlaf_desc, grid);
+  return offset == 0 ? ptr : ptr + offset;
+}
+
+/// Host matrix of the submatrix described by a descriptor of the C API.
+///
+/// If the submatrix starts at a block boundary of the global matrix (see is_block_aligned) the matrix
+/// uses the memory of the global matrix in place. Otherwise, the submatrix is copied (with
+/// dlaf::matrix::redistribute) to a matrix allocated by DLA-Future, distributed as described by
+/// make_submatrix_distribution, and copy_back() copies it back to the global matrix.
+template <class T>
+class SubmatrixHost {
+  using MatrixHost = dlaf::matrix::Matrix<T, dlaf::Device::CPU>;
+  using MatrixRefHost = dlaf::matrix::internal::MatrixRef<T, dlaf::Device::CPU>;
+
+public:
+  /// @param ptr pointer to the first local element of the global matrix,
+  /// @param copy_in if false, the values of the submatrix are not copied to the allocated matrix (i.e.
+  ///        the submatrix is an output only).
+  SubmatrixHost(const struct DLAF_descriptor dlaf_desc, dlaf::comm::CommunicatorGrid& grid, T* ptr,
+                const bool copy_in = true)
+      : grid_(grid) {
+    if (is_block_aligned(dlaf_desc)) {
+      matrix_.emplace(make_layout(dlaf_desc, grid), local_submatrix_ptr(dlaf_desc, grid, ptr));
+      return;
+    }
+
+    struct DLAF_descriptor global_desc = dlaf_desc;
+    global_desc.m = dlaf_desc.i + dlaf_desc.m;
+    global_desc.n = dlaf_desc.j + dlaf_desc.n;
+    global_desc.i = 0;
+    global_desc.j = 0;
+
+    global_.emplace(make_layout(global_desc, grid), ptr);
+    global_ref_.emplace(*global_, dlaf::matrix::internal::SubMatrixSpec{{dlaf_desc.i, dlaf_desc.j},
+                                                                        {dlaf_desc.m, dlaf_desc.n}});
+    matrix_.emplace(make_submatrix_distribution(dlaf_desc, grid));
+
+    if (copy_in)
+      dlaf::matrix::redistribute(grid_, *global_ref_, grid_, *matrix_);
+  }
+
+  SubmatrixHost(const SubmatrixHost&) = delete;
+  SubmatrixHost& operator=(const SubmatrixHost&) = delete;
+  SubmatrixHost(SubmatrixHost&&) = delete;
+  SubmatrixHost& operator=(SubmatrixHost&&) = delete;
+
+  MatrixHost& get() noexcept {
+    return *matrix_;
+  }
+
+  /// Copies the values back to the global matrix (no-op if the submatrix is used in place).
+  void copy_back() {
+    if (global_ref_)
+      dlaf::matrix::redistribute(grid_, *matrix_, grid_, *global_ref_);
+  }
+
+  /// Waits for all the local tiles of the global matrix (or of the submatrix if used in place).
+  void waitLocalTiles() {
+    if (global_)
+      global_->waitLocalTiles();
+    else
+      matrix_->waitLocalTiles();
+  }
+
+private:
+  dlaf::comm::CommunicatorGrid& grid_;
+  std::optional<MatrixHost> global_;
+  std::optional<MatrixRefHost> global_ref_;
+  std::optional<MatrixHost> matrix_;
+};
+
 dlaf::common::Ordering char2order(const char order);
 
 dlaf::comm::CommunicatorGrid& grid_from_context(int dlaf_context);
 
+/// Grid and distribution on which the C API solves a problem when the auto layout is enabled.
+struct AutoLayout {
+  dlaf::comm::CommunicatorGrid& grid;
+  dlaf::matrix::Distribution distribution;
+};
+
+/// Returns the layout chosen by DLA-Future for a matrix distributed as @p dist on the grid of
+/// @p dlaf_context.
+///
+/// The grid is the most square one over the ranks of the context grid (with no more rows than columns)
+/// and the block size is selected according to dlaf::TuneParameters::c_api_auto_layout_block_sizes.
+/// Returns std::nullopt if the auto layout is disabled (see dlaf::TuneParameters::c_api_auto_layout)
+/// or if it would not change the grid shape and the block size of @p dist.
+std::optional<AutoLayout> auto_layout_from_context(int dlaf_context,
+                                                   const dlaf::matrix::Distribution& dist);
+
+// Resumes the pika runtime for the lifetime of the object, unless the runtime is kept running between
+// calls (see dlaf::configuration::c_api_persistent_runtime).
 struct [[nodiscard]] PikaRunningScope {
-  PikaRunningScope() {
-    pika::resume();
+  PikaRunningScope() : persistent_(dlaf::internal::getConfiguration().c_api_persistent_runtime) {
+    if (!persistent_)
+      pika::resume();
   }
 
   ~PikaRunningScope() {
-    pika::suspend();
+    if (!persistent_)
+      pika::suspend();
   }
 
   PikaRunningScope(const PikaRunningScope&) = delete;
   PikaRunningScope& operator=(const PikaRunningScope&) = delete;
   PikaRunningScope(PikaRunningScope&&) = delete;
   PikaRunningScope& operator=(PikaRunningScope&&) = delete;
+
+private:
+  bool persistent_;
 };
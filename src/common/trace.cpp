@@ -0,0 +1,172 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+#include <cxxabi.h>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/common/trace.h>
+
+namespace dlaf::common::internal {
+namespace {
+struct TraceBuffer {
+  std::size_t thread_id;
+  std::vector<TraceEvent> events;
+  std::size_t dropped_events = 0;
+};
+
+std::atomic<bool> trace_enabled = false;
+std::atomic<std::size_t> trace_max_events_per_thread = 0;
+TraceClock::time_point trace_origin;
+
+thread_local TraceTileIndex current_tile;
+
+// Note: buffers are never deallocated, as they are referenced by the thread_local pointers.
+std::mutex buffers_mutex;
+std::vector<std::unique_ptr<TraceBuffer>> buffers;
+
+TraceBuffer& localBuffer() {
+  thread_local TraceBuffer* buffer = nullptr;
+  if (buffer == nullptr) {
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    buffers.push_back(std::make_unique<TraceBuffer>(TraceBuffer{buffers.size(), {}}));
+    buffer = buffers.back().get();
+  }
+  return *buffer;
+}
+
+std::string demangle(const std::type_info& type) {
+  int status = 0;
+  std::unique_ptr<char, void (*)(void*)> name(abi::__cxa_demangle(type.name(), nullptr, nullptr,
+                                                                  &status),
+                                              std::free);
+  return status == 0 ? std::string(name.get()) : std::string(type.name());
+}
+
+void writeJsonString(std::ostream& os, const std::string& str) {
+  os << '"';
+  for (const char c : str) {
+    if (c == '"' || c == '\\')
+      os << '\\';
+    os << c;
+  }
+  os << '"';
+}
+
+double toMicroseconds(const TraceClock::duration& duration) {
+  return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void clearBuffers() {
+  std::lock_guard<std::mutex> lock(buffers_mutex);
+  for (auto& buffer : buffers) {
+    buffer->events.clear();
+    buffer->dropped_events = 0;
+  }
+}
+}
+
+bool traceEnabled() noexcept {
+  return trace_enabled.load(std::memory_order_relaxed);
+}
+
+void enableTrace(const std::size_t max_events_per_thread) {
+  trace_origin = TraceClock::now();
+  trace_max_events_per_thread = max_events_per_thread;
+  trace_enabled = true;
+}
+
+void disableTrace() {
+  trace_enabled = false;
+  clearBuffers();
+}
+
+void recordTraceEvent(const TraceEvent& event) {
+  TraceBuffer& buffer = localBuffer();
+  if (buffer.events.size() < trace_max_events_per_thread.load(std::memory_order_relaxed))
+    buffer.events.push_back(event);
+  else
+    ++buffer.dropped_events;
+}
+
+TraceTileIndex currentTraceTile() noexcept {
+  return current_tile;
+}
+
+TraceTileScope::TraceTileScope(const SizeType row, const SizeType col) noexcept
+    : previous_(current_tile) {
+  current_tile = {row, col};
+}
+
+TraceTileScope::~TraceTileScope() {
+  current_tile = previous_;
+}
+
+void exportTrace(const std::string& filename, const int rank) {
+  std::ofstream os(filename);
+  DLAF_ASSERT(os.good(), "Cannot open the trace file.", filename);
+
+  // Note: timestamps are in microseconds, with nanoseconds precision.
+  os << std::fixed << std::setprecision(3);
+  os << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+  os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << rank
+     << ",\"args\":{\"name\":\"rank " << rank << "\"}}";
+
+  {
+    std::unordered_map<const std::type_info*, std::string> names;
+
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+
+    std::size_t dropped_events = 0;
+    for (const auto& buffer : buffers)
+      dropped_events += buffer->dropped_events;
+    if (dropped_events > 0) {
+      std::cerr << "[WARNING] " << dropped_events << " trace events of rank " << rank
+                << " have been dropped (see configuration::trace_max_events_per_thread)." << std::endl;
+      os << ",\n{\"name\":\"dropped_events\",\"ph\":\"M\",\"pid\":" << rank
+         << ",\"args\":{\"count\":" << dropped_events << "}}";
+    }
+
+    for (const auto& buffer : buffers) {
+      for (const auto& event : buffer->events) {
+        auto name = names.find(event.name);
+        if (name == names.end())
+          name = names.emplace(event.name, demangle(*event.name)).first;
+
+        os << ",\n{\"name\":";
+        writeJsonString(os, name->second);
+        os << ",\"cat\":\"" << event.category << "\",\"ph\":\"X\",\"pid\":" << rank
+           << ",\"tid\":" << buffer->thread_id
+           << ",\"ts\":" << toMicroseconds(event.begin - trace_origin)
+           << ",\"dur\":" << toMicroseconds(event.end - event.begin);
+        if (event.tile.row >= 0)
+          os << ",\"args\":{\"tile\":[" << event.tile.row << "," << event.tile.col << "]}";
+        os << "}";
+      }
+    }
+  }
+
+  os << "\n]}\n";
+
+  clearBuffers();
+}
+}
@@ -20,6 +20,7 @@
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/communication/error.h>
 #include <dlaf/communication/index.h>
+#include <dlaf/metrics.h>
 #include <dlaf/sender/transform_mpi.h>
 
 namespace dlaf {
@@ -59,6 +60,11 @@ CommunicatorGrid::CommunicatorGrid(Communicator comm, IndexT_MPI nrows, IndexT_M
   row_ = make_communicator_managed(mpi_row);
   col_ = make_communicator_managed(mpi_col);
 
+  // Note: the type is inherited by the clones used by the pipelines.
+  internal::setCommunicatorType(full_, CommunicatorType::Full);
+  internal::setCommunicatorType(row_, CommunicatorType::Row);
+  internal::setCommunicatorType(col_, CommunicatorType::Col);
+
   using dlaf::internal::WithResultOf;
 
   full_pipelines_ = RoundRobinPipeline<CommunicatorType::Full>(
@@ -10,10 +10,16 @@
 
 #include <complex>
 
+#include <dlaf/factorization/qr/impl.h>
 #include <dlaf/factorization/qr/t_factor_impl.h>
 
 namespace dlaf::factorization::internal {
 
+DLAF_FACTORIZATION_QR_ETI(, Backend::GPU, Device::GPU, float)
+DLAF_FACTORIZATION_QR_ETI(, Backend::GPU, Device::GPU, double)
+DLAF_FACTORIZATION_QR_ETI(, Backend::GPU, Device::GPU, std::complex<float>)
+DLAF_FACTORIZATION_QR_ETI(, Backend::GPU, Device::GPU, std::complex<double>)
+
 DLAF_FACTORIZATION_QR_TFACTOR_ETI(, Backend::GPU, Device::GPU, float)
 DLAF_FACTORIZATION_QR_TFACTOR_ETI(, Backend::GPU, Device::GPU, double)
 DLAF_FACTORIZATION_QR_TFACTOR_ETI(, Backend::GPU, Device::GPU, std::complex<float>)
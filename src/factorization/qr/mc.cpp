@@ -10,10 +10,16 @@
 
 #include <complex>
 
+#include <dlaf/factorization/qr/impl.h>
 #include <dlaf/factorization/qr/t_factor_impl.h>
 
 namespace dlaf::factorization::internal {
 
+DLAF_FACTORIZATION_QR_ETI(, Backend::MC, Device::CPU, float)
+DLAF_FACTORIZATION_QR_ETI(, Backend::MC, Device::CPU, double)
+DLAF_FACTORIZATION_QR_ETI(, Backend::MC, Device::CPU, std::complex<float>)
+DLAF_FACTORIZATION_QR_ETI(, Backend::MC, Device::CPU, std::complex<double>)
+
 DLAF_FACTORIZATION_QR_TFACTOR_ETI(, Backend::MC, Device::CPU, float)
 DLAF_FACTORIZATION_QR_TFACTOR_ETI(, Backend::MC, Device::CPU, double)
 DLAF_FACTORIZATION_QR_TFACTOR_ETI(, Backend::MC, Device::CPU, std::complex<float>)
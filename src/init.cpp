@@ -17,16 +17,21 @@
 #include <iostream>
 #include <memory>
 #include <optional>
+#include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <pika/mpi.hpp>
 #include <pika/runtime.hpp>
 
 #include <dlaf/common/assert.h>
+#include <dlaf/common/trace.h>
 #include <dlaf/communication/error.h>
 #include <dlaf/init.h>
 #include <dlaf/matrix/allocation_io.h>
 #include <dlaf/memory/memory_chunk.h>
+#include <dlaf/metrics.h>
 #include <dlaf/tune.h>
 
 namespace dlaf {
@@ -52,6 +57,11 @@ std::ostream& operator<<(std::ostream& os, const configuration& cfg) {
   os << "  umpire_device_memory_pool_coalescing_reallocation_ratio = " << cfg.umpire_device_memory_pool_coalescing_reallocation_ratio << std::endl;
   os << "  num_gpu_blas_handles = " << cfg.num_gpu_blas_handles << std::endl;
   os << "  num_gpu_lapack_handles = " << cfg.num_gpu_lapack_handles << std::endl;
+  os << "  c_api_persistent_runtime = " << cfg.c_api_persistent_runtime << std::endl;
+  os << "  hdf5_io_pool = " << cfg.hdf5_io_pool << std::endl;
+  os << "  trace_file = " << cfg.trace_file << std::endl;
+  os << "  trace_max_events_per_thread = " << cfg.trace_max_events_per_thread << std::endl;
+  os << "  metrics = " << cfg.metrics << std::endl;
   os << "  mpi_pool = " << pika::mpi::experimental::get_pool_name() << std::endl;
   // clang-format on
   return os;
@@ -192,6 +202,27 @@ private:
   }
 };
 
+template <>
+struct parseFromString<std::vector<std::pair<SizeType, SizeType>>> {
+  // Parses a list of pairs in the format "first:second,first:second,...".
+  static std::optional<std::vector<std::pair<SizeType, SizeType>>> call(const std::string& var) {
+    std::vector<std::pair<SizeType, SizeType>> pairs;
+    std::istringstream entries(var);
+    for (std::string entry; std::getline(entries, entry, ',');) {
+      const auto sep = entry.find(':');
+      if (sep == std::string::npos)
+        return std::nullopt;
+      try {
+        pairs.emplace_back(std::stoll(entry.substr(0, sep)), std::stoll(entry.substr(sep + 1)));
+      }
+      catch (const std::exception&) {
+        return std::nullopt;
+      }
+    }
+    return pairs;
+  }
+};
+
 template <class T>
 struct parseFromCommandLine {
   static T call(const pika::program_options::variables_map& vm, const std::string& cmd_val) {
@@ -199,6 +230,19 @@ struct parseFromCommandLine {
   }
 };
 
+template <>
+struct parseFromCommandLine<std::vector<std::pair<SizeType, SizeType>>> {
+  static std::vector<std::pair<SizeType, SizeType>> call(const pika::program_options::variables_map& vm,
+                                                         const std::string& cmd_val) {
+    const auto value = vm[cmd_val].as<std::string>();
+    if (auto parsed_value = parseFromString<std::vector<std::pair<SizeType, SizeType>>>::call(value))
+      return parsed_value.value();
+
+    std::cerr << "Command line option " << cmd_val << " has an invalid value (='" << value << "').\n";
+    std::terminate();
+  }
+};
+
 template <class T>
 void updateConfigurationValue(const pika::program_options::variables_map& vm, T& var,
                               const std::string& env_var, const std::string& cmdline_option) {
@@ -275,6 +319,16 @@ void updateConfiguration(const pika::program_options::variables_map& vm, configu
   updateConfigurationValue(vm, cfg.umpire_device_memory_pool_coalescing_reallocation_ratio, "UMPIRE_DEVICE_MEMORY_POOL_COALESCING_REALLOCATION_RATIO", "umpire-device-memory-pool-coalescing-reallocation-ratio");
   updateConfigurationValue(vm, cfg.num_gpu_blas_handles, "NUM_GPU_BLAS_HANDLES", "num-gpu-blas-handles");
   updateConfigurationValue(vm, cfg.num_gpu_lapack_handles, "NUM_GPU_LAPACK_HANDLES", "num-gpu-lapack-handles");
+  updateConfigurationValue(vm, cfg.c_api_persistent_runtime, "C_API_PERSISTENT_RUNTIME", "c-api-persistent-runtime");
+  updateConfigurationValue(vm, cfg.hdf5_io_pool, "HDF5_IO_POOL", "hdf5-io-pool");
+#ifdef DLAF_WITH_TRACE
+  updateConfigurationValue(vm, cfg.trace_file, "TRACE_FILE", "trace-file");
+  updateConfigurationValue(vm, cfg.trace_max_events_per_thread, "TRACE_MAX_EVENTS_PER_THREAD", "trace-max-events-per-thread");
+#else
+  warnUnusedConfigurationOption(vm, "TRACE_FILE", "trace-file", "only supported with DLAF_WITH_TRACE");
+  warnUnusedConfigurationOption(vm, "TRACE_MAX_EVENTS_PER_THREAD", "trace-max-events-per-thread", "only supported with DLAF_WITH_TRACE");
+#endif
+  updateConfigurationValue(vm, cfg.metrics, "METRICS", "metrics");
 
   // update tune parameters
   //
@@ -287,13 +341,21 @@ void updateConfiguration(const pika::program_options::variables_map& vm, configu
   if (default_allocation_layout_str != "") {
     param.default_allocation_layout = matrix::allocation_layout_from(default_allocation_layout_str);
   }
+  updateConfigurationValue(vm, param.cholesky_broadcast_panel_ring, "CHOLESKY_BROADCAST_PANEL_RING", "cholesky-broadcast-panel-ring");
   updateConfigurationValue(vm, param.tfactor_num_threads, "TFACTOR_NUM_THREADS", "tfactor-num-threads");
   updateConfigurationValue(vm, param.tfactor_num_streams, "TFACTOR_NUM_STREAMS", "tfactor-num-streams");
   updateConfigurationValue(vm, param.tfactor_barrier_busy_wait_us, "TFACTOR_BARRIER_BUSY_WAIT_US", "tfactor-barrier-busy-wait-us");
   updateConfigurationValue(vm, param.red2band_panel_num_threads, "RED2BAND_PANEL_NUM_THREADS", "red2band-panel-num-threads");
   updateConfigurationValue(vm, param.red2band_barrier_busy_wait_us, "RED2BAND_BARRIER_BUSY_WAIT_US", "red2band-barrier-busy-wait-us");
+  updateConfigurationValue(vm, param.red2band_broadcast_panel_ring, "RED2BAND_BROADCAST_PANEL_RING", "red2band-broadcast-panel-ring");
   updateConfigurationValue(vm, param.eigensolver_min_band, "EIGENSOLVER_MIN_BAND", "eigensolver-min-band");
+  updateConfigurationValue(vm, param.eigensolver_one_stage_max_size, "EIGENSOLVER_ONE_STAGE_MAX_SIZE", "eigensolver-one-stage-max-size");
+  updateConfigurationValue(vm, param.eigensolver_one_stage_distributed, "EIGENSOLVER_ONE_STAGE_DISTRIBUTED", "eigensolver-one-stage-distributed");
+  updateConfigurationValue(vm, param.eigensolver_one_stage_max_nranks, "EIGENSOLVER_ONE_STAGE_MAX_NRANKS", "eigensolver-one-stage-max-nranks");
+  updateConfigurationValue(vm, param.eigensolver_checkpoint_file, "EIGENSOLVER_CHECKPOINT_FILE", "eigensolver-checkpoint-file");
   updateConfigurationValue(vm, param.band_to_tridiag_1d_block_size_base, "BAND_TO_TRIDIAG_1D_BLOCK_SIZE_BASE", "band-to-tridiag-1d-block-size-base");
+  updateConfigurationValue(vm, param.band_to_tridiag_sweeps_per_task, "BAND_TO_TRIDIAG_SWEEPS_PER_TASK", "band-to-tridiag-sweeps-per-task");
+  updateConfigurationValue(vm, param.band_to_tridiag_persistent_requests, "BAND_TO_TRIDIAG_PERSISTENT_REQUESTS", "band-to-tridiag-persistent-requests");
 
   updateConfigurationValue(vm, param.debug_dump_cholesky_factorization_data, "DEBUG_DUMP_CHOLESKY_FACTORIZATION_DATA", "");
   updateConfigurationValue(vm, param.debug_dump_generalized_eigensolver_data, "DEBUG_DUMP_GENERALIZED_EIGENSOLVER_DATA", "");
@@ -304,14 +366,24 @@ void updateConfiguration(const pika::program_options::variables_map& vm, configu
   updateConfigurationValue(vm, param.debug_dump_band_to_tridiagonal_data, "DEBUG_DUMP_BAND_TO_TRIDIAGONAL_DATA", "");
   updateConfigurationValue(vm, param.debug_dump_triangular_inverse_data, "DEBUG_DUMP_TRIANGULAR_INVERSE_DATA", "");
   updateConfigurationValue(vm, param.debug_dump_tridiag_solver_data, "DEBUG_DUMP_TRIDIAG_SOLVER_DATA", "");
+  updateConfigurationValue(vm, param.debug_tridiag_solver_merge_stats, "DEBUG_TRIDIAG_SOLVER_MERGE_STATS", "");
 
   updateConfigurationValue(vm, param.tridiag_rank1_num_threads, "TRIDIAG_RANK1_NUM_THREADS", "tridiag-rank1-num-threads");
 
   updateConfigurationValue(vm, param.tridiag_rank1_barrier_busy_wait_us, "TRIDIAG_RANK1_BARRIER_BUSY_WAIT_US", "tridiag-rank1-barrier-busy-wait-us");
 
+  updateConfigurationValue(vm, param.tridiag_partial_spectrum_threshold, "TRIDIAG_PARTIAL_SPECTRUM_THRESHOLD", "tridiag-partial-spectrum-threshold");
+  updateConfigurationValue(vm, param.tridiag_max_concurrent_merges, "TRIDIAG_MAX_CONCURRENT_MERGES", "tridiag-max-concurrent-merges");
+
   updateConfigurationValue(vm, param.bt_band_to_tridiag_hh_apply_group_size, "BT_BAND_TO_TRIDIAG_HH_APPLY_GROUP_SIZE", "bt-band-to-tridiag-hh-apply-group-size");
 
+  updateConfigurationValue(vm, param.permutations_pipeline_num_tiles, "PERMUTATIONS_PIPELINE_NUM_TILES", "permutations-pipeline-num-tiles");
+  updateConfigurationValue(vm, param.broadcast_panel_aggregate_max_bytes, "BROADCAST_PANEL_AGGREGATE_MAX_BYTES", "broadcast-panel-aggregate-max-bytes");
+
   updateConfigurationValue(vm, param.communicator_grid_num_pipelines, "COMMUNICATOR_GRID_NUM_PIPELINES", "communicator-grid-num-pipelines");
+
+  updateConfigurationValue(vm, param.c_api_auto_layout, "C_API_AUTO_LAYOUT", "c-api-auto-layout");
+  updateConfigurationValue(vm, param.c_api_auto_layout_block_sizes, "C_API_AUTO_LAYOUT_BLOCK_SIZES", "c-api-auto-layout-block-sizes");
   // clang-format on
 }
 
@@ -344,20 +416,39 @@ pika::program_options::options_description getOptionsDescription() {
   desc.add_options()("dlaf:num-gpu-blas-handles", pika::program_options::value<std::size_t>(), "Number of GPU BLAS (cuBLAS/rocBLAS) handles");
   desc.add_options()("dlaf:num-gpu-lapack-handles", pika::program_options::value<std::size_t>(), "Number of GPU LAPACK (cuSOLVER/rocSOLVER) handles");
   desc.add_options()("dlaf:no-mpi-pool", pika::program_options::bool_switch(), "Disable the MPI pool.");
+  desc.add_options()("dlaf:c-api-persistent-runtime", "Keep the pika runtime running between C API calls");
+  desc.add_options()("dlaf:hdf5-io-pool", pika::program_options::value<std::string>(), "Name of the pika thread pool for the asynchronous HDF5 I/O (the default pool is used if it does not exist).");
+  desc.add_options()("dlaf:trace-file", pika::program_options::value<std::string>(), "Record the tasks run by DLA-Future and write the timeline of each rank in <trace-file>.<rank>.json (Chrome trace event format).");
+  desc.add_options()("dlaf:trace-max-events-per-thread", pika::program_options::value<std::size_t>(), "Maximum number of events recorded by each thread (further events are dropped).");
+  desc.add_options()("dlaf:metrics", "Count the FLOPs of the tile kernels, the bytes communicated and the bytes allocated (see dlaf::getMetrics).");
 
   // Tune parameters command line options
   desc.add_options()("dlaf:default_allocation_layout", pika::program_options::value<std::string>(), "The default AllocationLayout for Matrices.");
+  desc.add_options()("dlaf:cholesky-broadcast-panel-ring", "Broadcast the panels of the distributed Cholesky factorization with a pipelined ring of point to point communications.");
   desc.add_options()("dlaf:tfactor-num-threads", pika::program_options::value<std::size_t>(), "The maximum number of threads to use for computing the tfactor.");
   desc.add_options()("dlaf:tfactor-num-streams", pika::program_options::value<std::size_t>(), "The maximum number of GPU streams to use for computing the tfactor.");
   desc.add_options()("dlaf:tfactor-barrier-busy-wait-us", pika::program_options::value<std::size_t>(), "The duration in microseconds to busy-wait in barriers in the tfactor algorithm.");
   desc.add_options()("dlaf:red2band-panel-num-threads", pika::program_options::value<std::size_t>(), "The maximum number of threads to use for computing the panel in the reduction to band algorithm.");
   desc.add_options()("dlaf:red2band-barrier-busy-wait-us", pika::program_options::value<std::size_t>(), "The duration in microseconds to busy-wait in barriers in the reduction to band algorithm.");
+  desc.add_options()("dlaf:red2band-broadcast-panel-ring", "Broadcast the panels of the reduction to band algorithm with a pipelined ring of point to point communications.");
   desc.add_options()("dlaf:eigensolver-min-band", pika::program_options::value<SizeType>(), "The minimum value to start looking for a divisor of the block size. When larger than the block size, the block size will be used instead.");
+  desc.add_options()("dlaf:eigensolver-one-stage-max-size", pika::program_options::value<SizeType>(), "Matrices up to this size are reduced to tridiagonal form by the eigensolver with the one-stage algorithm. 0 disables it.");
+  desc.add_options()("dlaf:eigensolver-one-stage-distributed", "Enable the one-stage tridiagonal reduction in the distributed eigensolver.");
+  desc.add_options()("dlaf:eigensolver-one-stage-max-nranks", pika::program_options::value<SizeType>(), "Maximum number of ranks of the grid for using the one-stage tridiagonal reduction in the distributed eigensolver.");
+  desc.add_options()("dlaf:eigensolver-checkpoint-file", pika::program_options::value<std::string>(), "HDF5 file used by the distributed eigensolver for checkpointing the results of each stage and restarting from them (empty disables it).");
   desc.add_options()("dlaf:band-to-tridiag-1d-block-size-base", pika::program_options::value<SizeType>(), "The 1D block size for band_to_tridiagonal is computed as 1d_block_size_base / nb * nb. (The input matrix is distributed with a {nb x nb} block size.)");
+  desc.add_options()("dlaf:band-to-tridiag-sweeps-per-task", pika::program_options::value<SizeType>(), "Number of consecutive sweeps chased by each task of the local band to tridiagonal reduction on CPU.");
+  desc.add_options()("dlaf:band-to-tridiag-persistent-requests", "Use MPI persistent requests for the columns exchanged by the distributed band to tridiagonal reduction.");
   desc.add_options()("dlaf:tridiag-rank1-num-threads", pika::program_options::value<std::size_t>(), "The maximum number of threads to use for computing rank1 problem solution in tridiagonal solver algorithm.");
   desc.add_options()("dlaf:tridiag-rank1-barrier-busy-wait-us", pika::program_options::value<std::size_t>(), "The duration in microseconds to busy-wait in barriers when computing rank1 problem solution in the tridiagonal solver algorithm.");
+  desc.add_options()("dlaf:tridiag-partial-spectrum-threshold", pika::program_options::value<double>(), "The tridiagonal solver computes only the requested eigenvectors with MRRR if their number is at most threshold * N (0 disables it).");
+  desc.add_options()("dlaf:tridiag-max-concurrent-merges", pika::program_options::value<SizeType>(), "The maximum number of merges of the D&C tree of the tridiagonal solver that can run concurrently (0 means no limit).");
   desc.add_options()("dlaf:bt-band-to-tridiag-hh-apply-group-size", pika::program_options::value<SizeType>(), "The application of the HH reflector is splitted in smaller applications of group size reflectors.");
+  desc.add_options()("dlaf:permutations-pipeline-num-tiles", pika::program_options::value<SizeType>(), "The number of tiles of each chunk in distributed permutations, such that packing, communication and unpacking of different chunks overlap (0 disables the chunking).");
+  desc.add_options()("dlaf:broadcast-panel-aggregate-max-bytes", pika::program_options::value<SizeType>(), "Panels on CPU with local tiles up to this number of bytes are broadcast with a single collective instead of one per tile (0 disables it).");
   desc.add_options()("dlaf:communicator-grid-num-pipelines", pika::program_options::value<std::size_t>(), "The default number of row, column, and full communicator pipelines to initialize in CommunicatorGrid.");
+  desc.add_options()("dlaf:c-api-auto-layout", "The C API eigensolver and Cholesky redistribute the matrices to a block size and grid chosen by DLA-Future.");
+  desc.add_options()("dlaf:c-api-auto-layout-block-sizes", pika::program_options::value<std::string>(), "The block sizes used by the C API auto layout, as a list \"min_size:block_size,...\" sorted by matrix size.");
   // clang-format on
 
   return desc;
@@ -402,6 +493,14 @@ void initialize(const pika::program_options::variables_map& vm, const configurat
 #ifdef DLAF_WITH_GPU
   internal::Init<Backend::GPU>::initialize(cfg);
 #endif
+#ifdef DLAF_WITH_TRACE
+  if (!cfg.trace_file.empty())
+    common::internal::enableTrace(cfg.trace_max_events_per_thread);
+#endif
+  if (cfg.metrics) {
+    resetMetrics();
+    internal::enableMetrics();
+  }
   internal::initialized() = true;
 }
 
@@ -417,6 +516,16 @@ void initialize(int argc, const char* const argv[], const configuration& user_cf
 
 void finalize() {
   DLAF_ASSERT(internal::initialized(), "");
+#ifdef DLAF_WITH_TRACE
+  if (const std::string& trace_file = internal::getConfiguration().trace_file; !trace_file.empty()) {
+    int rank = 0;
+    if (dlaf::internal::mpi_initialized())
+      DLAF_MPI_CHECK_ERROR(MPI_Comm_rank(MPI_COMM_WORLD, &rank));
+    common::internal::exportTrace(trace_file + "." + std::to_string(rank) + ".json", rank);
+    common::internal::disableTrace();
+  }
+#endif
+  internal::disableMetrics();
   internal::Init<Backend::MC>::finalize();
 #ifdef DLAF_WITH_GPU
   internal::Init<Backend::GPU>::finalize();
@@ -0,0 +1,109 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <complex>
+
+#include <whip.hpp>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/gpu/assert.cu.h>
+#include <dlaf/gpu/blas/api.h>
+#include <dlaf/lapack/gpu/lacpy_conj_trans.h>
+#include <dlaf/types.h>
+#include <dlaf/util_cublas.h>
+#include <dlaf/util_math.h>
+
+namespace dlaf::gpulapack {
+namespace kernels {
+
+using namespace dlaf::util::cuda_operators;
+
+struct LacpyConjTransParams {
+  static constexpr unsigned kernel_tile_size = 32;
+};
+
+// Each block copies a (kernel_tile_size x kernel_tile_size) tile of b, i.e. b(i, j) = conj(a(j, i)).
+// The block is staged in shared memory to have coalesced reads of a and writes of b.
+template <class T>
+__global__ void lacpy_conj_trans(cublasFillMode_t uplo, const unsigned m, const unsigned n,
+                                 const T* a, const unsigned lda, T* b, const unsigned ldb) {
+  constexpr unsigned kernel_tile_size = LacpyConjTransParams::kernel_tile_size;
+
+  DLAF_GPU_ASSERT_HEAVY(kernel_tile_size == blockDim.x);
+  DLAF_GPU_ASSERT_HEAVY(kernel_tile_size == blockDim.y);
+  DLAF_GPU_ASSERT_HEAVY(1 == blockDim.z);
+  DLAF_GPU_ASSERT_HEAVY(gridDim.x == ceilDiv(n, kernel_tile_size));
+  DLAF_GPU_ASSERT_HEAVY(gridDim.y == ceilDiv(m, kernel_tile_size));
+  DLAF_GPU_ASSERT_HEAVY(1 == gridDim.z);
+
+  // Skip the blocks which do not contain any element of the uplo triangle of b.
+  if ((uplo == CUBLAS_FILL_MODE_LOWER && blockIdx.x < blockIdx.y) ||
+      (uplo == CUBLAS_FILL_MODE_UPPER && blockIdx.x > blockIdx.y))
+    return;
+
+  __shared__ T buffer[kernel_tile_size][kernel_tile_size + 1];
+
+  // Read a(ia, ja) (coalesced along ia).
+  const unsigned ia = blockIdx.y * kernel_tile_size + threadIdx.x;
+  const unsigned ja = blockIdx.x * kernel_tile_size + threadIdx.y;
+  if (ia < m && ja < n)
+    buffer[threadIdx.y][threadIdx.x] = conj(a[ia + ja * lda]);
+
+  __syncthreads();
+
+  // Write b(ib, jb) (coalesced along ib).
+  const unsigned ib = blockIdx.x * kernel_tile_size + threadIdx.x;
+  const unsigned jb = blockIdx.y * kernel_tile_size + threadIdx.y;
+  if (ib >= n || jb >= m)
+    return;
+
+  switch (uplo) {
+    case CUBLAS_FILL_MODE_LOWER:
+      if (dlaf::util::isLower(ib, jb))
+        b[ib + jb * ldb] = buffer[threadIdx.x][threadIdx.y];
+      break;
+    case CUBLAS_FILL_MODE_UPPER:
+      if (dlaf::util::isUpper(ib, jb))
+        b[ib + jb * ldb] = buffer[threadIdx.x][threadIdx.y];
+      break;
+    case CUBLAS_FILL_MODE_FULL:
+      b[ib + jb * ldb] = buffer[threadIdx.x][threadIdx.y];
+      break;
+  }
+}
+}
+
+template <class T>
+void lacpy_conj_trans(const blas::Uplo uplo, const SizeType m, const SizeType n, const T* a,
+                      const SizeType lda, T* b, const SizeType ldb, const whip::stream_t stream) {
+  if (m == 0 || n == 0)
+    return;
+
+  DLAF_ASSERT_HEAVY(m <= lda, m, lda);
+  DLAF_ASSERT_HEAVY(n <= ldb, n, ldb);
+  DLAF_ASSERT_HEAVY(uplo == blas::Uplo::General || m == n, uplo, m, n);
+
+  constexpr unsigned kernel_tile_size = kernels::LacpyConjTransParams::kernel_tile_size;
+
+  const unsigned um = to_uint(m);
+  const unsigned un = to_uint(n);
+
+  const dim3 nr_threads(kernel_tile_size, kernel_tile_size);
+  const dim3 nr_blocks(util::ceilDiv(un, kernel_tile_size), util::ceilDiv(um, kernel_tile_size));
+  kernels::lacpy_conj_trans<<<nr_blocks, nr_threads, 0, stream>>>(
+      util::blasToCublas(uplo), um, un, util::cppToCudaCast(a), to_uint(lda), util::cppToCudaCast(b),
+      to_uint(ldb));
+}
+
+DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(, float);
+DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(, double);
+DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(, std::complex<float>);
+DLAF_CUBLAS_LACPY_CONJ_TRANS_ETI(, std::complex<double>);
+}
@@ -0,0 +1,111 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <mpi.h>
+
+#include <dlaf/common/assert.h>
+#include <dlaf/communication/error.h>
+#include <dlaf/matrix/redistribution.h>
+
+namespace dlaf::matrix {
+namespace {
+// Splits the range [0, size) along coordinate C at the tile boundaries of both distributions.
+template <Coord C>
+std::vector<RedistributionPlan::Segment> computeSegments(const Distribution& src_dist,
+                                                         const Distribution& dst_dist) {
+  std::vector<RedistributionPlan::Segment> segments;
+  for (SizeType i = 0; i < src_dist.size().get<C>();) {
+    const SizeType src_tile = src_dist.global_tile_from_global_element<C>(i);
+    const SizeType src_tile_element = src_dist.tile_element_from_global_element<C>(i);
+    const SizeType dst_tile = dst_dist.global_tile_from_global_element<C>(i);
+    const SizeType dst_tile_element = dst_dist.tile_element_from_global_element<C>(i);
+
+    const SizeType size = std::min(src_dist.global_tile_size_of<C>(src_tile) - src_tile_element,
+                                   dst_dist.global_tile_size_of<C>(dst_tile) - dst_tile_element);
+
+    segments.push_back({size, src_dist.rank_global_tile<C>(src_tile), src_tile, src_tile_element,
+                        dst_dist.rank_global_tile<C>(dst_tile), dst_tile, dst_tile_element});
+    i += size;
+  }
+  return segments;
+}
+}
+
+RedistributionPlan::RedistributionPlan(comm::CommunicatorGrid& src_grid, const Distribution& src_dist,
+                                       comm::CommunicatorGrid& dst_grid, const Distribution& dst_dist)
+    : src_dist_(src_dist), dst_dist_(dst_dist),
+      row_segments_(computeSegments<Coord::Row>(src_dist, dst_dist)),
+      col_segments_(computeSegments<Coord::Col>(src_dist, dst_dist)) {
+  DLAF_ASSERT(src_dist.size() == dst_dist.size(), src_dist.size(), dst_dist.size());
+  DLAF_ASSERT(src_dist.grid_size() == src_grid.size(), src_dist.grid_size(), src_grid.size());
+  DLAF_ASSERT(src_dist.rank_index() == src_grid.rank(), src_dist.rank_index(), src_grid.rank());
+  DLAF_ASSERT(dst_dist.grid_size() == dst_grid.size(), dst_dist.grid_size(), dst_grid.size());
+  DLAF_ASSERT(dst_dist.rank_index() == dst_grid.rank(), dst_dist.rank_index(), dst_grid.rank());
+
+  const comm::IndexT_MPI nranks = src_grid.fullCommunicator().size();
+  DLAF_ASSERT(nranks == dst_grid.fullCommunicator().size(), nranks,
+              dst_grid.fullCommunicator().size());
+
+  // Map the ranks of the full communicator of the destination grid to the ones of the source grid
+  // (which is used for communicating).
+  const comm::IndexT_MPI dst_rank_full = dst_grid.rankFullCommunicator(dst_grid.rank());
+  std::vector<comm::IndexT_MPI> dst_ranks_full(to_sizet(nranks));
+  DLAF_MPI_CHECK_ERROR(MPI_Allgather(&dst_rank_full, 1, MPI_INT, dst_ranks_full.data(), 1, MPI_INT,
+                                     src_grid.fullCommunicator()));
+  dst_to_src_comm_rank_.resize(to_sizet(nranks));
+  for (comm::IndexT_MPI rank = 0; rank < nranks; ++rank)
+    dst_to_src_comm_rank_[to_sizet(dst_ranks_full[to_sizet(rank)])] = rank;
+
+  // Each chunk contains the column segments of a tile column of the destination distribution.
+  chunk_begin_.reserve(to_sizet(nr_chunks()) + 1);
+  for (std::size_t cs_index = 0; cs_index < col_segments_.size(); ++cs_index) {
+    if (cs_index == 0 || col_segments_[cs_index].dst_tile != col_segments_[cs_index - 1].dst_tile)
+      chunk_begin_.push_back(cs_index);
+  }
+  chunk_begin_.push_back(col_segments_.size());
+  DLAF_ASSERT(to_SizeType(chunk_begin_.size()) == nr_chunks() + 1, chunk_begin_.size(), nr_chunks());
+
+  // Number of rows exchanged between the local row of tiles and each row of the other grid.
+  const comm::Index2D src_rank = src_dist.rank_index();
+  const comm::Index2D dst_rank = dst_dist.rank_index();
+  std::vector<SizeType> send_rows(to_sizet(dst_dist.grid_size().rows()), 0);
+  std::vector<SizeType> recv_rows(to_sizet(src_dist.grid_size().rows()), 0);
+  for (const auto& rs : row_segments_) {
+    if (rs.src_rank == src_rank.row())
+      send_rows[to_sizet(rs.dst_rank)] += rs.size;
+    if (rs.dst_rank == dst_rank.row())
+      recv_rows[to_sizet(rs.src_rank)] += rs.size;
+  }
+
+  send_counts_.resize(to_sizet(nr_chunks()), std::vector<int>(to_sizet(nranks), 0));
+  recv_counts_.resize(to_sizet(nr_chunks()), std::vector<int>(to_sizet(nranks), 0));
+  for (SizeType k = 0; k < nr_chunks(); ++k) {
+    const auto [cs_begin, cs_end] = chunk_col_segments(k);
+    for (std::size_t cs_index = cs_begin; cs_index < cs_end; ++cs_index) {
+      const auto& cs = col_segments_[cs_index];
+
+      if (cs.src_rank == src_rank.col()) {
+        for (comm::IndexT_MPI row = 0; row < dst_dist.grid_size().rows(); ++row)
+          send_counts_[to_sizet(k)][to_sizet(dst_comm_rank({row, cs.dst_rank}))] +=
+              to_int(send_rows[to_sizet(row)] * cs.size);
+      }
+      if (cs.dst_rank == dst_rank.col()) {
+        for (comm::IndexT_MPI row = 0; row < src_dist.grid_size().rows(); ++row)
+          recv_counts_[to_sizet(k)][to_sizet(src_comm_rank({row, cs.src_rank}))] +=
+              to_int(recv_rows[to_sizet(row)] * cs.size);
+      }
+    }
+  }
+}
+}
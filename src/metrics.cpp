@@ -0,0 +1,192 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <mpi.h>
+
+#include <dlaf/communication/communicator_type.h>
+#include <dlaf/communication/error.h>
+#include <dlaf/metrics.h>
+
+namespace dlaf {
+namespace internal {
+namespace {
+using comm::CommunicatorType;
+
+// Note: the counters of a buffer are updated only by the owning thread, they are atomic only to allow
+// getMetrics to read them concurrently.
+struct MetricsBuffer {
+  std::atomic<double> flops = 0;
+  std::array<std::atomic<std::size_t>, 3> bytes_sent = {};
+  std::array<std::atomic<std::size_t>, 3> bytes_received = {};
+  std::atomic<std::size_t> bytes_allocated = 0;
+};
+
+template <class T>
+void increment(std::atomic<T>& counter, const T value) noexcept {
+  counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+template <class T>
+T value(const std::atomic<T>& counter) noexcept {
+  return counter.load(std::memory_order_relaxed);
+}
+
+std::atomic<bool> metrics_enabled = false;
+
+// Note: buffers are never deallocated, as they are referenced by the thread_local pointers.
+std::mutex buffers_mutex;
+std::vector<std::unique_ptr<MetricsBuffer>> buffers;
+
+MetricsBuffer& localBuffer() {
+  thread_local MetricsBuffer* buffer = nullptr;
+  if (buffer == nullptr) {
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+    buffers.push_back(std::make_unique<MetricsBuffer>());
+    buffer = buffers.back().get();
+  }
+  return *buffer;
+}
+}
+
+bool metricsEnabled() noexcept {
+  return metrics_enabled.load(std::memory_order_relaxed);
+}
+
+void enableMetrics() noexcept {
+  metrics_enabled = true;
+}
+
+void disableMetrics() noexcept {
+  metrics_enabled = false;
+}
+
+void addFlops(const double flops) noexcept {
+  if (metricsEnabled())
+    increment(localBuffer().flops, flops);
+}
+
+void addBytesAllocated(const std::size_t bytes) noexcept {
+  if (metricsEnabled())
+    increment(localBuffer().bytes_allocated, bytes);
+}
+}
+
+std::ostream& operator<<(std::ostream& os, const Metrics& metrics) {
+  using comm::CommunicatorType;
+  os << "  flops = " << metrics.flops << std::endl;
+  os << "  bytes_sent (row, col, full) = " << metrics.sent(CommunicatorType::Row) << ", "
+     << metrics.sent(CommunicatorType::Col) << ", " << metrics.sent(CommunicatorType::Full)
+     << std::endl;
+  os << "  bytes_received (row, col, full) = " << metrics.received(CommunicatorType::Row) << ", "
+     << metrics.received(CommunicatorType::Col) << ", " << metrics.received(CommunicatorType::Full)
+     << std::endl;
+  os << "  bytes_allocated = " << metrics.bytes_allocated << std::endl;
+  return os;
+}
+
+Metrics getMetrics() {
+  using internal::value;
+
+  Metrics metrics;
+  std::lock_guard<std::mutex> lock(internal::buffers_mutex);
+  for (const auto& buffer : internal::buffers) {
+    metrics.flops += value(buffer->flops);
+    for (std::size_t i = 0; i < metrics.bytes_sent.size(); ++i) {
+      metrics.bytes_sent[i] += value(buffer->bytes_sent[i]);
+      metrics.bytes_received[i] += value(buffer->bytes_received[i]);
+    }
+    metrics.bytes_allocated += value(buffer->bytes_allocated);
+  }
+  return metrics;
+}
+
+void resetMetrics() {
+  std::lock_guard<std::mutex> lock(internal::buffers_mutex);
+  for (auto& buffer : internal::buffers) {
+    buffer->flops = 0;
+    for (std::size_t i = 0; i < buffer->bytes_sent.size(); ++i) {
+      buffer->bytes_sent[i] = 0;
+      buffer->bytes_received[i] = 0;
+    }
+    buffer->bytes_allocated = 0;
+  }
+}
+}
+
+namespace dlaf::comm::internal {
+namespace {
+// The type of a communicator is stored as an MPI attribute pointing to one of the elements of
+// communicator_types. The attribute is copied by MPI_Comm_dup, therefore the clones of the
+// communicators of a CommunicatorGrid used by the pipelines have the same type.
+constexpr CommunicatorType communicator_types[] = {CommunicatorType::Row, CommunicatorType::Col,
+                                                   CommunicatorType::Full};
+
+int communicatorTypeKeyval() {
+  static const int keyval = []() {
+    int keyval;
+    DLAF_MPI_CHECK_ERROR(
+        MPI_Comm_create_keyval(MPI_COMM_DUP_FN, MPI_COMM_NULL_DELETE_FN, &keyval, nullptr));
+    return keyval;
+  }();
+  return keyval;
+}
+
+// Returns the index of the counters of @p comm, or -1 if it has no type.
+int communicatorTypeIndex(MPI_Comm comm) noexcept {
+  if (comm == MPI_COMM_NULL)
+    return -1;
+
+  void* attr;
+  int found;
+  DLAF_MPI_CHECK_ERROR(MPI_Comm_get_attr(comm, communicatorTypeKeyval(), &attr, &found));
+  if (!found)
+    return -1;
+  return static_cast<int>(*static_cast<const CommunicatorType*>(attr));
+}
+
+std::size_t messageBytes(MPI_Datatype dtype, int count) noexcept {
+  int type_size;
+  DLAF_MPI_CHECK_ERROR(MPI_Type_size(dtype, &type_size));
+  return static_cast<std::size_t>(type_size) * static_cast<std::size_t>(count);
+}
+}
+
+void setCommunicatorType(MPI_Comm comm, const CommunicatorType type) {
+  const CommunicatorType* attr = &communicator_types[static_cast<std::size_t>(type)];
+  DLAF_MPI_CHECK_ERROR(
+      MPI_Comm_set_attr(comm, communicatorTypeKeyval(), const_cast<CommunicatorType*>(attr)));
+}
+
+void addBytesSent(MPI_Comm comm, MPI_Datatype dtype, const int count) noexcept {
+  using dlaf::internal::increment;
+  if (!dlaf::internal::metricsEnabled())
+    return;
+
+  if (const int index = communicatorTypeIndex(comm); index >= 0)
+    increment(dlaf::internal::localBuffer().bytes_sent[index], messageBytes(dtype, count));
+}
+
+void addBytesReceived(MPI_Comm comm, MPI_Datatype dtype, const int count) noexcept {
+  using dlaf::internal::increment;
+  if (!dlaf::internal::metricsEnabled())
+    return;
+
+  if (const int index = communicatorTypeIndex(comm); index >= 0)
+    increment(dlaf::internal::localBuffer().bytes_received[index], messageBytes(dtype, count));
+}
+}
@@ -8,6 +8,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <cstddef>
+
 #include <dlaf/init.h>
 #include <dlaf/matrix/allocation_io.h>
 #include <dlaf/tune.h>
@@ -21,19 +23,41 @@ TuneParameters& getTuneParameters() {
 
 std::ostream& operator<<(std::ostream& os, const TuneParameters& params) {
   os << "  default_allocation_layout = " << params.default_allocation_layout << std::endl;
+  os << "  cholesky_broadcast_panel_ring = " << params.cholesky_broadcast_panel_ring << std::endl;
   os << "  tfactor_num_threads = " << params.tfactor_num_threads << std::endl;
   os << "  tfactor_num_streams = " << params.tfactor_num_streams << std::endl;
   os << "  tfactor_barrier_busy_wait_us = " << params.tfactor_barrier_busy_wait_us << std::endl;
   os << "  red2band_panel_num_threads = " << params.red2band_panel_num_threads << std::endl;
   os << "  red2band_barrier_busy_wait_us = " << params.red2band_barrier_busy_wait_us << std::endl;
+  os << "  red2band_broadcast_panel_ring = " << params.red2band_broadcast_panel_ring << std::endl;
   os << "  tridiag_rank1_num_threads = " << params.tridiag_rank1_num_threads << std::endl;
   os << "  tridiag_rank1_barrier_busy_wait_us = " << params.tridiag_rank1_barrier_busy_wait_us
      << std::endl;
+  os << "  tridiag_partial_spectrum_threshold = " << params.tridiag_partial_spectrum_threshold
+     << std::endl;
+  os << "  tridiag_max_concurrent_merges = " << params.tridiag_max_concurrent_merges << std::endl;
   os << "  eigensolver_min_band = " << params.eigensolver_min_band << std::endl;
+  os << "  eigensolver_one_stage_max_size = " << params.eigensolver_one_stage_max_size << std::endl;
+  os << "  eigensolver_one_stage_distributed = " << params.eigensolver_one_stage_distributed << std::endl;
+  os << "  eigensolver_one_stage_max_nranks = " << params.eigensolver_one_stage_max_nranks << std::endl;
+  os << "  eigensolver_checkpoint_file = " << params.eigensolver_checkpoint_file << std::endl;
   os << "  band_to_tridiag_1d_block_size_base = " << params.band_to_tridiag_1d_block_size_base
      << std::endl;
+  os << "  band_to_tridiag_sweeps_per_task = " << params.band_to_tridiag_sweeps_per_task << std::endl;
+  os << "  band_to_tridiag_persistent_requests = " << params.band_to_tridiag_persistent_requests
+     << std::endl;
   os << "  bt_band_to_tridiag_hh_apply_group_size = " << params.bt_band_to_tridiag_hh_apply_group_size
      << std::endl;
+  os << "  permutations_pipeline_num_tiles = " << params.permutations_pipeline_num_tiles << std::endl;
+  os << "  broadcast_panel_aggregate_max_bytes = " << params.broadcast_panel_aggregate_max_bytes
+     << std::endl;
+  os << "  c_api_auto_layout = " << params.c_api_auto_layout << std::endl;
+  os << "  c_api_auto_layout_block_sizes = ";
+  for (std::size_t i = 0; i < params.c_api_auto_layout_block_sizes.size(); ++i) {
+    const auto& [min_size, block_size] = params.c_api_auto_layout_block_sizes[i];
+    os << (i == 0 ? "" : ",") << min_size << ":" << block_size;
+  }
+  os << std::endl;
   return os;
 }
 
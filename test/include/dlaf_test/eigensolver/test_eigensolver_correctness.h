@@ -98,7 +98,7 @@ void testEigensolverCorrectness(const blas::Uplo uplo, Matrix<const T, Device::C
 
   // Compute Lambda E (in place in mat_e_local)
   for (SizeType j = 0; j < n; ++j) {
-    blas::scal(m, mat_evalues_local({j, 0}), mat_e_local.ptr({0, j}), 1);
+    blas::scal(m, mat_evalues_local({eigenvalue_index_begin + j, 0}), mat_e_local.ptr({0, j}), 1);
   }
 
   // Check A E == Lambda E
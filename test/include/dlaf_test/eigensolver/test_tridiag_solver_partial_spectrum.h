@@ -0,0 +1,46 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
+
+namespace dlaf::test {
+
+// clang-format off
+inline const std::vector<std::tuple<SizeType, SizeType, SizeType, SizeType>> tested_partial_problems = {
+    // n, nb, evals_begin, evals_end
+    {16, 5, 4, 6},
+    {16, 4, 3, 7},
+    {21, 4, 0, 5},
+    {93, 7, 40, 61},
+    {93, 7, 3, 52},
+    {93, 7, 92, 93},
+};
+// clang-format on
+
+// Forces the tridiagonal solver to use the partial-spectrum solver for the lifetime of the object.
+struct ForcePartialSpectrum {
+  ForcePartialSpectrum() : threshold_(getTuneParameters().tridiag_partial_spectrum_threshold) {
+    getTuneParameters().tridiag_partial_spectrum_threshold = 1;
+  }
+  ~ForcePartialSpectrum() {
+    getTuneParameters().tridiag_partial_spectrum_threshold = threshold_;
+  }
+
+private:
+  double threshold_;
+};
+
+}
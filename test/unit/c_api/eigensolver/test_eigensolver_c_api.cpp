@@ -24,6 +24,7 @@
 #include <dlaf/eigensolver/eigensolver.h>
 #include <dlaf/matrix/copy.h>
 #include <dlaf/matrix/matrix.h>
+#include <dlaf/tune.h>
 #include <dlaf_c_test/c_api_helpers.h>
 
 #include "test_eigensolver_c_api_config.h"
@@ -34,10 +35,13 @@
 #include <dlaf_test/comm_grids/grids_6_ranks.h>
 #include <dlaf_test/eigensolver/test_eigensolver_correctness.h>
 #include <dlaf_test/matrix/util_matrix.h>
+#include <dlaf_test/matrix/util_matrix_local.h>
+#include <dlaf_test/util_types.h>
 
 using namespace dlaf;
 using namespace dlaf::comm;
 using namespace dlaf::matrix;
+using namespace dlaf::matrix::test;
 using namespace dlaf::test;
 using namespace testing;
 
@@ -52,7 +56,7 @@ using EigensolverTestCapi = EigensolverTest<T>;
 
 TYPED_TEST_SUITE(EigensolverTestCapi, MatrixElementTypes);
 
-const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower});
+const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower, blas::Uplo::Upper});
 
 const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
     // {m, mb, eigensolver_min_band}
@@ -62,6 +66,13 @@ const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
     {34, 8, 3},  {32, 6, 3}                                   // m > mb, sub-band
 };
 
+// Submatrices of a larger matrix, starting at a block boundary (used in place) or not (copied)
+const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes_submatrix = {
+    // m, mb, offset
+    {16, 10, 10}, {34, 13, 26},  // aligned
+    {16, 10, 7},  {34, 13, 1},   // unaligned
+};
+
 std::set<std::optional<SizeType>> num_evals(const SizeType m) {
   return {std::nullopt, 0, m / 2, m};
 }
@@ -244,6 +255,273 @@ void testEigensolver(int dlaf_context, const blas::Uplo uplo, const SizeType m,
   pika::suspend();
 }
 
+template <class T, API api>
+void testEigensolverJobz(int dlaf_context, const char jobz, const blas::Uplo uplo, const SizeType m,
+                         const SizeType mb, CommunicatorGrid& grid) {
+  const bool compute_eigenvectors = (jobz == 'V');
+
+  // In normal use the runtime is resumed by the C API call
+  // The pika runtime is suspended by dlaf_initialize
+  // Here we need to resume it manually to build the matrices with DLA-Future
+  pika::resume();
+
+  const TileElementSize block_size(mb, mb);
+
+  Matrix<const T, Device::CPU> reference = [&]() {
+    Matrix<T, Device::CPU> reference(GlobalElementSize(m, m), block_size, grid);
+    matrix::util::set_random_hermitian(reference);
+    return reference;
+  }();
+
+  Matrix<T, Device::CPU> mat_a_h(reference.distribution());
+  copy(reference, mat_a_h);
+  mat_a_h.waitLocalTiles();
+
+  Matrix<BaseType<T>, Device::CPU> eigenvalues(LocalElementSize(m, 1), TileElementSize(mb, 1));
+  Matrix<T, Device::CPU> eigenvectors(GlobalElementSize(m, m), block_size, grid);
+  eigenvalues.waitLocalTiles();
+  eigenvectors.waitLocalTiles();
+
+  {
+    char dlaf_uplo = blas::to_char(uplo);
+
+    // Get top left local tiles
+    auto [local_a_ptr, lld_a] = top_left_tile(mat_a_h);
+    auto [local_eigenvectors_ptr, lld_eigenvectors] = top_left_tile(eigenvectors);
+    auto [eigenvalues_ptr, lld_eigenvalues] = top_left_tile(eigenvalues);
+
+    // With jobz == 'N' the eigenvectors are not referenced
+    T* local_z_ptr = compute_eigenvectors ? local_eigenvectors_ptr : nullptr;
+
+    // Suspend pika to ensure it is resumed by the C API
+    pika::suspend();
+
+    if constexpr (api == API::dlaf) {
+      DLAF_descriptor dlaf_desc_a = {(int) m, (int) m, (int) mb, (int) mb, 0, 0, 0, 0, lld_a};
+      DLAF_descriptor dlaf_desc_z = {(int) m, (int) m, (int) mb, (int) mb, 0,
+                                     0,       0,       0,        lld_eigenvectors};
+
+      int err = -1;
+      if constexpr (std::is_same_v<T, double>) {
+        err = C_dlaf_symmetric_eigensolver_jobz_d(dlaf_context, jobz, dlaf_uplo, local_a_ptr,
+                                                  dlaf_desc_a, eigenvalues_ptr, local_z_ptr,
+                                                  dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, float>) {
+        err = C_dlaf_symmetric_eigensolver_jobz_s(dlaf_context, jobz, dlaf_uplo, local_a_ptr,
+                                                  dlaf_desc_a, eigenvalues_ptr, local_z_ptr,
+                                                  dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<double>>) {
+        err = C_dlaf_hermitian_eigensolver_jobz_z(dlaf_context, jobz, dlaf_uplo, local_a_ptr,
+                                                  dlaf_desc_a, eigenvalues_ptr, local_z_ptr,
+                                                  dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<float>>) {
+        err = C_dlaf_hermitian_eigensolver_jobz_c(dlaf_context, jobz, dlaf_uplo, local_a_ptr,
+                                                  dlaf_desc_a, eigenvalues_ptr, local_z_ptr,
+                                                  dlaf_desc_z);
+      }
+      else {
+        DLAF_ASSERT(false, typeid(T).name());
+      }
+      DLAF_ASSERT(err == 0, err);
+    }
+    else if constexpr (api == API::scalapack) {
+#ifdef DLAF_WITH_SCALAPACK
+      int desc_a[] = {1, dlaf_context, (int) m, (int) m, (int) mb, (int) mb, 0, 0, lld_a};
+      int desc_z[] = {1, dlaf_context, (int) m, (int) m, (int) mb, (int) mb, 0, 0, lld_eigenvectors};
+      int info = -1;
+
+      if constexpr (std::is_same_v<T, double>) {
+        C_dlaf_pdsyevd_jobz(jobz, dlaf_uplo, (int) m, local_a_ptr, 1, 1, desc_a, eigenvalues_ptr,
+                            local_z_ptr, 1, 1, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, float>) {
+        C_dlaf_pssyevd_jobz(jobz, dlaf_uplo, (int) m, local_a_ptr, 1, 1, desc_a, eigenvalues_ptr,
+                            local_z_ptr, 1, 1, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<double>>) {
+        C_dlaf_pzheevd_jobz(jobz, dlaf_uplo, (int) m, local_a_ptr, 1, 1, desc_a, eigenvalues_ptr,
+                            local_z_ptr, 1, 1, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<float>>) {
+        C_dlaf_pcheevd_jobz(jobz, dlaf_uplo, (int) m, local_a_ptr, 1, 1, desc_a, eigenvalues_ptr,
+                            local_z_ptr, 1, 1, desc_z, &info);
+      }
+      else {
+        DLAF_ASSERT(false, typeid(T).name());
+      }
+      DLAF_ASSERT(info == 0, info);
+#else
+      static_assert(api != API::scalapack, "DLA-Future compiled without ScaLAPACK support.");
+#endif
+    }
+  }
+
+  // Resume pika runtime suspended by C API for correctness checks
+  pika::resume();
+
+  if (!mat_a_h.size().isEmpty()) {
+    if (compute_eigenvectors) {
+      testEigensolverCorrectness(uplo, reference, eigenvalues, eigenvectors, 0l, m, grid);
+    }
+    else {
+      // The eigenvalues computed together with the eigenvectors are used as reference.
+      Matrix<T, Device::CPU> mat_b(reference.distribution());
+      copy(reference, mat_b);
+      auto ret = hermitian_eigensolver<Backend::MC>(grid, uplo, mat_b);
+
+      Matrix<const BaseType<T>, Device::CPU>& evals = eigenvalues;
+      Matrix<const BaseType<T>, Device::CPU>& evals_ref = ret.eigenvalues;
+      auto evals_local = allGather<BaseType<T>>(blas::Uplo::General, evals);
+      auto evals_ref_local = allGather<BaseType<T>>(blas::Uplo::General, evals_ref);
+
+      auto expected = [&evals_ref_local](GlobalElementIndex index) {
+        return evals_ref_local(index);
+      };
+      CHECK_MATRIX_NEAR(expected, evals_local, m * TypeUtilities<T>::error,
+                        m * TypeUtilities<T>::error);
+    }
+  }
+
+  // Suspend pika to make sure dlaf_finalize resumes it
+  pika::suspend();
+}
+
+// The C API operates on the m x m submatrices starting at (offset, offset) of the global matrices A
+// and Z
+template <class T, API api>
+void testEigensolverSubmatrix(int dlaf_context, const blas::Uplo uplo, const SizeType m,
+                              const SizeType mb, const SizeType offset, CommunicatorGrid& grid) {
+  // In normal use the runtime is resumed by the C API call
+  // The pika runtime is suspended by dlaf_initialize
+  // Here we need to resume it manually to build the matrices with DLA-Future
+  pika::resume();
+
+  const TileElementSize block_size(mb, mb);
+
+  Matrix<const T, Device::CPU> reference = [&]() {
+    Matrix<T, Device::CPU> reference(GlobalElementSize(m, m), block_size, grid);
+    matrix::util::set_random_hermitian(reference);
+    return reference;
+  }();
+  const auto reference_local = allGather<const T>(blas::Uplo::General, reference, grid);
+
+  // Elements outside the submatrices are set to -1 and must not be modified
+  auto submatrix = [offset](auto f) {
+    return [f, offset](const GlobalElementIndex& ij) {
+      if (ij.row() < offset || ij.col() < offset)
+        return TypeUtilities<T>::element(-1, 0);
+      return f(GlobalElementIndex{ij.row() - offset, ij.col() - offset});
+    };
+  };
+
+  const GlobalElementSize size(offset + m, offset + m);
+  Matrix<T, Device::CPU> mat_a_h(size, block_size, grid);
+  Matrix<T, Device::CPU> mat_z_h(size, block_size, grid);
+  Matrix<BaseType<T>, Device::CPU> eigenvalues(LocalElementSize(m, 1), TileElementSize(mb, 1));
+
+  set(mat_a_h, submatrix([&reference_local](const GlobalElementIndex& ij) -> T {
+        return reference_local(ij);
+      }));
+  set(mat_z_h, submatrix([](const GlobalElementIndex&) { return TypeUtilities<T>::element(0, 0); }));
+  mat_a_h.waitLocalTiles();
+  mat_z_h.waitLocalTiles();
+  eigenvalues.waitLocalTiles();
+
+  {
+    char dlaf_uplo = blas::to_char(uplo);
+
+    // Get top left local tiles
+    auto [local_a_ptr, lld_a] = top_left_tile(mat_a_h);
+    auto [local_z_ptr, lld_z] = top_left_tile(mat_z_h);
+    auto [eigenvalues_ptr, lld_eigenvalues] = top_left_tile(eigenvalues);
+
+    // Suspend pika to ensure it is resumed by the C API
+    pika::suspend();
+
+    if constexpr (api == API::dlaf) {
+      DLAF_descriptor dlaf_desc_a = {(int) m,      (int) m,      (int) mb, (int) mb, 0, 0,
+                                     (int) offset, (int) offset, lld_a};
+      DLAF_descriptor dlaf_desc_z = {(int) m,      (int) m,      (int) mb, (int) mb, 0, 0,
+                                     (int) offset, (int) offset, lld_z};
+
+      int err = -1;
+      if constexpr (std::is_same_v<T, double>) {
+        err = C_dlaf_symmetric_eigensolver_d(dlaf_context, dlaf_uplo, local_a_ptr, dlaf_desc_a,
+                                             eigenvalues_ptr, local_z_ptr, dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, float>) {
+        err = C_dlaf_symmetric_eigensolver_s(dlaf_context, dlaf_uplo, local_a_ptr, dlaf_desc_a,
+                                             eigenvalues_ptr, local_z_ptr, dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<double>>) {
+        err = C_dlaf_hermitian_eigensolver_z(dlaf_context, dlaf_uplo, local_a_ptr, dlaf_desc_a,
+                                             eigenvalues_ptr, local_z_ptr, dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<float>>) {
+        err = C_dlaf_hermitian_eigensolver_c(dlaf_context, dlaf_uplo, local_a_ptr, dlaf_desc_a,
+                                             eigenvalues_ptr, local_z_ptr, dlaf_desc_z);
+      }
+      else {
+        DLAF_ASSERT(false, typeid(T).name());
+      }
+      DLAF_ASSERT(err == 0, err);
+    }
+    else if constexpr (api == API::scalapack) {
+#ifdef DLAF_WITH_SCALAPACK
+      const int n = static_cast<int>(offset + m);
+      int desc_a[] = {1, dlaf_context, n, n, (int) mb, (int) mb, 0, 0, lld_a};
+      int desc_z[] = {1, dlaf_context, n, n, (int) mb, (int) mb, 0, 0, lld_z};
+      const int ia = static_cast<int>(offset) + 1;
+      int info = -1;
+
+      if constexpr (std::is_same_v<T, double>) {
+        C_dlaf_pdsyevd(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, eigenvalues_ptr, local_z_ptr,
+                       ia, ia, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, float>) {
+        C_dlaf_pssyevd(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, eigenvalues_ptr, local_z_ptr,
+                       ia, ia, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<double>>) {
+        C_dlaf_pzheevd(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, eigenvalues_ptr, local_z_ptr,
+                       ia, ia, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<float>>) {
+        C_dlaf_pcheevd(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, eigenvalues_ptr, local_z_ptr,
+                       ia, ia, desc_z, &info);
+      }
+      else {
+        DLAF_ASSERT(false, typeid(T).name());
+      }
+      DLAF_ASSERT(info == 0, info);
+#else
+      static_assert(api != API::scalapack, "DLA-Future compiled without ScaLAPACK support.");
+#endif
+    }
+  }
+
+  // Resume pika runtime suspended by C API for correctness checks
+  pika::resume();
+
+  Matrix<const T, Device::CPU>& mat_z = mat_z_h;
+  const auto z_local = allGather<const T>(blas::Uplo::General, mat_z, grid);
+  auto z_submatrix = [&z_local, offset](const GlobalElementIndex& ij) -> T {
+    return z_local(GlobalElementIndex{ij.row() + offset, ij.col() + offset});
+  };
+
+  CHECK_MATRIX_EQ(submatrix(z_submatrix), mat_z_h);
+
+  Matrix<T, Device::CPU> eigenvectors(GlobalElementSize(m, m), block_size, grid);
+  set(eigenvectors, z_submatrix);
+  testEigensolverCorrectness(uplo, reference, eigenvalues, eigenvectors, 0l, m, grid);
+
+  // Suspend pika to make sure dlaf_finalize resumes it
+  pika::suspend();
+}
+
 TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedDLAF) {
   for (comm::CommunicatorGrid& grid : this->commGrids()) {
     auto dlaf_context =
@@ -262,6 +540,58 @@ TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedDLAF) {
   }
 }
 
+TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedAutoLayoutDLAF) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    auto dlaf_context =
+        c_api_test_initialize<API::dlaf>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+    getTuneParameters().c_api_auto_layout = true;
+
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        auto numevals = num_evals(m);
+        for (auto nevals : numevals) {
+          testEigensolver<TypeParam, API::dlaf>(dlaf_context, uplo, m, mb, grid, nevals);
+        }
+      }
+    }
+
+    getTuneParameters().c_api_auto_layout = false;
+    c_api_test_finalize<API::dlaf>(dlaf_context);
+  }
+}
+
+TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedSubmatrixDLAF) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    auto dlaf_context =
+        c_api_test_initialize<API::dlaf>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, offset] : sizes_submatrix) {
+        testEigensolverSubmatrix<TypeParam, API::dlaf>(dlaf_context, uplo, m, mb, offset, grid);
+      }
+    }
+
+    c_api_test_finalize<API::dlaf>(dlaf_context);
+  }
+}
+
+TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedJobzDLAF) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    auto dlaf_context =
+        c_api_test_initialize<API::dlaf>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+
+    for (const char jobz : {'N', 'V'}) {
+      for (auto uplo : blas_uplos) {
+        for (auto [m, mb, b_min] : sizes) {
+          testEigensolverJobz<TypeParam, API::dlaf>(dlaf_context, jobz, uplo, m, mb, grid);
+        }
+      }
+    }
+
+    c_api_test_finalize<API::dlaf>(dlaf_context);
+  }
+}
+
 #ifdef DLAF_WITH_SCALAPACK
 TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedScalapack) {
   for (comm::CommunicatorGrid& grid : this->commGrids()) {
@@ -280,4 +610,36 @@ TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedScalapack) {
     c_api_test_finalize<API::scalapack>(dlaf_context);
   }
 }
+
+TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedJobzScalapack) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    auto dlaf_context =
+        c_api_test_initialize<API::scalapack>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+
+    for (const char jobz : {'N', 'V'}) {
+      for (auto uplo : blas_uplos) {
+        for (auto [m, mb, b_min] : sizes) {
+          testEigensolverJobz<TypeParam, API::scalapack>(dlaf_context, jobz, uplo, m, mb, grid);
+        }
+      }
+    }
+
+    c_api_test_finalize<API::scalapack>(dlaf_context);
+  }
+}
+
+TYPED_TEST(EigensolverTestCapi, CorrectnessDistributedSubmatrixScalapack) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    auto dlaf_context =
+        c_api_test_initialize<API::scalapack>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, offset] : sizes_submatrix) {
+        testEigensolverSubmatrix<TypeParam, API::scalapack>(dlaf_context, uplo, m, mb, offset, grid);
+      }
+    }
+
+    c_api_test_finalize<API::scalapack>(dlaf_context);
+  }
+}
 #endif
@@ -72,6 +72,32 @@ int C_dlaf_hermitian_eigensolver_partial_spectrum_z(
                                                        eigenvalues_index_begin, eigenvalues_index_end);
 }
 
+int C_dlaf_symmetric_eigensolver_jobz_s(const int dlaf_context, const char jobz, const char uplo,
+                                        float* a, const struct DLAF_descriptor desca, float* w,
+                                        float* z, const struct DLAF_descriptor descz) {
+  return dlaf_symmetric_eigensolver_jobz_s(dlaf_context, jobz, uplo, a, desca, w, z, descz);
+}
+
+int C_dlaf_symmetric_eigensolver_jobz_d(const int dlaf_context, const char jobz, const char uplo,
+                                        double* a, const struct DLAF_descriptor desca, double* w,
+                                        double* z, const struct DLAF_descriptor descz) {
+  return dlaf_symmetric_eigensolver_jobz_d(dlaf_context, jobz, uplo, a, desca, w, z, descz);
+}
+
+int C_dlaf_hermitian_eigensolver_jobz_c(const int dlaf_context, const char jobz, const char uplo,
+                                        dlaf_complex_c* a, const struct DLAF_descriptor desca,
+                                        float* w, dlaf_complex_c* z,
+                                        const struct DLAF_descriptor descz) {
+  return dlaf_hermitian_eigensolver_jobz_c(dlaf_context, jobz, uplo, a, desca, w, z, descz);
+}
+
+int C_dlaf_hermitian_eigensolver_jobz_z(const int dlaf_context, const char jobz, const char uplo,
+                                        dlaf_complex_z* a, const struct DLAF_descriptor desca,
+                                        double* w, dlaf_complex_z* z,
+                                        const struct DLAF_descriptor descz) {
+  return dlaf_hermitian_eigensolver_jobz_z(dlaf_context, jobz, uplo, a, desca, w, z, descz);
+}
+
 #ifdef DLAF_WITH_SCALAPACK
 
 void C_dlaf_pssyevd(char uplo, const int m, float* a, const int ia, const int ja, const int desca[9],
@@ -132,4 +158,28 @@ void C_dlaf_pzheevd_partial_spectrum(const char uplo, const int m, dlaf_complex_
                                 eigenvalues_index_end, info);
 }
 
+void C_dlaf_pssyevd_jobz(const char jobz, const char uplo, const int m, float* a, const int ia,
+                         const int ja, const int desca[9], float* w, float* z, const int iz,
+                         const int jz, const int descz[9], int* info) {
+  dlaf_pssyevd_jobz(jobz, uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, info);
+}
+
+void C_dlaf_pdsyevd_jobz(const char jobz, const char uplo, const int m, double* a, const int ia,
+                         const int ja, const int desca[9], double* w, double* z, const int iz,
+                         const int jz, const int descz[9], int* info) {
+  dlaf_pdsyevd_jobz(jobz, uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, info);
+}
+
+void C_dlaf_pcheevd_jobz(const char jobz, const char uplo, const int m, dlaf_complex_c* a,
+                         const int ia, const int ja, const int desca[9], float* w, dlaf_complex_c* z,
+                         const int iz, const int jz, const int descz[9], int* info) {
+  dlaf_pcheevd_jobz(jobz, uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, info);
+}
+
+void C_dlaf_pzheevd_jobz(const char jobz, const char uplo, const int m, dlaf_complex_z* a,
+                         const int ia, const int ja, const int desca[9], double* w, dlaf_complex_z* z,
+                         const int iz, const int jz, const int descz[9], int* info) {
+  dlaf_pzheevd_jobz(jobz, uplo, m, a, ia, ja, desca, w, z, iz, jz, descz, info);
+}
+
 #endif
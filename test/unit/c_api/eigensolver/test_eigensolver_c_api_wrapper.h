@@ -54,6 +54,28 @@ DLAF_EXTERN_C int C_dlaf_hermitian_eigensolver_partial_spectrum_z(
     double* w, dlaf_complex_z* z, const struct DLAF_descriptor descz,
     const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end);
 
+DLAF_EXTERN_C int C_dlaf_symmetric_eigensolver_jobz_s(const int dlaf_context, const char jobz,
+                                                      const char uplo, float* a,
+                                                      const struct DLAF_descriptor desca, float* w,
+                                                      float* z, const struct DLAF_descriptor descz);
+
+DLAF_EXTERN_C int C_dlaf_symmetric_eigensolver_jobz_d(const int dlaf_context, const char jobz,
+                                                      const char uplo, double* a,
+                                                      const struct DLAF_descriptor desca, double* w,
+                                                      double* z, const struct DLAF_descriptor descz);
+
+DLAF_EXTERN_C int C_dlaf_hermitian_eigensolver_jobz_c(const int dlaf_context, const char jobz,
+                                                      const char uplo, dlaf_complex_c* a,
+                                                      const struct DLAF_descriptor desca, float* w,
+                                                      dlaf_complex_c* z,
+                                                      const struct DLAF_descriptor descz);
+
+DLAF_EXTERN_C int C_dlaf_hermitian_eigensolver_jobz_z(const int dlaf_context, const char jobz,
+                                                      const char uplo, dlaf_complex_z* a,
+                                                      const struct DLAF_descriptor desca, double* w,
+                                                      dlaf_complex_z* z,
+                                                      const struct DLAF_descriptor descz);
+
 #ifdef DLAF_WITH_SCALAPACK
 DLAF_EXTERN_C void C_dlaf_pssyevd(const char uplo, const int m, float* a, const int ia, const int ja,
                                   const int desca[9], float* w, float* z, const int iz, const int jz,
@@ -91,4 +113,23 @@ DLAF_EXTERN_C void C_dlaf_pzheevd_partial_spectrum(
     const char uplo, const int m, dlaf_complex_z* a, const int ia, const int ja, const int desca[9],
     double* w, dlaf_complex_z* z, const int iz, const int jz, const int descz[9],
     const SizeType eigenvalues_index_begin, const SizeType eigenvalues_index_end, int* info);
+DLAF_EXTERN_C void C_dlaf_pssyevd_jobz(const char jobz, const char uplo, const int m, float* a,
+                                       const int ia, const int ja, const int desca[9], float* w,
+                                       float* z, const int iz, const int jz, const int descz[9],
+                                       int* info);
+
+DLAF_EXTERN_C void C_dlaf_pdsyevd_jobz(const char jobz, const char uplo, const int m, double* a,
+                                       const int ia, const int ja, const int desca[9], double* w,
+                                       double* z, const int iz, const int jz, const int descz[9],
+                                       int* info);
+
+DLAF_EXTERN_C void C_dlaf_pcheevd_jobz(const char jobz, const char uplo, const int m, dlaf_complex_c* a,
+                                       const int ia, const int ja, const int desca[9], float* w,
+                                       dlaf_complex_c* z, const int iz, const int jz,
+                                       const int descz[9], int* info);
+
+DLAF_EXTERN_C void C_dlaf_pzheevd_jobz(const char jobz, const char uplo, const int m, dlaf_complex_z* a,
+                                       const int ia, const int ja, const int desca[9], double* w,
+                                       dlaf_complex_z* z, const int iz, const int jz,
+                                       const int descz[9], int* info);
 #endif
@@ -33,10 +33,13 @@
 #include <dlaf_test/comm_grids/grids_6_ranks.h>
 #include <dlaf_test/eigensolver/test_gen_eigensolver_correctness.h>
 #include <dlaf_test/matrix/util_matrix.h>
+#include <dlaf_test/matrix/util_matrix_local.h>
+#include <dlaf_test/util_types.h>
 
 using namespace dlaf;
 using namespace dlaf::comm;
 using namespace dlaf::matrix;
+using namespace dlaf::matrix::test;
 using namespace dlaf::test;
 using namespace testing;
 
@@ -60,7 +63,7 @@ TYPED_TEST_SUITE(GenEigensolverTestGPU, MatrixElementTypes);
 
 using dlaf::eigensolver::internal::Factorization;
 
-const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower});
+const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower, blas::Uplo::Upper});
 
 const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
     // {m, mb, eigensolver_min_band}
@@ -70,6 +73,13 @@ const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
     {34, 8, 3},  {32, 6, 3}                                   // m > mb, sub-band
 };
 
+// Submatrices of a larger matrix, starting at a block boundary (used in place) or not (copied)
+const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes_submatrix = {
+    // m, mb, offset
+    {16, 10, 10}, {34, 13, 26},  // aligned
+    {16, 10, 7},  {34, 13, 1},   // unaligned
+};
+
 std::set<std::optional<SizeType>> num_evals(const SizeType m) {
   return {std::nullopt, 0, m / 2, m};
 }
@@ -420,6 +430,180 @@ void testGenEigensolver(int dlaf_context, const blas::Uplo uplo, const SizeType
   pika::suspend();
 }
 
+// The C API operates on the m x m submatrices starting at (offset, offset) of the global matrices A, B
+// and Z
+template <class T, API api>
+void testGenEigensolverSubmatrix(int dlaf_context, const blas::Uplo uplo, const SizeType m,
+                                 const SizeType mb, const SizeType offset, CommunicatorGrid& grid) {
+  // In normal use the runtime is resumed by the C API call
+  // The pika runtime is suspended by dlaf_initialize
+  // Here we need to resume it manually to build the matrices with DLA-Future
+  pika::resume();
+
+  const TileElementSize block_size(mb, mb);
+
+  auto create_reference = [&]() {
+    return Matrix<T, Device::CPU>(GlobalElementSize(m, m), block_size, grid);
+  };
+
+  Matrix<const T, Device::CPU> reference_a = [&]() {
+    auto reference = create_reference();
+    matrix::util::set_random_hermitian(reference);
+    return reference;
+  }();
+
+  Matrix<const T, Device::CPU> reference_b = [&]() {
+    auto reference = create_reference();
+    matrix::util::set_random_hermitian_positive_definite(reference);
+    return reference;
+  }();
+
+  const auto reference_a_local = allGather<const T>(blas::Uplo::General, reference_a, grid);
+  const auto reference_b_local = allGather<const T>(blas::Uplo::General, reference_b, grid);
+
+  // Elements outside the submatrices are set to -1 and must not be modified
+  auto submatrix = [offset](auto f) {
+    return [f, offset](const GlobalElementIndex& ij) {
+      if (ij.row() < offset || ij.col() < offset)
+        return TypeUtilities<T>::element(-1, 0);
+      return f(GlobalElementIndex{ij.row() - offset, ij.col() - offset});
+    };
+  };
+
+  const GlobalElementSize size(offset + m, offset + m);
+  Matrix<T, Device::CPU> mat_a_h(size, block_size, grid);
+  Matrix<T, Device::CPU> mat_b_h(size, block_size, grid);
+  Matrix<T, Device::CPU> mat_z_h(size, block_size, grid);
+  Matrix<BaseType<T>, Device::CPU> eigenvalues(LocalElementSize(m, 1), TileElementSize(mb, 1));
+
+  set(mat_a_h, submatrix([&reference_a_local](const GlobalElementIndex& ij) -> T {
+        return reference_a_local(ij);
+      }));
+  set(mat_b_h, submatrix([&reference_b_local](const GlobalElementIndex& ij) -> T {
+        return reference_b_local(ij);
+      }));
+  set(mat_z_h, submatrix([](const GlobalElementIndex&) { return TypeUtilities<T>::element(0, 0); }));
+  mat_a_h.waitLocalTiles();
+  mat_b_h.waitLocalTiles();
+  mat_z_h.waitLocalTiles();
+  eigenvalues.waitLocalTiles();
+
+  {
+    char dlaf_uplo = blas::to_char(uplo);
+
+    // Get top left local tiles
+    auto [local_a_ptr, lld_a] = top_left_tile(mat_a_h);
+    auto [local_b_ptr, lld_b] = top_left_tile(mat_b_h);
+    auto [local_z_ptr, lld_z] = top_left_tile(mat_z_h);
+    auto [eigenvalues_ptr, lld_eigenvalues] = top_left_tile(eigenvalues);
+
+    // Suspend pika to ensure it is resumed by the C API
+    pika::suspend();
+
+    if constexpr (api == API::dlaf) {
+      DLAF_descriptor dlaf_desc_a = {(int) m,      (int) m,      (int) mb, (int) mb, 0, 0,
+                                     (int) offset, (int) offset, lld_a};
+      DLAF_descriptor dlaf_desc_b = {(int) m,      (int) m,      (int) mb, (int) mb, 0, 0,
+                                     (int) offset, (int) offset, lld_b};
+      DLAF_descriptor dlaf_desc_z = {(int) m,      (int) m,      (int) mb, (int) mb, 0, 0,
+                                     (int) offset, (int) offset, lld_z};
+
+      int err = -1;
+      if constexpr (std::is_same_v<T, double>) {
+        err = C_dlaf_symmetric_generalized_eigensolver_d(dlaf_context, dlaf_uplo, local_a_ptr,
+                                                         dlaf_desc_a, local_b_ptr, dlaf_desc_b,
+                                                         eigenvalues_ptr, local_z_ptr, dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, float>) {
+        err = C_dlaf_symmetric_generalized_eigensolver_s(dlaf_context, dlaf_uplo, local_a_ptr,
+                                                         dlaf_desc_a, local_b_ptr, dlaf_desc_b,
+                                                         eigenvalues_ptr, local_z_ptr, dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<double>>) {
+        err = C_dlaf_hermitian_generalized_eigensolver_z(dlaf_context, dlaf_uplo, local_a_ptr,
+                                                         dlaf_desc_a, local_b_ptr, dlaf_desc_b,
+                                                         eigenvalues_ptr, local_z_ptr, dlaf_desc_z);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<float>>) {
+        err = C_dlaf_hermitian_generalized_eigensolver_c(dlaf_context, dlaf_uplo, local_a_ptr,
+                                                         dlaf_desc_a, local_b_ptr, dlaf_desc_b,
+                                                         eigenvalues_ptr, local_z_ptr, dlaf_desc_z);
+      }
+      else {
+        DLAF_ASSERT(false, typeid(T).name());
+      }
+      DLAF_ASSERT(err == 0, err);
+    }
+    else if constexpr (api == API::scalapack) {
+#ifdef DLAF_WITH_SCALAPACK
+      const int n = static_cast<int>(offset + m);
+      int desc_a[] = {1, dlaf_context, n, n, (int) mb, (int) mb, 0, 0, lld_a};
+      int desc_b[] = {1, dlaf_context, n, n, (int) mb, (int) mb, 0, 0, lld_b};
+      int desc_z[] = {1, dlaf_context, n, n, (int) mb, (int) mb, 0, 0, lld_z};
+      const int ia = static_cast<int>(offset) + 1;
+      int info = -1;
+
+      if constexpr (std::is_same_v<T, double>) {
+        C_dlaf_pdsygvd(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, local_b_ptr, ia, ia, desc_b,
+                       eigenvalues_ptr, local_z_ptr, ia, ia, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, float>) {
+        C_dlaf_pssygvd(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, local_b_ptr, ia, ia, desc_b,
+                       eigenvalues_ptr, local_z_ptr, ia, ia, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<double>>) {
+        C_dlaf_pzhegvd(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, local_b_ptr, ia, ia, desc_b,
+                       eigenvalues_ptr, local_z_ptr, ia, ia, desc_z, &info);
+      }
+      else if constexpr (std::is_same_v<T, std::complex<float>>) {
+        C_dlaf_pchegvd(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, local_b_ptr, ia, ia, desc_b,
+                       eigenvalues_ptr, local_z_ptr, ia, ia, desc_z, &info);
+      }
+      else {
+        DLAF_ASSERT(false, typeid(T).name());
+      }
+      DLAF_ASSERT(info == 0, info);
+#else
+      static_assert(api != API::scalapack, "DLA-Future compiled without ScaLAPACK support.");
+#endif
+    }
+  }
+
+  // Resume pika runtime suspended by C API for correctness checks
+  pika::resume();
+
+  // Returns the m x m submatrix of the global matrix gathered in mat_local
+  auto get_submatrix = [&](const auto& mat_local) {
+    Matrix<T, Device::CPU> mat(GlobalElementSize(m, m), block_size, grid);
+    set(mat, [&mat_local, offset](const GlobalElementIndex& ij) -> T {
+      return mat_local(GlobalElementIndex{ij.row() + offset, ij.col() + offset});
+    });
+    return mat;
+  };
+
+  Matrix<const T, Device::CPU>& mat_b = mat_b_h;
+  Matrix<const T, Device::CPU>& mat_z = mat_z_h;
+  const auto b_local = allGather<const T>(blas::Uplo::General, mat_b, grid);
+  const auto z_local = allGather<const T>(blas::Uplo::General, mat_z, grid);
+
+  Matrix<const T, Device::CPU> mat_b_factor = get_submatrix(b_local);
+  EigensolverResult<T, Device::CPU> ret{std::move(eigenvalues), get_submatrix(z_local)};
+
+  auto check_outside = [&](const auto& mat_local, Matrix<T, Device::CPU>& mat_h) {
+    CHECK_MATRIX_EQ(submatrix([&mat_local, offset](const GlobalElementIndex& ij) -> T {
+                      return mat_local(GlobalElementIndex{ij.row() + offset, ij.col() + offset});
+                    }),
+                    mat_h);
+  };
+  check_outside(b_local, mat_b_h);
+  check_outside(z_local, mat_z_h);
+
+  testGenEigensolverCorrectness(uplo, reference_a, reference_b, mat_b_factor, ret, 0l, m, grid);
+
+  // Suspend pika to make sure dlaf_finalize resumes it
+  pika::suspend();
+}
+
 TYPED_TEST(GenEigensolverTestCapi, CorrectnessDistributedDLAF) {
   using T = TypeParam;
 
@@ -441,6 +625,21 @@ TYPED_TEST(GenEigensolverTestCapi, CorrectnessDistributedDLAF) {
   }
 }
 
+TYPED_TEST(GenEigensolverTestCapi, CorrectnessDistributedSubmatrixDLAF) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    auto dlaf_context =
+        c_api_test_initialize<API::dlaf>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, offset] : sizes_submatrix) {
+        testGenEigensolverSubmatrix<TypeParam, API::dlaf>(dlaf_context, uplo, m, mb, offset, grid);
+      }
+    }
+
+    c_api_test_finalize<API::dlaf>(dlaf_context);
+  }
+}
+
 #ifdef DLAF_WITH_SCALAPACK
 TYPED_TEST(GenEigensolverTestCapi, CorrectnessDistributedScaLAPACK) {
   using T = TypeParam;
@@ -464,4 +663,19 @@ TYPED_TEST(GenEigensolverTestCapi, CorrectnessDistributedScaLAPACK) {
     c_api_test_finalize<API::scalapack>(dlaf_context);
   }
 }
+
+TYPED_TEST(GenEigensolverTestCapi, CorrectnessDistributedSubmatrixScaLAPACK) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    auto dlaf_context =
+        c_api_test_initialize<API::scalapack>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, offset] : sizes_submatrix) {
+        testGenEigensolverSubmatrix<TypeParam, API::scalapack>(dlaf_context, uplo, m, mb, offset, grid);
+      }
+    }
+
+    c_api_test_finalize<API::scalapack>(dlaf_context);
+  }
+}
 #endif
@@ -20,6 +20,7 @@
 
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/matrix/matrix.h>
+#include <dlaf/tune.h>
 #include <dlaf_c_test/c_api_helpers.h>
 
 #include "test_cholesky_c_api_config.h"
@@ -52,25 +53,44 @@ const std::vector<std::tuple<SizeType, SizeType>> sizes = {
     {4, 3}, {16, 10}, {34, 13}, {32, 5}  // m > mb
 };
 
+// Submatrices of a larger matrix, starting at a block boundary (used in place) or not (copied)
+const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes_submatrix = {
+    // m, mb, offset
+    {5, 8, 8},  {16, 10, 10}, {34, 13, 26}, {32, 5, 15},  // aligned
+    {5, 8, 3},  {16, 10, 7},  {34, 13, 1},  {32, 5, 12},  // unaligned
+};
+
 template <class T, API api>
 void testCholesky(comm::CommunicatorGrid& grid, const blas::Uplo uplo, const SizeType m,
-                  const SizeType mb) {
+                  const SizeType mb, const SizeType offset = 0, const bool auto_layout = false) {
   auto dlaf_context = c_api_test_initialize<api>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+  if (auto_layout)
+    getTuneParameters().c_api_auto_layout = true;
 
   // In normal use the runtime is resumed by the C API call
   // The pika runtime is suspended by dlaf_initialize
   // Here we need to resume it manually to build the matrices with DLA-Future
   pika::resume();
 
-  const GlobalElementSize size(m, m);
+  // The C API operates on the m x m submatrix starting at (offset, offset)
+  const GlobalElementSize size(offset + m, offset + m);
   const TileElementSize block_size(mb, mb);
   Index2D src_rank_index(std::max(0, grid.size().rows() - 1), std::min(1, grid.size().cols() - 1));
 
   Distribution distribution(size, block_size, grid.size(), grid.rank(), src_rank_index);
   Matrix<T, Device::CPU> mat_h(std::move(distribution));
 
+  // Elements outside the submatrix are set to -1 and must not be modified
+  auto submatrix = [offset](auto f) {
+    return [f, offset](const GlobalElementIndex& ij) {
+      if (ij.row() < offset || ij.col() < offset)
+        return TypeUtilities<T>::element(-1, 0);
+      return f(GlobalElementIndex{ij.row() - offset, ij.col() - offset});
+    };
+  };
+
   auto [el, res] = getCholeskySetters<GlobalElementIndex, T>(uplo);
-  set(mat_h, el);
+  set(mat_h, submatrix(el));
   mat_h.waitLocalTiles();
 
   char dlaf_uplo = blas::to_char(uplo);
@@ -82,8 +102,15 @@ void testCholesky(comm::CommunicatorGrid& grid, const blas::Uplo uplo, const Siz
   pika::suspend();
 
   if constexpr (api == API::dlaf) {
-    DLAF_descriptor dlaf_desc =
-        {(int) m, (int) m, (int) mb, (int) mb, src_rank_index.row(), src_rank_index.col(), 0, 0, lld};
+    DLAF_descriptor dlaf_desc = {(int) m,
+                                 (int) m,
+                                 (int) mb,
+                                 (int) mb,
+                                 src_rank_index.row(),
+                                 src_rank_index.col(),
+                                 (int) offset,
+                                 (int) offset,
+                                 lld};
     int err = -1;
     if constexpr (std::is_same_v<T, double>) {
       err = C_dlaf_cholesky_factorization_d(dlaf_context, dlaf_uplo, local_a_ptr, dlaf_desc);
@@ -106,25 +133,26 @@ void testCholesky(comm::CommunicatorGrid& grid, const blas::Uplo uplo, const Siz
 #ifdef DLAF_WITH_SCALAPACK
     int desc_a[] = {1,
                     dlaf_context,
-                    (int) m,
-                    (int) m,
+                    (int) (offset + m),
+                    (int) (offset + m),
                     (int) mb,
                     (int) mb,
                     src_rank_index.row(),
                     src_rank_index.col(),
                     lld};
+    const int ia = static_cast<int>(offset) + 1;
     int info = -1;
     if constexpr (std::is_same_v<T, double>) {
-      C_dlaf_pdpotrf(dlaf_uplo, (int) m, local_a_ptr, 1, 1, desc_a, &info);
+      C_dlaf_pdpotrf(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, &info);
     }
     else if constexpr (std::is_same_v<T, float>) {
-      C_dlaf_pspotrf(dlaf_uplo, (int) m, local_a_ptr, 1, 1, desc_a, &info);
+      C_dlaf_pspotrf(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, &info);
     }
     else if constexpr (std::is_same_v<T, std::complex<double>>) {
-      C_dlaf_pzpotrf(dlaf_uplo, (int) m, local_a_ptr, 1, 1, desc_a, &info);
+      C_dlaf_pzpotrf(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, &info);
     }
     else if constexpr (std::is_same_v<T, std::complex<float>>) {
-      C_dlaf_pcpotrf(dlaf_uplo, (int) m, local_a_ptr, 1, 1, desc_a, &info);
+      C_dlaf_pcpotrf(dlaf_uplo, (int) m, local_a_ptr, ia, ia, desc_a, &info);
     }
     else {
       DLAF_ASSERT(false, typeid(T).name());
@@ -138,12 +166,14 @@ void testCholesky(comm::CommunicatorGrid& grid, const blas::Uplo uplo, const Siz
   // Resume pika for the checks (suspended by the C API)
   pika::resume();
 
-  CHECK_MATRIX_NEAR(res, mat_h, 4 * (mat_h.size().rows() + 1) * TypeUtilities<T>::error,
-                    4 * (mat_h.size().rows() + 1) * TypeUtilities<T>::error);
+  CHECK_MATRIX_NEAR(submatrix(res), mat_h, 4 * (m + 1) * TypeUtilities<T>::error,
+                    4 * (m + 1) * TypeUtilities<T>::error);
 
   // Suspend pika to make sure dlaf_finalize resumes it
   pika::suspend();
 
+  if (auto_layout)
+    getTuneParameters().c_api_auto_layout = false;
   c_api_test_finalize<api>(dlaf_context);
 }
 
@@ -157,6 +187,30 @@ TYPED_TEST(CholeskyTestCapi, CorrectnessDistributedDLAF) {
   }
 }
 
+TYPED_TEST(CholeskyTestCapi, CorrectnessDistributedSubmatrixDLAF) {
+  for (auto& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (const auto& [m, mb, offset] : sizes_submatrix) {
+        testCholesky<TypeParam, API::dlaf>(grid, uplo, m, mb, offset);
+      }
+    }
+  }
+}
+
+// The auto layout redistributes the matrix to a different block size and grid shape
+TYPED_TEST(CholeskyTestCapi, CorrectnessDistributedAutoLayoutDLAF) {
+  for (auto& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (const auto& [m, mb] : sizes) {
+        testCholesky<TypeParam, API::dlaf>(grid, uplo, m, mb, 0, true);
+      }
+      for (const auto& [m, mb, offset] : sizes_submatrix) {
+        testCholesky<TypeParam, API::dlaf>(grid, uplo, m, mb, offset, true);
+      }
+    }
+  }
+}
+
 #ifdef DLAF_WITH_SCALAPACK
 TYPED_TEST(CholeskyTestCapi, CorrectnessDistributedScaLAPACK) {
   for (auto& grid : this->commGrids()) {
@@ -167,4 +221,14 @@ TYPED_TEST(CholeskyTestCapi, CorrectnessDistributedScaLAPACK) {
     }
   }
 }
+
+TYPED_TEST(CholeskyTestCapi, CorrectnessDistributedSubmatrixScaLAPACK) {
+  for (auto& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (const auto& [m, mb, offset] : sizes_submatrix) {
+        testCholesky<TypeParam, API::scalapack>(grid, uplo, m, mb, offset);
+      }
+    }
+  }
+}
 #endif
@@ -0,0 +1,259 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include <pika/execution.hpp>
+#include <pika/init.hpp>
+
+#include <lapack.hh>
+
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/factorization/qr.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf_c_test/c_api_helpers.h>
+
+#include "test_qr_c_api_config.h"
+#include "test_qr_c_api_wrapper.h"
+
+#include <dlaf_test/comm_grids/grids_6_ranks.h>
+#include <dlaf_test/matrix/util_matrix.h>
+#include <dlaf_test/matrix/util_matrix_local.h>
+
+using namespace dlaf;
+using namespace dlaf::comm;
+using namespace dlaf::matrix;
+using namespace dlaf::matrix::test;
+using namespace dlaf::test;
+using namespace testing;
+
+::testing::Environment* const comm_grids_env =
+    ::testing::AddGlobalTestEnvironment(new CommunicatorGrid6RanksCAPIEnvironment);
+
+template <class T>
+struct QRTestCapi : public TestWithCommGrids {};
+
+TYPED_TEST_SUITE(QRTestCapi, MatrixElementTypes);
+
+const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
+    // m, n, mb
+    {0, 2, 2},   {5, 5, 8},   {8, 5, 8},   {5, 8, 8},
+    {16, 16, 4}, {34, 13, 6}, {13, 34, 6}, {26, 7, 3},
+};
+
+// Submatrices of a larger matrix, starting at a block boundary
+const std::vector<std::tuple<SizeType, SizeType, SizeType, SizeType>> sizes_submatrix = {
+    // m, n, mb, offset
+    {5, 5, 8, 8},
+    {34, 13, 6, 12},
+    {13, 34, 6, 6},
+};
+
+// The result of the C API is compared with the one of the C++ API on the same submatrix.
+template <class T, API api>
+void testQR(comm::CommunicatorGrid& grid, const SizeType m, const SizeType n, const SizeType mb,
+            const SizeType offset = 0) {
+  auto dlaf_context = c_api_test_initialize<api>(pika_argc, pika_argv, dlaf_argc, dlaf_argv, grid);
+
+  // In normal use the runtime is resumed by the C API call
+  // The pika runtime is suspended by dlaf_initialize
+  // Here we need to resume it manually to build the matrices with DLA-Future
+  pika::resume();
+
+  // The C API operates on the m x n submatrix starting at (offset, offset)
+  const GlobalElementSize size(offset + m, offset + n);
+  const TileElementSize block_size(mb, mb);
+  Index2D src_rank_index(std::max(0, grid.size().rows() - 1), std::min(1, grid.size().cols() - 1));
+
+  Distribution distribution(size, block_size, grid.size(), grid.rank(), src_rank_index);
+  Matrix<T, Device::CPU> mat_h(distribution);
+
+  auto el = [](const GlobalElementIndex& ij) {
+    const auto i = static_cast<double>(ij.row());
+    const auto j = static_cast<double>(ij.col());
+    return TypeUtilities<T>::element(std::sin(0.7 * i + 1.3 * j + 0.1), std::cos(0.3 * i - 0.9 * j));
+  };
+
+  // Elements outside the submatrix are set to -1 and must not be modified
+  auto submatrix = [offset](auto f) {
+    return [f, offset](const GlobalElementIndex& ij) {
+      if (ij.row() < offset || ij.col() < offset)
+        return TypeUtilities<T>::element(-1, 0);
+      return f(GlobalElementIndex{ij.row() - offset, ij.col() - offset});
+    };
+  };
+
+  set(mat_h, submatrix(el));
+  mat_h.waitLocalTiles();
+
+  // Reference computed with the C++ API on a matrix distributed as the submatrix
+  const Index2D src_rank_index_sub((src_rank_index.row() + offset / mb) % grid.size().rows(),
+                                   (src_rank_index.col() + offset / mb) % grid.size().cols());
+  Matrix<T, Device::CPU> mat_ref(Distribution(GlobalElementSize(m, n), block_size, grid.size(),
+                                              grid.rank(), src_rank_index_sub));
+  set(mat_ref, el);
+  auto mat_taus_ref = qr_factorization<Backend::MC>(grid, mat_ref);
+  const auto mat_ref_local = allGather<T>(blas::Uplo::General, mat_ref, grid);
+
+  // The C API computes the reflector of size 1 (m <= n), which is not computed by the C++ API, as LAPACK
+  // does (i.e. tau = 0 for real types, while for complex types R(m-1, m-1) is made real).
+  T tau_last(0);
+  if (m > 0 && m <= n) {
+    T* alpha = mat_ref_local.ptr({m - 1, m - 1});
+    lapack::larfg(1, alpha, alpha + 1, 1, &tau_last);
+    for (SizeType j = m; j < n; ++j)
+      mat_ref_local({m - 1, j}) *= T(1) - dlaf::conj(tau_last);
+  }
+
+  // tau is distributed as the columns of the global matrix
+  std::vector<T> tau(static_cast<std::size_t>(std::max<SizeType>(1, distribution.local_size().cols())),
+                     TypeUtilities<T>::element(-1, 0));
+
+  // Get pointer to first element of local matrix
+  auto [local_a_ptr, lld] = top_left_tile(mat_h);
+
+  // Suspend pika to ensure it is resumed by the C API
+  pika::suspend();
+
+  if constexpr (api == API::dlaf) {
+    DLAF_descriptor dlaf_desc = {(int) m,
+                                 (int) n,
+                                 (int) mb,
+                                 (int) mb,
+                                 src_rank_index.row(),
+                                 src_rank_index.col(),
+                                 (int) offset,
+                                 (int) offset,
+                                 lld};
+    int err = -1;
+    if constexpr (std::is_same_v<T, double>) {
+      err = C_dlaf_qr_factorization_d(dlaf_context, local_a_ptr, dlaf_desc, tau.data());
+    }
+    else if constexpr (std::is_same_v<T, float>) {
+      err = C_dlaf_qr_factorization_s(dlaf_context, local_a_ptr, dlaf_desc, tau.data());
+    }
+    else if constexpr (std::is_same_v<T, std::complex<double>>) {
+      err = C_dlaf_qr_factorization_z(dlaf_context, local_a_ptr, dlaf_desc, tau.data());
+    }
+    else if constexpr (std::is_same_v<T, std::complex<float>>) {
+      err = C_dlaf_qr_factorization_c(dlaf_context, local_a_ptr, dlaf_desc, tau.data());
+    }
+    else {
+      DLAF_ASSERT(false, typeid(T).name());
+    }
+    DLAF_ASSERT(err == 0, err);
+  }
+  else if constexpr (api == API::scalapack) {
+#ifdef DLAF_WITH_SCALAPACK
+    int desc_a[] = {1,
+                    dlaf_context,
+                    (int) (offset + m),
+                    (int) (offset + n),
+                    (int) mb,
+                    (int) mb,
+                    src_rank_index.row(),
+                    src_rank_index.col(),
+                    lld};
+    const int ia = static_cast<int>(offset) + 1;
+    int info = -1;
+    if constexpr (std::is_same_v<T, double>) {
+      C_dlaf_pdgeqrf((int) m, (int) n, local_a_ptr, ia, ia, desc_a, tau.data(), &info);
+    }
+    else if constexpr (std::is_same_v<T, float>) {
+      C_dlaf_psgeqrf((int) m, (int) n, local_a_ptr, ia, ia, desc_a, tau.data(), &info);
+    }
+    else if constexpr (std::is_same_v<T, std::complex<double>>) {
+      C_dlaf_pzgeqrf((int) m, (int) n, local_a_ptr, ia, ia, desc_a, tau.data(), &info);
+    }
+    else if constexpr (std::is_same_v<T, std::complex<float>>) {
+      C_dlaf_pcgeqrf((int) m, (int) n, local_a_ptr, ia, ia, desc_a, tau.data(), &info);
+    }
+    else {
+      DLAF_ASSERT(false, typeid(T).name());
+    }
+    DLAF_ASSERT(info == 0, info);
+#else
+    static_assert(api != API::scalapack, "DLA-Future compiled without ScaLAPACK support.");
+#endif
+  }
+
+  // Resume pika for the checks (suspended by the C API)
+  pika::resume();
+
+  const auto error = 4 * (std::max(m, n) + 1) * TypeUtilities<T>::error;
+
+  auto el_ref = [&mat_ref_local](const GlobalElementIndex& ij) { return mat_ref_local(ij); };
+  CHECK_MATRIX_NEAR(submatrix(el_ref), mat_h, error, error);
+
+  // Expected tau of the column j of the global matrix (-1 means untouched)
+  const SizeType k = std::min(m, n);
+  const auto& dist_taus_ref = mat_taus_ref.distribution();
+  auto expected_tau = [&](const SizeType j) {
+    if (j < offset || j >= offset + k)
+      return TypeUtilities<T>::element(-1, 0);
+    // Note: the tau of the size 1 reflector (m <= n) is not computed by the C++ API
+    const SizeType j_sub = j - offset;
+    if (j_sub >= dist_taus_ref.size().rows())
+      return tau_last;
+    const GlobalTileIndex tau_idx(dist_taus_ref.global_tile_from_global_element<Coord::Row>(j_sub), 0);
+    const auto tile_tau = pika::this_thread::experimental::sync_wait(mat_taus_ref.read(tau_idx));
+    return tile_tau.get()({dist_taus_ref.tile_element_from_global_element<Coord::Row>(j_sub), 0});
+  };
+
+  for (SizeType j_lc = 0; j_lc < distribution.local_size().cols(); ++j_lc) {
+    const SizeType j = distribution.global_element_from_local_element<Coord::Col>(j_lc);
+    EXPECT_LE(std::abs(tau[static_cast<std::size_t>(j_lc)] - expected_tau(j)), error) << "j = " << j;
+  }
+
+  // Suspend pika to make sure dlaf_finalize resumes it
+  pika::suspend();
+
+  c_api_test_finalize<api>(dlaf_context);
+}
+
+TYPED_TEST(QRTestCapi, CorrectnessDistributedDLAF) {
+  for (auto& grid : this->commGrids()) {
+    for (const auto& [m, n, mb] : sizes) {
+      testQR<TypeParam, API::dlaf>(grid, m, n, mb);
+    }
+  }
+}
+
+TYPED_TEST(QRTestCapi, CorrectnessDistributedSubmatrixDLAF) {
+  for (auto& grid : this->commGrids()) {
+    for (const auto& [m, n, mb, offset] : sizes_submatrix) {
+      testQR<TypeParam, API::dlaf>(grid, m, n, mb, offset);
+    }
+  }
+}
+
+#ifdef DLAF_WITH_SCALAPACK
+TYPED_TEST(QRTestCapi, CorrectnessDistributedScaLAPACK) {
+  for (auto& grid : this->commGrids()) {
+    for (const auto& [m, n, mb] : sizes) {
+      testQR<TypeParam, API::scalapack>(grid, m, n, mb);
+    }
+  }
+}
+
+TYPED_TEST(QRTestCapi, CorrectnessDistributedSubmatrixScaLAPACK) {
+  for (auto& grid : this->commGrids()) {
+    for (const auto& [m, n, mb, offset] : sizes_submatrix) {
+      testQR<TypeParam, API::scalapack>(grid, m, n, mb, offset);
+    }
+  }
+}
+#endif
@@ -0,0 +1,56 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include "test_qr_c_api_wrapper.h"
+
+#include <dlaf_c/factorization/qr.h>
+#include <dlaf_c/utils.h>
+
+int C_dlaf_qr_factorization_s(const int dlaf_context, float* a, const struct DLAF_descriptor desca,
+                              float* tau) {
+  return dlaf_qr_factorization_s(dlaf_context, a, desca, tau);
+}
+
+int C_dlaf_qr_factorization_d(const int dlaf_context, double* a, const struct DLAF_descriptor desca,
+                              double* tau) {
+  return dlaf_qr_factorization_d(dlaf_context, a, desca, tau);
+}
+
+int C_dlaf_qr_factorization_c(const int dlaf_context, dlaf_complex_c* a,
+                              const struct DLAF_descriptor desca, dlaf_complex_c* tau) {
+  return dlaf_qr_factorization_c(dlaf_context, a, desca, tau);
+}
+
+int C_dlaf_qr_factorization_z(const int dlaf_context, dlaf_complex_z* a,
+                              const struct DLAF_descriptor desca, dlaf_complex_z* tau) {
+  return dlaf_qr_factorization_z(dlaf_context, a, desca, tau);
+}
+
+#ifdef DLAF_WITH_SCALAPACK
+void C_dlaf_psgeqrf(const int m, const int n, float* a, const int ia, const int ja, const int desca[9],
+                    float* tau, int* info) {
+  dlaf_psgeqrf(m, n, a, ia, ja, desca, tau, info);
+}
+
+void C_dlaf_pdgeqrf(const int m, const int n, double* a, const int ia, const int ja,
+                    const int desca[9], double* tau, int* info) {
+  dlaf_pdgeqrf(m, n, a, ia, ja, desca, tau, info);
+}
+
+void C_dlaf_pcgeqrf(const int m, const int n, dlaf_complex_c* a, const int ia, const int ja,
+                    const int desca[9], dlaf_complex_c* tau, int* info) {
+  dlaf_pcgeqrf(m, n, a, ia, ja, desca, tau, info);
+}
+
+void C_dlaf_pzgeqrf(const int m, const int n, dlaf_complex_z* a, const int ia, const int ja,
+                    const int desca[9], dlaf_complex_z* tau, int* info) {
+  dlaf_pzgeqrf(m, n, a, ia, ja, desca, tau, info);
+}
+#endif
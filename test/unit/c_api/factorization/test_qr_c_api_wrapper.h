@@ -0,0 +1,40 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#pragma once
+
+#include <dlaf_c/desc.h>
+#include <dlaf_c/utils.h>
+
+DLAF_EXTERN_C int C_dlaf_qr_factorization_s(const int dlaf_context, float* a,
+                                            const struct DLAF_descriptor desca, float* tau);
+
+DLAF_EXTERN_C int C_dlaf_qr_factorization_d(const int dlaf_context, double* a,
+                                            const struct DLAF_descriptor desca, double* tau);
+
+DLAF_EXTERN_C int C_dlaf_qr_factorization_c(const int dlaf_context, dlaf_complex_c* a,
+                                            const struct DLAF_descriptor desca, dlaf_complex_c* tau);
+
+DLAF_EXTERN_C int C_dlaf_qr_factorization_z(const int dlaf_context, dlaf_complex_z* a,
+                                            const struct DLAF_descriptor desca, dlaf_complex_z* tau);
+
+#ifdef DLAF_WITH_SCALAPACK
+DLAF_EXTERN_C void C_dlaf_psgeqrf(const int m, const int n, float* a, const int ia, const int ja,
+                                  const int desca[9], float* tau, int* info);
+
+DLAF_EXTERN_C void C_dlaf_pdgeqrf(const int m, const int n, double* a, const int ia, const int ja,
+                                  const int desca[9], double* tau, int* info);
+
+DLAF_EXTERN_C void C_dlaf_pcgeqrf(const int m, const int n, dlaf_complex_c* a, const int ia,
+                                  const int ja, const int desca[9], dlaf_complex_c* tau, int* info);
+
+DLAF_EXTERN_C void C_dlaf_pzgeqrf(const int m, const int n, dlaf_complex_z* a, const int ia,
+                                  const int ja, const int desca[9], dlaf_complex_z* tau, int* info);
+#endif
@@ -0,0 +1,149 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+
+#include <pika/execution.hpp>
+
+#include <dlaf/common/trace.h>
+#include <dlaf/sender/policy.h>
+#include <dlaf/sender/transform.h>
+
+#include <gtest/gtest.h>
+
+using namespace dlaf;
+using namespace dlaf::common::internal;
+
+namespace ex = pika::execution::experimental;
+namespace tt = pika::this_thread::experimental;
+
+namespace {
+constexpr std::size_t max_events_per_thread = 1024;
+
+struct traced_kernel_t {
+  int operator()(const int value) const {
+    return 2 * value;
+  }
+};
+
+std::string readFile(const std::string& filename) {
+  std::ifstream is(filename);
+  std::stringstream ss;
+  ss << is.rdbuf();
+  return ss.str();
+}
+
+int runKernel() {
+  return tt::sync_wait(ex::just(13) | dlaf::internal::transform(dlaf::internal::Policy<Backend::MC>(),
+                                                                traced_kernel_t{}));
+}
+}
+
+TEST(TraceTest, Disabled) {
+  const std::string filename = "test_trace_disabled.json";
+
+  EXPECT_FALSE(traceEnabled());
+  EXPECT_EQ(26, runKernel());
+
+  exportTrace(filename, 3);
+  const std::string trace = readFile(filename);
+  std::remove(filename.c_str());
+
+  EXPECT_NE(std::string::npos, trace.find("\"traceEvents\""));
+  EXPECT_NE(std::string::npos, trace.find("rank 3"));
+  EXPECT_EQ(std::string::npos, trace.find("traced_kernel_t"));
+}
+
+TEST(TraceTest, Enabled) {
+  const std::string filename = "test_trace_enabled.json";
+
+  enableTrace(max_events_per_thread);
+  EXPECT_TRUE(traceEnabled());
+  EXPECT_EQ(26, runKernel());
+  EXPECT_EQ(26, runKernel());
+
+  exportTrace(filename, 3);
+  disableTrace();
+  const std::string trace = readFile(filename);
+  std::remove(filename.c_str());
+
+  // both calls of the kernel are recorded as complete events of rank 3
+  const std::string event_name = "\"name\":\"(anonymous namespace)::traced_kernel_t\"";
+  const auto first = trace.find(event_name);
+  ASSERT_NE(std::string::npos, first);
+  EXPECT_NE(std::string::npos, trace.find(event_name, first + 1));
+  EXPECT_NE(std::string::npos, trace.find("\"cat\":\"mc\",\"ph\":\"X\",\"pid\":3"));
+
+  // exported events are discarded
+  exportTrace(filename, 3);
+  EXPECT_EQ(std::string::npos, readFile(filename).find("traced_kernel_t"));
+  std::remove(filename.c_str());
+}
+
+TEST(TraceTest, TileIndex) {
+  const std::string filename = "test_trace_tile_index.json";
+
+  enableTrace(max_events_per_thread);
+  EXPECT_EQ(26, runKernel());
+  {
+    TraceTileScope scope(4, 5);
+    EXPECT_EQ(4, currentTraceTile().row);
+    EXPECT_EQ(5, currentTraceTile().col);
+    {
+      TraceTileScope inner_scope(6, 7);
+      EXPECT_EQ(6, currentTraceTile().row);
+    }
+    EXPECT_EQ(4, currentTraceTile().row);
+    EXPECT_EQ(26, runKernel());
+  }
+  EXPECT_EQ(-1, currentTraceTile().row);
+  EXPECT_EQ(-1, currentTraceTile().col);
+
+  exportTrace(filename, 3);
+  disableTrace();
+  const std::string trace = readFile(filename);
+  std::remove(filename.c_str());
+
+  // only the kernel created in the scope records the tile index
+  const auto tile = trace.find("\"args\":{\"tile\":[4,5]}");
+  ASSERT_NE(std::string::npos, tile);
+  EXPECT_EQ(std::string::npos, trace.find("\"tile\"", tile + 1));
+}
+
+TEST(TraceTest, DroppedEvents) {
+  const std::string filename = "test_trace_dropped_events.json";
+  const std::size_t max_events = 2;
+
+  enableTrace(max_events);
+  for (int i = 0; i < 5; ++i) {
+    const auto now = TraceClock::now();
+    recordTraceEvent({&typeid(traced_kernel_t), "mc", now, now, {}});
+  }
+
+  exportTrace(filename, 3);
+  disableTrace();
+  const std::string trace = readFile(filename);
+  std::remove(filename.c_str());
+
+  // events exceeding the size of the buffer of the thread are dropped and counted
+  const std::string event_name = "\"name\":\"(anonymous namespace)::traced_kernel_t\"";
+  const auto first = trace.find(event_name);
+  ASSERT_NE(std::string::npos, first);
+  const auto second = trace.find(event_name, first + 1);
+  ASSERT_NE(std::string::npos, second);
+  EXPECT_EQ(std::string::npos, trace.find(event_name, second + 1));
+  EXPECT_NE(std::string::npos, trace.find("\"name\":\"dropped_events\",\"ph\":\"M\",\"pid\":3,"
+                                          "\"args\":{\"count\":3}"));
+}
@@ -17,6 +17,8 @@
 #include <dlaf/communication/communicator_pipeline.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/panel.h>
+#include <dlaf/tune.h>
+#include <dlaf/types.h>
 
 #include <gtest/gtest.h>
 
@@ -54,7 +56,8 @@ std::vector<ParamsBcast> test_params{
     {{26, 13}, {3, 3}, {1, 2}},
 };
 
-template <class TypeParam, Coord panel_axis, StoreTransposed Storage>
+template <class TypeParam, Coord panel_axis, StoreTransposed Storage,
+          BroadcastPanelAlgorithm algorithm = BroadcastPanelAlgorithm::collective>
 void testBroadcast(const ParamsBcast& cfg, comm::CommunicatorGrid& comm_grid) {
   using TypeUtil = TypeUtilities<TypeParam>;
 
@@ -80,7 +83,7 @@ void testBroadcast(const ParamsBcast& cfg, comm::CommunicatorGrid& comm_grid) {
   constexpr Coord comm_dir = orthogonal(panel_axis);
   auto mpi_task_chain(comm_grid.communicator_pipeline<comm_dir>());
 
-  broadcast(root, panel, mpi_task_chain);
+  broadcast(root, panel, mpi_task_chain, algorithm);
 
   // check all panel are equal on all ranks
   for (const auto i_w : panel.iteratorLocal())
@@ -111,6 +114,56 @@ TYPED_TEST(PanelBcastTest, BroadcastRowStoreTransposed) {
       testBroadcast<TypeParam, Coord::Row, StoreTransposed::Yes>(cfg, comm_grid);
 }
 
+TYPED_TEST(PanelBcastTest, BroadcastColRing) {
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params)
+      testBroadcast<TypeParam, Coord::Col, StoreTransposed::No, BroadcastPanelAlgorithm::ring>(
+          cfg, comm_grid);
+}
+
+TYPED_TEST(PanelBcastTest, BroadcastRowRing) {
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params)
+      testBroadcast<TypeParam, Coord::Row, StoreTransposed::No, BroadcastPanelAlgorithm::ring>(
+          cfg, comm_grid);
+}
+
+// Note: the maximum size is large enough for all the local tiles of the panels of test_params (and of
+// test_params_bcast_transpose), hence they are broadcast with a single message when more than one.
+constexpr SizeType aggregate_max_bytes = 1 << 20;
+
+TYPED_TEST(PanelBcastTest, BroadcastColAggregated) {
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = aggregate_max_bytes;
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params)
+      testBroadcast<TypeParam, Coord::Col, StoreTransposed::No>(cfg, comm_grid);
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = 0;
+}
+
+TYPED_TEST(PanelBcastTest, BroadcastRowAggregated) {
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = aggregate_max_bytes;
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params)
+      testBroadcast<TypeParam, Coord::Row, StoreTransposed::No>(cfg, comm_grid);
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = 0;
+}
+
+TYPED_TEST(PanelBcastTest, BroadcastColStoreTransposedAggregated) {
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = aggregate_max_bytes;
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params)
+      testBroadcast<TypeParam, Coord::Col, StoreTransposed::Yes>(cfg, comm_grid);
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = 0;
+}
+
+TYPED_TEST(PanelBcastTest, BroadcastRowStoreTransposedAggregated) {
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = aggregate_max_bytes;
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params)
+      testBroadcast<TypeParam, Coord::Row, StoreTransposed::Yes>(cfg, comm_grid);
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = 0;
+}
+
 struct ParamsBcastTranspose {
   const GlobalElementSize sz;
   const TileElementSize blocksz;
@@ -126,7 +179,8 @@ std::vector<ParamsBcastTranspose> test_params_bcast_transpose{
     {{25, 25}, {5, 5}, {1, 1}, {3, 3}},
 };
 
-template <class TypeParam, Coord AxisSrc, StoreTransposed storageT>
+template <class TypeParam, Coord AxisSrc, StoreTransposed storageT,
+          BroadcastPanelAlgorithm algorithm = BroadcastPanelAlgorithm::collective>
 void testBroadcastTranspose(const ParamsBcastTranspose& cfg, comm::CommunicatorGrid& comm_grid) {
   using TypeUtil = TypeUtilities<TypeParam>;
 
@@ -150,7 +204,7 @@ void testBroadcastTranspose(const ParamsBcastTranspose& cfg, comm::CommunicatorG
   // select a "random" source rank which will be the source for the data
   const comm::IndexT_MPI owner = comm_grid.size().get(AxisSrc) / 2;
 
-  broadcast(owner, panel_src, panel_dst, row_task_chain, col_task_chain);
+  broadcast(owner, panel_src, panel_dst, row_task_chain, col_task_chain, algorithm);
 
   // Note:
   // all source panels will have access to the same data available on the root rank,
@@ -186,3 +240,33 @@ TYPED_TEST(PanelBcastTest, BroadcastRow2ColStoreTransposed) {
     for (const auto& cfg : test_params_bcast_transpose)
       testBroadcastTranspose<TypeParam, Coord::Row, StoreTransposed::Yes>(cfg, comm_grid);
 }
+
+TYPED_TEST(PanelBcastTest, BroadcastCol2RowRing) {
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params_bcast_transpose)
+      testBroadcastTranspose<TypeParam, Coord::Col, StoreTransposed::No, BroadcastPanelAlgorithm::ring>(
+          cfg, comm_grid);
+}
+
+TYPED_TEST(PanelBcastTest, BroadcastRow2ColRing) {
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params_bcast_transpose)
+      testBroadcastTranspose<TypeParam, Coord::Row, StoreTransposed::No, BroadcastPanelAlgorithm::ring>(
+          cfg, comm_grid);
+}
+
+TYPED_TEST(PanelBcastTest, BroadcastCol2RowAggregated) {
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = aggregate_max_bytes;
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params_bcast_transpose)
+      testBroadcastTranspose<TypeParam, Coord::Col, StoreTransposed::No>(cfg, comm_grid);
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = 0;
+}
+
+TYPED_TEST(PanelBcastTest, BroadcastRow2ColAggregated) {
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = aggregate_max_bytes;
+  for (auto& comm_grid : this->commGrids())
+    for (const auto& cfg : test_params_bcast_transpose)
+      testBroadcastTranspose<TypeParam, Coord::Row, StoreTransposed::No>(cfg, comm_grid);
+  getTuneParameters().broadcast_panel_aggregate_max_bytes = 0;
+}
@@ -8,7 +8,10 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <algorithm>
+#include <memory>
 #include <utility>
+#include <vector>
 
 #include <dlaf/common/data.h>
 #include <dlaf/common/index2d.h>
@@ -16,6 +19,7 @@
 #include <dlaf/communication/communicator.h>
 #include <dlaf/communication/kernels/p2p.h>
 #include <dlaf/communication/kernels/p2p_allsum.h>
+#include <dlaf/communication/kernels/persistent.h>
 #include <dlaf/matrix/copy_tile.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/index.h>
@@ -298,3 +302,94 @@ TEST_F(P2PTestMC, AllSumMixTags) {
   // tiles are stored in non-contiguous memory
   testSendRecvMixTags(world, MatrixT(dist, {matrix::AllocationLayout::ColMajor, 16}));
 }
+
+TEST_F(P2PTestMC, PersistentSendRecv) {
+  const comm::IndexT_MPI rank_src = world.size() - 1;
+  const comm::IndexT_MPI rank_dst = (world.size() - 1) / 2;
+
+  constexpr comm::IndexT_MPI tag = 13;
+  constexpr int count = 5;
+
+  auto requests = std::make_shared<comm::PersistentRequests>();
+  std::vector<T> buffer(count);
+
+  // the same persistent request is restarted at each step
+  for (int step = 0; step < 3; ++step) {
+    if (world.rank() == rank_src) {
+      std::fill(buffer.begin(), buffer.end(), static_cast<T>(step));
+      tt::sync_wait(comm::schedule_persistent_send(ex::just(world), requests, rank_dst, tag,
+                                                   buffer.data(), count, ex::just()));
+    }
+    else if (world.rank() == rank_dst) {
+      std::fill(buffer.begin(), buffer.end(), static_cast<T>(-1));
+      tt::sync_wait(comm::schedule_persistent_recv(ex::just(world), requests, rank_src, tag,
+                                                   buffer.data(), count, ex::just()));
+      for (const T& value : buffer)
+        EXPECT_EQ(static_cast<T>(step), value);
+    }
+  }
+}
+
+TEST_F(P2PTestMC, PersistentSendRecvInUse) {
+  const comm::IndexT_MPI rank_src = world.size() - 1;
+  const comm::IndexT_MPI rank_dst = (world.size() - 1) / 2;
+
+  constexpr comm::IndexT_MPI tag = 13;
+  constexpr int count = 5;
+
+  auto requests = std::make_shared<comm::PersistentRequests>();
+  std::vector<T> buffer(count, static_cast<T>(26));
+
+  // the second send is issued while the persistent request of the first one is still in use
+  if (world.rank() == rank_src) {
+    auto send1 = ex::ensure_started(comm::schedule_persistent_send(
+        ex::just(world), requests, rank_dst, tag, buffer.data(), count, ex::just()));
+    auto send2 = ex::ensure_started(comm::schedule_persistent_send(
+        ex::just(world), requests, rank_dst, tag, buffer.data(), count, ex::just()));
+    tt::sync_wait(ex::when_all(std::move(send1), std::move(send2)));
+  }
+  else if (world.rank() == rank_dst) {
+    for (int i = 0; i < 2; ++i) {
+      std::fill(buffer.begin(), buffer.end(), static_cast<T>(-1));
+      tt::sync_wait(comm::schedule_persistent_recv(ex::just(world), requests, rank_src, tag,
+                                                   buffer.data(), count, ex::just()));
+      for (const T& value : buffer)
+        EXPECT_EQ(static_cast<T>(26), value);
+    }
+  }
+}
+
+TEST_F(P2PTestMC, PersistentBcast) {
+  const comm::IndexT_MPI root = world.size() - 1;
+  constexpr int count = 5;
+
+  auto requests = std::make_shared<comm::PersistentRequests>();
+  std::vector<T> buffer(count);
+
+  for (int step = 0; step < 3; ++step) {
+    std::fill(buffer.begin(), buffer.end(), static_cast<T>(world.rank() == root ? step : -1));
+    tt::sync_wait(comm::schedule_persistent_bcast(ex::just(world), requests, root, buffer.data(),
+                                                  count, ex::just()));
+    for (const T& value : buffer)
+      EXPECT_EQ(static_cast<T>(step), value);
+  }
+}
+
+TEST_F(P2PTestMC, PersistentBcastInUse) {
+  const comm::IndexT_MPI root = world.size() - 1;
+  constexpr int count = 5;
+
+  auto requests = std::make_shared<comm::PersistentRequests>();
+  std::vector<T> buffer(count, static_cast<T>(world.rank() == root ? 26 : -1));
+
+  // the second broadcast is scheduled while the persistent request of the first one is still in use,
+  // hence it waits for its completion
+  auto bcast1 = ex::ensure_started(comm::schedule_persistent_bcast(ex::just(world), requests, root,
+                                                                   buffer.data(), count, ex::just()));
+  auto bcast2 = ex::ensure_started(comm::schedule_persistent_bcast(ex::just(world), requests, root,
+                                                                   buffer.data(), count, ex::just()));
+  tt::sync_wait(ex::when_all(std::move(bcast1), std::move(bcast2)));
+
+  for (const T& value : buffer)
+    EXPECT_EQ(static_cast<T>(26), value);
+}
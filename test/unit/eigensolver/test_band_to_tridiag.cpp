@@ -173,6 +173,20 @@ TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessLocalFromCPU) {
   }
 }
 
+TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessLocalFromCPUMultipleSweepsPerTask) {
+  const blas::Uplo uplo = blas::Uplo::Lower;
+
+  for (const SizeType sweeps_per_task : {2, 3, 4}) {
+    getTuneParameters().band_to_tridiag_sweeps_per_task = sweeps_per_task;
+    for (const auto& [m, mb, mb_1d, b] : sizes) {
+      SCOPED_TRACE(::testing::Message() << "sweeps per task " << sweeps_per_task);
+      getTuneParameters().band_to_tridiag_1d_block_size_base = mb_1d;
+      testBandToTridiag<Device::CPU, TypeParam>(uplo, b, m, mb);
+    }
+  }
+  getTuneParameters().band_to_tridiag_sweeps_per_task = 1;
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessLocalFromGPU) {
   const blas::Uplo uplo = blas::Uplo::Lower;
@@ -195,6 +209,19 @@ TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessDistributed) {
   }
 }
 
+TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessDistributedPersistentRequests) {
+  const blas::Uplo uplo = blas::Uplo::Lower;
+
+  getTuneParameters().band_to_tridiag_persistent_requests = true;
+  for (auto& comm_grid : this->commGrids()) {
+    for (const auto& [m, mb, mb_1d, b] : sizes) {
+      getTuneParameters().band_to_tridiag_1d_block_size_base = mb_1d;
+      testBandToTridiag<Device::CPU, TypeParam>(comm_grid, uplo, b, m, mb);
+    }
+  }
+  getTuneParameters().band_to_tridiag_persistent_requests = false;
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(EigensolverBandToTridiagTest, CorrectnessDistributedFromGPU) {
   const blas::Uplo uplo = blas::Uplo::Lower;
@@ -13,6 +13,7 @@
 
 #include <pika/init.hpp>
 
+#include <dlaf/common/range2d.h>
 #include <dlaf/common/single_threaded_blas.h>
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/eigensolver/band_to_tridiag.h>  // for nrSweeps/nrStepsForSweep
@@ -92,12 +93,28 @@ void computeTaus(const SizeType max_refl_size, const SizeType k, matrix::Tile<T,
   }
 }
 
+// If @p from_real is true, E is initialized by the algorithm from a random real matrix (see
+// BackTransformationT2B::call), hence its initial random values must be overwritten.
+template <class T>
+void setFromReal(MatrixLocal<T>& mat_e_local, MatrixLocal<const BaseType<T>>& mat_e_real_local) {
+  for (const auto& ij : common::iterate_range2d(mat_e_local.size()))
+    *mat_e_local.ptr(ij) = T(mat_e_real_local(ij));
+}
+
 template <Backend B, Device D, class T>
-void testBacktransformation(SizeType m, SizeType n, SizeType mb, SizeType nb, const SizeType b) {
+void testBacktransformation(SizeType m, SizeType n, SizeType mb, SizeType nb, const SizeType b,
+                            const bool from_real = false) {
   Matrix<T, Device::CPU> mat_e_h({m, n}, {mb, nb});
   set_random(mat_e_h);
   auto mat_e_local = allGather<T>(blas::Uplo::General, mat_e_h);
 
+  Matrix<BaseType<T>, Device::CPU> mat_e_real_h(mat_e_h.distribution());
+  if (from_real) {
+    set_random(mat_e_real_h);
+    auto mat_e_real_local = allGather<const BaseType<T>>(blas::Uplo::General, mat_e_real_h);
+    setFromReal(mat_e_local, mat_e_real_local);
+  }
+
   Matrix<const T, Device::CPU> mat_hh = [m, mb, b]() {
     Matrix<T, Device::CPU> mat_hh({m, m}, {mb, mb});
     set_random(mat_hh);
@@ -133,7 +150,16 @@ void testBacktransformation(SizeType m, SizeType n, SizeType mb, SizeType nb, co
   {
     MatrixMirror<T, D, Device::CPU> mat_e(mat_e_h);
     matrix::internal::MatrixRef mat_e_ref(mat_e.get());
-    eigensolver::internal::bt_band_to_tridiagonal<B>(b, mat_e_ref, mat_hh);
+    if (from_real) {
+      MatrixMirror<const BaseType<T>, D, Device::CPU> mat_e_real(mat_e_real_h);
+      matrix::internal::MatrixRef<const BaseType<T>, D> mat_e_real_ref(mat_e_real.get());
+      eigensolver::internal::BackTransformationT2BWorkspace<B, D, T> ws;
+      eigensolver::internal::BackTransformationT2B<B, D, T>::call(b, mat_e_ref, mat_e_real_ref, mat_hh,
+                                                                  ws);
+    }
+    else {
+      eigensolver::internal::bt_band_to_tridiagonal<B>(b, mat_e_ref, mat_hh);
+    }
   }
 
   if (m == 0 || n == 0)
@@ -174,13 +200,20 @@ void testBacktransformation(SizeType m, SizeType n, SizeType mb, SizeType nb, co
 
 template <Backend B, Device D, class T>
 void testBacktransformation(comm::CommunicatorGrid& grid, SizeType m, SizeType n, SizeType mb,
-                            SizeType nb, const SizeType b) {
+                            SizeType nb, const SizeType b, const bool from_real = false) {
   const Distribution dist({m, n}, {mb, nb}, grid.size(), grid.rank(), {0, 0});
 
   Matrix<T, Device::CPU> mat_e_h(dist);
   set_random(mat_e_h);
   auto mat_e_local = allGather<T>(blas::Uplo::General, mat_e_h, grid);
 
+  Matrix<BaseType<T>, Device::CPU> mat_e_real_h(dist);
+  if (from_real) {
+    set_random(mat_e_real_h);
+    auto mat_e_real_local = allGather<const BaseType<T>>(blas::Uplo::General, mat_e_real_h, grid);
+    setFromReal(mat_e_local, mat_e_real_local);
+  }
+
   Matrix<const T, Device::CPU> mat_hh = [&grid, m, mb, b]() {
     const Distribution dist({m, m}, {mb, mb}, grid.size(), grid.rank(), {0, 0});
 
@@ -213,7 +246,16 @@ void testBacktransformation(comm::CommunicatorGrid& grid, SizeType m, SizeType n
   {
     MatrixMirror<T, D, Device::CPU> mat_e(mat_e_h);
     matrix::internal::MatrixRef mat_e_ref(mat_e.get());
-    eigensolver::internal::bt_band_to_tridiagonal<B>(grid, b, mat_e_ref, mat_hh);
+    if (from_real) {
+      MatrixMirror<const BaseType<T>, D, Device::CPU> mat_e_real(mat_e_real_h);
+      matrix::internal::MatrixRef<const BaseType<T>, D> mat_e_real_ref(mat_e_real.get());
+      eigensolver::internal::BackTransformationT2BWorkspace<B, D, T> ws;
+      eigensolver::internal::BackTransformationT2B<B, D, T>::call(grid, b, mat_e_ref, mat_e_real_ref,
+                                                                  mat_hh, ws);
+    }
+    else {
+      eigensolver::internal::bt_band_to_tridiagonal<B>(grid, b, mat_e_ref, mat_hh);
+    }
   }
 
   if (m == 0 || n == 0)
@@ -280,6 +322,23 @@ TYPED_TEST(BacktransformationBandToTridiagTestMC, CorrectnessDistributed) {
   }
 }
 
+TYPED_TEST(BacktransformationBandToTridiagTestMC, CorrectnessLocalFromReal) {
+  for (const auto& [m, n, mb, nb, group_size, b] : configs) {
+    getTuneParameters().bt_band_to_tridiag_hh_apply_group_size = group_size;
+    testBacktransformation<Backend::MC, Device::CPU, TypeParam>(m, n, mb, nb, b, true);
+  }
+}
+
+TYPED_TEST(BacktransformationBandToTridiagTestMC, CorrectnessDistributedFromReal) {
+  for (auto& comm_grid : this->commGrids()) {
+    for (const auto& [m, n, mb, nb, group_size, b] : configs) {
+      getTuneParameters().bt_band_to_tridiag_hh_apply_group_size = group_size;
+      testBacktransformation<Backend::MC, Device::CPU, TypeParam>(comm_grid, m, n, mb, nb, b, true);
+      pika::wait();
+    }
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(BacktransformationBandToTridiagTestGPU, CorrectnessLocal) {
   for (const auto& [m, n, mb, nb, group_size, b] : configs) {
@@ -297,6 +356,23 @@ TYPED_TEST(BacktransformationBandToTridiagTestGPU, CorrectnessDistributed) {
     }
   }
 }
+
+TYPED_TEST(BacktransformationBandToTridiagTestGPU, CorrectnessLocalFromReal) {
+  for (const auto& [m, n, mb, nb, group_size, b] : configs) {
+    getTuneParameters().bt_band_to_tridiag_hh_apply_group_size = group_size;
+    testBacktransformation<Backend::GPU, Device::GPU, TypeParam>(m, n, mb, nb, b, true);
+  }
+}
+
+TYPED_TEST(BacktransformationBandToTridiagTestGPU, CorrectnessDistributedFromReal) {
+  for (auto& comm_grid : this->commGrids()) {
+    for (const auto& [m, n, mb, nb, group_size, b] : configs) {
+      getTuneParameters().bt_band_to_tridiag_hh_apply_group_size = group_size;
+      testBacktransformation<Backend::GPU, Device::GPU, TypeParam>(comm_grid, m, n, mb, nb, b, true);
+      pika::wait();
+    }
+  }
+}
 #endif
 
 std::vector<config_t> configs_subband{
@@ -8,16 +8,24 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <filesystem>
 #include <optional>
 #include <set>
+#include <stdexcept>
+#include <string>
 #include <tuple>
 #include <utility>
 #include <vector>
 
+#include <pika/init.hpp>
+
 #include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/error.h>
 #include <dlaf/eigensolver/eigensolver.h>
 #include <dlaf/eigensolver/eigensolver/api.h>
+#include <dlaf/eigensolver/eigensolver/checkpoint.h>
 #include <dlaf/matrix/copy.h>
+#include <dlaf/matrix/hdf5.h>
 #include <dlaf/matrix/matrix.h>
 #include <dlaf/matrix/matrix_mirror.h>
 #include <dlaf/tune.h>
@@ -60,7 +68,7 @@ TYPED_TEST_SUITE(EigensolverTestGPU, MatrixElementTypes);
 enum class Allocation { use_preallocated, do_allocation };
 enum class MatrixType { random, identity };
 
-const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower});
+const std::vector<blas::Uplo> blas_uplos({blas::Uplo::Lower, blas::Uplo::Upper});
 
 const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
     // {m, mb, eigensolver_min_band}
@@ -80,6 +88,48 @@ std::set<std::optional<SizeType>> num_evals(const SizeType m) {
   return {std::nullopt, 0, m / 2, m};
 }
 
+// Sets the limits for using the one-stage tridiagonal reduction for the lifetime of the object.
+struct OneStageReductionLimits {
+  OneStageReductionLimits(const SizeType max_size, const bool distributed, const SizeType max_nranks)
+      : max_size_(getTuneParameters().eigensolver_one_stage_max_size),
+        distributed_(getTuneParameters().eigensolver_one_stage_distributed),
+        max_nranks_(getTuneParameters().eigensolver_one_stage_max_nranks) {
+    getTuneParameters().eigensolver_one_stage_max_size = max_size;
+    getTuneParameters().eigensolver_one_stage_distributed = distributed;
+    getTuneParameters().eigensolver_one_stage_max_nranks = max_nranks;
+  }
+  ~OneStageReductionLimits() {
+    getTuneParameters().eigensolver_one_stage_max_size = max_size_;
+    getTuneParameters().eigensolver_one_stage_distributed = distributed_;
+    getTuneParameters().eigensolver_one_stage_max_nranks = max_nranks_;
+  }
+
+private:
+  SizeType max_size_;
+  bool distributed_;
+  SizeType max_nranks_;
+};
+
+// With uplo == Upper the strictly lower triangle of the input matrix is not referenced, therefore it has
+// to be left untouched by the eigensolver.
+template <class T, class... GridIfDistributed>
+void checkStrictlyLowerUntouched(Matrix<const T, Device::CPU>& reference,
+                                 Matrix<const T, Device::CPU>& mat_a, GridIfDistributed&... grid) {
+  constexpr bool isDistributed = (sizeof...(grid) == 1);
+  if constexpr (isDistributed)
+    pika::wait();
+
+  auto reference_local = allGather<T>(blas::Uplo::General, reference, grid...);
+  auto mat_a_local = allGather<T>(blas::Uplo::General, mat_a, grid...);
+
+  for (SizeType j = 0; j < mat_a.size().cols(); ++j) {
+    for (SizeType i = j + 1; i < mat_a.size().rows(); ++i) {
+      const GlobalElementIndex ij(i, j);
+      EXPECT_EQ(reference_local(ij), mat_a_local(ij)) << ij;
+    }
+  }
+}
+
 template <class T, Backend B, Device D, Allocation allocation, class... GridIfDistributed>
 void testEigensolver(const blas::Uplo uplo, const SizeType m, const SizeType mb, const MatrixType type,
                      const std::optional<SizeType> eigenvalues_index_end, GridIfDistributed&... grid) {
@@ -162,6 +212,13 @@ void testEigensolver(const blas::Uplo uplo, const SizeType m, const SizeType mb,
     }
   }();
 
+  if (uplo == blas::Uplo::Upper)
+    checkStrictlyLowerUntouched(reference, mat_a_h, grid...);
+
+  // The eigenvectors allocated by the solver only hold the requested ones.
+  if constexpr (allocation == Allocation::do_allocation)
+    EXPECT_EQ(GlobalElementSize(m, eval_idx_end), ret.eigenvectors.size());
+
   if (mat_a_h.size().isEmpty() || eval_idx_end == 0)
     return;
 
@@ -169,6 +226,204 @@ void testEigensolver(const blas::Uplo uplo, const SizeType m, const SizeType mb,
                              grid...);
 }
 
+template <class T, Backend B, Device D, Allocation allocation, class... GridIfDistributed>
+void testEigenvaluesOnly(const blas::Uplo uplo, const SizeType m, const SizeType mb,
+                         GridIfDistributed&... grid) {
+  constexpr bool isDistributed = (sizeof...(grid) == 1);
+  const TileElementSize block_size(mb, mb);
+
+  Matrix<const T, Device::CPU> reference = [&]() {
+    auto reference = [&]() -> auto {
+      if constexpr (isDistributed)
+        return Matrix<T, Device::CPU>(GlobalElementSize(m, m), block_size, grid...);
+      else
+        return Matrix<T, Device::CPU>(LocalElementSize(m, m), block_size);
+    }();
+    matrix::util::set_random_hermitian(reference);
+    return reference;
+  }();
+
+  Matrix<T, Device::CPU> mat_a_h(reference.distribution());
+  copy(reference, mat_a_h);
+  Matrix<T, Device::CPU> mat_b_h(reference.distribution());
+  copy(reference, mat_b_h);
+
+  Matrix<BaseType<T>, D> eigenvalues = [&]() {
+    MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+
+    if constexpr (allocation == Allocation::do_allocation) {
+      return hermitian_eigenvalues<B>(grid..., uplo, mat_a.get());
+    }
+    else if constexpr (allocation == Allocation::use_preallocated) {
+      Matrix<BaseType<T>, D> eigenvalues(LocalElementSize(m, 1), TileElementSize(mb, 1));
+      hermitian_eigenvalues<B>(grid..., uplo, mat_a.get(), eigenvalues);
+      return eigenvalues;
+    }
+  }();
+
+  // The eigenvalues computed together with the eigenvectors are used as reference.
+  EigensolverResult<T, D> ret = [&]() {
+    MatrixMirror<T, D, Device::CPU> mat_b(mat_b_h);
+    return hermitian_eigensolver<B>(grid..., uplo, mat_b.get());
+  }();
+
+  if (mat_a_h.size().isEmpty())
+    return;
+
+  auto evals_local = [&]() {
+    MatrixMirror<const BaseType<T>, Device::CPU, D> evals(eigenvalues);
+    return allGather<BaseType<T>>(blas::Uplo::General, evals.get());
+  }();
+  auto evals_ref_local = [&]() {
+    MatrixMirror<const BaseType<T>, Device::CPU, D> evals(ret.eigenvalues);
+    return allGather<BaseType<T>>(blas::Uplo::General, evals.get());
+  }();
+
+  auto expected = [&evals_ref_local](GlobalElementIndex index) { return evals_ref_local(index); };
+  CHECK_MATRIX_NEAR(expected, evals_local, m * TypeUtilities<T>::error, m * TypeUtilities<T>::error);
+}
+
+// Solves two different problems with the same plan, checking that the workspaces are correctly reused.
+// Both a plan for all the eigenvectors and a plan for half of them are tested.
+template <class T, Backend B, Device D, class... GridIfDistributed>
+void testEigensolverPlan(const blas::Uplo uplo, const SizeType m, const SizeType mb,
+                         GridIfDistributed&... grid) {
+  constexpr bool isDistributed = (sizeof...(grid) == 1);
+  const TileElementSize block_size(mb, mb);
+
+  auto reference = [&]() -> auto {
+    if constexpr (isDistributed)
+      return Matrix<T, Device::CPU>(GlobalElementSize(m, m), block_size, grid...);
+    else
+      return Matrix<T, Device::CPU>(LocalElementSize(m, m), block_size);
+  }();
+
+  for (const SizeType nr_evecs : {m, m / 2}) {
+    EigensolverPlan<B, D, T> plan(reference.distribution(), nr_evecs);
+    EXPECT_EQ(GlobalElementSize(m, nr_evecs), plan.result().eigenvectors.size());
+
+    for (SizeType run = 0; run < 2; ++run) {
+      // The diagonal is shifted by run, such that each run solves a different problem.
+      matrix::util::internal::set_random_hermitian_with_offset(reference, run);
+
+      Matrix<T, Device::CPU> mat_a_h(reference.distribution());
+      copy(reference, mat_a_h);
+
+      EigensolverResult<T, D>& ret = [&]() -> EigensolverResult<T, D>& {
+        MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+        return hermitian_eigensolver<B>(grid..., uplo, mat_a.get(), plan);
+      }();
+
+      // The workspace for the upper storage is owned by the plan, and only allocated if needed.
+      EXPECT_EQ(uplo == blas::Uplo::Upper, plan.swap_triangles_workspace().has_value());
+      if (uplo == blas::Uplo::Upper)
+        checkStrictlyLowerUntouched(reference, mat_a_h, grid...);
+
+      if (nr_evecs == 0)
+        continue;
+
+      testEigensolverCorrectness(uplo, reference, ret.eigenvalues, ret.eigenvectors, 0l, nr_evecs,
+                                 grid...);
+    }
+  }
+}
+
+#ifdef DLAF_WITH_HDF5
+// Solves the same problem with checkpointing enabled, first from scratch and then restarting after
+// each of the stages (the interruption is simulated by resetting the last completed stage in the file).
+template <class T, Backend B, Device D>
+void testEigensolverCheckpoint(comm::CommunicatorGrid& grid, const blas::Uplo uplo, const SizeType m,
+                               const SizeType mb) {
+  using eigensolver::internal::EigensolverCheckpoint;
+  using eigensolver::internal::EigensolverStage;
+  using matrix::internal::FileHDF5;
+
+  const std::string filepath = "test_eigensolver_checkpoint.h5";
+  auto remove_file = [&]() {
+    if (grid.rankFullCommunicator(grid.rank()) == 0)
+      std::filesystem::remove(filepath);
+    DLAF_MPI_CHECK_ERROR(MPI_Barrier(grid.fullCommunicator()));
+  };
+
+  Matrix<T, Device::CPU> reference(GlobalElementSize(m, m), TileElementSize(mb, mb), grid);
+  matrix::util::set_random_hermitian(reference);
+
+  remove_file();
+  getTuneParameters().eigensolver_checkpoint_file = filepath;
+
+  for (const auto restart_stage :
+       {EigensolverStage::none, EigensolverStage::tridiagonal_eigensolver,
+        EigensolverStage::band_to_tridiagonal, EigensolverStage::reduction_to_band}) {
+    if (restart_stage != EigensolverStage::none) {
+      FileHDF5 file(grid.fullCommunicator(), filepath, FileHDF5::FileMode::append);
+      file.writeAttribute("stage", static_cast<SizeType>(restart_stage));
+    }
+
+    Matrix<T, Device::CPU> mat_a_h(reference.distribution());
+    copy(reference, mat_a_h);
+
+    EigensolverResult<T, D> ret = [&]() {
+      MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+      return hermitian_eigensolver<B>(grid, uplo, mat_a.get());
+    }();
+
+    testEigensolverCorrectness(uplo, reference, ret.eigenvalues, ret.eigenvectors, 0l, m, grid);
+
+    // The checkpoint of a completed call is marked as finished.
+    FileHDF5 file(grid.fullCommunicator(), filepath, FileHDF5::FileMode::append);
+    EXPECT_EQ(static_cast<SizeType>(EigensolverStage::none), file.readAttribute("stage"));
+  }
+
+  // A finished checkpoint is discarded, hence it can be used for a different problem, while the
+  // checkpoint of an interrupted call cannot.
+  {
+    const matrix::Distribution dist_other(GlobalElementSize(m + 1, m + 1), TileElementSize(mb, mb),
+                                          grid.size(), grid.rank(), {0, 0});
+    EXPECT_NO_THROW(EigensolverCheckpoint<T>(grid, dist_other, mb, 0, m + 1));
+
+    {
+      FileHDF5 file(grid.fullCommunicator(), filepath, FileHDF5::FileMode::append);
+      file.writeAttribute("stage", static_cast<SizeType>(EigensolverStage::reduction_to_band));
+    }
+    EXPECT_THROW(EigensolverCheckpoint<T>(grid, reference.distribution(), mb, 0, m),
+                 std::runtime_error);
+  }
+
+  getTuneParameters().eigensolver_checkpoint_file = "";
+  remove_file();
+}
+#endif
+
+// Solves all the problems in sizes together with a single batched call.
+template <class T, Backend B, Device D>
+void testEigensolverBatched(const blas::Uplo uplo, const SizeType b_min) {
+  getTuneParameters().eigensolver_min_band = b_min;
+
+  std::vector<Matrix<T, Device::CPU>> references;
+  std::vector<Matrix<T, D>> mats;
+  for (const auto& size : sizes) {
+    const SizeType m = std::get<0>(size);
+    const SizeType mb = std::get<1>(size);
+    auto& reference = references.emplace_back(LocalElementSize(m, m), TileElementSize(mb, mb));
+    matrix::util::set_random_hermitian(reference);
+
+    auto& mat = mats.emplace_back(reference.distribution());
+    copy(reference, mat);
+  }
+
+  std::vector<EigensolverResult<T, D>> results = hermitian_eigensolver_batched<B>(uplo, mats);
+  ASSERT_EQ(references.size(), results.size());
+
+  for (std::size_t k = 0; k < references.size(); ++k) {
+    const SizeType m = references[k].size().rows();
+    if (m == 0)
+      continue;
+
+    testEigensolverCorrectness(uplo, references[k], results[k].eigenvalues, results[k].eigenvectors, 0l,
+                               m);
+  }
+}
+
 TYPED_TEST(EigensolverTestMC, CorrectnessLocal) {
   for (auto uplo : blas_uplos) {
     for (auto [m, mb, b_min] : sizes) {
@@ -219,6 +474,106 @@ TYPED_TEST(EigensolverTestMC, CorrectnessDistributed) {
   }
 }
 
+TYPED_TEST(EigensolverTestMC, CorrectnessLocalTwoStage) {
+  const OneStageReductionLimits two_stage_only(0, false, 0);
+
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+
+      for (auto nevals : num_evals(m))
+        testEigensolver<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(
+            uplo, m, mb, MatrixType::random, nevals);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, CorrectnessDistributedOneStage) {
+  const OneStageReductionLimits one_stage(1024, true, 6);
+
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        for (auto nevals : num_evals(m))
+          testEigensolver<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(
+              uplo, m, mb, MatrixType::random, nevals, grid);
+
+        testEigenvaluesOnly<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(uplo, m, mb,
+                                                                                            grid);
+      }
+    }
+  }
+}
+
+#ifdef DLAF_WITH_HDF5
+TYPED_TEST(EigensolverTestMC, CheckpointDistributed) {
+  const OneStageReductionLimits two_stage_only(0, false, 0);
+
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : {std::tuple<SizeType, SizeType, SizeType>{34, 8, 3}, {32, 5, 100}}) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverCheckpoint<TypeParam, Backend::MC, Device::CPU>(grid, uplo, m, mb);
+      }
+    }
+  }
+}
+#endif
+
+TYPED_TEST(EigensolverTestMC, BatchedLocal) {
+  for (auto uplo : blas_uplos) {
+    for (const SizeType b_min : {100l, 3l})
+      testEigensolverBatched<TypeParam, Backend::MC, Device::CPU>(uplo, b_min);
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, PlanLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testEigensolverPlan<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, PlanDistributed) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverPlan<TypeParam, Backend::MC, Device::CPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, EigenvaluesOnlyLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+
+      testEigenvaluesOnly<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(uplo, m, mb);
+      testEigenvaluesOnly<TypeParam, Backend::MC, Device::CPU, Allocation::use_preallocated>(uplo, m,
+                                                                                             mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestMC, EigenvaluesOnlyDistributed) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+
+        testEigenvaluesOnly<TypeParam, Backend::MC, Device::CPU, Allocation::do_allocation>(uplo, m, mb,
+                                                                                            grid);
+        testEigenvaluesOnly<TypeParam, Backend::MC, Device::CPU, Allocation::use_preallocated>(
+            uplo, m, mb, grid);
+      }
+    }
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(EigensolverTestGPU, CorrectnessLocal) {
   for (auto uplo : blas_uplos) {
@@ -267,4 +622,104 @@ TYPED_TEST(EigensolverTestGPU, CorrectnessDistributed) {
     }
   }
 }
+
+TYPED_TEST(EigensolverTestGPU, CorrectnessLocalTwoStage) {
+  const OneStageReductionLimits two_stage_only(0, false, 0);
+
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+
+      for (auto nevals : num_evals(m))
+        testEigensolver<TypeParam, Backend::GPU, Device::GPU, Allocation::do_allocation>(
+            uplo, m, mb, MatrixType::random, nevals);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, CorrectnessDistributedOneStage) {
+  const OneStageReductionLimits one_stage(1024, true, 6);
+
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        for (auto nevals : num_evals(m))
+          testEigensolver<TypeParam, Backend::GPU, Device::GPU, Allocation::do_allocation>(
+              uplo, m, mb, MatrixType::random, nevals, grid);
+
+        testEigenvaluesOnly<TypeParam, Backend::GPU, Device::GPU, Allocation::do_allocation>(uplo, m, mb,
+                                                                                             grid);
+      }
+    }
+  }
+}
+
+#ifdef DLAF_WITH_HDF5
+TYPED_TEST(EigensolverTestGPU, CheckpointDistributed) {
+  const OneStageReductionLimits two_stage_only(0, false, 0);
+
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : {std::tuple<SizeType, SizeType, SizeType>{34, 8, 3}, {32, 5, 100}}) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverCheckpoint<TypeParam, Backend::GPU, Device::GPU>(grid, uplo, m, mb);
+      }
+    }
+  }
+}
+#endif
+
+TYPED_TEST(EigensolverTestGPU, BatchedLocal) {
+  for (auto uplo : blas_uplos) {
+    for (const SizeType b_min : {100l, 3l})
+      testEigensolverBatched<TypeParam, Backend::GPU, Device::GPU>(uplo, b_min);
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, PlanLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+      testEigensolverPlan<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, PlanDistributed) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+        testEigensolverPlan<TypeParam, Backend::GPU, Device::GPU>(uplo, m, mb, grid);
+      }
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, EigenvaluesOnlyLocal) {
+  for (auto uplo : blas_uplos) {
+    for (auto [m, mb, b_min] : sizes) {
+      getTuneParameters().eigensolver_min_band = b_min;
+
+      testEigenvaluesOnly<TypeParam, Backend::GPU, Device::GPU, Allocation::do_allocation>(uplo, m, mb);
+      testEigenvaluesOnly<TypeParam, Backend::GPU, Device::GPU, Allocation::use_preallocated>(uplo, m,
+                                                                                              mb);
+    }
+  }
+}
+
+TYPED_TEST(EigensolverTestGPU, EigenvaluesOnlyDistributed) {
+  for (comm::CommunicatorGrid& grid : this->commGrids()) {
+    for (auto uplo : blas_uplos) {
+      for (auto [m, mb, b_min] : sizes) {
+        getTuneParameters().eigensolver_min_band = b_min;
+
+        testEigenvaluesOnly<TypeParam, Backend::GPU, Device::GPU, Allocation::do_allocation>(uplo, m, mb,
+                                                                                             grid);
+        testEigenvaluesOnly<TypeParam, Backend::GPU, Device::GPU, Allocation::use_preallocated>(
+            uplo, m, mb, grid);
+      }
+    }
+  }
+}
 #endif
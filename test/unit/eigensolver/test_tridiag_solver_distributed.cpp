@@ -8,6 +8,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <cmath>
+#include <optional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -18,11 +20,13 @@
 #include <dlaf/communication/kernels.h>
 #include <dlaf/eigensolver/tridiag_solver.h>
 #include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/tune.h>
 
 #include <gtest/gtest.h>
 
 #include <dlaf_test/comm_grids/grids_6_ranks.h>
 #include <dlaf_test/eigensolver/test_eigensolver_correctness.h>
+#include <dlaf_test/eigensolver/test_tridiag_solver_partial_spectrum.h>
 #include <dlaf_test/matrix/util_generic_lapack.h>
 #include <dlaf_test/matrix/util_matrix.h>
 #include <dlaf_test/util_types.h>
@@ -105,8 +109,13 @@ void solveDistributedLaplace1D(comm::CommunicatorGrid& grid, SizeType n, SizeTyp
     matrix::MatrixMirror<RealParam, D, Device::CPU> evals_mirror(evals);
     matrix::MatrixMirror<T, D, Device::CPU> evecs_mirror(evecs);
 
-    eigensolver::internal::tridiagonal_eigensolver<B>(grid, tridiag, evals_mirror.get(),
-                                                      evecs_mirror.get());
+    if (evals_range)
+      eigensolver::internal::tridiagonal_eigensolver<B>(grid, tridiag, evals_mirror.get(),
+                                                        evecs_mirror.get(), evals_range->first,
+                                                        evals_range->second);
+    else
+      eigensolver::internal::tridiagonal_eigensolver<B>(grid, tridiag, evals_mirror.get(),
+                                                        evecs_mirror.get());
   }
   if (n == 0)
     return;
@@ -182,16 +191,29 @@ void solveDistributedLaplace1D(comm::CommunicatorGrid& grid, SizeType n, SizeTyp
   CHECK_MATRIX_NEAR(expected_evecs_fn, evecs, complex_error * n, complex_error * n);
 }
 
+// Kind of the random tridiagonal matrix: `clustered` has its diagonal elements rounded to a few values
+// and tiny off-diagonal elements, therefore its eigenvalues form a few tight clusters.
+enum class TridiagType { random, clustered };
+
+// Solves a random tridiagonal matrix of size n. If @p evals_range is set only the eigenvectors with
+// index in the range are computed and, if @p compact_evecs is true, stored in an eigenvector matrix
+// having only evals_range->second columns.
 template <Backend B, Device D, class T>
-void solveRandomTridiagMatrix(comm::CommunicatorGrid& grid, SizeType n, SizeType nb) {
+void solveRandomTridiagMatrix(comm::CommunicatorGrid& grid, SizeType n, SizeType nb,
+                              std::optional<std::pair<SizeType, SizeType>> evals_range = std::nullopt,
+                              const bool compact_evecs = false,
+                              const TridiagType type = TridiagType::random) {
   using RealParam = BaseType<T>;
 
   Index2D src_rank_index(std::max(0, grid.size().rows() - 1), std::min(1, grid.size().cols() - 1));
 
+  const SizeType n_evecs = (evals_range && compact_evecs) ? evals_range->second : n;
   Distribution dist_trd(LocalElementSize(n, 2), TileElementSize(nb, 2));
   Distribution dist_evals(LocalElementSize(n, 1), TileElementSize(nb, 1));
-  Distribution dist_evecs(GlobalElementSize(n, n), TileElementSize(nb, nb), grid.size(), grid.rank(),
-                          src_rank_index);
+  Distribution dist_evecs(GlobalElementSize(n, n_evecs), TileElementSize(nb, nb), grid.size(),
+                          grid.rank(), src_rank_index);
+  Distribution dist_full(GlobalElementSize(n, n), TileElementSize(nb, nb), grid.size(), grid.rank(),
+                         src_rank_index);
 
   // Allocate the tridiagonal, eigenvalues and eigenvectors matrices
   Matrix<RealParam, Device::CPU> tridiag(dist_trd);
@@ -211,6 +233,12 @@ void solveRandomTridiagMatrix(comm::CommunicatorGrid& grid, SizeType n, SizeType
   dlaf::matrix::util::internal::getter_random<RealParam> offdiag_rand_gen(offdiag_seed);
   std::generate(std::begin(diag_arr), std::end(diag_arr), diag_rand_gen);
   std::generate(std::begin(offdiag_arr), std::end(offdiag_arr), offdiag_rand_gen);
+  if (type == TridiagType::clustered) {
+    for (auto& d : diag_arr)
+      d = std::round(4 * d) / 4;
+    for (auto& e : offdiag_arr)
+      e *= RealParam(1e-6);
+  }
 
   dlaf::matrix::util::set(tridiag, [&diag_arr, &offdiag_arr](GlobalElementIndex i) {
     if (i.col() == 0) {
@@ -229,15 +257,20 @@ void solveRandomTridiagMatrix(comm::CommunicatorGrid& grid, SizeType n, SizeType
     // Find eigenvalues and eigenvectors of the tridiagonal matrix.
     //
     // Note: this modifies `tridiag`
-    eigensolver::internal::tridiagonal_eigensolver<B>(grid, tridiag, evals_mirror.get(),
-                                                      evecs_mirror.get());
+    if (evals_range)
+      eigensolver::internal::tridiagonal_eigensolver<B>(grid, tridiag, evals_mirror.get(),
+                                                        evecs_mirror.get(), evals_range->first,
+                                                        evals_range->second);
+    else
+      eigensolver::internal::tridiagonal_eigensolver<B>(grid, tridiag, evals_mirror.get(),
+                                                        evecs_mirror.get());
   }
 
   if (n == 0)
     return;
 
   // Make a copy of the tridiagonal matrix (Lower) but with explicit zeroes.
-  matrix::Matrix<T, Device::CPU> tridiag_full(dist_evecs);
+  matrix::Matrix<T, Device::CPU> tridiag_full(dist_full);
   dlaf::matrix::util::set(tridiag_full, [&diag_arr, &offdiag_arr](GlobalElementIndex i) {
     if (i.row() == i.col()) {
       return T(diag_arr[to_sizet(i.row())]);
@@ -251,7 +284,9 @@ void solveRandomTridiagMatrix(comm::CommunicatorGrid& grid, SizeType n, SizeType
   });
   tridiag_full.waitLocalTiles();  // makes sure that diag_arr and offdiag_arr don't go out of scope
 
-  testEigensolverCorrectness(blas::Uplo::Lower, tridiag_full, evals, evecs, 0l, n, grid);
+  const auto [evals_begin, evals_end] = evals_range.value_or(std::pair<SizeType, SizeType>(0, n));
+  testEigensolverCorrectness(blas::Uplo::Lower, tridiag_full, evals, evecs, evals_begin, evals_end,
+                             grid);
 }
 
 TYPED_TEST(TridiagSolverDistTestMC, Laplace1D) {
@@ -272,6 +307,39 @@ TYPED_TEST(TridiagSolverDistTestMC, Random) {
   }
 }
 
+TYPED_TEST(TridiagSolverDistTestMC, RandomPartialSpectrum) {
+  ForcePartialSpectrum force_partial_spectrum;
+  for (auto& comm_grid : this->commGrids()) {
+    for (auto [n, nb, evals_begin, evals_end] : tested_partial_problems) {
+      solveRandomTridiagMatrix<Backend::MC, Device::CPU, TypeParam>(comm_grid, n, nb,
+                                                                     {{evals_begin, evals_end}});
+      pika::wait();
+    }
+  }
+}
+
+TYPED_TEST(TridiagSolverDistTestMC, RandomPartialSpectrumCompactEigenvectors) {
+  for (auto& comm_grid : this->commGrids()) {
+    for (auto [n, nb, evals_begin, evals_end] : tested_partial_problems) {
+      // D&C (computing all the eigenvectors in the workspace) or MRRR, depending on the threshold
+      solveRandomTridiagMatrix<Backend::MC, Device::CPU, TypeParam>(comm_grid, n, nb,
+                                                                     {{evals_begin, evals_end}}, true);
+      pika::wait();
+    }
+  }
+}
+
+TYPED_TEST(TridiagSolverDistTestMC, ClusteredPartialSpectrum) {
+  ForcePartialSpectrum force_partial_spectrum;
+  for (auto& comm_grid : this->commGrids()) {
+    for (auto [n, nb, evals_begin, evals_end] : tested_partial_problems) {
+      solveRandomTridiagMatrix<Backend::MC, Device::CPU, TypeParam>(
+          comm_grid, n, nb, {{evals_begin, evals_end}}, true, TridiagType::clustered);
+      pika::wait();
+    }
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(TridiagSolverDistTestGPU, Laplace1D) {
   for (auto& comm_grid : this->commGrids()) {
@@ -290,4 +358,37 @@ TYPED_TEST(TridiagSolverDistTestGPU, Random) {
     }
   }
 }
+
+TYPED_TEST(TridiagSolverDistTestGPU, RandomPartialSpectrum) {
+  ForcePartialSpectrum force_partial_spectrum;
+  for (auto& comm_grid : this->commGrids()) {
+    for (auto [n, nb, evals_begin, evals_end] : tested_partial_problems) {
+      solveRandomTridiagMatrix<Backend::GPU, Device::GPU, TypeParam>(comm_grid, n, nb,
+                                                                     {{evals_begin, evals_end}});
+      pika::wait();
+    }
+  }
+}
+
+TYPED_TEST(TridiagSolverDistTestGPU, RandomPartialSpectrumCompactEigenvectors) {
+  for (auto& comm_grid : this->commGrids()) {
+    for (auto [n, nb, evals_begin, evals_end] : tested_partial_problems) {
+      // D&C (computing all the eigenvectors in the workspace) or MRRR, depending on the threshold
+      solveRandomTridiagMatrix<Backend::GPU, Device::GPU, TypeParam>(comm_grid, n, nb,
+                                                                     {{evals_begin, evals_end}}, true);
+      pika::wait();
+    }
+  }
+}
+
+TYPED_TEST(TridiagSolverDistTestGPU, ClusteredPartialSpectrum) {
+  ForcePartialSpectrum force_partial_spectrum;
+  for (auto& comm_grid : this->commGrids()) {
+    for (auto [n, nb, evals_begin, evals_end] : tested_partial_problems) {
+      solveRandomTridiagMatrix<Backend::GPU, Device::GPU, TypeParam>(
+          comm_grid, n, nb, {{evals_begin, evals_end}}, true, TridiagType::clustered);
+      pika::wait();
+    }
+  }
+}
 #endif
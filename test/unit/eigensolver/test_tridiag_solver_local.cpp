@@ -8,6 +8,7 @@
 // SPDX-License-Identifier: BSD-3-Clause
 //
 
+#include <optional>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -15,10 +16,12 @@
 #include <dlaf/eigensolver/tridiag_solver.h>
 #include <dlaf/eigensolver/tridiag_solver/impl.h>
 #include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/tune.h>
 
 #include <gtest/gtest.h>
 
 #include <dlaf_test/eigensolver/test_eigensolver_correctness.h>
+#include <dlaf_test/eigensolver/test_tridiag_solver_partial_spectrum.h>
 #include <dlaf_test/matrix/util_matrix.h>
 #include <dlaf_test/matrix/util_tile.h>
 #include <dlaf_test/util_types.h>
@@ -49,6 +52,21 @@ TEST(MatrixIndexPairsGeneration, IndexPairsGeneration) {
   ASSERT_TRUE(actual_indices == expected_indices);
 }
 
+TEST(MatrixIndexPairsGeneration, IndexPairsGroupedByLevel) {
+  SizeType n = 10;
+  auto actual_levels = dlaf::eigensolver::internal::groupSubproblemIndicesByLevel(n);
+  // i_begin, i_split, i_end
+  std::vector<std::vector<std::tuple<SizeType, SizeType, SizeType>>> expected_levels{
+      {{0, 1, 2}, {3, 4, 5}, {5, 6, 7}, {8, 9, 10}},
+      {{0, 2, 3}, {5, 7, 8}},
+      {{0, 3, 5}, {5, 8, 10}},
+      {{0, 5, 10}}};
+  ASSERT_TRUE(actual_levels == expected_levels);
+
+  EXPECT_TRUE(dlaf::eigensolver::internal::groupSubproblemIndicesByLevel(0).empty());
+  EXPECT_TRUE(dlaf::eigensolver::internal::groupSubproblemIndicesByLevel(1).empty());
+}
+
 // import numpy as np
 // from scipy.sparse import diags
 // from scipy.linalg import eigh
@@ -132,7 +150,8 @@ void solveLaplace1D(SizeType n, SizeType nb) {
 }
 
 template <Backend B, Device D, class T>
-void solveRandomTridiagMatrix(SizeType n, SizeType nb) {
+void solveRandomTridiagMatrix(SizeType n, SizeType nb,
+                              std::optional<std::pair<SizeType, SizeType>> evals_range = std::nullopt) {
   using RealParam = BaseType<T>;
 
   // Allocate the tridiagonal, eigenvalues and eigenvectors matrices
@@ -171,7 +190,12 @@ void solveRandomTridiagMatrix(SizeType n, SizeType nb) {
     // Find eigenvalues and eigenvectors of the tridiagonal matrix.
     //
     // Note: this modifies `tridiag`
-    eigensolver::internal::tridiagonal_eigensolver<B>(tridiag, evals_mirror.get(), evecs_mirror.get());
+    if (evals_range)
+      eigensolver::internal::tridiagonal_eigensolver<B>(tridiag, evals_mirror.get(), evecs_mirror.get(),
+                                                        evals_range->first, evals_range->second);
+    else
+      eigensolver::internal::tridiagonal_eigensolver<B>(tridiag, evals_mirror.get(),
+                                                        evecs_mirror.get());
   }
 
   if (n == 0)
@@ -194,7 +218,8 @@ void solveRandomTridiagMatrix(SizeType n, SizeType nb) {
   });
   tridiag_full.waitLocalTiles();  // makes sure that diag_arr and offdiag_arr don't go out of scope
 
-  testEigensolverCorrectness(blas::Uplo::Lower, tridiag_full, evals, evecs, 0l, n);
+  const auto [evals_begin, evals_end] = evals_range.value_or(std::pair<SizeType, SizeType>(0, n));
+  testEigensolverCorrectness(blas::Uplo::Lower, tridiag_full, evals, evecs, evals_begin, evals_end);
 }
 
 // clang-format off
@@ -211,6 +236,20 @@ const std::vector<std::tuple<SizeType, SizeType>> tested_problems = {
 };
 // clang-format on
 
+// Limits the number of concurrent merges of the D&C tree for the lifetime of the object.
+struct LimitConcurrentMerges {
+  LimitConcurrentMerges(const SizeType max_concurrent_merges)
+      : max_concurrent_merges_(getTuneParameters().tridiag_max_concurrent_merges) {
+    getTuneParameters().tridiag_max_concurrent_merges = max_concurrent_merges;
+  }
+  ~LimitConcurrentMerges() {
+    getTuneParameters().tridiag_max_concurrent_merges = max_concurrent_merges_;
+  }
+
+private:
+  SizeType max_concurrent_merges_;
+};
+
 TYPED_TEST(TridiagEigensolverTestCPU, Laplace1D) {
   for (auto [n, nb] : tested_problems) {
     solveLaplace1D<Backend::MC, Device::CPU, TypeParam>(n, nb);
@@ -223,6 +262,22 @@ TYPED_TEST(TridiagEigensolverTestCPU, Random) {
   }
 }
 
+TYPED_TEST(TridiagEigensolverTestCPU, RandomLimitedConcurrentMerges) {
+  for (const SizeType max_concurrent_merges : {1, 3}) {
+    LimitConcurrentMerges limit_concurrent_merges(max_concurrent_merges);
+    for (auto [n, nb] : tested_problems) {
+      solveRandomTridiagMatrix<Backend::MC, Device::CPU, TypeParam>(n, nb);
+    }
+  }
+}
+
+TYPED_TEST(TridiagEigensolverTestCPU, RandomPartialSpectrum) {
+  ForcePartialSpectrum force_partial_spectrum;
+  for (auto [n, nb, evals_begin, evals_end] : tested_partial_problems) {
+    solveRandomTridiagMatrix<Backend::MC, Device::CPU, TypeParam>(n, nb, {{evals_begin, evals_end}});
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(TridiagEigensolverTestGPU, Laplace1D) {
   for (auto [n, nb] : tested_problems) {
@@ -235,4 +290,20 @@ TYPED_TEST(TridiagEigensolverTestGPU, Random) {
     solveRandomTridiagMatrix<Backend::GPU, Device::GPU, TypeParam>(n, nb);
   }
 }
+
+TYPED_TEST(TridiagEigensolverTestGPU, RandomLimitedConcurrentMerges) {
+  for (const SizeType max_concurrent_merges : {1, 3}) {
+    LimitConcurrentMerges limit_concurrent_merges(max_concurrent_merges);
+    for (auto [n, nb] : tested_problems) {
+      solveRandomTridiagMatrix<Backend::GPU, Device::GPU, TypeParam>(n, nb);
+    }
+  }
+}
+
+TYPED_TEST(TridiagEigensolverTestGPU, RandomPartialSpectrum) {
+  ForcePartialSpectrum force_partial_spectrum;
+  for (auto [n, nb, evals_begin, evals_end] : tested_partial_problems) {
+    solveRandomTridiagMatrix<Backend::GPU, Device::GPU, TypeParam>(n, nb, {{evals_begin, evals_end}});
+  }
+}
 #endif
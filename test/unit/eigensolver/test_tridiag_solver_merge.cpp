@@ -284,3 +284,59 @@ TYPED_TEST(TridiagEigensolverMergeTest, Deflation) {
   };
   CHECK_MATRIX_EQ(expected_c_fn, c_mat_sorted);
 }
+
+TYPED_TEST(TridiagEigensolverMergeTest, DeflationChunked) {
+  const SizeType len = 64;
+  const TypeParam tol = TypeParam(0.01);
+  const TypeParam rho = TypeParam(1);
+
+  // the index array that sorts `d` (elements are stored in reverse order)
+  std::vector<SizeType> index_arr(to_sizet(len));
+  std::iota(index_arr.rbegin(), index_arr.rend(), 0);
+
+  std::vector<TypeParam> d_arr(to_sizet(len));
+  std::vector<TypeParam> z_arr(to_sizet(len));
+  std::vector<ColType> c_arr(to_sizet(len));
+  for (SizeType i = 0; i < len; ++i) {
+    const std::size_t is = to_sizet(index_arr[to_sizet(i)]);
+    // clusters of 5 nearly equal values, that get deflated with Givens rotations
+    d_arr[is] = TypeParam(i / 5) + TypeParam(1e-4) * TypeParam(i % 5);
+    // some values of z are zero, that get deflated directly
+    z_arr[is] = (i % 7 == 3) ? TypeParam(0) : TypeParam(0.1) + TypeParam(0.01) * TypeParam(i % 4);
+    c_arr[is] = (i % 3 == 0) ? ColType::LowerHalf : ColType::UpperHalf;
+  }
+
+  std::vector<TypeParam> expected_d_arr = d_arr;
+  std::vector<TypeParam> expected_z_arr = z_arr;
+  std::vector<ColType> expected_c_arr = c_arr;
+  const auto expected_rots =
+      applyDeflationToArrays(rho, tol, len, index_arr.data(), expected_d_arr.data(),
+                             expected_z_arr.data(), expected_c_arr.data());
+  ASSERT_FALSE(expected_rots.empty());
+
+  for (const std::size_t nchunks : {1, 2, 3, 5, 16, 64, 100}) {
+    std::vector<TypeParam> d_chunked = d_arr;
+    std::vector<TypeParam> z_chunked = z_arr;
+    std::vector<ColType> c_chunked = c_arr;
+
+    auto chunks = initDeflationChunks<TypeParam>(len, nchunks);
+    for (auto& chunk : chunks)
+      speculateDeflation(rho, tol, index_arr.data(), d_chunked.data(), z_chunked.data(),
+                         c_chunked.data(), chunk);
+    const auto rots = resolveDeflation(rho, tol, index_arr.data(), d_chunked.data(), z_chunked.data(),
+                                       c_chunked.data(), chunks);
+
+    // The result has to be exactly the same as the sequential one
+    EXPECT_EQ(expected_d_arr, d_chunked) << "nchunks " << nchunks;
+    EXPECT_EQ(expected_z_arr, z_chunked) << "nchunks " << nchunks;
+    EXPECT_EQ(expected_c_arr, c_chunked) << "nchunks " << nchunks;
+
+    ASSERT_EQ(expected_rots.size(), rots.size()) << "nchunks " << nchunks;
+    for (std::size_t i = 0; i < rots.size(); ++i) {
+      EXPECT_EQ(expected_rots[i].i, rots[i].i) << "nchunks " << nchunks << " rotation " << i;
+      EXPECT_EQ(expected_rots[i].j, rots[i].j) << "nchunks " << nchunks << " rotation " << i;
+      EXPECT_EQ(expected_rots[i].c, rots[i].c) << "nchunks " << nchunks << " rotation " << i;
+      EXPECT_EQ(expected_rots[i].s, rots[i].s) << "nchunks " << nchunks << " rotation " << i;
+    }
+  }
+}
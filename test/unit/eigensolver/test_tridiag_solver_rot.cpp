@@ -70,6 +70,10 @@ struct TridiagEigensolverRotTest : public TestWithCommGrids {
       // range fully in-bound, non-independent rotations, between same pair of tiles
       {12, 3, 1, 3, {GRot{0, 5, rot_c, rot_s}, GRot{0, 4, rot_c, rot_s}}},
       {12, 3, 1, 3, {GRot{0, 5, rot_c, rot_s}, GRot{1, 5, rot_c, rot_s}}},
+      // full-range, chains of rotations spanning multiple rows of tiles
+      {20, 3, 0, 7,
+       {GRot{0, 5, rot_c, rot_s}, GRot{0, 9, rot_c, rot_s}, GRot{1, 19, rot_c, rot_s},
+        GRot{0, 19, rot_c, rot_s}, GRot{12, 13, rot_c, rot_s}}},
   };
 };
 
@@ -85,6 +89,34 @@ using TridiagEigensolverRotGPUTest = TridiagEigensolverRotTest<T>;
 TYPED_TEST_SUITE(TridiagEigensolverRotGPUTest, RealMatrixElementTypes);
 #endif
 
+// Applies the rotations to the reference @p mat_loc and checks the result against @p mat_h
+template <class T>
+void checkGivenRotations(matrix::Matrix<T, Device::CPU>& mat_h, matrix::test::MatrixLocal<T>& mat_loc,
+                         const SizeType m, const SizeType mb, const SizeType idx_begin,
+                         const SizeType idx_end, const std::vector<di::GivensRotation<T>>& rots) {
+  // Apply Given Rotations
+  const SizeType n = std::min((idx_end) *mb, m) - idx_begin * mb;
+  const GlobalElementSize offset(idx_begin * mb, idx_begin * mb);
+
+  {
+    dlaf::common::internal::SingleThreadedBlasScope single;
+
+    for (auto rot : rots) {
+      T* x = mat_loc.ptr(GlobalElementIndex{0, rot.i} + offset);
+      T* y = mat_loc.ptr(GlobalElementIndex{0, rot.j} + offset);
+      blas::rot(n, x, 1, y, 1, rot.c, rot.s);
+    }
+  }
+
+  auto result = [&dist = mat_h.distribution(), &mat_local = mat_loc](const GlobalElementIndex& element) {
+    const auto tile_index = dist.globalTileIndex(element);
+    const auto tile_element = dist.tileElementIndex(element);
+    return mat_local.tile_read(tile_index)(tile_element);
+  };
+
+  CHECK_MATRIX_NEAR(result, mat_h, m * TypeUtilities<T>::error, m * TypeUtilities<T>::error);
+}
+
 template <class T, Device D>
 void testApplyGivenRotations(comm::CommunicatorGrid& grid, const SizeType m, const SizeType mb,
                              const SizeType idx_begin, const SizeType idx_end,
@@ -106,27 +138,25 @@ void testApplyGivenRotations(comm::CommunicatorGrid& grid, const SizeType m, con
                                         mat.get());
   }
 
-  // Apply Given Rotations
-  const SizeType n = std::min((idx_end) *mb, m) - idx_begin * mb;
-  const GlobalElementSize offset(idx_begin * mb, idx_begin * mb);
+  checkGivenRotations(mat_h, mat_loc, m, mb, idx_begin, idx_end, rots);
+}
 
-  {
-    dlaf::common::internal::SingleThreadedBlasScope single;
+template <class T, Device D>
+void testApplyGivenRotationsLocal(const SizeType m, const SizeType mb, const SizeType idx_begin,
+                                  const SizeType idx_end, std::vector<di::GivensRotation<T>> rots) {
+  using dlaf::eigensolver::internal::applyGivensRotationsToMatrixColumns;
 
-    for (auto rot : rots) {
-      T* x = mat_loc.ptr(GlobalElementIndex{0, rot.i} + offset);
-      T* y = mat_loc.ptr(GlobalElementIndex{0, rot.j} + offset);
-      blas::rot(n, x, 1, y, 1, rot.c, rot.s);
-    }
-  }
+  matrix::Matrix<T, Device::CPU> mat_h(LocalElementSize(m, m), TileElementSize(mb, mb));
+  matrix::util::set_random(mat_h);
 
-  auto result = [&dist = mat_h.distribution(), &mat_local = mat_loc](const GlobalElementIndex& element) {
-    const auto tile_index = dist.globalTileIndex(element);
-    const auto tile_element = dist.tileElementIndex(element);
-    return mat_local.tile_read(tile_index)(tile_element);
-  };
+  matrix::test::MatrixLocal<T> mat_loc = matrix::test::allGather<T>(blas::Uplo::General, mat_h);
 
-  CHECK_MATRIX_NEAR(result, mat_h, m * TypeUtilities<T>::error, m * TypeUtilities<T>::error);
+  {
+    matrix::MatrixMirror<T, D, Device::CPU> mat(mat_h);
+    applyGivensRotationsToMatrixColumns(idx_begin, idx_end, ex::just(rots), mat.get());
+  }
+
+  checkGivenRotations(mat_h, mat_loc, m, mb, idx_begin, idx_end, rots);
 }
 
 TYPED_TEST(TridiagEigensolverRotMCTest, ApplyGivenRotations) {
@@ -137,6 +167,12 @@ TYPED_TEST(TridiagEigensolverRotMCTest, ApplyGivenRotations) {
   }
 }
 
+TYPED_TEST(TridiagEigensolverRotMCTest, ApplyGivenRotationsLocal) {
+  for (const auto& [m, mb, idx_begin, idx_end, rots] : this->configs) {
+    testApplyGivenRotationsLocal<TypeParam, Device::CPU>(m, mb, idx_begin, idx_end, rots);
+  }
+}
+
 #ifdef DLAF_WITH_GPU
 TYPED_TEST(TridiagEigensolverRotGPUTest, ApplyGivenRotations) {
   for (auto& grid : this->commGrids()) {
@@ -145,4 +181,10 @@ TYPED_TEST(TridiagEigensolverRotGPUTest, ApplyGivenRotations) {
     }
   }
 }
+
+TYPED_TEST(TridiagEigensolverRotGPUTest, ApplyGivenRotationsLocal) {
+  for (const auto& [m, mb, idx_begin, idx_end, rots] : this->configs) {
+    testApplyGivenRotationsLocal<TypeParam, Device::GPU>(m, mb, idx_begin, idx_end, rots);
+  }
+}
 #endif
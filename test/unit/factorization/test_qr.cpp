@@ -0,0 +1,188 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <pika/init.hpp>
+
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/factorization/qr.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/matrix_mirror.h>
+#include <dlaf/util_matrix.h>
+
+#include <gtest/gtest.h>
+
+#include <dlaf_test/comm_grids/grids_6_ranks.h>
+#include <dlaf_test/matrix/matrix_local.h>
+#include <dlaf_test/matrix/util_matrix.h>
+#include <dlaf_test/matrix/util_matrix_local.h>
+#include <dlaf_test/util_types.h>
+
+using namespace dlaf;
+using namespace dlaf::comm;
+using namespace dlaf::matrix;
+using namespace dlaf::matrix::test;
+using namespace dlaf::test;
+using namespace testing;
+
+using dlaf::factorization::internal::qrTausDistribution;
+
+::testing::Environment* const comm_grids_env =
+    ::testing::AddGlobalTestEnvironment(new CommunicatorGrid6RanksEnvironment);
+
+template <class T>
+struct QRTestMC : public TestWithCommGrids {};
+
+TYPED_TEST_SUITE(QRTestMC, MatrixElementTypes);
+
+#ifdef DLAF_WITH_GPU
+template <class T>
+struct QRTestGPU : public TestWithCommGrids {};
+
+TYPED_TEST_SUITE(QRTestGPU, MatrixElementTypes);
+#endif
+
+// m, n, mb
+const std::vector<std::tuple<SizeType, SizeType, SizeType>> sizes = {
+    {0, 4, 2},   {4, 0, 2},   {1, 1, 2},                             // without reflectors
+    {5, 5, 8},   {8, 5, 8},   {5, 8, 8},                             // single tile
+    {16, 16, 4}, {34, 13, 6}, {13, 34, 6}, {26, 7, 3}, {7, 26, 3},  // multiple tiles
+};
+
+// Checks that Q R == A and Q^H Q == I, where:
+// - mat_a_ref is the original matrix A,
+// - mat_qr_r contains Q R,
+// - mat_i contains Q^H Q.
+template <class T>
+void checkQR(const MatrixLocal<const T>& mat_a_ref, Matrix<const T, Device::CPU>& mat_qr_r,
+             Matrix<const T, Device::CPU>& mat_i) {
+  const SizeType k = std::max(mat_a_ref.size().rows(), mat_a_ref.size().cols());
+  const auto error = 4 * (k + 1) * TypeUtilities<T>::error;
+
+  auto el_a = [&mat_a_ref](const GlobalElementIndex& ij) { return mat_a_ref(ij); };
+  CHECK_MATRIX_NEAR(el_a, mat_qr_r, error, error);
+
+  auto el_id = [](const GlobalElementIndex& ij) { return ij.row() == ij.col() ? T(1) : T(0); };
+  CHECK_MATRIX_NEAR(el_id, mat_i, error, error);
+}
+
+template <class T>
+auto elR(const MatrixLocal<const T>& mat_qr) {
+  return [&mat_qr](const GlobalElementIndex& ij) { return ij.row() <= ij.col() ? mat_qr(ij) : T(0); };
+}
+
+template <class T, Backend B, Device D>
+void testQR(const SizeType m, const SizeType n, const SizeType mb) {
+  const LocalElementSize size(m, n);
+  const TileElementSize block_size(mb, mb);
+
+  Matrix<T, Device::CPU> mat_a_h(size, block_size);
+  matrix::util::set_random(mat_a_h);
+  const auto mat_a_ref = allGather<T>(blas::Uplo::General, mat_a_h);
+
+  Matrix<T, Device::CPU> mat_taus_h(qrTausDistribution(mat_a_h.distribution()));
+  {
+    MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+    MatrixMirror<T, D, Device::CPU> mat_taus(mat_taus_h);
+    qr_factorization<B, D, T>(mat_a.get(), mat_taus.get());
+  }
+
+  const auto mat_qr = allGather<T>(blas::Uplo::General, mat_a_h);
+
+  Matrix<T, Device::CPU> mat_r_h(size, block_size);
+  set(mat_r_h, elR<T>(mat_qr));
+  Matrix<T, Device::CPU> mat_q_h(LocalElementSize(m, m), block_size);
+  {
+    MatrixMirror<const T, D, Device::CPU> mat_v(mat_a_h);
+    MatrixMirror<const T, D, Device::CPU> mat_taus(mat_taus_h);
+    MatrixMirror<T, D, Device::CPU> mat_r(mat_r_h);
+    MatrixMirror<T, D, Device::CPU> mat_q(mat_q_h);
+
+    qr_apply_q<B>(blas::Op::NoTrans, mat_v.get(), mat_taus.get(), mat_r.get());
+    qr_form_q<B>(mat_v.get(), mat_taus.get(), mat_q.get());
+    qr_apply_q<B>(blas::Op::ConjTrans, mat_v.get(), mat_taus.get(), mat_q.get());
+  }
+
+  checkQR<T>(mat_a_ref, mat_r_h, mat_q_h);
+}
+
+template <class T, Backend B, Device D>
+void testQR(comm::CommunicatorGrid& grid, const SizeType m, const SizeType n, const SizeType mb) {
+  const GlobalElementSize size(m, n);
+  const TileElementSize block_size(mb, mb);
+  Index2D src_rank_index(std::max(0, grid.size().rows() - 1), std::min(1, grid.size().cols() - 1));
+
+  Matrix<T, Device::CPU> mat_a_h(Distribution(size, block_size, grid.size(), grid.rank(),
+                                              src_rank_index));
+  matrix::util::set_random(mat_a_h);
+  const auto mat_a_ref = allGather<T>(blas::Uplo::General, mat_a_h, grid);
+
+  Matrix<T, Device::CPU> mat_taus_h(qrTausDistribution(mat_a_h.distribution()));
+  {
+    MatrixMirror<T, D, Device::CPU> mat_a(mat_a_h);
+    MatrixMirror<T, D, Device::CPU> mat_taus(mat_taus_h);
+    qr_factorization<B, D, T>(grid, mat_a.get(), mat_taus.get());
+  }
+
+  const auto mat_qr = allGather<T>(blas::Uplo::General, mat_a_h, grid);
+
+  Matrix<T, Device::CPU> mat_r_h(mat_a_h.distribution());
+  set(mat_r_h, elR<T>(mat_qr));
+  Matrix<T, Device::CPU> mat_q_h(Distribution(GlobalElementSize(m, m), block_size, grid.size(),
+                                              grid.rank(), src_rank_index));
+  {
+    MatrixMirror<const T, D, Device::CPU> mat_v(mat_a_h);
+    MatrixMirror<const T, D, Device::CPU> mat_taus(mat_taus_h);
+    MatrixMirror<T, D, Device::CPU> mat_r(mat_r_h);
+    MatrixMirror<T, D, Device::CPU> mat_q(mat_q_h);
+
+    qr_apply_q<B>(grid, blas::Op::NoTrans, mat_v.get(), mat_taus.get(), mat_r.get());
+    qr_form_q<B>(grid, mat_v.get(), mat_taus.get(), mat_q.get());
+    qr_apply_q<B>(grid, blas::Op::ConjTrans, mat_v.get(), mat_taus.get(), mat_q.get());
+  }
+
+  checkQR<T>(mat_a_ref, mat_r_h, mat_q_h);
+}
+
+TYPED_TEST(QRTestMC, CorrectnessLocal) {
+  for (const auto& [m, n, mb] : sizes) {
+    testQR<TypeParam, Backend::MC, Device::CPU>(m, n, mb);
+  }
+}
+
+TYPED_TEST(QRTestMC, CorrectnessDistributed) {
+  for (auto& comm_grid : this->commGrids()) {
+    for (const auto& [m, n, mb] : sizes) {
+      testQR<TypeParam, Backend::MC, Device::CPU>(comm_grid, m, n, mb);
+      pika::wait();
+    }
+  }
+}
+
+#ifdef DLAF_WITH_GPU
+TYPED_TEST(QRTestGPU, CorrectnessLocal) {
+  for (const auto& [m, n, mb] : sizes) {
+    testQR<TypeParam, Backend::GPU, Device::GPU>(m, n, mb);
+  }
+}
+
+TYPED_TEST(QRTestGPU, CorrectnessDistributed) {
+  for (auto& comm_grid : this->commGrids()) {
+    for (const auto& [m, n, mb] : sizes) {
+      testQR<TypeParam, Backend::GPU, Device::GPU>(comm_grid, m, n, mb);
+      pika::wait();
+    }
+  }
+}
+#endif
@@ -14,10 +14,13 @@
 #include <tuple>
 #include <utility>
 
+#include <pika/execution.hpp>
+
 #include <dlaf/common/index2d.h>
 #include <dlaf/communication/communicator.h>
 #include <dlaf/communication/communicator_grid.h>
 #include <dlaf/communication/error.h>
+#include <dlaf/matrix/copy.h>
 #include <dlaf/matrix/distribution.h>
 #include <dlaf/matrix/hdf5.h>
 #include <dlaf/matrix/index.h>
@@ -209,3 +212,99 @@ TYPED_TEST(MatrixHDF5Test, RWParallelFromDistributedGPU) {
   testHDF5Parallel<TypeParam, Device::GPU>(this->isMasterRank(), grid, this->filepath, dist);
 }
 #endif
+
+template <class T>
+void testHDF5ParallelAsync(comm::CommunicatorGrid& grid, const std::filesystem::path& filepath,
+                           matrix::Distribution dist) {
+  namespace tt = pika::this_thread::experimental;
+
+  const std::string dataset_name = "/matrix";
+
+  auto [mat_original, original_values] = getMatrixAndSetter<T, Device::CPU>(dist);
+
+  comm::Communicator& world = grid.fullCommunicator();
+
+  FileHDF5 file(world, filepath);
+
+  tt::sync_wait(file.writeAsync(mat_original, dataset_name));
+
+  file.flush();
+  DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+
+  // Read with the synchronous interface
+  testReadDistributed(file, dataset_name, grid, mat_original, original_values);
+
+  // Read asynchronously in a local and in a distributed matrix
+  matrix::Matrix<T, Device::CPU> mat_local({83, 88}, {13, 27});
+  tt::sync_wait(file.readAsync(dataset_name, mat_local));
+  CHECK_MATRIX_EQ(original_values, mat_local);
+
+  matrix::Matrix<T, Device::CPU> mat_dist(
+      matrix::Distribution({83, 88}, {26, 13}, grid.size(), grid.rank(), {0, 0}));
+  tt::sync_wait(file.readAsync(dataset_name, mat_dist));
+  CHECK_MATRIX_EQ(original_values, mat_dist);
+}
+
+TYPED_TEST(MatrixHDF5Test, RWParallelAsyncFromLocalMC) {
+  comm::CommunicatorGrid grid(this->world, this->world.size(), 1, common::Ordering::RowMajor);
+  matrix::Distribution dist({83, 88}, {9, 6});
+  testHDF5ParallelAsync<TypeParam>(grid, this->filepath, dist);
+}
+
+TYPED_TEST(MatrixHDF5Test, RWParallelAsyncFromDistributedMC) {
+  comm::CommunicatorGrid grid(this->world, this->world.size(), 1, common::Ordering::RowMajor);
+  matrix::Distribution dist({83, 88}, {9, 6}, grid.size(), grid.rank(), {0, 0});
+  testHDF5ParallelAsync<TypeParam>(grid, this->filepath, dist);
+}
+
+// Schedules the computations using the matrix before waiting for the asynchronous I/O, so that they
+// overlap with it: the tasks only reading the matrix run concurrently with the write, the ones
+// writing it wait for the write to have read the tiles, and the ones using the tiles read from the
+// file start as soon as they have been read.
+template <class T>
+void testHDF5ParallelAsyncOverlap(comm::CommunicatorGrid& grid, const std::filesystem::path& filepath,
+                                  matrix::Distribution dist) {
+  namespace tt = pika::this_thread::experimental;
+  using pika::execution::thread_priority;
+
+  const std::string dataset_name = "/matrix";
+  auto zero = [](const GlobalElementIndex&) { return T(0); };
+
+  auto [mat, original_values] = getMatrixAndSetter<T, Device::CPU>(dist);
+
+  comm::Communicator& world = grid.fullCommunicator();
+
+  FileHDF5 file(world, filepath);
+
+  auto write = file.writeAsync(mat, dataset_name);
+  matrix::Matrix<T, Device::CPU> mat_copy(dist);
+  copy(mat, mat_copy);
+  matrix::util::set0<Backend::MC>(thread_priority::normal, mat);
+  tt::sync_wait(std::move(write));
+
+  CHECK_MATRIX_EQ(original_values, mat_copy);
+  CHECK_MATRIX_EQ(zero, mat);
+
+  file.flush();
+  DLAF_MPI_CHECK_ERROR(MPI_Barrier(world));
+
+  auto read = file.readAsync(dataset_name, mat);
+  matrix::Matrix<T, Device::CPU> mat_read(dist);
+  copy(mat, mat_read);
+  tt::sync_wait(std::move(read));
+
+  CHECK_MATRIX_EQ(original_values, mat_read);
+  CHECK_MATRIX_EQ(original_values, mat);
+}
+
+TYPED_TEST(MatrixHDF5Test, RWParallelAsyncOverlapFromLocalMC) {
+  comm::CommunicatorGrid grid(this->world, this->world.size(), 1, common::Ordering::RowMajor);
+  matrix::Distribution dist({83, 88}, {9, 6});
+  testHDF5ParallelAsyncOverlap<TypeParam>(grid, this->filepath, dist);
+}
+
+TYPED_TEST(MatrixHDF5Test, RWParallelAsyncOverlapFromDistributedMC) {
+  comm::CommunicatorGrid grid(this->world, this->world.size(), 1, common::Ordering::RowMajor);
+  matrix::Distribution dist({83, 88}, {9, 6}, grid.size(), grid.rank(), {0, 0});
+  testHDF5ParallelAsyncOverlap<TypeParam>(grid, this->filepath, dist);
+}
@@ -0,0 +1,127 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <algorithm>
+#include <vector>
+
+#include <pika/init.hpp>
+
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/matrix/redistribution.h>
+#include <dlaf/util_matrix.h>
+
+#include <gtest/gtest.h>
+
+#include <dlaf_test/comm_grids/grids_6_ranks.h>
+#include <dlaf_test/matrix/util_matrix.h>
+#include <dlaf_test/util_types.h>
+
+using namespace dlaf;
+using namespace dlaf::matrix;
+using namespace dlaf::matrix::test;
+using namespace dlaf::comm;
+using namespace dlaf::test;
+using namespace testing;
+
+::testing::Environment* const comm_grids_env =
+    ::testing::AddGlobalTestEnvironment(new CommunicatorGrid6RanksEnvironment);
+
+template <typename Type>
+struct MatrixRedistributionTest : public TestWithCommGrids {};
+
+TYPED_TEST_SUITE(MatrixRedistributionTest, MatrixElementTypes);
+
+struct RedistributionConfig {
+  GlobalElementSize size;
+  TileElementSize src_block_size;
+  TileElementSize dst_block_size;
+};
+
+const std::vector<RedistributionConfig> configs({
+    {{0, 0}, {3, 3}, {2, 2}},
+    {{0, 7}, {3, 3}, {4, 2}},
+    {{9, 0}, {3, 3}, {4, 2}},
+    {{10, 10}, {3, 3}, {3, 3}},    // same block size
+    {{26, 13}, {10, 3}, {5, 6}},   // block sizes dividing each other
+    {{32, 45}, {4, 4}, {7, 11}},   // arbitrary block sizes
+    {{17, 23}, {2, 32}, {32, 2}},  // tall/wide blocks
+    {{64, 64}, {1, 1}, {16, 16}},  // element-wise cyclic
+});
+
+template <class T>
+T inputValues(const GlobalElementIndex& index) noexcept {
+  const SizeType i = index.row();
+  const SizeType j = index.col();
+  return TypeUtilities<T>::element(i + j / 1024., j - i / 128.);
+}
+
+template <class T>
+void testRedistribution(const RedistributionConfig& config, CommunicatorGrid& src_grid,
+                        CommunicatorGrid& dst_grid) {
+  const comm::Index2D src_source_rank(src_grid.size().rows() - 1, 0);
+  const comm::Index2D dst_source_rank(0, std::min(1, dst_grid.size().cols() - 1));
+  const Distribution src_dist(config.size, config.src_block_size, src_grid.size(), src_grid.rank(),
+                              src_source_rank);
+  const Distribution dst_dist(config.size, config.dst_block_size, dst_grid.size(), dst_grid.rank(),
+                              dst_source_rank);
+
+  Matrix<const T, Device::CPU> src = [&]() {
+    Matrix<T, Device::CPU> src(src_dist);
+    util::set(src, inputValues<T>);
+    return src;
+  }();
+  Matrix<T, Device::CPU> dst(dst_dist);
+  Matrix<T, Device::CPU> src_back(src_dist);
+
+  // there and back again, reusing the plan for the second redistribution
+  redistribute(src_grid, src, dst_grid, dst);
+
+  const RedistributionPlan plan_back(dst_grid, dst_dist, src_grid, src_dist);
+  redistribute(dst_grid, plan_back, dst, src_back);
+  CHECK_MATRIX_EQ(inputValues<T>, dst);
+  CHECK_MATRIX_EQ(inputValues<T>, src_back);
+
+  util::set(src_back, [](const GlobalElementIndex&) { return T(0); });
+  redistribute(dst_grid, plan_back, dst, src_back);
+  CHECK_MATRIX_EQ(inputValues<T>, src_back);
+
+  // Note: ensure that everything finishes before the next collective call, which might block a
+  // working thread (and if it is just one, it would deadlock)
+  pika::wait();
+}
+
+TYPED_TEST(MatrixRedistributionTest, DifferentGrids) {
+  for (auto& grid : this->commGrids()) {
+    const IndexT_MPI nranks = grid.size().rows() * grid.size().cols();
+    std::vector<CommunicatorGrid> other_grids;
+    other_grids.emplace_back(grid.fullCommunicator(), 1, nranks, common::Ordering::ColumnMajor);
+    other_grids.emplace_back(grid.fullCommunicator(), nranks, 1, common::Ordering::RowMajor);
+    other_grids.emplace_back(grid.fullCommunicator(), grid.size().cols(), grid.size().rows(),
+                             common::Ordering::RowMajor);
+
+    for (auto& other_grid : other_grids) {
+      for (const auto& config : configs) {
+        testRedistribution<TypeParam>(config, grid, other_grid);
+        testRedistribution<TypeParam>(config, other_grid, grid);
+      }
+    }
+  }
+}
+
+TYPED_TEST(MatrixRedistributionTest, SameGrid) {
+  for (auto& grid : this->commGrids()) {
+    for (const auto& config : configs) {
+      testRedistribution<TypeParam>(config, grid, grid);
+    }
+  }
+}
@@ -207,6 +207,71 @@ TYPED_TEST(RetiledMatrixRefLocalTest, LocalConstructor) {
   }
 }
 
+TYPED_TEST(RetiledMatrixRefLocalTest, LocalConstructorBlockOrigin) {
+  using Type = TypeParam;
+
+  auto el1 = [](const GlobalElementIndex& index) {
+    SizeType i = index.row();
+    SizeType j = index.col();
+    return TypeUtilities<Type>::element(i + j / 1024., j - i / 128.);
+  };
+
+  auto el2 = [](const GlobalElementIndex& index) {
+    SizeType i = index.row();
+    SizeType j = index.col();
+    return TypeUtilities<Type>::element(2. * i + j / 1024., j / 3. - i / 18.);
+  };
+
+  // size, tile_size (target), tiles_per_block (target), origin at a block boundary (ref), size (ref)
+  const std::vector<std::tuple<LocalElementSize, TileElementSize, LocalTileSize, GlobalElementIndex,
+                               GlobalElementSize>>
+      tests({
+          {{8, 8}, {2, 2}, {1, 1}, {2, 4}, {6, 4}},
+          {{8, 8}, {2, 2}, {2, 2}, {4, 4}, {4, 3}},
+          {{15, 18}, {2, 3}, {1, 1}, {6, 3}, {9, 15}},
+          {{16, 24}, {2, 3}, {3, 2}, {6, 6}, {7, 5}},
+      });
+
+  for (const auto& [size, tile_size, tiles_per_block, dist_origin, dist_size] : tests) {
+    const GlobalElementSize block_size(tile_size.rows() * tiles_per_block.rows(),
+                                       tile_size.cols() * tiles_per_block.cols());
+
+    Distribution expected_distribution({dist_size.rows(), dist_size.cols()}, block_size, tile_size,
+                                       {1, 1}, {0, 0}, {0, 0});
+
+    Matrix<Type, Device::CPU> mat(size, {block_size.rows(), block_size.cols()});
+
+    SubDistributionSpec spec{dist_origin, dist_size};
+    MatrixRef<Type, Device::CPU> mat_ref(mat, spec);
+
+    auto el1_ref = [&](const GlobalElementIndex& index) {
+      return el1({dist_origin.row() + index.row(), dist_origin.col() + index.col()});
+    };
+    auto el_mat = [&](const GlobalElementIndex& index) {
+      const bool in_ref = index.row() >= dist_origin.row() && index.col() >= dist_origin.col() &&
+                          index.row() < dist_origin.row() + dist_size.rows() &&
+                          index.col() < dist_origin.col() + dist_size.cols();
+      return in_ref ? el2({index.row() - dist_origin.row(), index.col() - dist_origin.col()})
+                    : el1(index);
+    };
+
+    set(mat, el1);
+    {
+      Matrix<const Type, Device::CPU> rt_mat = mat_ref.retiled_sub_pipeline_const(tiles_per_block);
+      EXPECT_EQ(expected_distribution, rt_mat.distribution());
+      CHECK_MATRIX_EQ(el1_ref, rt_mat);
+    }
+    {
+      Matrix<Type, Device::CPU> rt_mat = mat_ref.retiled_sub_pipeline(tiles_per_block);
+      EXPECT_EQ(expected_distribution, rt_mat.distribution());
+      CHECK_MATRIX_EQ(el1_ref, rt_mat);
+
+      set(rt_mat, el2);
+    }
+    CHECK_MATRIX_EQ(el_mat, mat);
+  }
+}
+
 TYPED_TEST(RetiledMatrixRefTest, GlobalConstructor) {
   using Type = TypeParam;
 
@@ -69,21 +69,38 @@ struct GemmConfig {
     const GlobalElementIndex br = {0, 0};
   } margin_a = {}, margin_b = {}, margin_c = {};
 
+  // Note: sizes and margins refer to opA(A) and opB(B), they get transposed for the stored operands.
+  template <class Index2DType>
+  static Index2DType op_transposed(const blas::Op op, Index2DType index) noexcept {
+    if (op != blas::Op::NoTrans)
+      index.transpose();
+    return index;
+  }
+
+  TileElementSize block_size_a() const noexcept {
+    return op_transposed(opA, TileElementSize{mb, kb});
+  }
+  TileElementSize block_size_b() const noexcept {
+    return op_transposed(opB, TileElementSize{kb, nb});
+  }
+
   matrix::internal::SubMatrixSpec sub_a() const noexcept {
-    return {margin_a.tl, {m, k}};
+    return {op_transposed(opA, margin_a.tl), op_transposed(opA, GlobalElementSize{m, k})};
   }
   matrix::internal::SubMatrixSpec sub_b() const noexcept {
-    return {margin_b.tl, {k, n}};
+    return {op_transposed(opB, margin_b.tl), op_transposed(opB, GlobalElementSize{k, n})};
   }
   matrix::internal::SubMatrixSpec sub_c() const noexcept {
     return {margin_c.tl, {m, n}};
   }
 
   GlobalElementSize full_a() const noexcept {
-    return sizeFromOrigin(margin_a.tl) + common::sizeFromOrigin(margin_a.br) + sub_a().size;
+    return sizeFromOrigin(sub_a().origin) +
+           common::sizeFromOrigin(op_transposed(opA, margin_a.br)) + sub_a().size;
   }
   GlobalElementSize full_b() const noexcept {
-    return sizeFromOrigin(margin_b.tl) + common::sizeFromOrigin(margin_b.br) + sub_b().size;
+    return sizeFromOrigin(sub_b().origin) +
+           common::sizeFromOrigin(op_transposed(opB, margin_b.br)) + sub_b().size;
   }
   GlobalElementSize full_c() const noexcept {
     return sizeFromOrigin(margin_c.tl) + common::sizeFromOrigin(margin_c.br) + sub_c().size;
@@ -109,8 +126,8 @@ void testGeneralMultiplication(const T alpha, const T beta, const GemmConfig& co
   const auto fullValuesB = mix_values(config.sub_b(), subValuesB, [](auto) { return T(-99); });
   const auto fullValuesC = mix_values(config.sub_c(), subValuesC, [](auto) { return T(-99); });
 
-  Matrix<const T, Device::CPU> mat_ah = setMatrix(fullValuesA, config.full_a(), {config.mb, config.kb});
-  Matrix<const T, Device::CPU> mat_bh = setMatrix(fullValuesB, config.full_b(), {config.kb, config.nb});
+  Matrix<const T, Device::CPU> mat_ah = setMatrix(fullValuesA, config.full_a(), config.block_size_a());
+  Matrix<const T, Device::CPU> mat_bh = setMatrix(fullValuesB, config.full_b(), config.block_size_b());
   Matrix<T, Device::CPU> mat_ch = setMatrix(fullValuesC, config.full_c(), {config.mb, config.nb});
 
   {
@@ -122,16 +139,15 @@ void testGeneralMultiplication(const T alpha, const T beta, const GemmConfig& co
     MatrixRef<const T, D> mat_sub_b(mat_b.get(), config.sub_b());
     MatrixRef<T, D> mat_sub_c(mat_c.get(), config.sub_c());
 
-    // Note: currently it is implemented just the NoTrans/NoTrans case
-    ASSERT_EQ(config.opA, blas::Op::NoTrans);
-    ASSERT_EQ(config.opB, blas::Op::NoTrans);
     multiplication::internal::generalMatrix<B>(config.opA, config.opB, alpha, mat_sub_a, mat_sub_b, beta,
                                                mat_sub_c);
   }
 
+  const SizeType full_k =
+      config.opA == blas::Op::NoTrans ? mat_ah.size().cols() : mat_ah.size().rows();
   const auto fullValuesResult = mix_values(config.sub_c(), subValuesResult, fullValuesC);
-  CHECK_MATRIX_NEAR(fullValuesResult, mat_ch, 2 * (mat_ah.size().cols() + 1) * TypeUtilities<T>::error,
-                    2 * (mat_ah.size().cols() + 1) * TypeUtilities<T>::error);
+  CHECK_MATRIX_NEAR(fullValuesResult, mat_ch, 2 * (full_k + 1) * TypeUtilities<T>::error,
+                    2 * (full_k + 1) * TypeUtilities<T>::error);
 }
 
 template <class T, Backend B, Device D>
@@ -142,27 +158,30 @@ void testGeneralMultiplication(const T alpha, const T beta, const GemmConfig& co
   auto mpi_row_chain = grid.row_communicator_pipeline();
   auto mpi_col_chain = grid.col_communicator_pipeline();
 
-  const TileElementSize blocksize_a(config.mb, config.kb);
-  const TileElementSize blocksize_b(config.kb, config.nb);
+  const TileElementSize blocksize_a = config.block_size_a();
+  const TileElementSize blocksize_b = config.block_size_b();
   const TileElementSize blocksize_c(config.mb, config.nb);
 
   const comm::Index2D src_rank_c(std::max(0, grid.size().rows() - 1),
                                  std::min(1, grid.size().cols() - 1));
   const matrix::Distribution dist_c(config.full_c(), blocksize_c, grid.size(), grid.rank(), src_rank_c);
 
-  const comm::IndexT_MPI rank_aligned_row =
-      align_sub_rank_index<Coord::Row>(dist_c, config.sub_c().origin, blocksize_a,
-                                       config.sub_a().origin);
-  const comm::IndexT_MPI rank_aligned_col =
-      align_sub_rank_index<Coord::Col>(dist_c, config.sub_c().origin, blocksize_b,
-                                       config.sub_b().origin);
-
   // Note:
-  // GEMM(NoTrans, NoTrans) requires:
-  // - a is rank aligned with c for what concerns rows
-  // - b is rank aligned with c for what concerns cols
-  const comm::Index2D src_rank_a{rank_aligned_row, 0};
-  const comm::Index2D src_rank_b{0, rank_aligned_col};
+  // GEMM requires:
+  // - a is rank aligned with c for what concerns rows, if it is not transposed
+  // - b is rank aligned with c for what concerns cols, if it is not transposed
+  // Tiles of transposed operands are redistributed, hence any source rank is fine for them.
+  const comm::Index2D src_rank_a =
+      config.opA == blas::Op::NoTrans
+          ? comm::Index2D{align_sub_rank_index<Coord::Row>(dist_c, config.sub_c().origin, blocksize_a,
+                                                           config.sub_a().origin),
+                          0}
+          : comm::Index2D{0, std::min(1, grid.size().cols() - 1)};
+  const comm::Index2D src_rank_b =
+      config.opB == blas::Op::NoTrans
+          ? comm::Index2D{0, align_sub_rank_index<Coord::Col>(dist_c, config.sub_c().origin,
+                                                              blocksize_b, config.sub_b().origin)}
+          : comm::Index2D{std::max(0, grid.size().rows() - 1), 0};
 
   const matrix::Distribution dist_a(config.full_a(), blocksize_a, grid.size(), grid.rank(), src_rank_a);
   const matrix::Distribution dist_b(config.full_b(), blocksize_b, grid.size(), grid.rank(), src_rank_b);
@@ -194,16 +213,15 @@ void testGeneralMultiplication(const T alpha, const T beta, const GemmConfig& co
     MatrixRef<const T, D> mat_sub_b(mat_b.get(), config.sub_b());
     MatrixRef<T, D> mat_sub_c(mat_c.get(), config.sub_c());
 
-    // Note: currently it is implemented just the NoTrans/NoTrans case
-    ASSERT_EQ(config.opA, blas::Op::NoTrans);
-    ASSERT_EQ(config.opB, blas::Op::NoTrans);
-    multiplication::internal::generalMatrix<B>(mpi_row_chain, mpi_col_chain, alpha, mat_sub_a, mat_sub_b,
-                                               beta, mat_sub_c);
+    multiplication::internal::generalMatrix<B>(mpi_row_chain, mpi_col_chain, config.opA, config.opB,
+                                               alpha, mat_sub_a, mat_sub_b, beta, mat_sub_c);
   }
 
+  const SizeType full_k =
+      config.opA == blas::Op::NoTrans ? mat_ah.size().cols() : mat_ah.size().rows();
   const auto fullValuesResult = mix_values(config.sub_c(), subValuesResult, fullValuesC);
-  CHECK_MATRIX_NEAR(fullValuesResult, mat_ch, 2 * (mat_ah.size().cols() + 1) * TypeUtilities<T>::error,
-                    2 * (mat_ah.size().cols() + 1) * TypeUtilities<T>::error);
+  CHECK_MATRIX_NEAR(fullValuesResult, mat_ch, 2 * (full_k + 1) * TypeUtilities<T>::error,
+                    2 * (full_k + 1) * TypeUtilities<T>::error);
 }
 
 std::vector<GemmConfig> gemm_configs = {
@@ -237,11 +255,22 @@ std::vector<GemmConfig> sub_gemm_configs = {
     {blas::Op::NoTrans, blas::Op::NoTrans, 12, 20, 11, 3, 4, 5, {{6, 10}}, {{5, 8}}, {{9, 12}}},
 };
 
+// Returns the given configurations for all the combinations of opA and opB
+std::vector<GemmConfig> allOps(const std::vector<GemmConfig>& configs) {
+  std::vector<GemmConfig> all_configs;
+  for (const auto opA : {blas::Op::NoTrans, blas::Op::Trans, blas::Op::ConjTrans})
+    for (const auto opB : {blas::Op::NoTrans, blas::Op::Trans, blas::Op::ConjTrans})
+      for (const GemmConfig& c : configs)
+        all_configs.push_back(
+            {opA, opB, c.m, c.n, c.k, c.mb, c.nb, c.kb, c.margin_a, c.margin_b, c.margin_c});
+  return all_configs;
+}
+
 TYPED_TEST(GeneralMultiplicationTestMC, CorrectnessLocal) {
   constexpr TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
   constexpr TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
 
-  for (const GemmConfig& test_config : gemm_configs) {
+  for (const GemmConfig& test_config : allOps(gemm_configs)) {
     testGeneralMultiplication<TypeParam, Backend::MC, Device::CPU>(alpha, beta, test_config);
   }
 }
@@ -250,7 +279,7 @@ TYPED_TEST(GeneralMultiplicationTestMC, CorrectnessLocalSub) {
   constexpr TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
   constexpr TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
 
-  for (const GemmConfig& test_config : sub_gemm_configs) {
+  for (const GemmConfig& test_config : allOps(sub_gemm_configs)) {
     testGeneralMultiplication<TypeParam, Backend::MC, Device::CPU>(alpha, beta, test_config);
   }
 }
@@ -260,7 +289,7 @@ TYPED_TEST(GeneralMultiplicationTestGPU, CorrectnessLocal) {
   constexpr TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
   constexpr TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
 
-  for (const GemmConfig& test_config : gemm_configs) {
+  for (const GemmConfig& test_config : allOps(gemm_configs)) {
     testGeneralMultiplication<TypeParam, Backend::GPU, Device::GPU>(alpha, beta, test_config);
   }
 }
@@ -269,7 +298,7 @@ TYPED_TEST(GeneralMultiplicationTestGPU, CorrectnessLocalSub) {
   constexpr TypeParam alpha = TypeUtilities<TypeParam>::element(-1.3, .5);
   constexpr TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
 
-  for (const GemmConfig& test_config : sub_gemm_configs) {
+  for (const GemmConfig& test_config : allOps(sub_gemm_configs)) {
     testGeneralMultiplication<TypeParam, Backend::GPU, Device::GPU>(alpha, beta, test_config);
   }
 }
@@ -280,7 +309,7 @@ TYPED_TEST(GeneralMultiplicationDistTestMC, CorrectnessDistributed) {
   constexpr TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
 
   for (auto& comm_grid : this->commGrids()) {
-    for (const GemmConfig& test_config : gemm_configs) {
+    for (const GemmConfig& test_config : allOps(gemm_configs)) {
       testGeneralMultiplication<TypeParam, Backend::MC, Device::CPU>(alpha, beta, test_config,
                                                                      comm_grid);
       pika::wait();
@@ -293,7 +322,7 @@ TYPED_TEST(GeneralMultiplicationDistTestMC, CorrectnessDistributedSub) {
   constexpr TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
 
   for (auto& comm_grid : this->commGrids()) {
-    for (const GemmConfig& test_config : sub_gemm_configs) {
+    for (const GemmConfig& test_config : allOps(sub_gemm_configs)) {
       testGeneralMultiplication<TypeParam, Backend::MC, Device::CPU>(alpha, beta, test_config,
                                                                      comm_grid);
       pika::wait();
@@ -307,7 +336,7 @@ TYPED_TEST(GeneralMultiplicationDistTestGPU, CorrectnessDistributed) {
   constexpr TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
 
   for (auto& comm_grid : this->commGrids()) {
-    for (const GemmConfig& test_config : gemm_configs) {
+    for (const GemmConfig& test_config : allOps(gemm_configs)) {
       testGeneralMultiplication<TypeParam, Backend::GPU, Device::GPU>(alpha, beta, test_config,
                                                                       comm_grid);
       pika::wait();
@@ -320,7 +349,7 @@ TYPED_TEST(GeneralMultiplicationDistTestGPU, CorrectnessDistributedSub) {
   constexpr TypeParam beta = TypeUtilities<TypeParam>::element(-2.6, .7);
 
   for (auto& comm_grid : this->commGrids()) {
-    for (const GemmConfig& test_config : sub_gemm_configs) {
+    for (const GemmConfig& test_config : allOps(sub_gemm_configs)) {
       testGeneralMultiplication<TypeParam, Backend::GPU, Device::GPU>(alpha, beta, test_config,
                                                                       comm_grid);
       pika::wait();
@@ -19,6 +19,7 @@
 #include <dlaf/common/assert.h>
 #include <dlaf/matrix/matrix_mirror.h>
 #include <dlaf/permutations/general.h>
+#include <dlaf/tune.h>
 #include <dlaf/types.h>
 
 #include <gtest/gtest.h>
@@ -188,6 +189,37 @@ TYPED_TEST(PermutationsDistTestMC, Rows) {
   }
 }
 
+// Number of tiles per chunk used to check the pipelined implementation (0 means no chunking).
+const std::vector<SizeType> pipeline_num_tiles = {1, 2};
+
+TYPED_TEST(PermutationsDistTestMC, ColumnsPipelined) {
+  for (const SizeType num_tiles : pipeline_num_tiles) {
+    getTuneParameters().permutations_pipeline_num_tiles = num_tiles;
+    for (auto& comm_grid : this->commGrids()) {
+      for (const auto& [n, nb, i_begin, i_end, perms] : params) {
+        testDistPermutations<TypeParam, Device::CPU, Coord::Col>(comm_grid, n, nb, i_begin, i_end,
+                                                                 perms);
+        pika::wait();
+      }
+    }
+  }
+  getTuneParameters().permutations_pipeline_num_tiles = 0;
+}
+
+TYPED_TEST(PermutationsDistTestMC, RowsPipelined) {
+  for (const SizeType num_tiles : pipeline_num_tiles) {
+    getTuneParameters().permutations_pipeline_num_tiles = num_tiles;
+    for (auto& comm_grid : this->commGrids()) {
+      for (const auto& [n, nb, i_begin, i_end, perms] : params) {
+        testDistPermutations<TypeParam, Device::CPU, Coord::Row>(comm_grid, n, nb, i_begin, i_end,
+                                                                 perms);
+        pika::wait();
+      }
+    }
+  }
+  getTuneParameters().permutations_pipeline_num_tiles = 0;
+}
+
 template <class T, Device D, Coord C>
 void testDistPermutationsAsLocal(comm::CommunicatorGrid& grid, SizeType n, SizeType nb, SizeType i_begin,
                                  SizeType i_end) {
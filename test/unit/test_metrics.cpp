@@ -0,0 +1,238 @@
+//
+// Distributed Linear Algebra with Future (DLAF)
+//
+// Copyright (c) ETH Zurich
+// All rights reserved.
+//
+// Please, refer to the LICENSE file in the root directory.
+// SPDX-License-Identifier: BSD-3-Clause
+//
+
+#include <complex>
+#include <cstddef>
+
+#include <pika/execution.hpp>
+
+#include <dlaf/blas/tile.h>
+#include <dlaf/common/index2d.h>
+#include <dlaf/communication/communicator.h>
+#include <dlaf/communication/communicator_grid.h>
+#include <dlaf/communication/kernels/all_reduce.h>
+#include <dlaf/communication/kernels/broadcast.h>
+#include <dlaf/communication/kernels/p2p.h>
+#include <dlaf/lapack/tile.h>
+#include <dlaf/matrix/distribution.h>
+#include <dlaf/matrix/index.h>
+#include <dlaf/matrix/matrix.h>
+#include <dlaf/memory/memory_chunk.h>
+#include <dlaf/metrics.h>
+#include <dlaf_c/metrics.h>
+
+#include <gtest/gtest.h>
+
+#include <dlaf_test/matrix/util_tile.h>
+
+using namespace dlaf;
+using dlaf::comm::CommunicatorType;
+using dlaf::matrix::test::createTile;
+using dlaf::matrix::test::fixedValueTile;
+
+namespace tt = pika::this_thread::experimental;
+
+class MetricsTest : public ::testing::Test {
+  static_assert(NUM_MPI_RANKS == 2, "exactly 2 ranks are required");
+
+protected:
+  void SetUp() override {
+    resetMetrics();
+    internal::enableMetrics();
+  }
+
+  void TearDown() override {
+    internal::disableMetrics();
+    resetMetrics();
+  }
+
+  comm::Communicator world = MPI_COMM_WORLD;
+};
+
+namespace {
+void expectNoBytesCommunicated(const Metrics& metrics) {
+  for (const auto type : {CommunicatorType::Row, CommunicatorType::Col, CommunicatorType::Full}) {
+    EXPECT_EQ(0u, metrics.sent(type));
+    EXPECT_EQ(0u, metrics.received(type));
+  }
+}
+}
+
+TEST_F(MetricsTest, Disabled) {
+  internal::disableMetrics();
+
+  memory::MemoryChunk<double, Device::CPU> chunk(16);
+  auto a = createTile<const double>(fixedValueTile(1.), {3, 3}, 3);
+  auto c = createTile<double>(fixedValueTile(0.), {3, 3}, 3);
+  tile::internal::gemm(blas::Op::NoTrans, blas::Op::NoTrans, 1., a, a, 0., c);
+
+  const Metrics metrics = getMetrics();
+  EXPECT_EQ(0, metrics.flops);
+  EXPECT_EQ(0u, metrics.bytes_allocated);
+  expectNoBytesCommunicated(metrics);
+}
+
+TEST_F(MetricsTest, Flops) {
+  using ComplexT = std::complex<double>;
+  auto spd = [](const TileElementIndex& index) { return index.row() == index.col() ? 2. : 0.; };
+
+  auto a = createTile<const double>(fixedValueTile(1.), {4, 3}, 4);
+  auto b = createTile<const double>(fixedValueTile(1.), {3, 2}, 3);
+  auto c = createTile<double>(fixedValueTile(0.), {4, 2}, 4);
+  auto a_z = createTile<const ComplexT>(fixedValueTile(ComplexT(1.)), {4, 3}, 4);
+  auto b_z = createTile<const ComplexT>(fixedValueTile(ComplexT(1.)), {3, 2}, 3);
+  auto c_z = createTile<ComplexT>(fixedValueTile(ComplexT(0.)), {4, 2}, 4);
+  auto l = createTile<double>(spd, {3, 3}, 3);
+
+  // 24 additions and 24 multiplications
+  tile::internal::gemm(blas::Op::NoTrans, blas::Op::NoTrans, 1., a, b, 0., c);
+  EXPECT_DOUBLE_EQ(48, getMetrics().flops);
+
+  // complex additions and multiplications count 2 and 6 operations respectively
+  tile::internal::gemm(blas::Op::NoTrans, blas::Op::NoTrans, ComplexT(1.), a_z, b_z, ComplexT(0.), c_z);
+  EXPECT_DOUBLE_EQ(48 + 192, getMetrics().flops);
+
+  // 4 additions and 10 multiplications
+  tile::internal::potrf(blas::Uplo::Lower, l);
+  EXPECT_DOUBLE_EQ(48 + 192 + 14, getMetrics().flops);
+
+  // 15 additions and 37 multiplications
+  auto h = createTile<double>(spd, {3, 3}, 3);
+  tile::internal::hegst(1, blas::Uplo::Lower, h, l);
+  EXPECT_DOUBLE_EQ(48 + 192 + 14 + 52, getMetrics().flops);
+
+  resetMetrics();
+  EXPECT_EQ(0, getMetrics().flops);
+}
+
+TEST_F(MetricsTest, BytesAllocated) {
+  {
+    memory::MemoryChunk<double, Device::CPU> chunk(16);
+  }
+  memory::MemoryChunk<std::complex<float>, Device::CPU> chunk(5);
+  EXPECT_EQ(16 * sizeof(double) + 5 * sizeof(std::complex<float>), getMetrics().bytes_allocated);
+
+  // memory not allocated by DLA-Future is not counted
+  double data[4];
+  memory::MemoryChunk<double, Device::CPU> chunk_external(data, 4);
+  EXPECT_EQ(16 * sizeof(double) + 5 * sizeof(std::complex<float>), getMetrics().bytes_allocated);
+}
+
+TEST_F(MetricsTest, BytesCommunicated) {
+  comm::CommunicatorGrid grid(world, 1, 2, common::Ordering::ColumnMajor);
+  matrix::Matrix<double, Device::CPU> mat(matrix::Distribution({4, 4}, {4, 4}));
+  const LocalTileIndex idx(0, 0);
+  const std::size_t bytes = 16 * sizeof(double);
+
+  resetMetrics();
+  const comm::IndexT_MPI root = 0;
+  if (grid.rank().col() == root)
+    tt::sync_wait(comm::schedule_bcast_send(grid.row_communicator_pipeline().exclusive(),
+                                            mat.read(idx)));
+  else
+    tt::sync_wait(comm::schedule_bcast_recv(grid.row_communicator_pipeline().exclusive(), root,
+                                            mat.readwrite(idx)));
+
+  const Metrics metrics = getMetrics();
+  EXPECT_EQ(grid.rank().col() == root ? bytes : 0u, metrics.sent(CommunicatorType::Row));
+  EXPECT_EQ(grid.rank().col() == root ? 0u : bytes, metrics.received(CommunicatorType::Row));
+  for (const auto type : {CommunicatorType::Col, CommunicatorType::Full}) {
+    EXPECT_EQ(0u, metrics.sent(type));
+    EXPECT_EQ(0u, metrics.received(type));
+  }
+
+  // communications on communicators not belonging to a grid are not counted
+  resetMetrics();
+  comm::internal::addBytesSent(world, MPI_DOUBLE, 1);
+  comm::internal::addBytesReceived(world, MPI_DOUBLE, 1);
+  expectNoBytesCommunicated(getMetrics());
+}
+
+TEST_F(MetricsTest, BytesCommunicatedP2P) {
+  comm::CommunicatorGrid grid(world, 1, 2, common::Ordering::ColumnMajor);
+  matrix::Matrix<double, Device::CPU> mat(matrix::Distribution({4, 4}, {4, 4}));
+  const LocalTileIndex idx(0, 0);
+  const std::size_t bytes = 16 * sizeof(double);
+
+  resetMetrics();
+  const comm::IndexT_MPI tag = 0;
+  if (grid.rank().col() == 0)
+    tt::sync_wait(comm::schedule_send(grid.row_communicator_pipeline().exclusive(), 1, tag,
+                                      mat.read(idx)));
+  else
+    tt::sync_wait(comm::schedule_recv(grid.row_communicator_pipeline().exclusive(), 0, tag,
+                                      mat.readwrite(idx)));
+
+  const Metrics metrics = getMetrics();
+  EXPECT_EQ(grid.rank().col() == 0 ? bytes : 0u, metrics.sent(CommunicatorType::Row));
+  EXPECT_EQ(grid.rank().col() == 0 ? 0u : bytes, metrics.received(CommunicatorType::Row));
+  for (const auto type : {CommunicatorType::Col, CommunicatorType::Full}) {
+    EXPECT_EQ(0u, metrics.sent(type));
+    EXPECT_EQ(0u, metrics.received(type));
+  }
+}
+
+TEST_F(MetricsTest, BytesCommunicatedAllReduce) {
+  comm::CommunicatorGrid grid(world, 1, 2, common::Ordering::ColumnMajor);
+  matrix::Matrix<double, Device::CPU> mat(matrix::Distribution({4, 4}, {4, 4}));
+  const LocalTileIndex idx(0, 0);
+  const std::size_t bytes = 16 * sizeof(double);
+
+  resetMetrics();
+  tt::sync_wait(comm::schedule_all_reduce_in_place(grid.full_communicator_pipeline().exclusive(),
+                                                   MPI_SUM, mat.readwrite(idx)));
+
+  // all-reductions count the message both as sent and received
+  const Metrics metrics = getMetrics();
+  EXPECT_EQ(bytes, metrics.sent(CommunicatorType::Full));
+  EXPECT_EQ(bytes, metrics.received(CommunicatorType::Full));
+  for (const auto type : {CommunicatorType::Row, CommunicatorType::Col}) {
+    EXPECT_EQ(0u, metrics.sent(type));
+    EXPECT_EQ(0u, metrics.received(type));
+  }
+}
+
+TEST_F(MetricsTest, CAPI) {
+  comm::CommunicatorGrid grid(world, 1, 2, common::Ordering::ColumnMajor);
+  matrix::Matrix<double, Device::CPU> mat(matrix::Distribution({4, 4}, {4, 4}));
+  const LocalTileIndex idx(0, 0);
+  const std::size_t bytes = 16 * sizeof(double);
+
+  dlaf_reset_metrics();
+  tt::sync_wait(comm::schedule_all_reduce_in_place(grid.col_communicator_pipeline().exclusive(),
+                                                   MPI_SUM, mat.readwrite(idx)));
+  tt::sync_wait(comm::schedule_all_reduce_in_place(grid.row_communicator_pipeline().exclusive(),
+                                                   MPI_SUM, mat.readwrite(idx)));
+
+  auto a = createTile<const double>(fixedValueTile(1.), {4, 3}, 4);
+  auto b = createTile<const double>(fixedValueTile(1.), {3, 2}, 3);
+  auto c = createTile<double>(fixedValueTile(0.), {4, 2}, 4);
+  tile::internal::gemm(blas::Op::NoTrans, blas::Op::NoTrans, 1., a, b, 0., c);
+
+  // the C API reports the same values of the C++ API
+  const Metrics metrics = getMetrics();
+  const DLAF_metrics dlaf_metrics = dlaf_get_metrics();
+  EXPECT_DOUBLE_EQ(48, dlaf_metrics.flops);
+  EXPECT_DOUBLE_EQ(metrics.flops, dlaf_metrics.flops);
+  EXPECT_EQ(bytes, dlaf_metrics.bytes_sent_row);
+  EXPECT_EQ(bytes, dlaf_metrics.bytes_received_row);
+  EXPECT_EQ(bytes, dlaf_metrics.bytes_sent_col);
+  EXPECT_EQ(bytes, dlaf_metrics.bytes_received_col);
+  EXPECT_EQ(0u, dlaf_metrics.bytes_sent_full);
+  EXPECT_EQ(0u, dlaf_metrics.bytes_received_full);
+  EXPECT_EQ(metrics.bytes_allocated, dlaf_metrics.bytes_allocated);
+
+  dlaf_reset_metrics();
+  const DLAF_metrics dlaf_metrics_reset = dlaf_get_metrics();
+  EXPECT_EQ(0, dlaf_metrics_reset.flops);
+  EXPECT_EQ(0u, dlaf_metrics_reset.bytes_sent_row);
+  EXPECT_EQ(0u, dlaf_metrics_reset.bytes_received_row);
+  EXPECT_EQ(0u, dlaf_metrics_reset.bytes_allocated);
+}